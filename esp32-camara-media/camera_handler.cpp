@@ -1,11 +1,24 @@
 #include "camera_handler.h"
 #include "config.h"
+#include "frame_pipeline.h"
+#include "esp_timer.h"
 #include <Preferences.h>
 
 CameraHandler camera;
 static Preferences prefs;
 
-CameraHandler::CameraHandler() : initialized(false) {
+static portMUX_TYPE flashMux = portMUX_INITIALIZER_UNLOCKED;
+// Latencias y contadores de caché: capturePhoto() corre en loop(), en la
+// tarea del stream (sin pipeline) y en la de Telegram; metrics los lee
+static portMUX_TYPE statsMux = portMUX_INITIALIZER_UNLOCKED;
+
+CameraHandler::CameraHandler()
+    : initialized(false), sensorChangedUs(0), cacheHits(0), cacheMisses(0),
+      flashState(FLASH_IDLE), pendingCount(0), flashStartMs(0), ledOnUs(0),
+      lastFrameSeq(0), lastExposure(-1), lastGain(-1), stableFrames(0),
+      aecFrames(0), lastAecFrames(0), flashHolders(0) {
+    memset(&latencyNoFlash, 0, sizeof(latencyNoFlash));
+    memset(&latencyFlash, 0, sizeof(latencyFlash));
     setDefaultSettings();
 }
 
@@ -22,6 +35,8 @@ void CameraHandler::setDefaultSettings() {
     settings.quality = 12;
     settings.frameSize = FRAMESIZE_VGA;
     settings.flashEnabled = false;
+    settings.streamFps = STREAM_DEFAULT_FPS;
+    settings.cacheMaxAge = FRAME_CACHE_MAX_AGE;
 }
 
 bool CameraHandler::init() {
@@ -52,7 +67,7 @@ bool CameraHandler::init() {
     if (psramFound()) {
         config.frame_size = FRAMESIZE_UXGA;
         config.jpeg_quality = 10;
-        config.fb_count = 2;
+        config.fb_count = CAMERA_FB_COUNT;
         config.fb_location = CAMERA_FB_IN_PSRAM;
         Serial.println("PSRAM encontrado, usando alta resolución");
     } else {
@@ -77,6 +92,9 @@ bool CameraHandler::init() {
     // Cargar configuración guardada
     loadSettings();
 
+    // Captura en segundo plano (requiere más de un buffer)
+    framePipeline.begin(config.fb_count);
+
     initialized = true;
     Serial.println("Cámara inicializada correctamente");
     return true;
@@ -88,31 +106,47 @@ camera_fb_t* CameraHandler::capturePhoto(bool useFlash) {
         return nullptr;
     }
 
-    // Encender flash si está habilitado y se solicita (para capturas individuales)
-    bool flashOn = useFlash && settings.flashEnabled;
-    if (flashOn) {
-        digitalWrite(FLASH_GPIO_NUM, HIGH);
-        delay(150);  // Esperar que el LED alcance su brillo máximo
-
-        // Descartar frames obsoletos del buffer capturados ANTES de encender el flash.
-        // El sensor OV2640 usa buffer doble: esp_camera_fb_get() puede devolver un
-        // frame antiguo (oscuro) que ya estaba en cola antes de que el flash encendiera.
-        // Además, el AEC (Auto Exposure Control) necesita 2-3 frames para recalibrarse
-        // con la nueva iluminación del flash.
-        for (int i = 0; i < 2; i++) {
-            camera_fb_t* dummy = esp_camera_fb_get();
-            if (dummy) {
-                esp_camera_fb_return(dummy);
-            }
-            delay(50);
+    if (useFlash && settings.flashEnabled) {
+        // Versión bloqueante de requestCapture(): avanza la misma máquina de
+        // estados hasta que entregue el frame
+        camera_fb_t* result = nullptr;
+        bool done = false;
+        CaptureCallback onReady = [&result, &done](camera_fb_t* fb) {
+            result = fb;
+            done = true;
+        };
+        while (!requestCapture(true, onReady)) {
+            poll();  // Hay otra captura con flash en curso
+            delay(2);
+        }
+        while (!done) {
+            poll();
+            delay(2);
         }
+        if (!result) {
+            Serial.println("Error al capturar foto");
+        }
+        return result;
     }
 
-    camera_fb_t* fb = esp_camera_fb_get();
-
-    // Apagar flash después de captura individual
-    if (flashOn) {
-        digitalWrite(FLASH_GPIO_NUM, LOW);
+    unsigned long startMs = millis();
+    camera_fb_t* fb = nullptr;
+    if (framePipeline.isEnabled()) {
+        // Sirve el último frame si tiene menos de cacheMaxAge ms; si no, se
+        // espera uno nuevo y las peticiones simultáneas comparten esa captura.
+        int64_t requestUs = esp_timer_get_time();
+        int64_t notBeforeUs = max(requestUs - (int64_t)settings.cacheMaxAge * 1000, sensorChangedUs);
+
+        PipelineFrame* frame = framePipeline.acquireFresh(notBeforeUs, FRAME_ACQUIRE_TIMEOUT);
+        if (frame) {
+            fb = frame->fb;
+            portENTER_CRITICAL(&statsMux);
+            if (frame->timestampUs < requestUs) cacheHits++;
+            else cacheMisses++;
+            portEXIT_CRITICAL(&statsMux);
+        }
+    } else {
+        fb = esp_camera_fb_get();
     }
 
     if (!fb) {
@@ -120,11 +154,228 @@ camera_fb_t* CameraHandler::capturePhoto(bool useFlash) {
         return nullptr;
     }
 
+    recordLatency(latencyNoFlash, startMs);
     return fb;
 }
 
+bool CameraHandler::requestCapture(bool useFlash, CaptureCallback callback) {
+    if (!initialized || !callback) {
+        return false;
+    }
+
+    if (!useFlash) {
+        callback(capturePhoto(false));
+        return true;
+    }
+
+    // Sin pipeline el frame no se puede compartir: una petición a la vez
+    int limit = framePipeline.isEnabled() ? CAPTURE_MAX_PENDING : 1;
+    if (pendingCount >= limit) {
+        return false;
+    }
+
+    // Las peticiones que llegan durante una captura en curso se suman a ella:
+    // cualquier frame posterior al encendido del LED les sirve
+    pendingCallbacks[pendingCount] = callback;
+    pendingStart[pendingCount] = millis();
+    pendingCount++;
+
+    if (flashState == FLASH_IDLE) {
+        startFlashCapture();
+    }
+    return true;
+}
+
+bool CameraHandler::isCaptureBusy() const {
+    return flashState != FLASH_IDLE;
+}
+
+void CameraHandler::startFlashCapture() {
+    // Si el stream ya tiene el LED encendido la exposición ya se adaptó
+    bool alreadyLit = flashHolders > 0;
+    holdFlashLed();
+
+    flashStartMs = millis();
+    ledOnUs = alreadyLit ? 0 : esp_timer_get_time();
+    lastFrameSeq = framePipeline.getCapturedCount();
+    lastExposure = -1;
+    lastGain = -1;
+    stableFrames = 0;
+    aecFrames = 0;
+
+    // Mantener la tarea de captura produciendo frames mientras converge el AEC
+    if (framePipeline.isEnabled()) {
+        framePipeline.addConsumer();
+    }
+    flashState = alreadyLit ? FLASH_CONVERGING : FLASH_WARMUP;
+}
+
+void CameraHandler::poll() {
+    if (flashState == FLASH_IDLE) {
+        return;
+    }
+
+    unsigned long elapsed = millis() - flashStartMs;
+    if (flashState == FLASH_WARMUP) {
+        if (elapsed < FLASH_WARMUP_MS) {
+            return;  // El LED todavía no alcanzó su brillo máximo
+        }
+        flashState = FLASH_CONVERGING;
+    }
+
+    PipelineFrame* source = nullptr;
+    camera_fb_t* fb = nextFlashFrame(&source);
+    if (!fb) {
+        if (elapsed > FLASH_AEC_TIMEOUT + FRAME_ACQUIRE_TIMEOUT) {
+            Serial.println("Captura con flash: sin frames del sensor");
+            finishFlashCapture(nullptr, nullptr);
+        }
+        return;
+    }
+
+    aecFrames++;
+    if (exposureStable()) {
+        finishFlashCapture(fb, source);
+    } else if (elapsed >= FLASH_AEC_TIMEOUT) {
+        Serial.printf("Captura con flash: AEC sin converger tras %d frames\n", aecFrames);
+        finishFlashCapture(fb, source);
+    } else {
+        // Exposición todavía ajustándose al flash: descartar este frame
+        releaseFrame(fb);
+    }
+}
+
+camera_fb_t* CameraHandler::nextFlashFrame(PipelineFrame** source) {
+    *source = nullptr;
+
+    if (!framePipeline.isEnabled()) {
+        // Sin pipeline esp_camera_fb_get() bloquea hasta el próximo frame
+        return esp_camera_fb_get();
+    }
+
+    PipelineFrame* frame = framePipeline.acquireNewer(lastFrameSeq);
+    if (!frame) {
+        return nullptr;
+    }
+    lastFrameSeq = frame->seq;
+
+    // Frames recibidos antes de que el LED llegara a su brillo máximo
+    // están (al menos en parte) expuestos sin flash
+    if (frame->timestampUs < ledOnUs + (int64_t)FLASH_WARMUP_MS * 1000) {
+        framePipeline.release(frame);
+        return nullptr;
+    }
+
+    *source = frame;
+    return frame->fb;
+}
+
+bool CameraHandler::exposureStable() {
+    // Exposición manual: no hay nada que esperar
+    if (!settings.exposureCtrl) {
+        return true;
+    }
+
+    sensor_t* s = esp_camera_sensor_get();
+    int32_t exposure = -1;
+    int gain = -1;
+    if (s && s->get_reg && s->id.PID == OV2640_PID) {
+        // AEC del OV2640 en el banco del sensor (0x100 | reg):
+        // AEC[15:10] = 0x45, AEC[9:2] = 0x10, AEC[1:0] = 0x04; ganancia = 0x00
+        int high = s->get_reg(s, 0x145, 0x3F);
+        int mid = s->get_reg(s, 0x110, 0xFF);
+        int low = s->get_reg(s, 0x104, 0x03);
+        gain = s->get_reg(s, 0x100, 0xFF);
+        if (high >= 0 && mid >= 0 && low >= 0) {
+            exposure = (high << 10) | (mid << 2) | low;
+        }
+    }
+
+    if (exposure < 0 || gain < 0) {
+        // Sin lectura de registros: mismo criterio que antes (dos frames descartados)
+        return aecFrames > 2;
+    }
+
+    bool sameAsLast = lastExposure >= 0 &&
+                      abs(exposure - lastExposure) <= (lastExposure >> FLASH_AEC_TOLERANCE_SHIFT) &&
+                      abs(gain - lastGain) <= max(1, lastGain >> FLASH_AEC_TOLERANCE_SHIFT);
+    stableFrames = sameAsLast ? stableFrames + 1 : 1;
+    lastExposure = exposure;
+    lastGain = gain;
+
+    return stableFrames >= FLASH_AEC_STABLE_FRAMES;
+}
+
+void CameraHandler::finishFlashCapture(camera_fb_t* fb, PipelineFrame* source) {
+    releaseFlashLed();
+    if (framePipeline.isEnabled()) {
+        framePipeline.removeConsumer();
+    }
+    flashState = FLASH_IDLE;
+    lastAecFrames = aecFrames;
+
+    // Copiar la lista: un callback puede pedir otra captura
+    CaptureCallback callbacks[CAPTURE_MAX_PENDING];
+    unsigned long starts[CAPTURE_MAX_PENDING];
+    int count = pendingCount;
+    for (int i = 0; i < count; i++) {
+        callbacks[i] = pendingCallbacks[i];
+        starts[i] = pendingStart[i];
+        pendingCallbacks[i] = nullptr;
+    }
+    pendingCount = 0;
+
+    // Cada receptor devuelve su propia referencia con releaseFrame()
+    if (fb && source) {
+        for (int i = 1; i < count; i++) {
+            framePipeline.retain(source);
+        }
+    }
+
+    for (int i = 0; i < count; i++) {
+        if (fb) {
+            recordLatency(latencyFlash, starts[i]);
+        }
+        callbacks[i](fb);
+    }
+}
+
+void CameraHandler::holdFlashLed() {
+    portENTER_CRITICAL(&flashMux);
+    if (flashHolders++ == 0) {
+        digitalWrite(FLASH_GPIO_NUM, HIGH);
+    }
+    portEXIT_CRITICAL(&flashMux);
+}
+
+void CameraHandler::releaseFlashLed() {
+    portENTER_CRITICAL(&flashMux);
+    if (flashHolders > 0 && --flashHolders == 0) {
+        digitalWrite(FLASH_GPIO_NUM, LOW);
+    }
+    portEXIT_CRITICAL(&flashMux);
+}
+
+CaptureLatency CameraHandler::getLatency(bool flash) const {
+    portENTER_CRITICAL(&statsMux);
+    CaptureLatency latency = flash ? latencyFlash : latencyNoFlash;
+    portEXIT_CRITICAL(&statsMux);
+    return latency;
+}
+
+void CameraHandler::recordLatency(CaptureLatency& latency, unsigned long startMs) {
+    uint32_t ms = millis() - startMs;
+    portENTER_CRITICAL(&statsMux);
+    latency.count++;
+    latency.lastMs = ms;
+    if (ms > latency.maxMs) latency.maxMs = ms;
+    latency.avgMs = (latency.count == 1) ? ms : latency.avgMs + ((float)ms - latency.avgMs) * 0.1f;
+    portEXIT_CRITICAL(&statsMux);
+}
+
 void CameraHandler::releaseFrame(camera_fb_t* fb) {
-    if (fb) {
+    // Los frames del pipeline vuelven a su anillo; el resto, al driver
+    if (fb && !framePipeline.releaseBuffer(fb)) {
         esp_camera_fb_return(fb);
     }
 }
@@ -134,6 +385,7 @@ void CameraHandler::setBrightness(int value) {
     if (s) {
         s->set_brightness(s, constrain(value, -2, 2));
         settings.brightness = value;
+        markSensorChanged();
     }
 }
 
@@ -142,6 +394,7 @@ void CameraHandler::setContrast(int value) {
     if (s) {
         s->set_contrast(s, constrain(value, -2, 2));
         settings.contrast = value;
+        markSensorChanged();
     }
 }
 
@@ -150,6 +403,7 @@ void CameraHandler::setSaturation(int value) {
     if (s) {
         s->set_saturation(s, constrain(value, -2, 2));
         settings.saturation = value;
+        markSensorChanged();
     }
 }
 
@@ -158,6 +412,7 @@ void CameraHandler::setSpecialEffect(int effect) {
     if (s) {
         s->set_special_effect(s, constrain(effect, 0, 6));
         settings.specialEffect = effect;
+        markSensorChanged();
     }
 }
 
@@ -166,6 +421,7 @@ void CameraHandler::setWhiteBalance(int mode) {
     if (s) {
         s->set_wb_mode(s, constrain(mode, 0, 4));
         settings.whiteBalance = mode;
+        markSensorChanged();
     }
 }
 
@@ -174,6 +430,7 @@ void CameraHandler::setExposureCtrl(bool enable) {
     if (s) {
         s->set_exposure_ctrl(s, enable ? 1 : 0);
         settings.exposureCtrl = enable ? 1 : 0;
+        markSensorChanged();
     }
 }
 
@@ -182,6 +439,7 @@ void CameraHandler::setAecValue(int value) {
     if (s) {
         s->set_aec_value(s, constrain(value, 0, 1200));
         settings.aecValue = value;
+        markSensorChanged();
     }
 }
 
@@ -190,6 +448,7 @@ void CameraHandler::setGainCtrl(bool enable) {
     if (s) {
         s->set_gain_ctrl(s, enable ? 1 : 0);
         settings.gainCtrl = enable ? 1 : 0;
+        markSensorChanged();
     }
 }
 
@@ -198,6 +457,7 @@ void CameraHandler::setAgcGain(int value) {
     if (s) {
         s->set_agc_gain(s, constrain(value, 0, 30));
         settings.agcGain = value;
+        markSensorChanged();
     }
 }
 
@@ -206,6 +466,7 @@ void CameraHandler::setQuality(int value) {
     if (s) {
         s->set_quality(s, constrain(value, 10, 63));
         settings.quality = value;
+        markSensorChanged();
     }
 }
 
@@ -218,12 +479,10 @@ void CameraHandler::setFrameSize(framesize_t size) {
         // Descartar frames residuales tras el cambio de resolución.
         // Al cambiar resolución el sensor reinicia su pipeline interno y los
         // primeros frames pueden estar mal expuestos o ser de la resolución anterior.
-        for (int i = 0; i < 3; i++) {
-            camera_fb_t* dummy = esp_camera_fb_get();
-            if (dummy) {
-                esp_camera_fb_return(dummy);
-            }
-        }
+        // Los descarta la tarea de captura: pedirle frames al driver desde aquí
+        // competiría con ella por los mismos buffers.
+        sensorChangedUs = esp_timer_get_time();
+        framePipeline.sensorChanged(sensorChangedUs, FRAMESIZE_DISCARD_FRAMES);
     }
 }
 
@@ -233,6 +492,19 @@ void CameraHandler::setFlash(bool enable) {
     // No se deja encendido permanentemente
 }
 
+void CameraHandler::setStreamFps(int fps) {
+    settings.streamFps = constrain(fps, 1, STREAM_MAX_FPS);
+}
+
+void CameraHandler::setCacheMaxAge(int ms) {
+    settings.cacheMaxAge = constrain(ms, 0, FRAME_CACHE_MAX_AGE_LIMIT);
+}
+
+void CameraHandler::markSensorChanged() {
+    sensorChangedUs = esp_timer_get_time();
+    framePipeline.sensorChanged(sensorChangedUs);
+}
+
 CameraSettings CameraHandler::getSettings() {
     return settings;
 }
@@ -250,6 +522,8 @@ void CameraHandler::applySettings(CameraSettings& newSettings) {
     setQuality(newSettings.quality);
     setFrameSize(newSettings.frameSize);
     settings.flashEnabled = newSettings.flashEnabled;
+    setStreamFps(newSettings.streamFps);
+    setCacheMaxAge(newSettings.cacheMaxAge);
 }
 
 void CameraHandler::saveSettings() {
@@ -266,6 +540,8 @@ void CameraHandler::saveSettings() {
     prefs.putInt("quality", settings.quality);
     prefs.putInt("frameSize", (int)settings.frameSize);
     prefs.putBool("flash", settings.flashEnabled);
+    prefs.putInt("streamFps", settings.streamFps);
+    prefs.putInt("cacheAge", settings.cacheMaxAge);
     prefs.end();
     Serial.println("Configuración guardada");
 }
@@ -284,6 +560,8 @@ void CameraHandler::loadSettings() {
     settings.quality = prefs.getInt("quality", 12);
     settings.frameSize = (framesize_t)prefs.getInt("frameSize", FRAMESIZE_VGA);
     settings.flashEnabled = prefs.getBool("flash", false);
+    settings.streamFps = constrain(prefs.getInt("streamFps", STREAM_DEFAULT_FPS), 1, STREAM_MAX_FPS);
+    settings.cacheMaxAge = constrain(prefs.getInt("cacheAge", FRAME_CACHE_MAX_AGE), 0, FRAME_CACHE_MAX_AGE_LIMIT);
     prefs.end();
 
     // Aplicar configuración cargada
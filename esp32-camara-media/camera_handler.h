@@ -2,7 +2,9 @@
 #define CAMERA_HANDLER_H
 
 #include <Arduino.h>
+#include <functional>
 #include "esp_camera.h"
+#include "config.h"
 
 // Estructura para guardar configuración de la cámara
 struct CameraSettings {
@@ -18,6 +20,22 @@ struct CameraSettings {
     int quality;         // 10-63
     framesize_t frameSize; // Resolución
     bool flashEnabled;
+    int streamFps;       // FPS objetivo del stream (1-STREAM_MAX_FPS)
+    int cacheMaxAge;     // Antigüedad máxima del último frame reutilizable (ms)
+};
+
+struct PipelineFrame;
+
+// Receptor de una captura asíncrona. Se invoca desde poll() (contexto de
+// loop) con el frame listo o nullptr si falló; debe llamar releaseFrame().
+typedef std::function<void(camera_fb_t* fb)> CaptureCallback;
+
+// Latencia de captura por camino (sin flash / con flash)
+struct CaptureLatency {
+    uint32_t count;
+    uint32_t lastMs;
+    uint32_t maxMs;
+    float avgMs;            // Media móvil
 };
 
 class CameraHandler {
@@ -28,6 +46,20 @@ public:
     camera_fb_t* capturePhoto(bool useFlash = true);
     void releaseFrame(camera_fb_t* fb);
 
+    // Captura sin bloquear loop(): con flash enciende el LED y entrega el
+    // frame por callback cuando la exposición se estabilizó. Sin flash el
+    // callback se invoca antes de retornar. false si no se pudo encolar.
+    bool requestCapture(bool useFlash, CaptureCallback callback);
+    void poll();                    // Avanzar la captura con flash (desde loop)
+    bool isCaptureBusy() const;
+
+    // LED compartido (stream y capturas): encendido mientras alguien lo retenga
+    void holdFlashLed();
+    void releaseFlashLed();
+
+    CaptureLatency getLatency(bool flash) const;
+    int getLastAecFrames() const { return lastAecFrames; }
+
     // Getters y setters de configuración
     void setBrightness(int value);
     void setContrast(int value);
@@ -41,6 +73,13 @@ public:
     void setQuality(int value);
     void setFrameSize(framesize_t size);
     void setFlash(bool enable);
+    void setStreamFps(int fps);
+    void setCacheMaxAge(int ms);
+
+    // Capturas sin flash servidas desde el último frame vs. capturadas nuevas
+    uint32_t getCacheHits() const { return cacheHits; }
+    uint32_t getCacheMisses() const { return cacheMisses; }
+    int getPendingCaptures() const { return pendingCount; }  // Peticiones con flash en espera
 
     CameraSettings getSettings();
     void applySettings(CameraSettings& settings);
@@ -53,7 +92,37 @@ private:
     CameraSettings settings;
     bool initialized;
 
+    // Frames anteriores a un cambio del sensor no se reutilizan
+    int64_t sensorChangedUs;
+    uint32_t cacheHits;
+    uint32_t cacheMisses;
+
+    // Máquina de estados de la captura con flash
+    enum FlashState { FLASH_IDLE, FLASH_WARMUP, FLASH_CONVERGING };
+    FlashState flashState;
+    CaptureCallback pendingCallbacks[CAPTURE_MAX_PENDING];
+    unsigned long pendingStart[CAPTURE_MAX_PENDING];
+    int pendingCount;
+    unsigned long flashStartMs;
+    int64_t ledOnUs;
+    uint32_t lastFrameSeq;
+    int32_t lastExposure;
+    int lastGain;
+    int stableFrames;
+    int aecFrames;
+    int lastAecFrames;              // Frames evaluados en la última captura con flash
+    volatile int flashHolders;
+
+    CaptureLatency latencyNoFlash;
+    CaptureLatency latencyFlash;
+
     void setDefaultSettings();
+    void markSensorChanged();
+    void startFlashCapture();
+    camera_fb_t* nextFlashFrame(PipelineFrame** source);
+    bool exposureStable();
+    void finishFlashCapture(camera_fb_t* fb, PipelineFrame* source);
+    void recordLatency(CaptureLatency& latency, unsigned long startMs);
 };
 
 extern CameraHandler camera;
@@ -35,10 +35,91 @@
 #define HREF_GPIO_NUM     23
 #define PCLK_GPIO_NUM     22
 
+// ============================================
+// PIPELINE DE CAPTURA
+// ============================================
+// Buffers del driver (con PSRAM). La tarea de captura retiene hasta
+// FRAME_PIPELINE_DEPTH frames listos y deja el resto libre para el DMA.
+// Se pueden fijar al compilar (-D) para comparar profundidades.
+#ifndef CAMERA_FB_COUNT
+#define CAMERA_FB_COUNT        3
+#endif
+#ifndef FRAME_PIPELINE_DEPTH
+#define FRAME_PIPELINE_DEPTH   2
+#endif
+#define FRAME_TASK_STACK       3072
+#define FRAME_TASK_PRIORITY    3     // Por encima del stream para no perder frames
+#define FRAME_TASK_CORE        0
+#define FRAME_ACQUIRE_TIMEOUT  2000  // ms máximos esperando un frame nuevo
+#define FRAMESIZE_DISCARD_FRAMES 3   // Frames descartados tras cambiar la resolución
+
+// Capturas sin flash reutilizan el último frame si es más nuevo que esto (ms).
+// 0 = siempre esperar un frame nuevo. Ajustable desde /settings (cacheMaxAge).
+#define FRAME_CACHE_MAX_AGE    500
+#define FRAME_CACHE_MAX_AGE_LIMIT 5000
+
+// Pre-roll: anillo en PSRAM con los últimos REPLAY_SECONDS de frames (a
+// REPLAY_FPS) para /replay y para empezar cada grabación antes de pedirla.
+// Slots de tamaño fijo reservados al arrancar; los JPEG más grandes que un
+// slot se descartan (subir REPLAY_SLOT_SIZE con resoluciones altas).
+// Costo: mientras no está en modo sleep la cámara nunca queda inactiva; el
+// pipeline captura al menos REPLAY_FPS frames por segundo (DMA del sensor,
+// esp_camera_fb_get y una copia de 30-60 KB a PSRAM por frame) aunque nadie
+// mire el stream. Con false la cámara solo captura cuando hay demanda.
+#define REPLAY_ENABLED         true
+#define REPLAY_SECONDS         5
+#define REPLAY_FPS             5
+#define REPLAY_MAX_FRAMES      (REPLAY_SECONDS * REPLAY_FPS)
+#define REPLAY_SLOT_SIZE       (64 * 1024)    // Bytes por frame
+#define REPLAY_PSRAM_RESERVE   (1024 * 1024)  // PSRAM que se deja libre (con menos se reservan menos slots)
+#define REPLAY_TASK_STACK      3072
+#define REPLAY_TASK_PRIORITY   1
+#define REPLAY_TASK_CORE       0
+#define REPLAY_SLEEP_CHECK     500            // ms entre consultas del modo sleep mientras duerme
+
 // ============================================
 // CONFIGURACIÓN DEL SERVIDOR WEB
 // ============================================
 #define WEB_SERVER_PORT 80
+#define PHOTO_SEND_CHUNK 4096   // Bytes leídos de SD por escritura al servir /photo
+#define JSON_LIST_CHUNK 1024    // Bytes de JSON acumulados por parte (chunked) en /photos y /folders
+#define WEB_ASSET_MAX_AGE 31536000  // Caché de app.css/app.js en s (la URL lleva el hash del contenido)
+
+// Perfil por ruta en /bench: tiempo de cada handler y heap que deja ocupado.
+// WEB_PROFILE_BLOCKS cuenta además los bloques de heap asignados; recorre el
+// heap (unos cientos de µs por petición, fuera del tiempo medido)
+#define WEB_PROFILE_ENABLED true
+#define WEB_PROFILE_BLOCKS  true
+#define WEB_PROFILE_ROUTES  32      // Rutas con perfil (las que sobren se registran sin él)
+
+// ============================================
+// CONFIGURACIÓN DEL STREAMING
+// ============================================
+// El stream MJPEG corre en su propia tarea FreeRTOS para no bloquear loop()
+#define STREAM_TASK_STACK    4096  // Bytes de stack de la tarea de streaming
+#define STREAM_TASK_PRIORITY 2     // Prioridad (loop() corre con prioridad 1)
+#define STREAM_TASK_CORE     0     // Core 0: deja el core 1 libre para loop()
+#ifndef MAX_STREAM_CLIENTS
+#define MAX_STREAM_CLIENTS   4     // Clientes simultáneos en /stream
+#endif
+#define STREAM_FRAME_SLOTS   2     // Frames retenidos a la vez (no superar fb_count)
+#define STREAM_SEND_CHUNK    5744  // Bytes máximos por escritura (4 x MSS de lwIP, 1436)
+#define STREAM_DEFAULT_FPS   20    // FPS objetivo por defecto (configurable y persistido)
+#define STREAM_MAX_FPS       30    // Límite superior para ?fps= y la configuración
+#define STREAM_CLIENT_STALL_TIMEOUT 5000 // ms sin progreso antes de desconectar
+
+// ============================================
+// MÉTRICAS
+// ============================================
+// Una tarea refresca una copia de las métricas; /status, /metrics y el
+// estado de Telegram solo leen esa copia
+#define METRICS_REFRESH_MS       2000   // Heap, PSRAM, WiFi, stream, captura y colas
+#define METRICS_SD_REFRESH_MS    60000  // Uso de la SD (totalBytes/usedBytes recorren la FAT)
+#define METRICS_SD_MIN_INTERVAL  5000   // Tras guardar o borrar fotos, relectura como mucho cada 5 s
+#define METRICS_TASK_STACK       4096
+#define METRICS_TASK_PRIORITY    1
+#define METRICS_TASK_CORE        0
+#define METRICS_BUFFER_SIZE      4096   // Respuesta de /metrics (JSON o texto Prometheus)
 
 // ============================================
 // CONFIGURACIÓN DE FOTO DEL DÍA (valores por defecto)
@@ -59,11 +140,65 @@
 #define WEB_PHOTOS_FOLDER "fotos_web"            // Carpeta para fotos tomadas desde el dashboard web
 #define RECORDINGS_FOLDER "grabaciones"          // Carpeta para grabaciones de video
 
+// Índice de fotos: cada carpeta guarda un archivo binario con los nombres
+// ordenados, así las búsquedas no recorren el directorio
+#define SD_INDEX_FILE ".index"
+#define SD_INDEX_NAME_MAX 32          // Bytes por nombre (los más largos no se indexan)
+#define SD_INDEX_SHIFT_RECORDS 16     // Registros movidos por bloque al insertar/borrar
+#define SD_CURSOR_WINDOW 8            // Registros leídos por acceso al recorrer un listado
+#define SD_INDEX_VERIFY_ON_BOOT true  // Contar fotos al iniciar y reconstruir si no coincide
+
+// Escritura en segundo plano: cada foto se copia a PSRAM y una tarea la
+// escribe; con la cola llena se escribe en el momento
+#define SD_WRITER_QUEUE_DEPTH  4
+#define SD_WRITER_MAX_BYTES    (1536 * 1024)  // Bytes de copias encoladas como máximo
+#define SD_WRITER_STACK        8192   // Incluye la miniatura (decodificación JPEG)
+#define SD_WRITER_PRIORITY     1
+#define SD_WRITER_CORE         0
+#define SD_WRITE_BUFFER_SIZE   4096   // Buffer interno con DMA por write() (32768 si sobra RAM interna)
+#define SD_WRITER_HISTORY      16     // Tickets recientes con resultado consultable
+#define SD_WRITER_LATENCY_SAMPLES 64  // Escrituras usadas para los percentiles
+#define SD_WRITER_FLUSH_TIMEOUT 3000  // ms que /photos, /photo, /thumb y los reinicios esperan a la cola
+
+// /sdbench: escribe archivos de prueba (se borran al terminar) con la
+// escritura directa anterior y con la preasignada por bloques
+#define SD_BENCH_FOLDER        ".sdbench"
+#define SD_BENCH_MAX_FILES     50
+#define SD_BENCH_MAX_SIZE      2048   // KB por archivo como máximo
+
+// Grabación de video en RECORDINGS_FOLDER (AVI MJPEG) desde el pipeline de
+// captura; /record y /grabar de Telegram la controlan
+#define RECORD_DEFAULT_FPS     10
+#define RECORD_MAX_FPS         20
+#define RECORD_DEFAULT_SECONDS 30
+#define RECORD_MAX_SECONDS     900
+#define RECORD_PREALLOC_STEP   (4 * 1024 * 1024)  // Bytes reservados de una vez al crecer el AVI
+#define RECORD_INDEX_CHUNK     64     // Entradas de idx1 acumuladas antes de escribirlas (16 B c/u)
+#define RECORD_TASK_STACK      6144
+#define RECORD_TASK_PRIORITY   1
+#define RECORD_TASK_CORE       0
+
+// Miniaturas para la galería: se generan al guardar cada foto (decodificación
+// JPEG reducida 1/2, 1/4 o 1/8 y recompresión) en /.thumbs/<carpeta>/<nombre>
+#define THUMB_ENABLED true
+#define THUMBS_FOLDER ".thumbs"        // Oculta: el índice ignora carpetas con "."
+#define THUMB_MIN_WIDTH 160            // Mayor reducción que deja al menos este ancho
+#define THUMB_QUALITY 60               // Calidad JPEG de la miniatura (1-100)
+#define THUMB_CACHE_MAX_AGE 31536000   // Caché del navegador en s (la URL lleva el tamaño de la foto)
+
 // ============================================
 // LED FLASH
 // ============================================
 #define FLASH_GPIO_NUM 4
 
+// Captura con flash asíncrona: tras encender el LED se espera a que la
+// exposición automática (AEC) se estabilice en lugar de descartar N frames
+#define FLASH_WARMUP_MS          60    // Subida del LED antes de aceptar frames
+#define FLASH_AEC_TIMEOUT        800   // ms máximos esperando convergencia
+#define FLASH_AEC_STABLE_FRAMES  2     // Frames seguidos con exposición estable
+#define FLASH_AEC_TOLERANCE_SHIFT 4    // Estable si |Δ| <= valor/16
+#define CAPTURE_MAX_PENDING      4     // Peticiones con flash que comparten captura
+
 // ============================================
 // VENTILADOR / FAN
 // ============================================
@@ -71,10 +206,43 @@
 // Cambia este valor según tu hardware.
 #define FAN_GPIO_NUM 12
 
+// ============================================
+// TELEGRAM
+// ============================================
+#define TELEGRAM_UPLOAD_CHUNK 4096     // Buffer reutilizable para subir fotos (memoria o SD)
+#define TELEGRAM_RESPONSE_TIMEOUT 15000 // ms máximos esperando la respuesta de sendPhoto
+#define TELEGRAM_RESPONSE_MAX 4096     // Bytes de respuesta conservados (incluye los file_id)
+
+// Cola de salida: fotos y mensajes se envían desde una tarea propia con su
+// conexión TLS, así processMessage() y loop() nunca esperan a Telegram
+#define TELEGRAM_OUTBOX_DEPTH    8     // Trabajos en cola (fotos y mensajes)
+#define TELEGRAM_OUTBOX_STACK    8192  // Stack de la tarea de envío (handshake TLS)
+#define TELEGRAM_OUTBOX_PRIORITY 1
+#define TELEGRAM_OUTBOX_CORE     1
+#define TELEGRAM_OUTBOX_RETRIES  4     // Reintentos por trabajo antes de descartarlo
+#define TELEGRAM_OUTBOX_BACKOFF  2000  // ms hasta el primer reintento (se duplica en cada uno)
+#define TELEGRAM_RESTART_WAIT    10000 // ms máximos que /reiniciar espera a vaciar la cola
+
+// Recepción por long polling: una tarea mantiene un getUpdates abierto y
+// entrega los mensajes a loop() por una cola
+#define TELEGRAM_LONG_POLL       25    // s que Telegram retiene getUpdates sin mensajes
+#define TELEGRAM_POLL_STACK      8192
+#define TELEGRAM_POLL_PRIORITY   1
+#define TELEGRAM_POLL_CORE       1
+#define TELEGRAM_INBOX_DEPTH     8     // Mensajes recibidos esperando a loop()
+#define TELEGRAM_MESSAGES_PER_LOOP 3   // Mensajes procesados por pasada de loop()
+
+// Lectura de getUpdates: el cuerpo se parsea por bloques a slots de tamaño
+// fijo, la memoria no depende del tamaño de la respuesta
+#define TELEGRAM_UPDATE_SLOTS    4     // Updates por respuesta (parámetro limit)
+#define TELEGRAM_TEXT_MAX        256   // Bytes de texto por mensaje (se trunca el resto)
+#define TELEGRAM_NAME_MAX        64    // Bytes del nombre del remitente
+#define TELEGRAM_POLL_CHUNK      512   // Bloque de lectura del cuerpo HTTP
+
 // ============================================
 // INTERVALOS DE TIEMPO (en milisegundos)
 // ============================================
-#define TELEGRAM_CHECK_INTERVAL 1000   // Revisar mensajes cada 1 segundo
+#define TELEGRAM_CHECK_INTERVAL 1000   // Pausa mínima entre getUpdates fallidos (despierto se usa long polling)
 #define NTP_SYNC_INTERVAL 3600000      // Sincronizar hora cada hora
 
 // ============================================
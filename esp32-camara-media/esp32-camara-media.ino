@@ -30,6 +30,11 @@
 #include "telegram_bot.h"
 #include "sd_handler.h"
 #include "sleep_manager.h"
+#include "stream_server.h"
+#include "metrics.h"
+#include "sd_writer.h"
+#include "video_recorder.h"
+#include "replay_buffer.h"
 
 // Variables para control de tiempo
 unsigned long lastNTPSync = 0;
@@ -89,6 +94,7 @@ void setup() {
         delay(5000);
         ESP.restart();
     }
+    replayBuffer.begin();  // Pre-roll en PSRAM para /replay y las grabaciones
     Serial.println("Camara OK\n");
 
     // Inicializar SD Card
@@ -96,6 +102,8 @@ void setup() {
     if (!sdCard.init()) {
         Serial.println("ADVERTENCIA: SD no disponible, continuando sin almacenamiento local");
     } else {
+        sdWriter.begin();  // Escribe las fotos en segundo plano
+        videoRecorder.begin();
         Serial.println("SD Card OK");
         Serial.println();
     }
@@ -111,6 +119,7 @@ void setup() {
     // Inicializar servidor web
     Serial.println("[5/5] Iniciando servicios...");
     webServer.init();
+    streamServer.begin();
 
     // Inicializar bot de Telegram
     telegramBot.init();
@@ -118,6 +127,9 @@ void setup() {
     // Inicializar modo sleep
     sleepManager.begin();
 
+    // Métricas en segundo plano (/status, /metrics)
+    systemMetrics.begin();
+
     // Sistema listo
     systemReady = true;
     Serial.println("\n================================");
@@ -136,14 +148,26 @@ void setup() {
 void loop() {
     if (!systemReady) return;
 
+    // Un stream activo cuenta como actividad (corre en su propia tarea)
+    if (streamServer.isStreaming()) {
+        sleepManager.registerActivity();
+    }
+
     // Verificar auto-sleep por inactividad
     sleepManager.checkAutoSleep();
 
     // Manejar servidor web (siempre activo; las conexiones despiertan el sistema)
     webServer.handleClient();
 
+    // Avanzar capturas con flash pendientes (entregan su frame por callback)
+    camera.poll();
+
+    // Registrar en el índice las fotos que la tarea de escritura ya guardó
+    sdWriter.poll();
+
     // Manejar mensajes de Telegram
-    // (en modo sleep el checkInterval es mayor → menos polling)
+    // (llegan por long polling desde su propia tarea; en modo sleep la tarea
+    //  espera checkInterval entre consultas → menos polling)
     telegramBot.handleMessages();
 
     // Verificar si es hora de la foto del dia
@@ -194,6 +218,7 @@ void loop() {
         // Si el heap esta criticamente bajo, reiniciar para evitar crashes
         if (freeHeap < HEAP_CRITICAL_THRESHOLD) {
             Serial.println("[Salud] CRITICO: Heap muy bajo, reiniciando ESP32...");
+            sdWriter.flush(SD_WRITER_FLUSH_TIMEOUT);    // No perder fotos encoladas
             delay(1000);
             ESP.restart();
         }
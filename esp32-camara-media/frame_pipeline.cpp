@@ -0,0 +1,288 @@
+#include "frame_pipeline.h"
+#include "esp_timer.h"
+
+FramePipeline framePipeline;
+
+// Protege el anillo y los contadores (secciones críticas muy cortas)
+static portMUX_TYPE pipelineMux = portMUX_INITIALIZER_UNLOCKED;
+
+#define PIPELINE_MAX_FAILURES 10
+
+FramePipeline::FramePipeline()
+    : depth(0), task(nullptr), newest(nullptr), newestTaken(false),
+      consumers(0), waiters(0), validAfterUs(0), discardPending(0), nextSeq(0),
+      consecutiveFailures(0) {
+    for (int i = 0; i < FRAME_PIPELINE_DEPTH; i++) {
+        ring[i].fb = nullptr;
+        ring[i].seq = 0;
+        ring[i].timestampUs = 0;
+        ring[i].refs = 0;
+    }
+}
+
+bool FramePipeline::begin(int fbCount) {
+    depth = min(FRAME_PIPELINE_DEPTH, fbCount - 1);
+    if (depth < 1) {
+        Serial.println("Pipeline de captura deshabilitado (un solo buffer de cámara)");
+        depth = 0;
+        return false;
+    }
+
+    BaseType_t ok = xTaskCreatePinnedToCore(taskEntry, "capture", FRAME_TASK_STACK, this,
+                                            FRAME_TASK_PRIORITY, &task, FRAME_TASK_CORE);
+    if (ok != pdPASS) {
+        Serial.println("Error al crear tarea de captura");
+        depth = 0;
+        return false;
+    }
+
+    Serial.printf("Pipeline de captura iniciado (profundidad %d, %d buffers)\n", depth, fbCount);
+    return true;
+}
+
+bool FramePipeline::isEnabled() const {
+    return depth > 0;
+}
+
+void FramePipeline::addConsumer() {
+    portENTER_CRITICAL(&pipelineMux);
+    // El frame retenido mientras no había consumidores es viejo y el stream
+    // lo salta: sin esto la tarea esperaría a que alguien lo tome
+    if (consumers == 0) newestTaken = true;
+    consumers++;
+    portEXIT_CRITICAL(&pipelineMux);
+    wake();
+}
+
+void FramePipeline::removeConsumer() {
+    portENTER_CRITICAL(&pipelineMux);
+    if (consumers > 0) consumers--;
+    portEXIT_CRITICAL(&pipelineMux);
+    wake();
+}
+
+PipelineFrame* FramePipeline::acquireNewer(uint32_t afterSeq) {
+    PipelineFrame* frame = nullptr;
+    portENTER_CRITICAL(&pipelineMux);
+    if (newest && newest->seq > afterSeq && newest->timestampUs >= validAfterUs) {
+        newest->refs++;
+        newestTaken = true;
+        frame = newest;
+    }
+    portEXIT_CRITICAL(&pipelineMux);
+
+    // Al tomar el más reciente la tarea empieza a capturar el siguiente
+    if (frame) wake();
+    return frame;
+}
+
+PipelineFrame* FramePipeline::acquireFresh(int64_t notBeforeUs, uint32_t timeoutMs) {
+    if (!isEnabled()) return nullptr;
+
+    int64_t deadline = esp_timer_get_time() + (int64_t)timeoutMs * 1000;
+    PipelineFrame* frame = nullptr;
+    bool registered = false;
+
+    for (;;) {
+        portENTER_CRITICAL(&pipelineMux);
+        if (newest && newest->timestampUs >= max(notBeforeUs, validAfterUs)) {
+            newest->refs++;
+            newestTaken = true;
+            frame = newest;
+        } else if (!registered) {
+            waiters++;
+            registered = true;
+        }
+        portEXIT_CRITICAL(&pipelineMux);
+
+        if (frame || esp_timer_get_time() >= deadline) break;
+        wake();
+        vTaskDelay(pdMS_TO_TICKS(2));
+    }
+
+    if (registered) {
+        portENTER_CRITICAL(&pipelineMux);
+        waiters--;
+        portEXIT_CRITICAL(&pipelineMux);
+    }
+    if (frame) wake();
+    return frame;
+}
+
+void FramePipeline::sensorChanged(int64_t changedUs, int discardFrames) {
+    if (!isEnabled()) {
+        // Sin tarea de captura nadie más usa el driver: descartar en el acto
+        for (int i = 0; i < discardFrames; i++) {
+            camera_fb_t* fb = esp_camera_fb_get();
+            if (fb) esp_camera_fb_return(fb);
+        }
+        return;
+    }
+
+    portENTER_CRITICAL(&pipelineMux);
+    validAfterUs = changedUs;
+    discardPending = max(discardPending, discardFrames);
+    // El anterior ya no sirve de "último frame": releaseIdle() lo devuelve
+    if (newest && newest->timestampUs < changedUs) newest = nullptr;
+    portEXIT_CRITICAL(&pipelineMux);
+    wake();
+}
+
+void FramePipeline::retain(PipelineFrame* frame) {
+    if (!frame) return;
+    portENTER_CRITICAL(&pipelineMux);
+    frame->refs++;
+    portEXIT_CRITICAL(&pipelineMux);
+}
+
+void FramePipeline::release(PipelineFrame* frame) {
+    if (!frame) return;
+    portENTER_CRITICAL(&pipelineMux);
+    if (frame->refs > 0) frame->refs--;
+    portEXIT_CRITICAL(&pipelineMux);
+    wake();
+}
+
+bool FramePipeline::releaseBuffer(camera_fb_t* fb) {
+    PipelineFrame* owner = nullptr;
+    portENTER_CRITICAL(&pipelineMux);
+    for (int i = 0; i < depth; i++) {
+        if (ring[i].fb == fb && ring[i].seq != 0) {
+            owner = &ring[i];
+            if (owner->refs > 0) owner->refs--;
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&pipelineMux);
+
+    if (owner) wake();
+    return owner != nullptr;
+}
+
+int FramePipeline::getDepth() const {
+    return depth;
+}
+
+int FramePipeline::getReadyCount() const {
+    int ready = 0;
+    portENTER_CRITICAL(&pipelineMux);
+    for (int i = 0; i < depth; i++) {
+        if (ring[i].fb && ring[i].seq != 0) ready++;
+    }
+    portEXIT_CRITICAL(&pipelineMux);
+    return ready;
+}
+
+uint32_t FramePipeline::getCapturedCount() const {
+    return nextSeq;
+}
+
+bool FramePipeline::hasFailed() const {
+    return consecutiveFailures >= PIPELINE_MAX_FAILURES;
+}
+
+void FramePipeline::wake() {
+    if (task) xTaskNotifyGive(task);
+}
+
+void FramePipeline::taskEntry(void* arg) {
+    static_cast<FramePipeline*>(arg)->run();
+}
+
+bool FramePipeline::wantsCapture() {
+    portENTER_CRITICAL(&pipelineMux);
+    bool want = waiters > 0 || (consumers > 0 && (!newest || newestTaken));
+    portEXIT_CRITICAL(&pipelineMux);
+    return want;
+}
+
+PipelineFrame* FramePipeline::reserveSlot(camera_fb_t** toReturn) {
+    *toReturn = nullptr;
+    PipelineFrame* slot = nullptr;
+
+    portENTER_CRITICAL(&pipelineMux);
+    // Preferir un slot vacío; si no, reciclar el frame libre más antiguo
+    for (int i = 0; i < depth; i++) {
+        if (ring[i].seq == 0) {
+            slot = &ring[i];
+            break;
+        }
+        if (ring[i].refs == 0 && (!slot || ring[i].seq < slot->seq)) {
+            slot = &ring[i];
+        }
+    }
+    if (slot && slot->seq != 0) {
+        *toReturn = slot->fb;
+        slot->fb = nullptr;
+        slot->seq = 0;
+        if (newest == slot) newest = nullptr;
+    }
+    portEXIT_CRITICAL(&pipelineMux);
+
+    return slot;
+}
+
+void FramePipeline::releaseIdle() {
+    // Sin demanda se devuelven al driver los frames libres, salvo el más
+    // reciente (sirve como "último frame" para la siguiente petición)
+    for (int i = 0; i < depth; i++) {
+        camera_fb_t* fb = nullptr;
+        portENTER_CRITICAL(&pipelineMux);
+        if (ring[i].seq != 0 && ring[i].refs == 0 && &ring[i] != newest) {
+            fb = ring[i].fb;
+            ring[i].fb = nullptr;
+            ring[i].seq = 0;
+        }
+        portEXIT_CRITICAL(&pipelineMux);
+        if (fb) esp_camera_fb_return(fb);
+    }
+}
+
+void FramePipeline::run() {
+    for (;;) {
+        if (!wantsCapture()) {
+            releaseIdle();
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(100));
+            continue;
+        }
+
+        camera_fb_t* stale = nullptr;
+        PipelineFrame* slot = reserveSlot(&stale);
+        if (stale) esp_camera_fb_return(stale);
+        if (!slot) {
+            // Todos los frames están prestados: esperar a que devuelvan uno
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(10));
+            continue;
+        }
+
+        // Bloquea hasta que el DMA entregue el siguiente frame; mientras tanto
+        // los consumidores siguen enviando los frames ya publicados
+        camera_fb_t* fb = esp_camera_fb_get();
+        if (!fb) {
+            consecutiveFailures++;
+            Serial.println("Pipeline: captura fallida");
+            vTaskDelay(pdMS_TO_TICKS(50));
+            continue;
+        }
+        consecutiveFailures = 0;
+
+        portENTER_CRITICAL(&pipelineMux);
+        bool discard = discardPending > 0;
+        if (discard) discardPending--;
+        portEXIT_CRITICAL(&pipelineMux);
+        if (discard) {
+            // Frame de transición del sensor: vuelve al driver sin publicarse
+            esp_camera_fb_return(fb);
+            continue;
+        }
+
+        portENTER_CRITICAL(&pipelineMux);
+        slot->fb = fb;
+        slot->seq = ++nextSeq;
+        slot->timestampUs = esp_timer_get_time();
+        slot->refs = 0;
+        newest = slot;
+        newestTaken = false;
+        portEXIT_CRITICAL(&pipelineMux);
+    }
+}
@@ -0,0 +1,91 @@
+#ifndef FRAME_PIPELINE_H
+#define FRAME_PIPELINE_H
+
+#include <Arduino.h>
+#include "esp_camera.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "config.h"
+
+/*
+ * FramePipeline - Captura en segundo plano con anillo de frames listos
+ *
+ * Una tarea productora mantiene un anillo de hasta FRAME_PIPELINE_DEPTH
+ * camera_fb_t* ya capturados. Los consumidores (stream, /capture, Telegram)
+ * toman prestado el más reciente con conteo de referencias y lo devuelven con
+ * release() o camera.releaseFrame().
+ *
+ * Mientras un consumidor envía un frame por WiFi, la tarea ya está pidiendo el
+ * siguiente al driver: el DMA del sensor se solapa con la transmisión.
+ *
+ * El driver necesita al menos un buffer libre para seguir capturando, por eso
+ * la profundidad efectiva es min(FRAME_PIPELINE_DEPTH, fb_count - 1). Sin PSRAM
+ * (fb_count = 1) el pipeline queda deshabilitado y se captura en frío.
+ */
+
+struct PipelineFrame {
+    camera_fb_t* fb;
+    uint32_t seq;           // 0 = slot vacío
+    int64_t timestampUs;    // esp_timer_get_time() al recibir el frame
+    int refs;               // Consumidores que lo tienen prestado
+};
+
+class FramePipeline {
+public:
+    FramePipeline();
+
+    // Crear la tarea de captura (llamar tras esp_camera_init)
+    bool begin(int fbCount);
+    bool isEnabled() const;
+
+    // Consumidores continuos (stream): mientras haya alguno, la tarea
+    // precaptura un frame nuevo cada vez que se toma el más reciente
+    void addConsumer();
+    void removeConsumer();
+
+    // Frame más reciente con seq > afterSeq, sin bloquear (nullptr si no hay)
+    PipelineFrame* acquireNewer(uint32_t afterSeq);
+
+    // Frame capturado en o después de notBeforeUs; espera hasta timeoutMs
+    PipelineFrame* acquireFresh(int64_t notBeforeUs, uint32_t timeoutMs);
+
+    // Cambio de configuración del sensor en changedUs: ningún acquire entrega
+    // frames anteriores y la tarea descarta los próximos discardFrames que
+    // entregue el driver (tras cambiar la resolución salen mal expuestos o
+    // con el tamaño anterior). Sin pipeline los descarta aquí mismo.
+    void sensorChanged(int64_t changedUs, int discardFrames = 0);
+
+    void retain(PipelineFrame* frame);     // Referencia extra (varios receptores)
+    void release(PipelineFrame* frame);
+    bool releaseBuffer(camera_fb_t* fb);   // true si el fb pertenecía al anillo
+
+    int getDepth() const;
+    int getReadyCount() const;             // Frames capturados en el anillo
+    uint32_t getCapturedCount() const;
+    bool hasFailed() const;                // Varias capturas fallidas seguidas
+
+private:
+    PipelineFrame ring[FRAME_PIPELINE_DEPTH];
+    int depth;
+    TaskHandle_t task;
+
+    PipelineFrame* newest;
+    bool newestTaken;               // Alguien ya tomó el más reciente
+    volatile int consumers;
+    volatile int waiters;           // Llamadas a acquireFresh() esperando
+    int64_t validAfterUs;           // Último cambio del sensor
+    int discardPending;             // Frames del driver a tirar sin publicar
+    uint32_t nextSeq;
+    volatile uint32_t consecutiveFailures;
+
+    static void taskEntry(void* arg);
+    void run();
+    bool wantsCapture();
+    PipelineFrame* reserveSlot(camera_fb_t** toReturn);
+    void releaseIdle();
+    void wake();
+};
+
+extern FramePipeline framePipeline;
+
+#endif // FRAME_PIPELINE_H
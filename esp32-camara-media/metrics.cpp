@@ -0,0 +1,293 @@
+#include "metrics.h"
+#include "sd_handler.h"
+#include "frame_pipeline.h"
+#include "esp_timer.h"
+#include <WiFi.h>
+#include <stdarg.h>
+
+SystemMetrics systemMetrics;
+
+// Protege la copia de las métricas mientras se reemplaza o se lee
+static portMUX_TYPE metricsMux = portMUX_INITIALIZER_UNLOCKED;
+
+#define METRICS_PREFIX "esp32cam_"
+
+// Texto acumulado en un buffer fijo; lo que no entra se descarta
+struct MetricsWriter {
+    char* buffer;
+    size_t size;
+    size_t len;
+
+    void print(const char* format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+void MetricsWriter::print(const char* format, ...) {
+    if (len + 1 >= size) return;
+    va_list args;
+    va_start(args, format);
+    int n = vsnprintf(buffer + len, size - len, format, args);
+    va_end(args);
+    if (n > 0) len = min(len + (size_t)n, size - 1);
+}
+
+static void printJsonString(MetricsWriter& out, const char* text) {
+    out.print("\"");
+    for (const char* p = text; *p; p++) {
+        unsigned char c = *p;
+        if (c == '"' || c == '\\') {
+            out.print("\\%c", c);
+        } else if (c < 0x20) {
+            out.print("\\u%04x", c);
+        } else {
+            out.print("%c", c);
+        }
+    }
+    out.print("\"");
+}
+
+SystemMetrics::SystemMetrics() : task(nullptr), sdDirty(false), lastSdRefresh(0) {
+    memset(&snapshot, 0, sizeof(snapshot));
+}
+
+bool SystemMetrics::begin() {
+    refresh(true);
+
+    BaseType_t ok = xTaskCreatePinnedToCore(taskEntry, "metrics", METRICS_TASK_STACK, this,
+                                            METRICS_TASK_PRIORITY, &task, METRICS_TASK_CORE);
+    if (ok != pdPASS) {
+        Serial.println("Error al crear tarea de métricas");
+        return false;
+    }
+
+    Serial.println("Tarea de métricas iniciada");
+    return true;
+}
+
+MetricsSnapshot SystemMetrics::get() const {
+    MetricsSnapshot copy;
+    portENTER_CRITICAL(&metricsMux);
+    copy = snapshot;
+    portEXIT_CRITICAL(&metricsMux);
+    return copy;
+}
+
+void SystemMetrics::invalidateSd() {
+    sdDirty = true;
+}
+
+void SystemMetrics::taskEntry(void* arg) {
+    static_cast<SystemMetrics*>(arg)->run();
+}
+
+void SystemMetrics::run() {
+    for (;;) {
+        vTaskDelay(pdMS_TO_TICKS(METRICS_REFRESH_MS));
+
+        unsigned long sinceSd = millis() - lastSdRefresh;
+        bool sdDue = sinceSd >= METRICS_SD_REFRESH_MS ||
+                     (sdDirty && sinceSd >= METRICS_SD_MIN_INTERVAL);
+        refresh(sdDue);
+    }
+}
+
+void SystemMetrics::refresh(bool includeSd) {
+    // Se parte de la copia actual: sin relectura se conservan los datos de la SD
+    MetricsSnapshot next = get();
+
+    next.uptimeS = (uint32_t)(esp_timer_get_time() / 1000000LL);
+    next.freeHeap = ESP.getFreeHeap();
+    next.minFreeHeap = ESP.getMinFreeHeap();
+    next.psramSize = ESP.getPsramSize();
+    next.freePsram = ESP.getFreePsram();
+
+    next.wifiConnected = (WiFi.status() == WL_CONNECTED);
+    next.rssi = next.wifiConnected ? WiFi.RSSI() : 0;
+    snprintf(next.ssid, sizeof(next.ssid), "%s", next.wifiConnected ? WiFi.SSID().c_str() : "");
+    snprintf(next.ip, sizeof(next.ip), "%s", next.wifiConnected ? WiFi.localIP().toString().c_str() : "");
+
+    next.sdInitialized = sdCard.isInitialized();
+    if (includeSd) {
+        sdDirty = false;
+        next.sdTotal = next.sdInitialized ? sdCard.getTotalSpace() : 0;
+        next.sdUsed = next.sdInitialized ? sdCard.getUsedSpace() : 0;
+        next.sdUpdatedMs = millis();
+        lastSdRefresh = next.sdUpdatedMs;
+    }
+
+    next.stream = streamServer.getStats();
+    next.capture = camera.getLatency(false);
+    next.flashCapture = camera.getLatency(true);
+    next.flashAecFrames = camera.getLastAecFrames();
+    next.cacheHits = camera.getCacheHits();
+    next.cacheMisses = camera.getCacheMisses();
+    next.framesCaptured = framePipeline.getCapturedCount();
+
+    next.pipelineFrames = framePipeline.getReadyCount();
+    next.pendingCaptures = camera.getPendingCaptures();
+    next.telegramInbox = telegramBot.getInboxDepth();
+    next.sdWriter = sdWriter.getStats();
+    next.replay = replayBuffer.getStats();
+    next.outbox = telegramBot.getOutboxStats();
+    next.upload = telegramBot.getUploadStats();
+    next.telegramPolls = telegramBot.getPollRequests();
+
+    next.updatedMs = millis();
+
+    portENTER_CRITICAL(&metricsMux);
+    snapshot = next;
+    portEXIT_CRITICAL(&metricsMux);
+}
+
+size_t SystemMetrics::formatJson(char* buffer, size_t size) const {
+    if (size == 0) return 0;
+    MetricsSnapshot m = get();
+    MetricsWriter out = { buffer, size, 0 };
+    buffer[0] = '\0';
+
+    out.print("{\"uptime\":%u,\"age\":%lu", m.uptimeS, millis() - m.updatedMs);
+    out.print(",\"heap\":{\"free\":%u,\"minFree\":%u}", m.freeHeap, m.minFreeHeap);
+    out.print(",\"psram\":{\"size\":%u,\"free\":%u}", m.psramSize, m.freePsram);
+
+    out.print(",\"wifi\":{\"connected\":%s,\"ssid\":", m.wifiConnected ? "true" : "false");
+    printJsonString(out, m.ssid);
+    out.print(",\"ip\":\"%s\",\"rssi\":%d}", m.ip, m.rssi);
+
+    out.print(",\"sd\":{\"ok\":%s", m.sdInitialized ? "true" : "false");
+    if (m.sdInitialized) {
+        out.print(",\"totalMB\":%llu,\"usedMB\":%llu,\"freeMB\":%llu,\"age\":%lu",
+                  (unsigned long long)(m.sdTotal / (1024 * 1024)),
+                  (unsigned long long)(m.sdUsed / (1024 * 1024)),
+                  (unsigned long long)((m.sdTotal - m.sdUsed) / (1024 * 1024)),
+                  millis() - m.sdUpdatedMs);
+    }
+    out.print("}");
+
+    out.print(",\"stream\":{\"clients\":%d,\"fpsTarget\":%d,\"fps\":%.1f,\"jitterMs\":%.1f,\"lateFrames\":%u}",
+              m.stream.clients, m.stream.targetFps, m.stream.actualFps, m.stream.jitterMs,
+              m.stream.lateFrames);
+
+    out.print(",\"capture\":{\"avgMs\":%.1f,\"maxMs\":%u,\"count\":%u"
+              ",\"flashAvgMs\":%.1f,\"flashMaxMs\":%u,\"flashCount\":%u,\"aecFrames\":%d"
+              ",\"cacheHits\":%u,\"cacheMisses\":%u,\"frames\":%u}",
+              m.capture.avgMs, m.capture.maxMs, m.capture.count,
+              m.flashCapture.avgMs, m.flashCapture.maxMs, m.flashCapture.count, m.flashAecFrames,
+              m.cacheHits, m.cacheMisses, m.framesCaptured);
+
+    out.print(",\"queues\":{\"pipeline\":%d,\"flashPending\":%d,\"telegramIn\":%d,\"telegramOut\":%d,\"sdWrite\":%d}",
+              m.pipelineFrames, m.pendingCaptures, m.telegramInbox, m.outbox.depth, m.sdWriter.depth);
+
+    out.print(",\"sdWriter\":{\"maxDepth\":%d,\"queuedBytes\":%u,\"written\":%u,\"failed\":%u,\"sync\":%u"
+              ",\"p50Ms\":%u,\"p95Ms\":%u,\"p99Ms\":%u,\"maxMs\":%u}",
+              m.sdWriter.maxDepth, m.sdWriter.queuedBytes, m.sdWriter.written, m.sdWriter.failed,
+              m.sdWriter.syncFallbacks, m.sdWriter.p50Ms, m.sdWriter.p95Ms, m.sdWriter.p99Ms,
+              m.sdWriter.maxMs);
+
+    out.print(",\"replay\":{\"bytes\":%u,\"slots\":%d,\"frames\":%d,\"spanMs\":%u,\"stored\":%u"
+              ",\"dropOversize\":%u,\"dropBusy\":%u,\"maxFrame\":%u}",
+              m.replay.bytes, m.replay.slots, m.replay.frames, m.replay.spanMs, m.replay.stored,
+              m.replay.droppedOversize, m.replay.droppedBusy, m.replay.maxFrameSize);
+
+    out.print(",\"telegram\":{\"sent\":%u,\"failed\":%u,\"unconfirmed\":%u,\"retries\":%u,\"dropped\":%u"
+              ",\"latencyMs\":%.0f,\"polls\":%u,\"uploads\":%u,\"handshakes\":%u,\"uploadsUnconfirmed\":%u}}",
+              m.outbox.completed, m.outbox.failed, m.outbox.unconfirmed, m.outbox.retries, m.outbox.dropped,
+              m.outbox.avgLatencyMs, m.telegramPolls, m.upload.uploads, m.upload.handshakes,
+              m.upload.unconfirmed);
+
+    return out.len;
+}
+
+// Formato de exposición de Prometheus (texto 0.0.4): una línea por muestra
+size_t SystemMetrics::formatPrometheus(char* buffer, size_t size) const {
+    if (size == 0) return 0;
+    MetricsSnapshot m = get();
+    MetricsWriter out = { buffer, size, 0 };
+    buffer[0] = '\0';
+
+    out.print("# TYPE " METRICS_PREFIX "uptime_seconds counter\n" METRICS_PREFIX "uptime_seconds %u\n", m.uptimeS);
+    out.print("# TYPE " METRICS_PREFIX "heap_free_bytes gauge\n" METRICS_PREFIX "heap_free_bytes %u\n", m.freeHeap);
+    out.print("# TYPE " METRICS_PREFIX "heap_min_free_bytes gauge\n" METRICS_PREFIX "heap_min_free_bytes %u\n", m.minFreeHeap);
+    out.print("# TYPE " METRICS_PREFIX "psram_size_bytes gauge\n" METRICS_PREFIX "psram_size_bytes %u\n", m.psramSize);
+    out.print("# TYPE " METRICS_PREFIX "psram_free_bytes gauge\n" METRICS_PREFIX "psram_free_bytes %u\n", m.freePsram);
+
+    out.print("# TYPE " METRICS_PREFIX "wifi_connected gauge\n" METRICS_PREFIX "wifi_connected %d\n", m.wifiConnected ? 1 : 0);
+    if (m.wifiConnected) {
+        out.print("# TYPE " METRICS_PREFIX "wifi_rssi_dbm gauge\n" METRICS_PREFIX "wifi_rssi_dbm %d\n", m.rssi);
+    }
+
+    if (m.sdInitialized) {
+        out.print("# TYPE " METRICS_PREFIX "sd_total_bytes gauge\n" METRICS_PREFIX "sd_total_bytes %llu\n",
+                  (unsigned long long)m.sdTotal);
+        out.print("# TYPE " METRICS_PREFIX "sd_used_bytes gauge\n" METRICS_PREFIX "sd_used_bytes %llu\n",
+                  (unsigned long long)m.sdUsed);
+    }
+
+    out.print("# TYPE " METRICS_PREFIX "stream_clients gauge\n" METRICS_PREFIX "stream_clients %d\n", m.stream.clients);
+    out.print("# TYPE " METRICS_PREFIX "stream_fps gauge\n" METRICS_PREFIX "stream_fps %.1f\n", m.stream.actualFps);
+    out.print("# TYPE " METRICS_PREFIX "stream_fps_target gauge\n" METRICS_PREFIX "stream_fps_target %d\n", m.stream.targetFps);
+    out.print("# TYPE " METRICS_PREFIX "stream_jitter_ms gauge\n" METRICS_PREFIX "stream_jitter_ms %.1f\n", m.stream.jitterMs);
+    out.print("# TYPE " METRICS_PREFIX "stream_late_frames_total counter\n" METRICS_PREFIX "stream_late_frames_total %u\n",
+              m.stream.lateFrames);
+
+    out.print("# TYPE " METRICS_PREFIX "capture_latency_avg_ms gauge\n"
+              METRICS_PREFIX "capture_latency_avg_ms{flash=\"0\"} %.1f\n"
+              METRICS_PREFIX "capture_latency_avg_ms{flash=\"1\"} %.1f\n",
+              m.capture.avgMs, m.flashCapture.avgMs);
+    out.print("# TYPE " METRICS_PREFIX "capture_latency_max_ms gauge\n"
+              METRICS_PREFIX "capture_latency_max_ms{flash=\"0\"} %u\n"
+              METRICS_PREFIX "capture_latency_max_ms{flash=\"1\"} %u\n",
+              m.capture.maxMs, m.flashCapture.maxMs);
+    out.print("# TYPE " METRICS_PREFIX "captures_total counter\n"
+              METRICS_PREFIX "captures_total{flash=\"0\"} %u\n"
+              METRICS_PREFIX "captures_total{flash=\"1\"} %u\n",
+              m.capture.count, m.flashCapture.count);
+    out.print("# TYPE " METRICS_PREFIX "capture_cache_hits_total counter\n" METRICS_PREFIX "capture_cache_hits_total %u\n",
+              m.cacheHits);
+    out.print("# TYPE " METRICS_PREFIX "capture_cache_misses_total counter\n" METRICS_PREFIX "capture_cache_misses_total %u\n",
+              m.cacheMisses);
+    out.print("# TYPE " METRICS_PREFIX "frames_captured_total counter\n" METRICS_PREFIX "frames_captured_total %u\n",
+              m.framesCaptured);
+
+    out.print("# TYPE " METRICS_PREFIX "queue_depth gauge\n"
+              METRICS_PREFIX "queue_depth{queue=\"pipeline\"} %d\n"
+              METRICS_PREFIX "queue_depth{queue=\"flash_pending\"} %d\n"
+              METRICS_PREFIX "queue_depth{queue=\"telegram_in\"} %d\n"
+              METRICS_PREFIX "queue_depth{queue=\"telegram_out\"} %d\n"
+              METRICS_PREFIX "queue_depth{queue=\"sd_write\"} %d\n",
+              m.pipelineFrames, m.pendingCaptures, m.telegramInbox, m.outbox.depth, m.sdWriter.depth);
+
+    // Percentiles sobre las últimas SD_WRITER_LATENCY_SAMPLES escrituras
+    out.print("# TYPE " METRICS_PREFIX "sd_write_ms summary\n"
+              METRICS_PREFIX "sd_write_ms{quantile=\"0.5\"} %u\n"
+              METRICS_PREFIX "sd_write_ms{quantile=\"0.95\"} %u\n"
+              METRICS_PREFIX "sd_write_ms{quantile=\"0.99\"} %u\n"
+              METRICS_PREFIX "sd_write_ms{quantile=\"1\"} %u\n",
+              m.sdWriter.p50Ms, m.sdWriter.p95Ms, m.sdWriter.p99Ms, m.sdWriter.maxMs);
+    out.print("# TYPE " METRICS_PREFIX "sd_writes_total counter\n"
+              METRICS_PREFIX "sd_writes_total{result=\"ok\"} %u\n"
+              METRICS_PREFIX "sd_writes_total{result=\"failed\"} %u\n"
+              METRICS_PREFIX "sd_writes_total{result=\"sync\"} %u\n",
+              m.sdWriter.written, m.sdWriter.failed, m.sdWriter.syncFallbacks);
+
+    out.print("# TYPE " METRICS_PREFIX "replay_buffer_bytes gauge\n" METRICS_PREFIX "replay_buffer_bytes %u\n",
+              m.replay.bytes);
+    out.print("# TYPE " METRICS_PREFIX "replay_frames gauge\n" METRICS_PREFIX "replay_frames %d\n", m.replay.frames);
+    out.print("# TYPE " METRICS_PREFIX "replay_frames_stored_total counter\n"
+              METRICS_PREFIX "replay_frames_stored_total %u\n", m.replay.stored);
+    out.print("# TYPE " METRICS_PREFIX "replay_frames_dropped_total counter\n"
+              METRICS_PREFIX "replay_frames_dropped_total{reason=\"oversize\"} %u\n"
+              METRICS_PREFIX "replay_frames_dropped_total{reason=\"busy\"} %u\n",
+              m.replay.droppedOversize, m.replay.droppedBusy);
+
+    out.print("# TYPE " METRICS_PREFIX "telegram_sent_total counter\n" METRICS_PREFIX "telegram_sent_total %u\n",
+              m.outbox.completed);
+    out.print("# TYPE " METRICS_PREFIX "telegram_failed_total counter\n" METRICS_PREFIX "telegram_failed_total %u\n",
+              m.outbox.failed);
+    out.print("# TYPE " METRICS_PREFIX "telegram_unconfirmed_total counter\n"
+              METRICS_PREFIX "telegram_unconfirmed_total %u\n", m.outbox.unconfirmed);
+    out.print("# TYPE " METRICS_PREFIX "telegram_latency_avg_ms gauge\n" METRICS_PREFIX "telegram_latency_avg_ms %.0f\n",
+              m.outbox.avgLatencyMs);
+    out.print("# TYPE " METRICS_PREFIX "telegram_polls_total counter\n" METRICS_PREFIX "telegram_polls_total %u\n",
+              m.telegramPolls);
+
+    return out.len;
+}
@@ -0,0 +1,93 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <Arduino.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "config.h"
+#include "camera_handler.h"
+#include "stream_server.h"
+#include "telegram_bot.h"
+#include "sd_writer.h"
+#include "replay_buffer.h"
+
+/*
+ * SystemMetrics - Copia de las métricas del sistema refrescada en segundo plano
+ *
+ * Una tarea de baja prioridad toma cada METRICS_REFRESH_MS los valores baratos
+ * (heap, PSRAM, WiFi, stream, captura, colas) y cada METRICS_SD_REFRESH_MS el
+ * uso de la SD: SD_MMC.totalBytes()/usedBytes() recorren la FAT y en tarjetas
+ * grandes tardan lo suficiente como para notarse en cada petición. Guardar o
+ * borrar una foto pide una relectura, limitada a una cada METRICS_SD_MIN_INTERVAL.
+ *
+ * /status, /metrics y el estado de Telegram leen la copia (get()), así el
+ * polling del dashboard no recalcula nada ni toca la SD.
+ */
+
+struct MetricsSnapshot {
+    uint32_t uptimeS;
+    uint32_t freeHeap;
+    uint32_t minFreeHeap;
+    uint32_t psramSize;
+    uint32_t freePsram;
+
+    bool wifiConnected;
+    int rssi;
+    char ssid[33];
+    char ip[16];
+
+    bool sdInitialized;
+    uint64_t sdTotal;               // Bytes
+    uint64_t sdUsed;
+    uint32_t sdUpdatedMs;           // millis() de la última lectura de la SD
+
+    StreamStats stream;
+    CaptureLatency capture;
+    CaptureLatency flashCapture;
+    int flashAecFrames;
+    uint32_t cacheHits;
+    uint32_t cacheMisses;
+    uint32_t framesCaptured;
+
+    // Profundidad de las colas
+    int pipelineFrames;             // Frames listos en el anillo de captura
+    int pendingCaptures;            // Capturas con flash esperando
+    int telegramInbox;
+    OutboxStats outbox;             // outbox.depth = cola de salida de Telegram
+    SdWriterStats sdWriter;         // sdWriter.depth = fotos esperando a la SD
+    ReplayStats replay;             // Anillo de pre-roll en PSRAM
+
+    TelegramUploadStats upload;
+    uint32_t telegramPolls;
+
+    uint32_t updatedMs;             // millis() del último refresco
+};
+
+class SystemMetrics {
+public:
+    SystemMetrics();
+
+    // Primer refresco (síncrono) y tarea de refresco; llamar al final de setup()
+    bool begin();
+
+    MetricsSnapshot get() const;
+    void invalidateSd();            // La SD cambió: releer su uso pronto
+
+    // Formatean la copia actual; retornan los bytes escritos (sin el '\0')
+    size_t formatJson(char* buffer, size_t size) const;
+    size_t formatPrometheus(char* buffer, size_t size) const;
+
+private:
+    MetricsSnapshot snapshot;
+    TaskHandle_t task;
+    volatile bool sdDirty;
+    unsigned long lastSdRefresh;
+
+    static void taskEntry(void* arg);
+    void run();
+    void refresh(bool includeSd);
+};
+
+extern SystemMetrics systemMetrics;
+
+#endif // METRICS_H
@@ -0,0 +1,521 @@
+#include "photo_index.h"
+#include <new>
+
+PhotoIndex photoIndex;
+
+#define PHOTO_INDEX_MAGIC   0x58444950  // "PIDX"
+#define PHOTO_INDEX_VERSION 1
+
+// Buffer para desplazar registros al insertar o borrar en medio del índice
+static PhotoIndexEntry shiftBuffer[SD_INDEX_SHIFT_RECORDS];
+
+static bool isPhotoFolder(const String& name) {
+    return !name.isEmpty() && !name.startsWith(".") && name != "System Volume Information";
+}
+
+static bool isPhotoName(const String& name) {
+    return name.endsWith(".jpg") || name.endsWith(".JPG");
+}
+
+// Prioridad de carpetas para ordenar en listado
+static int getFolderPriority(const String& name) {
+    if (name == DEFAULT_PHOTOS_FOLDER) return 0;   // fotos_diarias
+    if (name == TELEGRAM_PHOTOS_FOLDER) return 1;   // fotos_telegram
+    if (name == WEB_PHOTOS_FOLDER) return 2;         // fotos_web
+    return 3;  // Otras carpetas al final
+}
+
+static int compareEntries(const void* a, const void* b) {
+    return strcmp(((const PhotoIndexEntry*)a)->name, ((const PhotoIndexEntry*)b)->name);
+}
+
+static bool readRecords(File& file, uint32_t index, PhotoIndexEntry* entries, size_t n) {
+    if (!file.seek(sizeof(PhotoIndexHeader) + index * sizeof(PhotoIndexEntry))) return false;
+    size_t bytes = n * sizeof(PhotoIndexEntry);
+    return file.read((uint8_t*)entries, bytes) == bytes;
+}
+
+static bool writeRecords(File& file, uint32_t index, const PhotoIndexEntry* entries, size_t n) {
+    if (!file.seek(sizeof(PhotoIndexHeader) + index * sizeof(PhotoIndexEntry))) return false;
+    size_t bytes = n * sizeof(PhotoIndexEntry);
+    return file.write((const uint8_t*)entries, bytes) == bytes;
+}
+
+static uint32_t countPhotos(const String& folderPath) {
+    File dir = SD_MMC.open(folderPath);
+    if (!dir || !dir.isDirectory()) return 0;
+
+    uint32_t count = 0;
+    File file = dir.openNextFile();
+    while (file) {
+        if (!file.isDirectory() && isPhotoName(String(file.name()))) count++;
+        file = dir.openNextFile();
+    }
+    dir.close();
+    return count;
+}
+
+PhotoIndex::PhotoIndex() : folders(nullptr), folderCount(0), folderCapacity(0) {}
+
+void PhotoIndex::begin() {
+    folderCount = 0;
+
+    File root = SD_MMC.open("/");
+    if (!root || !root.isDirectory()) return;
+
+    File entry = root.openNextFile();
+    while (entry) {
+        if (entry.isDirectory()) {
+            String name = String(entry.name());
+            if (name.startsWith("/")) name = name.substring(1);
+            if (isPhotoFolder(name) && insertFolder(name) < 0) {
+                Serial.printf("Indice: sin memoria para la carpeta /%s\n", name.c_str());
+            }
+        }
+        entry = root.openNextFile();
+    }
+    root.close();
+
+    unsigned long start = millis();
+    for (int f = 0; f < folderCount; f++) {
+        loadFolder(f);
+    }
+    Serial.printf("Indice de fotos: %u fotos en %d carpetas (%lu ms)\n",
+                  getTotalCount(), folderCount, millis() - start);
+}
+
+String PhotoIndex::indexPath(int folder) const {
+    return "/" + folders[folder].name + "/" SD_INDEX_FILE;
+}
+
+int PhotoIndex::insertFolder(const String& name) {
+    if (folderCount == folderCapacity) {
+        int newCapacity = folderCapacity ? folderCapacity * 2 : 8;
+        FolderState* grown = new (std::nothrow) FolderState[newCapacity];
+        if (!grown) return -1;
+        for (int f = 0; f < folderCount; f++) {
+            grown[f] = folders[f];
+        }
+        delete[] folders;
+        folders = grown;
+        folderCapacity = newCapacity;
+    }
+
+    int priority = getFolderPriority(name);
+    int pos = folderCount;
+    while (pos > 0) {
+        int prev = getFolderPriority(folders[pos - 1].name);
+        if (prev < priority || (prev == priority && folders[pos - 1].name < name)) break;
+        folders[pos] = folders[pos - 1];
+        pos--;
+    }
+    folders[pos].name = name;
+    folders[pos].count = 0;
+    folders[pos].generation = 0;
+    folderCount++;
+    return pos;
+}
+
+bool PhotoIndex::loadFolder(int folder) {
+    PhotoIndexHeader header;
+    bool valid = false;
+    uint32_t generation = 0;
+
+    File file = SD_MMC.open(indexPath(folder), FILE_READ);
+    bool existed = (bool)file;
+    if (existed) {
+        if (file.read((uint8_t*)&header, sizeof(header)) == sizeof(header) && header.magic == PHOTO_INDEX_MAGIC) {
+            generation = header.generation;
+            valid = header.version == PHOTO_INDEX_VERSION &&
+                    header.recordSize == sizeof(PhotoIndexEntry) && !header.dirty &&
+                    file.size() >= sizeof(header) + header.count * sizeof(PhotoIndexEntry);
+        }
+        file.close();
+    }
+
+#if SD_INDEX_VERIFY_ON_BOOT
+    // Fotos copiadas o borradas desde un PC no pasan por savePhoto/deletePhoto
+    if (valid && countPhotos("/" + folders[folder].name) != header.count) {
+        valid = false;
+    }
+#endif
+
+    if (valid) {
+        folders[folder].count = header.count;
+        folders[folder].generation = header.generation;
+        return true;
+    }
+
+    if (existed) {
+        Serial.printf("Indice de /%s desactualizado, reconstruyendo\n", folders[folder].name.c_str());
+    }
+    return rebuildFolder(folder, generation + 1);
+}
+
+// Recorre la carpeta una vez, ordena los nombres en memoria (PSRAM si hay)
+// con qsort y escribe el índice completo
+bool PhotoIndex::rebuildFolder(int folder, uint32_t generation) {
+    folders[folder].count = 0;
+    folders[folder].generation = generation;
+
+    String folderPath = "/" + folders[folder].name;
+    File dir = SD_MMC.open(folderPath);
+    if (!dir || !dir.isDirectory()) return false;
+
+    PhotoIndexEntry* entries = nullptr;
+    size_t count = 0;
+    size_t capacity = 0;
+    bool ok = true;
+
+    File file = dir.openNextFile();
+    while (file) {
+        String name = String(file.name());
+        if (!file.isDirectory() && isPhotoName(name)) {
+            if (name.length() >= SD_INDEX_NAME_MAX) {
+                Serial.printf("Indice: nombre demasiado largo, se omite %s\n", name.c_str());
+            } else {
+                if (count == capacity) {
+                    size_t newCapacity = capacity ? capacity * 2 : 64;
+                    size_t bytes = newCapacity * sizeof(PhotoIndexEntry);
+                    void* grown = psramFound() ? ps_realloc(entries, bytes) : realloc(entries, bytes);
+                    if (!grown) {
+                        ok = false;
+                        break;
+                    }
+                    entries = (PhotoIndexEntry*)grown;
+                    capacity = newCapacity;
+                }
+                memset(&entries[count], 0, sizeof(PhotoIndexEntry));
+                strcpy(entries[count].name, name.c_str());
+                entries[count].size = file.size();
+                count++;
+            }
+        }
+        file = dir.openNextFile();
+    }
+    dir.close();
+
+    if (!ok) {
+        Serial.printf("Indice: sin memoria para reconstruir %s\n", folderPath.c_str());
+        free(entries);
+        return false;
+    }
+
+    String path = indexPath(folder);
+    if (count == 0 && !SD_MMC.exists(path)) {
+        return true;  // Carpeta sin fotos: no se crea índice hasta la primera
+    }
+
+    qsort(entries, count, sizeof(PhotoIndexEntry), compareEntries);
+
+    File out = SD_MMC.open(path, FILE_WRITE);
+    if (!out) {
+        Serial.printf("Indice: no se pudo escribir %s\n", path.c_str());
+        free(entries);
+        return false;
+    }
+    folders[folder].count = count;
+    ok = writeHeader(out, folder, true) &&
+         writeRecords(out, 0, entries, count) &&
+         writeHeader(out, folder, false);
+    out.close();
+    free(entries);
+
+    Serial.printf("Indice de %s reconstruido: %u fotos\n", folderPath.c_str(), (unsigned)count);
+    return ok;
+}
+
+bool PhotoIndex::writeHeader(File& file, int folder, bool dirty) {
+    PhotoIndexHeader header;
+    memset(&header, 0, sizeof(header));
+    header.magic = PHOTO_INDEX_MAGIC;
+    header.version = PHOTO_INDEX_VERSION;
+    header.recordSize = sizeof(PhotoIndexEntry);
+    header.generation = folders[folder].generation;
+    header.count = folders[folder].count;
+    header.dirty = dirty ? 1 : 0;
+
+    if (!file.seek(0)) return false;
+    bool ok = file.write((const uint8_t*)&header, sizeof(header)) == sizeof(header);
+    // La marca dirty tiene que llegar a la tarjeta antes que los registros
+    if (dirty) file.flush();
+    return ok;
+}
+
+bool PhotoIndex::openForUpdate(int folder, File& file) {
+    String path = indexPath(folder);
+    if (!SD_MMC.exists(path)) {
+        File created = SD_MMC.open(path, FILE_WRITE);
+        if (!created) return false;
+        writeHeader(created, folder, false);
+        created.close();
+    }
+    file = SD_MMC.open(path, "r+");
+    return (bool)file;
+}
+
+uint32_t PhotoIndex::lowerBound(File& file, uint32_t count, const char* name) {
+    uint32_t lo = 0;
+    uint32_t hi = count;
+    PhotoIndexEntry entry;
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        if (!readRecords(file, mid, &entry, 1)) return count;
+        if (strcmp(entry.name, name) < 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+bool PhotoIndex::splitPath(const String& path, String& folder, String& name) {
+    int start = path.startsWith("/") ? 1 : 0;
+    int slash = path.indexOf('/', start);
+    if (slash < 0) return false;
+    folder = path.substring(start, slash);
+    name = path.substring(slash + 1);
+    return !folder.isEmpty() && !name.isEmpty() && name.indexOf('/') < 0;
+}
+
+bool PhotoIndex::add(const String& path, uint32_t size) {
+    String folderName, name;
+    if (!splitPath(path, folderName, name) || !isPhotoName(name)) return false;
+    if (name.length() >= SD_INDEX_NAME_MAX) {
+        Serial.printf("Indice: nombre demasiado largo, se omite %s\n", name.c_str());
+        return false;
+    }
+
+    int folder = findFolder(folderName);
+    if (folder < 0) folder = insertFolder(folderName);
+    if (folder < 0) return false;
+
+    File file;
+    if (!openForUpdate(folder, file)) return false;
+
+    uint32_t count = folders[folder].count;
+    uint32_t pos = lowerBound(file, count, name.c_str());
+    PhotoIndexEntry entry;
+    bool ok = true;
+
+    if (pos < count && readRecords(file, pos, &entry, 1) && strcmp(entry.name, name.c_str()) == 0) {
+        // Mismo nombre (foto sobrescrita): solo cambia el tamaño
+        entry.size = size;
+        ok = writeRecords(file, pos, &entry, 1);
+    } else {
+        ok = writeHeader(file, folder, true);
+        // Las fotos nuevas suelen ir al final (nombre = fecha): no se mueve nada
+        for (uint32_t end = count; ok && end > pos; ) {
+            uint32_t n = min(end - pos, (uint32_t)SD_INDEX_SHIFT_RECORDS);
+            end -= n;
+            ok = readRecords(file, end, shiftBuffer, n) && writeRecords(file, end + 1, shiftBuffer, n);
+        }
+        memset(&entry, 0, sizeof(entry));
+        strcpy(entry.name, name.c_str());
+        entry.size = size;
+        ok = ok && writeRecords(file, pos, &entry, 1);
+        if (ok) folders[folder].count++;
+    }
+
+    folders[folder].generation++;
+    ok = ok && writeHeader(file, folder, false);
+    file.close();
+
+    if (!ok) {
+        Serial.printf("Indice: error actualizando /%s, reconstruyendo\n", folderName.c_str());
+        rebuildFolder(folder, folders[folder].generation + 1);
+    }
+    return ok;
+}
+
+bool PhotoIndex::remove(const String& path) {
+    String folderName, name;
+    if (!splitPath(path, folderName, name)) return false;
+
+    int folder = findFolder(folderName);
+    if (folder < 0 || folders[folder].count == 0) return false;
+
+    File file;
+    if (!openForUpdate(folder, file)) return false;
+
+    uint32_t count = folders[folder].count;
+    uint32_t pos = lowerBound(file, count, name.c_str());
+    PhotoIndexEntry entry;
+    if (pos >= count || !readRecords(file, pos, &entry, 1) || strcmp(entry.name, name.c_str()) != 0) {
+        file.close();
+        return false;  // No estaba indexada
+    }
+
+    bool ok = writeHeader(file, folder, true);
+    for (uint32_t start = pos + 1; ok && start < count; ) {
+        uint32_t n = min(count - start, (uint32_t)SD_INDEX_SHIFT_RECORDS);
+        ok = readRecords(file, start, shiftBuffer, n) && writeRecords(file, start - 1, shiftBuffer, n);
+        start += n;
+    }
+    if (ok) folders[folder].count--;
+
+    folders[folder].generation++;
+    ok = ok && writeHeader(file, folder, false);
+    file.close();
+
+    if (!ok) {
+        Serial.printf("Indice: error actualizando /%s, reconstruyendo\n", folderName.c_str());
+        rebuildFolder(folder, folders[folder].generation + 1);
+    }
+    return ok;
+}
+
+int PhotoIndex::getFolderCount() const {
+    return folderCount;
+}
+
+String PhotoIndex::getFolderName(int folder) const {
+    if (folder < 0 || folder >= folderCount) return "";
+    return folders[folder].name;
+}
+
+int PhotoIndex::findFolder(const String& name) const {
+    for (int f = 0; f < folderCount; f++) {
+        if (folders[f].name == name) return f;
+    }
+    return -1;
+}
+
+uint32_t PhotoIndex::getPhotoCount(int folder) const {
+    if (folder < 0 || folder >= folderCount) return 0;
+    return folders[folder].count;
+}
+
+uint32_t PhotoIndex::getTotalCount() const {
+    uint32_t total = 0;
+    for (int f = 0; f < folderCount; f++) {
+        total += folders[f].count;
+    }
+    return total;
+}
+
+uint32_t PhotoIndex::getGeneration(int folder) const {
+    if (folder < 0 || folder >= folderCount) return 0;
+    return folders[folder].generation;
+}
+
+bool PhotoIndex::getEntry(int folder, uint32_t index, PhotoIndexEntry& entry) {
+    if (folder < 0 || folder >= folderCount || index >= folders[folder].count) return false;
+
+    File file = SD_MMC.open(indexPath(folder), FILE_READ);
+    if (!file) return false;
+    bool ok = readRecords(file, index, &entry, 1);
+    file.close();
+    return ok;
+}
+
+int32_t PhotoIndex::findPrefix(int folder, const char* prefix) {
+    if (folder < 0 || folder >= folderCount || folders[folder].count == 0) return -1;
+
+    File file = SD_MMC.open(indexPath(folder), FILE_READ);
+    if (!file) return -1;
+
+    uint32_t count = folders[folder].count;
+    uint32_t pos = lowerBound(file, count, prefix);
+    PhotoIndexEntry entry;
+    bool found = pos < count && readRecords(file, pos, &entry, 1) &&
+                 strncmp(entry.name, prefix, strlen(prefix)) == 0;
+    file.close();
+    return found ? (int32_t)pos : -1;
+}
+
+uint32_t PhotoIndex::findFirstFrom(int folder, const char* name) {
+    if (folder < 0 || folder >= folderCount || folders[folder].count == 0) return 0;
+
+    File file = SD_MMC.open(indexPath(folder), FILE_READ);
+    if (!file) return folders[folder].count;
+    uint32_t pos = lowerBound(file, folders[folder].count, name);
+    file.close();
+    return pos;
+}
+
+bool PhotoIndex::locate(uint32_t globalIndex, int& folder, uint32_t& index) const {
+    for (int f = 0; f < folderCount; f++) {
+        if (globalIndex < folders[f].count) {
+            folder = f;
+            index = globalIndex;
+            return true;
+        }
+        globalIndex -= folders[f].count;
+    }
+    return false;
+}
+
+PhotoCursor::PhotoCursor() : count(0), position(0), windowStart(0), windowCount(0) {}
+
+PhotoCursor::~PhotoCursor() {
+    close();
+}
+
+bool PhotoCursor::open(int folder) {
+    close();
+    count = photoIndex.getPhotoCount(folder);
+    folderName = photoIndex.getFolderName(folder);
+    if (count == 0) return !folderName.isEmpty();
+
+    file = SD_MMC.open("/" + folderName + "/" SD_INDEX_FILE, FILE_READ);
+    if (!file) {
+        count = 0;
+        return false;
+    }
+    return true;
+}
+
+void PhotoCursor::close() {
+    if (file) file.close();
+    count = 0;
+    position = 0;
+    windowStart = 0;
+    windowCount = 0;
+}
+
+uint32_t PhotoCursor::size() const {
+    return count;
+}
+
+String PhotoCursor::getFolderName() const {
+    return folderName;
+}
+
+bool PhotoCursor::read(uint32_t index, PhotoIndexEntry& entry) {
+    if (index >= count) return false;
+
+    if (index < windowStart || index >= windowStart + windowCount) {
+        // Cargar la ventana en la dirección del recorrido: hacia adelante
+        // empieza en index, hacia atrás termina en index
+        uint32_t start = index;
+        if (windowCount > 0 && index < windowStart) {
+            start = index + 1 >= SD_CURSOR_WINDOW ? index + 1 - SD_CURSOR_WINDOW : 0;
+        }
+        uint32_t n = min((uint32_t)SD_CURSOR_WINDOW, count - start);
+        if (!readRecords(file, start, window, n)) {
+            windowCount = 0;
+            return false;
+        }
+        windowStart = start;
+        windowCount = n;
+    }
+
+    entry = window[index - windowStart];
+    return true;
+}
+
+bool PhotoCursor::next(PhotoIndexEntry& entry) {
+    if (!read(position, entry)) return false;
+    position++;
+    return true;
+}
+
+void PhotoCursor::seek(uint32_t index) {
+    position = index;
+}
+
+uint32_t PhotoCursor::tell() const {
+    return position;
+}
@@ -0,0 +1,120 @@
+#ifndef PHOTO_INDEX_H
+#define PHOTO_INDEX_H
+
+#include <Arduino.h>
+#include "FS.h"
+#include "SD_MMC.h"
+#include "config.h"
+
+/*
+ * PhotoIndex - Índice persistente de fotos en la SD
+ *
+ * Cada carpeta de la raíz tiene un archivo SD_INDEX_FILE con una cabecera y
+ * registros de tamaño fijo (nombre + tamaño) ordenados por nombre. Como los
+ * nombres empiezan por la fecha, el orden alfabético es el cronológico.
+ *
+ *  - Foto i de una carpeta: un seek y una lectura, O(1)
+ *  - Foto por fecha: búsqueda binaria sobre el archivo, O(log n)
+ *  - Totales y numeración global: contadores en RAM por carpeta, O(carpetas)
+ *
+ * savePhoto()/deletePhoto() actualizan el índice al momento. La cabecera
+ * lleva un contador de generación (cambia con cada alta o baja) y una marca
+ * dirty mientras se modifica: si la placa se reinicia a mitad de una
+ * actualización, o la tarjeta se editó en un PC (la cantidad de fotos no
+ * coincide al iniciar), begin() reconstruye el índice de esa carpeta.
+ *
+ * Los listados usan PhotoCursor: el archivo queda abierto y se lee una
+ * ventana de SD_CURSOR_WINDOW registros, así paginar una carpeta de miles de
+ * fotos usa la misma memoria que una de diez.
+ *
+ * Solo se usa desde loop().
+ */
+
+struct PhotoIndexEntry {
+    char name[SD_INDEX_NAME_MAX];   // Nombre del archivo, sin carpeta
+    uint32_t size;
+};
+
+struct PhotoIndexHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t recordSize;
+    uint32_t generation;            // Se incrementa en cada alta o baja
+    uint32_t count;
+    uint8_t dirty;                  // 1 = actualización sin terminar
+    uint8_t reserved[3];
+};
+
+class PhotoIndex {
+public:
+    PhotoIndex();
+
+    void begin();                                   // Cargar (o reconstruir) todas las carpetas
+
+    // Mantenimiento incremental; path = /carpeta/nombre.jpg
+    bool add(const String& path, uint32_t size);
+    bool remove(const String& path);
+
+    // Carpetas en orden de listado: fotos_diarias, fotos_telegram, fotos_web, resto alfabético
+    int getFolderCount() const;
+    String getFolderName(int folder) const;
+    int findFolder(const String& name) const;
+    uint32_t getPhotoCount(int folder) const;
+    uint32_t getTotalCount() const;
+    uint32_t getGeneration(int folder) const;
+
+    bool getEntry(int folder, uint32_t index, PhotoIndexEntry& entry);
+    int32_t findPrefix(int folder, const char* prefix);    // Primer nombre con ese prefijo, -1 si no hay
+    uint32_t findFirstFrom(int folder, const char* name);  // Posición del primer nombre >= name
+    bool locate(uint32_t globalIndex, int& folder, uint32_t& index) const;  // Numeración global (0-based)
+
+private:
+    struct FolderState {
+        String name;
+        uint32_t count;
+        uint32_t generation;
+    };
+
+    FolderState* folders;           // Crece al aparecer carpetas nuevas
+    int folderCount;
+    int folderCapacity;
+
+    String indexPath(int folder) const;
+    int insertFolder(const String& name);
+    bool loadFolder(int folder);
+    bool rebuildFolder(int folder, uint32_t generation);
+    bool writeHeader(File& file, int folder, bool dirty);
+    bool openForUpdate(int folder, File& file);
+    uint32_t lowerBound(File& file, uint32_t count, const char* name);
+    static bool splitPath(const String& path, String& folder, String& name);
+};
+
+// Recorrido secuencial (hacia adelante o atrás) del índice de una carpeta
+class PhotoCursor {
+public:
+    PhotoCursor();
+    ~PhotoCursor();
+
+    bool open(int folder);
+    void close();
+
+    uint32_t size() const;                              // Fotos al abrir el cursor
+    String getFolderName() const;
+    bool read(uint32_t index, PhotoIndexEntry& entry);  // Acceso por posición
+    bool next(PhotoIndexEntry& entry);                  // Siguiente en orden de nombre
+    void seek(uint32_t index);
+    uint32_t tell() const;
+
+private:
+    File file;
+    String folderName;
+    uint32_t count;
+    uint32_t position;
+    PhotoIndexEntry window[SD_CURSOR_WINDOW];
+    uint32_t windowStart;
+    uint32_t windowCount;
+};
+
+extern PhotoIndex photoIndex;
+
+#endif // PHOTO_INDEX_H
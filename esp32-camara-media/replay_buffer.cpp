@@ -0,0 +1,219 @@
+#include "replay_buffer.h"
+#include "frame_pipeline.h"
+#include "sleep_manager.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+
+ReplayBuffer replayBuffer;
+
+// Protege los slots y los contadores (secciones críticas muy cortas)
+static portMUX_TYPE replayMux = portMUX_INITIALIZER_UNLOCKED;
+
+ReplayBuffer::ReplayBuffer()
+    : slotCount(0), memory(nullptr), task(nullptr), nextSeq(0), stored(0),
+      droppedOversize(0), droppedBusy(0), maxFrameSize(0) {
+    memset(slots, 0, sizeof(slots));
+}
+
+bool ReplayBuffer::begin() {
+#if REPLAY_ENABLED
+    if (!framePipeline.isEnabled()) {
+        Serial.println("Pre-roll deshabilitado (requiere el pipeline de captura)");
+        return false;
+    }
+
+    // Un solo bloque para todos los slots; con poca PSRAM se reservan menos
+    size_t largest = heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM);
+    int count = 0;
+    if (largest > REPLAY_PSRAM_RESERVE) {
+        count = min((size_t)REPLAY_MAX_FRAMES, (largest - REPLAY_PSRAM_RESERVE) / REPLAY_SLOT_SIZE);
+    }
+    if (count >= 2) {
+        memory = (uint8_t*)heap_caps_malloc((size_t)count * REPLAY_SLOT_SIZE, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    }
+    if (!memory) {
+        Serial.println("Pre-roll deshabilitado: PSRAM insuficiente");
+        return false;
+    }
+
+    slotCount = count;
+    for (int i = 0; i < slotCount; i++) {
+        slots[i].data = memory + (size_t)i * REPLAY_SLOT_SIZE;
+    }
+
+    if (xTaskCreatePinnedToCore(taskEntry, "replay", REPLAY_TASK_STACK, this,
+                                REPLAY_TASK_PRIORITY, &task, REPLAY_TASK_CORE) != pdPASS) {
+        Serial.println("Error al crear tarea de pre-roll");
+        free(memory);
+        memory = nullptr;
+        slotCount = 0;
+        task = nullptr;
+        return false;
+    }
+
+    Serial.printf("Pre-roll: %d frames de hasta %u KB (%u KB de PSRAM)\n", slotCount,
+                  (unsigned)(REPLAY_SLOT_SIZE / 1024), (unsigned)(slotCount * (REPLAY_SLOT_SIZE / 1024)));
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool ReplayBuffer::isEnabled() const {
+    return memory != nullptr;
+}
+
+int ReplayBuffer::acquire(ReplayFrame* frames, int max) {
+    if (!isEnabled() || max <= 0) {
+        return 0;
+    }
+    int64_t notBeforeUs = esp_timer_get_time() - (int64_t)REPLAY_SECONDS * 1000000;
+    int count = 0;
+
+    portENTER_CRITICAL(&replayMux);
+    const Slot* newest = nullptr;
+    for (int i = 0; i < slotCount; i++) {
+        if (slots[i].seq != 0 && (!newest || slots[i].seq > newest->seq)) {
+            newest = &slots[i];
+        }
+    }
+    // Un cambio de resolución deja frames de otro tamaño: solo los del actual
+    for (int i = 0; newest && i < slotCount && count < max; i++) {
+        Slot& s = slots[i];
+        if (s.seq != 0 && s.timestampUs >= notBeforeUs &&
+            s.width == newest->width && s.height == newest->height) {
+            s.refs++;
+            frames[count++] = { s.data, s.size, s.timestampUs, s.width, s.height, i };
+        }
+    }
+    portEXIT_CRITICAL(&replayMux);
+
+    // Orden cronológico (inserción: como mucho REPLAY_MAX_FRAMES)
+    for (int i = 1; i < count; i++) {
+        ReplayFrame value = frames[i];
+        int j = i - 1;
+        while (j >= 0 && frames[j].timestampUs > value.timestampUs) {
+            frames[j + 1] = frames[j];
+            j--;
+        }
+        frames[j + 1] = value;
+    }
+    return count;
+}
+
+void ReplayBuffer::release(const ReplayFrame* frames, int count) {
+    portENTER_CRITICAL(&replayMux);
+    for (int i = 0; i < count; i++) {
+        Slot& s = slots[frames[i].slot];
+        if (s.refs > 0) s.refs--;
+    }
+    portEXIT_CRITICAL(&replayMux);
+}
+
+ReplayStats ReplayBuffer::getStats() const {
+    ReplayStats stats;
+    stats.enabled = isEnabled();
+    stats.slots = slotCount;
+    stats.slotSize = REPLAY_SLOT_SIZE;
+    stats.bytes = (uint32_t)slotCount * REPLAY_SLOT_SIZE;
+
+    int frames = 0;
+    int64_t oldestUs = 0;
+    int64_t newestUs = 0;
+    portENTER_CRITICAL(&replayMux);
+    for (int i = 0; i < slotCount; i++) {
+        if (slots[i].seq == 0) continue;
+        if (frames == 0 || slots[i].timestampUs < oldestUs) oldestUs = slots[i].timestampUs;
+        if (frames == 0 || slots[i].timestampUs > newestUs) newestUs = slots[i].timestampUs;
+        frames++;
+    }
+    stats.stored = stored;
+    stats.droppedOversize = droppedOversize;
+    stats.droppedBusy = droppedBusy;
+    stats.maxFrameSize = maxFrameSize;
+    portEXIT_CRITICAL(&replayMux);
+
+    stats.frames = frames;
+    stats.spanMs = (uint32_t)((newestUs - oldestUs) / 1000);
+    return stats;
+}
+
+void ReplayBuffer::taskEntry(void* arg) {
+    static_cast<ReplayBuffer*>(arg)->run();
+}
+
+void ReplayBuffer::run() {
+    const int64_t intervalUs = 1000000LL / REPLAY_FPS;
+    int64_t nextDueUs = 0;
+
+    for (;;) {
+        // En modo sleep no se piden frames: sin otra demanda el pipeline
+        // suelta los buffers y la cámara queda parada. Al despertar el anillo
+        // se vuelve a llenar desde cero
+        if (sleepManager.isSleeping()) {
+            vTaskDelay(pdMS_TO_TICKS(REPLAY_SLEEP_CHECK));
+            nextDueUs = 0;
+            continue;
+        }
+
+        int64_t waitUs = nextDueUs - esp_timer_get_time();
+        if (waitUs > 0) {
+            vTaskDelay(pdMS_TO_TICKS(max((int64_t)1, waitUs / 1000)));
+            continue;
+        }
+
+        // Frame capturado desde la hora prevista: si el stream está activo ya
+        // está en el pipeline, si no se pide uno (como capturePhoto)
+        PipelineFrame* frame = framePipeline.acquireFresh(nextDueUs, FRAME_ACQUIRE_TIMEOUT);
+        if (!frame) {
+            vTaskDelay(pdMS_TO_TICKS(100));
+            continue;
+        }
+        int64_t timestampUs = frame->timestampUs;
+        store(frame->fb->buf, frame->fb->len, timestampUs, frame->fb->width, frame->fb->height);
+        framePipeline.release(frame);
+
+        // Mantener la cadencia; si se atrasó más de un frame, seguir desde este
+        nextDueUs += intervalUs;
+        if (nextDueUs <= timestampUs) {
+            nextDueUs = timestampUs + intervalUs;
+        }
+    }
+}
+
+void ReplayBuffer::store(const uint8_t* data, size_t size, int64_t timestampUs, uint16_t width, uint16_t height) {
+    Slot* slot = nullptr;
+
+    portENTER_CRITICAL(&replayMux);
+    if (size > maxFrameSize) maxFrameSize = size;
+    if (size > REPLAY_SLOT_SIZE) {
+        droppedOversize++;
+    } else {
+        // El slot libre más antiguo (los vacíos tienen seq 0)
+        for (int i = 0; i < slotCount; i++) {
+            if (slots[i].refs == 0 && (!slot || slots[i].seq < slot->seq)) {
+                slot = &slots[i];
+            }
+        }
+        if (slot) {
+            slot->seq = 0;          // Invisible para acquire() mientras se copia
+        } else {
+            droppedBusy++;
+        }
+    }
+    portEXIT_CRITICAL(&replayMux);
+
+    if (!slot) {
+        return;
+    }
+    memcpy(slot->data, data, size);
+
+    portENTER_CRITICAL(&replayMux);
+    slot->size = size;
+    slot->timestampUs = timestampUs;
+    slot->width = width;
+    slot->height = height;
+    slot->seq = ++nextSeq;
+    stored++;
+    portEXIT_CRITICAL(&replayMux);
+}
@@ -0,0 +1,89 @@
+#ifndef REPLAY_BUFFER_H
+#define REPLAY_BUFFER_H
+
+#include <Arduino.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "config.h"
+
+/*
+ * ReplayBuffer - Anillo en PSRAM con los últimos segundos de video
+ *
+ * Una tarea toma del pipeline de captura (el mismo que usa
+ * CameraHandler::capturePhoto) un frame cada 1/REPLAY_FPS s y copia el JPEG a
+ * un slot del anillo. Toda la memoria se reserva de una vez en begin(): slots
+ * de REPLAY_SLOT_SIZE, siempre los mismos, sin malloc/free por frame ni
+ * fragmentación de la PSRAM.
+ *
+ * acquire() fija los frames de los últimos REPLAY_SECONDS (orden cronológico)
+ * hasta release(): /replay los envía y VideoRecorder los pone al principio de
+ * cada grabación. Mientras están fijados la tarea no puede reutilizarlos y los
+ * frames nuevos se cuentan como descartados.
+ */
+
+struct ReplayFrame {
+    const uint8_t* data;
+    uint32_t size;
+    int64_t timestampUs;            // esp_timer_get_time() de la captura
+    uint16_t width;
+    uint16_t height;
+    int slot;
+};
+
+struct ReplayStats {
+    bool enabled;
+    int slots;
+    uint32_t slotSize;
+    uint32_t bytes;                 // PSRAM reservada (slots * slotSize)
+    int frames;                     // Frames guardados ahora mismo
+    uint32_t spanMs;                // Del más antiguo al más reciente
+    uint32_t stored;                // Frames copiados desde el arranque
+    uint32_t droppedOversize;       // JPEG más grande que un slot
+    uint32_t droppedBusy;           // Todos los slots fijados (/replay o grabación)
+    uint32_t maxFrameSize;          // JPEG más grande visto (para ajustar el slot)
+};
+
+class ReplayBuffer {
+public:
+    ReplayBuffer();
+
+    bool begin();                   // Tras camera.init(): reserva la PSRAM y crea la tarea
+    bool isEnabled() const;
+
+    // Fija los frames de los últimos REPLAY_SECONDS con la resolución del más
+    // reciente; retorna cuántos copió en frames (como mucho max)
+    int acquire(ReplayFrame* frames, int max);
+    void release(const ReplayFrame* frames, int count);
+
+    ReplayStats getStats() const;
+
+private:
+    struct Slot {
+        uint8_t* data;              // Dentro de memory, fijo
+        uint32_t size;
+        uint32_t seq;               // 0 = vacío o escribiéndose
+        int64_t timestampUs;
+        uint16_t width;
+        uint16_t height;
+        int refs;
+    };
+
+    Slot slots[REPLAY_MAX_FRAMES];
+    int slotCount;
+    uint8_t* memory;
+    TaskHandle_t task;
+    uint32_t nextSeq;
+
+    uint32_t stored;
+    uint32_t droppedOversize;
+    uint32_t droppedBusy;
+    uint32_t maxFrameSize;
+
+    static void taskEntry(void* arg);
+    void run();
+    void store(const uint8_t* data, size_t size, int64_t timestampUs, uint16_t width, uint16_t height);
+};
+
+extern ReplayBuffer replayBuffer;
+
+#endif // REPLAY_BUFFER_H
@@ -1,9 +1,60 @@
 #include "sd_handler.h"
 #include "config.h"
+#include "photo_index.h"
+#include "metrics.h"
+#include "esp_jpg_decode.h"
+#include "img_converters.h"
+#include "esp_heap_caps.h"
+#include "soc/soc_memory_layout.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
 #include <time.h>
 
 SDHandler sdCard;
 
+// esp_jpg_decode() usa un buffer de trabajo estático: las miniaturas de la
+// tarea de escritura y las de /thumb (loop()) se generan de una en una
+static SemaphoreHandle_t thumbLock = nullptr;
+
+// Buffer de RAM interna con DMA reutilizado por todas las escrituras. El
+// driver SDMMC no puede hacer DMA desde PSRAM: con datos de PSRAM (frames y
+// copias encoladas) escribe sector a sector a través de un buffer propio
+static uint8_t* writeBuffer = nullptr;
+static SemaphoreHandle_t writeLock = nullptr;
+
+// Carpeta de miniaturas que ya existe: evita dos búsquedas en el directorio
+// por foto guardada (protegida por thumbLock)
+static String knownThumbDir;
+
+// Escribe en bloques de SD_WRITE_BUFFER_SIZE: con el puntero alineado a
+// sector FATFS manda cada bloque al driver en una sola transferencia
+static size_t writeBlocks(File& file, const uint8_t* data, size_t size) {
+    bool copy = writeBuffer && !esp_ptr_dma_capable(data);
+    if (copy) {
+        xSemaphoreTake(writeLock, portMAX_DELAY);
+    }
+
+    size_t written = 0;
+    while (written < size) {
+        size_t chunk = min((size_t)SD_WRITE_BUFFER_SIZE, size - written);
+        const uint8_t* block = data + written;
+        if (copy) {
+            memcpy(writeBuffer, block, chunk);
+            block = writeBuffer;
+        }
+        size_t n = file.write(block, chunk);
+        written += n;
+        if (n != chunk) {
+            break;
+        }
+    }
+
+    if (copy) {
+        xSemaphoreGive(writeLock);
+    }
+    return written;
+}
+
 SDHandler::SDHandler() : initialized(false), photosFolder(DEFAULT_PHOTOS_FOLDER) {}
 
 bool SDHandler::init() {
@@ -41,6 +92,23 @@ bool SDHandler::init() {
     // Crear directorio para fotos de Telegram
     createDirectory("/" + String(TELEGRAM_PHOTOS_FOLDER));
 
+    // Crear directorio para fotos del dashboard web
+    createDirectory("/" + String(WEB_PHOTOS_FOLDER));
+
+    // Cargar el índice de fotos (se reconstruye si no coincide con la SD)
+    photoIndex.begin();
+
+    if (!thumbLock) {
+        thumbLock = xSemaphoreCreateMutex();
+    }
+    if (!writeLock) {
+        writeLock = xSemaphoreCreateMutex();
+        writeBuffer = (uint8_t*)heap_caps_malloc(SD_WRITE_BUFFER_SIZE, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+        if (!writeBuffer) {
+            Serial.println("Sin RAM interna para el buffer de escritura: se escribe desde PSRAM");
+        }
+    }
+
     initialized = true;
     Serial.println("Tarjeta SD inicializada correctamente");
     Serial.printf("Carpeta de fotos: /%s\n", photosFolder.c_str());
@@ -126,30 +194,146 @@ bool SDHandler::savePhoto(const uint8_t* data, size_t size, String filename) {
         filename = generateFilename();
     }
 
-    File file = SD_MMC.open(filename, FILE_WRITE);
-    if (!file) {
-        Serial.println("Error al abrir archivo para escritura");
+    if (!writePhotoFile(data, size, filename)) {
         return false;
     }
+    registerPhoto(filename, size);
+    return true;
+}
 
-    size_t bytesWritten = file.write(data, size);
-    file.close();
+bool SDHandler::writePhotoFile(const uint8_t* data, size_t size, const String& filename) {
+    if (!initialized) {
+        Serial.println("SD no inicializada");
+        return false;
+    }
 
-    if (bytesWritten != size) {
+    if (!writeFile(filename, data, size)) {
         Serial.println("Error al escribir archivo");
         return false;
     }
 
     Serial.printf("Foto guardada: %s (%d bytes)\n", filename.c_str(), size);
+
+#if THUMB_ENABLED
+    // Sin miniatura la foto sigue guardada: /thumb la genera al pedirla
+    saveThumbnail(data, size, filename);
+#endif
+    return true;
+}
+
+void SDHandler::registerPhoto(const String& filename, size_t size) {
+    photoIndex.add(filename, size);
+    systemMetrics.invalidateSd();
+}
+
+bool SDHandler::writeFile(const String& path, const uint8_t* data, size_t size, bool buffered) {
+    File file = SD_MMC.open(path, FILE_WRITE);
+    if (!file) {
+        return false;
+    }
+
+    size_t written;
+    if (buffered) {
+        // Preasignar: un seek más allá del final amplía el archivo y FATFS
+        // reserva toda la cadena de clusters de una vez (la FAT se actualiza
+        // en un solo paso en vez de cluster a cluster durante la escritura)
+        file.seek(size);
+        file.seek(0);
+        written = writeBlocks(file, data, size);
+    } else {
+        written = file.write(data, size);
+    }
+    // La entrada de directorio (tamaño, fecha) se escribe una sola vez al cerrar
+    file.close();
+
+    if (written != size) {
+        SD_MMC.remove(path);
+        return false;
+    }
     return true;
 }
 
+size_t SDHandler::writeData(File& file, const uint8_t* data, size_t size) {
+    return writeBlocks(file, data, size);
+}
+
+bool SDHandler::benchmarkWrites(int files, size_t size, bool buffered, SdBenchResult& result) {
+    memset(&result, 0, sizeof(result));
+    if (!initialized || files <= 0 || files > SD_BENCH_MAX_FILES || size == 0) {
+        return false;
+    }
+
+    // Los datos salen de PSRAM, como los frames de la cámara
+    uint8_t* data = (uint8_t*)(psramFound() ? ps_malloc(size) : malloc(size));
+    if (!data) {
+        return false;
+    }
+    for (size_t i = 0; i < size; i++) {
+        data[i] = (uint8_t)(i * 31 + 7);
+    }
+
+    String folder = "/" + String(SD_BENCH_FOLDER);
+    createDirectory(folder);
+
+    uint32_t times[SD_BENCH_MAX_FILES];
+    int done = 0;
+    unsigned long start = millis();
+    for (int i = 0; i < files; i++) {
+        String path = folder + "/b" + String(i) + ".jpg";
+        unsigned long t = millis();
+        if (!writeFile(path, data, size, buffered)) {
+            break;
+        }
+        times[done++] = millis() - t;
+    }
+    result.totalMs = millis() - start;
+    free(data);
+
+    for (int i = 0; i < files; i++) {
+        SD_MMC.remove(folder + "/b" + String(i) + ".jpg");
+    }
+    SD_MMC.rmdir(folder);
+
+    // Ordenar para los percentiles
+    for (int i = 1; i < done; i++) {
+        uint32_t value = times[i];
+        int j = i - 1;
+        while (j >= 0 && times[j] > value) {
+            times[j + 1] = times[j];
+            j--;
+        }
+        times[j + 1] = value;
+    }
+
+    result.files = done;
+    result.fileSize = size;
+    if (done > 0) {
+        result.p50Ms = times[(done - 1) * 50 / 100];
+        result.p99Ms = times[(done - 1) * 99 / 100];
+        result.maxMs = times[done - 1];
+    }
+    if (result.totalMs > 0) {
+        result.kbPerSec = (float)done * size / 1024.0f * 1000.0f / result.totalMs;
+    }
+    return done == files;
+}
+
 bool SDHandler::deletePhoto(String filename) {
     if (!initialized) {
         return false;
     }
 
-    return SD_MMC.remove(filename);
+    if (!SD_MMC.remove(filename)) {
+        return false;
+    }
+    photoIndex.remove(filename);
+    systemMetrics.invalidateSd();
+
+    String thumbPath = getThumbnailPath(filename);
+    if (SD_MMC.exists(thumbPath)) {
+        SD_MMC.remove(thumbPath);
+    }
+    return true;
 }
 
 uint8_t* SDHandler::readPhoto(String filename, size_t& size) {
@@ -213,36 +397,191 @@ void SDHandler::freePhotoBuffer(uint8_t* buffer) {
     }
 }
 
-String SDHandler::getLatestPhoto() {
-    if (!initialized) {
-        return "";
+// ===== Miniaturas =====
+
+struct ThumbDecoder {
+    const uint8_t* input;
+    uint8_t* output;        // RGB888 en el orden de bytes que espera fmt2jpg
+    uint16_t width;
+    uint16_t height;
+};
+
+static unsigned int thumbRead(void* arg, size_t index, uint8_t* buf, size_t len) {
+    ThumbDecoder* dec = (ThumbDecoder*)arg;
+    if (buf) {
+        memcpy(buf, dec->input + index, len);
     }
+    return len;
+}
 
-    String folderPath = "/" + photosFolder;
-    File root = SD_MMC.open(folderPath);
-    if (!root) {
-        return "";
+static bool thumbWrite(void* arg, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t* data) {
+    ThumbDecoder* dec = (ThumbDecoder*)arg;
+
+    if (!data) {
+        // La primera llamada (x = y = 0) trae el tamaño ya reducido; la última no trae nada
+        if (x == 0 && y == 0) {
+            size_t bytes = (size_t)w * h * 3;
+            dec->width = w;
+            dec->height = h;
+            dec->output = (uint8_t*)(psramFound() ? ps_malloc(bytes) : malloc(bytes));
+            return dec->output != nullptr;
+        }
+        return true;
+    }
+
+    if (!dec->output || x + w > dec->width || y + h > dec->height) {
+        return false;
+    }
+
+    // El decodificador entrega RGB y fmt2jpg lee RGB888 como B, G, R
+    // (el mismo orden que produce fmt2rgb888)
+    for (uint16_t row = 0; row < h; row++) {
+        uint8_t* out = dec->output + ((size_t)(y + row) * dec->width + x) * 3;
+        for (uint16_t col = 0; col < w; col++) {
+            out[0] = data[2];
+            out[1] = data[1];
+            out[2] = data[0];
+            out += 3;
+            data += 3;
+        }
+    }
+    return true;
+}
+
+// Ancho y alto del JPEG leídos del marcador SOF, sin decodificar
+static bool jpegDimensions(const uint8_t* data, size_t size, uint16_t& width, uint16_t& height) {
+    if (size < 4 || data[0] != 0xFF || data[1] != 0xD8) {
+        return false;
+    }
+
+    size_t pos = 2;
+    while (pos + 4 <= size) {
+        if (data[pos] != 0xFF) {
+            return false;
+        }
+        uint8_t marker = data[pos + 1];
+        if (marker == 0xFF) {
+            pos++;  // Relleno entre marcadores
+            continue;
+        }
+        if (marker >= 0xC0 && marker <= 0xC3) {
+            if (pos + 9 > size) {
+                return false;
+            }
+            height = (data[pos + 5] << 8) | data[pos + 6];
+            width = (data[pos + 7] << 8) | data[pos + 8];
+            return width > 0 && height > 0;
+        }
+        if (marker == 0xDA) {
+            return false;  // Empiezan los datos y no hubo SOF
+        }
+        pos += 2 + (((size_t)data[pos + 2] << 8) | data[pos + 3]);
+    }
+    return false;
+}
+
+String SDHandler::getThumbnailPath(String filename) {
+    if (!filename.startsWith("/")) {
+        filename = "/" + filename;
     }
+    return "/" + String(THUMBS_FOLDER) + filename;
+}
 
-    String latestFile = "";
-    unsigned long latestTime = 0;
+bool SDHandler::saveThumbnail(const uint8_t* data, size_t size, const String& filename) {
+    uint16_t width = 0;
+    uint16_t height = 0;
+    if (!jpegDimensions(data, size, width, height)) {
+        Serial.println("Miniatura: JPEG sin cabecera SOF");
+        return false;
+    }
 
-    File file = root.openNextFile();
-    while (file) {
-        if (!file.isDirectory()) {
-            String name = file.name();
-            if (name.endsWith(".jpg")) {
-                time_t modTime = file.getLastWrite();
-                if (modTime > latestTime) {
-                    latestTime = modTime;
-                    latestFile = folderPath + "/" + name;
-                }
+    // La reducción se hace en el dominio DCT: a 1/8 el decodificador solo usa
+    // el coeficiente DC de cada bloque, mucho más rápido que decodificar entero
+    jpg_scale_t scale = JPG_SCALE_NONE;
+    if (width / 8 >= THUMB_MIN_WIDTH) {
+        scale = JPG_SCALE_8X;
+    } else if (width / 4 >= THUMB_MIN_WIDTH) {
+        scale = JPG_SCALE_4X;
+    } else if (width / 2 >= THUMB_MIN_WIDTH) {
+        scale = JPG_SCALE_2X;
+    }
+
+    if (thumbLock) {
+        xSemaphoreTake(thumbLock, portMAX_DELAY);
+    }
+    ThumbDecoder dec = { data, nullptr, 0, 0 };
+    bool decoded = esp_jpg_decode(size, scale, thumbRead, thumbWrite, &dec) == ESP_OK;
+
+    uint8_t* thumb = nullptr;
+    size_t thumbSize = 0;
+    bool encoded = decoded && fmt2jpg(dec.output, (size_t)dec.width * dec.height * 3,
+                                      dec.width, dec.height, PIXFORMAT_RGB888,
+                                      THUMB_QUALITY, &thumb, &thumbSize);
+    free(dec.output);
+
+    String thumbPath = getThumbnailPath(filename);
+    bool saved = false;
+    if (encoded) {
+        String thumbDir = thumbPath.substring(0, thumbPath.lastIndexOf('/'));
+        if (thumbDir != knownThumbDir) {
+            createDirectory("/" + String(THUMBS_FOLDER));
+            if (createDirectory(thumbDir)) {
+                knownThumbDir = thumbDir;
             }
         }
-        file = root.openNextFile();
+        saved = writeFile(thumbPath, thumb, thumbSize);
+    }
+    if (thumbLock) {
+        xSemaphoreGive(thumbLock);
+    }
+    free(thumb);
+
+    if (!encoded) {
+        Serial.printf("Error al generar miniatura de %s\n", filename.c_str());
+        return false;
+    }
+    if (!saved) {
+        Serial.printf("Error al guardar miniatura: %s\n", thumbPath.c_str());
+        return false;
+    }
+
+    Serial.printf("Miniatura guardada: %s (%ux%u, %u bytes)\n",
+                  thumbPath.c_str(), dec.width, dec.height, (unsigned)thumbSize);
+    return true;
+}
+
+bool SDHandler::ensureThumbnail(String filename) {
+    if (!initialized) {
+        return false;
+    }
+    if (SD_MMC.exists(getThumbnailPath(filename))) {
+        return true;
     }
 
-    return latestFile;
+    // Fotos guardadas antes de existir las miniaturas: se generan una vez
+    size_t size = 0;
+    uint8_t* data = readPhoto(filename, size);
+    if (!data) {
+        return false;
+    }
+    bool saved = saveThumbnail(data, size, filename);
+    freePhotoBuffer(data);
+    return saved;
+}
+
+String SDHandler::getLatestPhoto() {
+    if (!initialized) {
+        return "";
+    }
+
+    // El nombre lleva la fecha: la última del índice es la más reciente
+    int folder = photoIndex.findFolder(photosFolder);
+    uint32_t count = photoIndex.getPhotoCount(folder);
+    PhotoIndexEntry entry;
+    if (count == 0 || !photoIndex.getEntry(folder, count - 1, entry)) {
+        return "";
+    }
+    return "/" + photosFolder + "/" + entry.name;
 }
 
 String SDHandler::getDailyPhotoPath() {
@@ -281,24 +620,7 @@ bool SDHandler::photoExistsToday() {
              timeinfo.tm_mon + 1,
              timeinfo.tm_mday);
 
-    String folderPath = "/" + photosFolder;
-    File dir = SD_MMC.open(folderPath);
-    if (!dir || !dir.isDirectory()) {
-        return false;
-    }
-
-    File file = dir.openNextFile();
-    while (file) {
-        String fileName = String(file.name());
-        if (fileName.startsWith(datePrefix)) {
-            file.close();
-            dir.close();
-            return true;
-        }
-        file = dir.openNextFile();
-    }
-    dir.close();
-    return false;
+    return photoIndex.findPrefix(photoIndex.findFolder(photosFolder), datePrefix) >= 0;
 }
 
 String SDHandler::findPhotoByDate(int year, int month, int day) {
@@ -314,25 +636,13 @@ String SDHandler::findPhotoInFolder(String folder, int year, int month, int day)
     char datePrefix[16];
     snprintf(datePrefix, sizeof(datePrefix), "%04d-%02d-%02d", year, month, day);
 
-    String folderPath = "/" + folder;
-    File dir = SD_MMC.open(folderPath);
-    if (!dir || !dir.isDirectory()) {
+    int folderIndex = photoIndex.findFolder(folder);
+    int32_t pos = photoIndex.findPrefix(folderIndex, datePrefix);
+    PhotoIndexEntry entry;
+    if (pos < 0 || !photoIndex.getEntry(folderIndex, pos, entry)) {
         return "";
     }
-
-    File file = dir.openNextFile();
-    while (file) {
-        String fileName = String(file.name());
-        if (fileName.startsWith(datePrefix) && fileName.endsWith(".jpg")) {
-            String fullPath = folderPath + "/" + fileName;
-            file.close();
-            dir.close();
-            return fullPath;
-        }
-        file = dir.openNextFile();
-    }
-    dir.close();
-    return "";
+    return "/" + folder + "/" + entry.name;
 }
 
 String SDHandler::listPhotos(int page, int perPage, int* totalPages) {
@@ -345,46 +655,16 @@ String SDHandler::listPhotosInFolder(String folder, int page, int perPage, int*
         return "";
     }
 
-    String folderPath = "/" + folder;
-    File dir = SD_MMC.open(folderPath);
-    if (!dir || !dir.isDirectory()) {
-        if (totalPages) *totalPages = 0;
-        return "";
-    }
-
-    // Recolectar archivos jpg (máximo 100 para no consumir mucha memoria)
-    String files[100];
-    int fileCount = 0;
-
-    File file = dir.openNextFile();
-    while (file && fileCount < 100) {
-        if (!file.isDirectory()) {
-            String fileName = String(file.name());
-            if (fileName.endsWith(".jpg") || fileName.endsWith(".JPG")) {
-                files[fileCount] = fileName;
-                fileCount++;
-            }
-        }
-        file = dir.openNextFile();
-    }
-    dir.close();
+    // El índice ya está ordenado (más antiguos primero por formato YYYY-MM-DD):
+    // solo se leen las fotos de la página pedida
+    PhotoCursor cursor;
+    int fileCount = cursor.open(photoIndex.findFolder(folder)) ? cursor.size() : 0;
 
     if (fileCount == 0) {
         if (totalPages) *totalPages = 0;
         return "";
     }
 
-    // Ordenar archivos alfabéticamente (más antiguos primero por formato YYYY-MM-DD)
-    for (int i = 0; i < fileCount - 1; i++) {
-        for (int j = i + 1; j < fileCount; j++) {
-            if (files[j] < files[i]) {
-                String temp = files[i];
-                files[i] = files[j];
-                files[j] = temp;
-            }
-        }
-    }
-
     // Calcular paginación
     int total = (fileCount + perPage - 1) / perPage;  // Redondear hacia arriba
     if (totalPages) *totalPages = total;
@@ -398,9 +678,11 @@ String SDHandler::listPhotosInFolder(String folder, int page, int perPage, int*
 
     // Construir lista formateada
     String result = "";
-    for (int i = startIndex; i < endIndex; i++) {
+    PhotoIndexEntry entry;
+    cursor.seek(startIndex);
+    for (int i = startIndex; i < endIndex && cursor.next(entry); i++) {
         int num = i + 1;  // Número de la foto (1-indexed)
-        String name = files[i];
+        String name = entry.name;
 
         // Extraer fecha del nombre: YYYY-MM-DD_HH-MM.jpg -> DD/MM/YYYY HH:MM
         if (name.length() >= 16) {
@@ -418,38 +700,6 @@ String SDHandler::listPhotosInFolder(String folder, int page, int perPage, int*
     return result;
 }
 
-// Recolecta fotos de una carpeta en un array (helper interno)
-static int collectPhotosFromFolder(String folderPath, String* files, int maxFiles) {
-    File dir = SD_MMC.open(folderPath);
-    if (!dir || !dir.isDirectory()) return 0;
-
-    int count = 0;
-    File file = dir.openNextFile();
-    while (file && count < maxFiles) {
-        if (!file.isDirectory()) {
-            String fileName = String(file.name());
-            if (fileName.endsWith(".jpg") || fileName.endsWith(".JPG")) {
-                files[count] = folderPath + "/" + fileName;
-                count++;
-            }
-        }
-        file = dir.openNextFile();
-    }
-    dir.close();
-
-    // Ordenar alfabéticamente ascendente (más antiguos primero)
-    for (int i = 0; i < count - 1; i++) {
-        for (int j = i + 1; j < count; j++) {
-            if (files[j] < files[i]) {
-                String temp = files[i];
-                files[i] = files[j];
-                files[j] = temp;
-            }
-        }
-    }
-    return count;
-}
-
 // Formatea nombre de archivo a fecha legible
 static String formatPhotoEntry(String fullPath, int num) {
     // Extraer solo el nombre del archivo
@@ -480,92 +730,14 @@ static String formatPhotoEntry(String fullPath, int num) {
     return String(num) + ". " + name;
 }
 
-// Prioridad de carpetas para ordenar en listado
-static int getFolderPriority(const String& name) {
-    if (name == DEFAULT_PHOTOS_FOLDER) return 0;   // fotos_diarias
-    if (name == TELEGRAM_PHOTOS_FOLDER) return 1;   // fotos_telegram
-    if (name == WEB_PHOTOS_FOLDER) return 2;         // fotos_web
-    return 3;  // Otras carpetas al final
-}
-
-// Estructura para info de carpeta (uso interno)
-struct FolderInfo {
-    String name;
-    int startIndex;
-    int count;
-};
-
-#define MAX_SD_FOLDERS 10
-#define MAX_TOTAL_PHOTOS 100
-
-// Recolecta todas las fotos de todas las carpetas en la SD
-static int collectAllPhotosFromSD(String* allPhotos, FolderInfo* folders, int* folderCount) {
-    *folderCount = 0;
-    int totalPhotos = 0;
-
-    // Recolectar nombres de directorios
-    String dirNames[MAX_SD_FOLDERS];
-    int dirCount = 0;
-
-    File root = SD_MMC.open("/");
-    if (!root || !root.isDirectory()) return 0;
-
-    File entry = root.openNextFile();
-    while (entry && dirCount < MAX_SD_FOLDERS) {
-        if (entry.isDirectory()) {
-            String name = String(entry.name());
-            if (name.startsWith("/")) name = name.substring(1);
-            if (!name.isEmpty() && !name.startsWith(".") && name != "System Volume Information") {
-                dirNames[dirCount] = name;
-                dirCount++;
-            }
-        }
-        entry = root.openNextFile();
-    }
-    root.close();
-
-    // Ordenar directorios por prioridad: fotos_diarias, fotos_telegram, fotos_web, resto alfabético
-    for (int i = 0; i < dirCount - 1; i++) {
-        for (int j = i + 1; j < dirCount; j++) {
-            int pi = getFolderPriority(dirNames[i]);
-            int pj = getFolderPriority(dirNames[j]);
-            if (pj < pi || (pj == pi && dirNames[j] < dirNames[i])) {
-                String temp = dirNames[i];
-                dirNames[i] = dirNames[j];
-                dirNames[j] = temp;
-            }
-        }
-    }
-
-    // Recolectar fotos de cada directorio
-    for (int d = 0; d < dirCount && totalPhotos < MAX_TOTAL_PHOTOS; d++) {
-        int maxForThis = MAX_TOTAL_PHOTOS - totalPhotos;
-        int collected = collectPhotosFromFolder("/" + dirNames[d], allPhotos + totalPhotos, maxForThis);
-
-        if (collected > 0) {
-            folders[*folderCount].name = dirNames[d];
-            folders[*folderCount].startIndex = totalPhotos;
-            folders[*folderCount].count = collected;
-            (*folderCount)++;
-            totalPhotos += collected;
-        }
-    }
-
-    return totalPhotos;
-}
-
 String SDHandler::listAllPhotosTree(int page, int perPage, int* totalPages) {
     if (!initialized) {
         if (totalPages) *totalPages = 0;
         return "";
     }
 
-    // Recolectar fotos de todas las carpetas de la SD
-    String allPhotos[MAX_TOTAL_PHOTOS];
-    FolderInfo folders[MAX_SD_FOLDERS];
-    int folderCount = 0;
-
-    int totalPhotos = collectAllPhotosFromSD(allPhotos, folders, &folderCount);
+    // Numeración global del índice: carpetas en orden de prioridad, fotos por nombre
+    int totalPhotos = photoIndex.getTotalCount();
 
     if (totalPhotos == 0) {
         if (totalPages) *totalPages = 0;
@@ -587,20 +759,25 @@ String SDHandler::listAllPhotosTree(int page, int perPage, int* totalPages) {
     String result = "";
 
     // Iterar carpetas en reversa para mostrar primero las que tienen fotos más recientes
-    for (int f = folderCount - 1; f >= 0; f--) {
-        int folderStart = folders[f].startIndex;
-        int folderEnd = folderStart + folders[f].count;
+    int folderStart = totalPhotos;
+    for (int f = photoIndex.getFolderCount() - 1; f >= 0; f--) {
+        int count = photoIndex.getPhotoCount(f);
+        folderStart -= count;
+        int folderEnd = folderStart + count;
 
-        // Saltar carpetas fuera del rango de la página actual
-        if (folderEnd <= startIndex || folderStart >= endIndex) continue;
+        // Saltar carpetas vacías o fuera del rango de la página actual
+        if (count == 0 || folderEnd <= startIndex || folderStart >= endIndex) continue;
 
-        // Encabezado de carpeta
-        result += "/" + folders[f].name + " (" + String(folders[f].count) + " fotos):\n";
+        PhotoCursor cursor;
+        if (!cursor.open(f)) continue;
+        String folderName = cursor.getFolderName();
+        result += "/" + folderName + " (" + String(count) + " fotos):\n";
 
         // Mostrar fotos en orden inverso (más reciente primero), manteniendo numeración original
-        for (int i = folderEnd - 1; i >= folderStart; i--) {
-            if (i >= startIndex && i < endIndex) {
-                result += formatPhotoEntry(allPhotos[i], i + 1) + "\n";  // 1-indexed
+        PhotoIndexEntry entry;
+        for (int i = min(folderEnd, endIndex) - 1; i >= max(folderStart, startIndex); i--) {
+            if (cursor.read(i - folderStart, entry)) {
+                result += formatPhotoEntry("/" + folderName + "/" + entry.name, i + 1) + "\n";  // 1-indexed
             }
         }
         result += "\n";
@@ -612,51 +789,20 @@ String SDHandler::listAllPhotosTree(int page, int perPage, int* totalPages) {
 String SDHandler::getPhotoPathByIndex(int index) {
     if (!initialized || index < 1) return "";
 
-    // Recolectar fotos de todas las carpetas (mismo orden que listAllPhotosTree)
-    String allPhotos[MAX_TOTAL_PHOTOS];
-    FolderInfo folders[MAX_SD_FOLDERS];
-    int folderCount = 0;
-
-    int totalPhotos = collectAllPhotosFromSD(allPhotos, folders, &folderCount);
-
-    if (index > totalPhotos) return "";
-    return allPhotos[index - 1];  // Convertir 1-indexed a 0-indexed
+    // Mismo orden que listAllPhotosTree: carpeta y posición sin recorrer la SD
+    int folder;
+    uint32_t folderIndex;
+    PhotoIndexEntry entry;
+    if (!photoIndex.locate(index - 1, folder, folderIndex) ||
+        !photoIndex.getEntry(folder, folderIndex, entry)) {
+        return "";
+    }
+    return "/" + photoIndex.getFolderName(folder) + "/" + entry.name;
 }
 
 int SDHandler::countAllPhotos() {
     if (!initialized) return 0;
-
-    int count = 0;
-
-    // Contar fotos en todas las carpetas de la SD
-    File root = SD_MMC.open("/");
-    if (!root || !root.isDirectory()) return 0;
-
-    File dirEntry = root.openNextFile();
-    while (dirEntry) {
-        if (dirEntry.isDirectory()) {
-            String dirName = String(dirEntry.name());
-            if (dirName.startsWith("/")) dirName = dirName.substring(1);
-            if (!dirName.isEmpty() && !dirName.startsWith(".") && dirName != "System Volume Information") {
-                File dir = SD_MMC.open("/" + dirName);
-                if (dir && dir.isDirectory()) {
-                    File f = dir.openNextFile();
-                    while (f) {
-                        if (!f.isDirectory()) {
-                            String name = String(f.name());
-                            if (name.endsWith(".jpg") || name.endsWith(".JPG")) count++;
-                        }
-                        f = dir.openNextFile();
-                    }
-                    dir.close();
-                }
-            }
-        }
-        dirEntry = root.openNextFile();
-    }
-    root.close();
-
-    return count;
+    return photoIndex.getTotalCount();
 }
 
 String SDHandler::getPhotosFolder() {
@@ -5,15 +5,33 @@
 #include "FS.h"
 #include "SD_MMC.h"
 
+// Resultado de /sdbench para un modo de escritura
+struct SdBenchResult {
+    int files;                  // Archivos escritos
+    size_t fileSize;
+    uint32_t totalMs;
+    float kbPerSec;             // Escritura secuencial (KB/s)
+    uint32_t p50Ms;             // Tiempo por archivo (abrir, escribir, cerrar)
+    uint32_t p99Ms;
+    uint32_t maxMs;
+};
+
 class SDHandler {
 public:
     SDHandler();
 
     bool init();
     bool savePhoto(const uint8_t* data, size_t size, String filename = "");
+    bool writePhotoFile(const uint8_t* data, size_t size, const String& filename);  // Solo archivo y miniatura (tarea de escritura)
+    void registerPhoto(const String& filename, size_t size);  // Añade al índice una foto ya escrita (solo desde loop())
+    bool writeFile(const String& path, const uint8_t* data, size_t size, bool buffered = true);  // Preasignado y por bloques alineados
+    size_t writeData(File& file, const uint8_t* data, size_t size);  // Añade datos con el buffer DMA (grabaciones)
+    bool benchmarkWrites(int files, size_t size, bool buffered, SdBenchResult& result);  // Para /sdbench
     bool deletePhoto(String filename);
     uint8_t* readPhoto(String filename, size_t& size);  // Lee foto de SD, caller debe liberar memoria con free()
     void freePhotoBuffer(uint8_t* buffer);              // Libera buffer de foto
+    String getThumbnailPath(String filename);           // /carpeta/foto.jpg -> /.thumbs/carpeta/foto.jpg
+    bool ensureThumbnail(String filename);              // Genera la miniatura si falta (fotos anteriores)
     String getLatestPhoto();
     String getDailyPhotoPath();
     bool photoExistsToday();
@@ -44,6 +62,7 @@ private:
     String getCurrentYearMonth();  // Para organizar por mes
     bool createDirectory(String path);
     void ensureMonthDirectory();   // Crea carpeta del mes actual si no existe
+    bool saveThumbnail(const uint8_t* data, size_t size, const String& filename);
 };
 
 extern SDHandler sdCard;
@@ -0,0 +1,228 @@
+#include "sd_writer.h"
+#include "sd_handler.h"
+#include "esp_heap_caps.h"
+
+SDWriter sdWriter;
+
+// Protege contadores, tickets y latencias compartidos con la tarea
+static portMUX_TYPE writerMux = portMUX_INITIALIZER_UNLOCKED;
+
+SDWriter::SDWriter()
+    : pending(nullptr), finished(nullptr), task(nullptr), nextTicket(1),
+      latencyCount(0), latencyNext(0), depth(0), maxDepth(0), queuedBytes(0),
+      written(0), failed(0), syncFallbacks(0) {
+    memset(results, 0, sizeof(results));
+    memset(latencies, 0, sizeof(latencies));
+}
+
+bool SDWriter::begin() {
+    pending = xQueueCreate(SD_WRITER_QUEUE_DEPTH, sizeof(WriteJob*));
+    // Una plaza más que la cola: la tarea nunca espera por una escritura en curso
+    finished = xQueueCreate(SD_WRITER_QUEUE_DEPTH + 1, sizeof(WriteJob*));
+    if (!pending || !finished ||
+        xTaskCreatePinnedToCore(taskEntry, "sd_write", SD_WRITER_STACK, this,
+                                SD_WRITER_PRIORITY, &task, SD_WRITER_CORE) != pdPASS) {
+        Serial.println("Error al crear tarea de escritura en SD");
+        task = nullptr;
+        return false;
+    }
+
+    Serial.println("Tarea de escritura en SD iniciada");
+    return true;
+}
+
+uint32_t SDWriter::savePhoto(const uint8_t* data, size_t size, const String& filename) {
+    if (!data || size == 0 || filename.isEmpty()) {
+        return 0;
+    }
+
+    uint32_t ticket = nextTicket++;
+    if (nextTicket == 0) nextTicket = 1;
+
+    // La copia sale de PSRAM: el framebuffer se devuelve al driver enseguida
+    bool accepted = false;
+    portENTER_CRITICAL(&writerMux);
+    if (task && depth < SD_WRITER_QUEUE_DEPTH && queuedBytes + size <= SD_WRITER_MAX_BYTES) {
+        depth++;
+        queuedBytes += size;
+        if (depth > maxDepth) maxDepth = depth;
+        accepted = true;
+    }
+    portEXIT_CRITICAL(&writerMux);
+
+    if (accepted) {
+        uint8_t* copy = (uint8_t*)heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        WriteJob* job = copy ? new WriteJob{ticket, copy, size, filename, false} : nullptr;
+        if (job) {
+            memcpy(copy, data, size);
+            setResult(ticket, SD_WRITE_PENDING);
+            if (xQueueSend(pending, &job, 0) == pdTRUE) {
+                return ticket;
+            }
+            delete job;
+        }
+        free(copy);
+
+        portENTER_CRITICAL(&writerMux);
+        depth--;
+        queuedBytes -= size;
+        portEXIT_CRITICAL(&writerMux);
+    }
+
+    // Escritura en el momento: cola llena, sin PSRAM libre o tarea sin iniciar
+    unsigned long start = millis();
+    bool ok = sdCard.savePhoto(data, size, filename);
+    uint32_t elapsed = millis() - start;
+
+    portENTER_CRITICAL(&writerMux);
+    syncFallbacks++;
+    portEXIT_CRITICAL(&writerMux);
+    recordLatency(elapsed);
+    setResult(ticket, ok ? SD_WRITE_DONE : SD_WRITE_FAILED);
+    if (task) {
+        Serial.printf("Cola de SD llena: %s escrita en el momento (%lu ms)\n",
+                      filename.c_str(), (unsigned long)elapsed);
+    }
+    return ok ? ticket : 0;
+}
+
+SdWriteState SDWriter::getState(uint32_t ticket) {
+    if (ticket == 0) {
+        return SD_WRITE_UNKNOWN;
+    }
+    TicketResult result;
+    portENTER_CRITICAL(&writerMux);
+    result = results[ticket % SD_WRITER_HISTORY];
+    portEXIT_CRITICAL(&writerMux);
+    return result.ticket == ticket ? result.state : SD_WRITE_UNKNOWN;
+}
+
+bool SDWriter::wait(uint32_t ticket, uint32_t timeoutMs) {
+    unsigned long start = millis();
+    SdWriteState state = getState(ticket);
+    while (state == SD_WRITE_PENDING && millis() - start < timeoutMs) {
+        vTaskDelay(pdMS_TO_TICKS(10));
+        state = getState(ticket);
+    }
+    return state == SD_WRITE_DONE;
+}
+
+void SDWriter::poll() {
+    if (!finished) {
+        return;
+    }
+    WriteJob* job;
+    while (xQueueReceive(finished, &job, 0) == pdTRUE) {
+        finish(job);
+    }
+}
+
+bool SDWriter::flush(uint32_t timeoutMs) {
+    unsigned long start = millis();
+    int remaining;
+    for (;;) {
+        portENTER_CRITICAL(&writerMux);
+        remaining = depth;
+        portEXIT_CRITICAL(&writerMux);
+        if (remaining == 0 || millis() - start >= timeoutMs) {
+            break;
+        }
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+    poll();
+    return remaining == 0;
+}
+
+void SDWriter::finish(WriteJob* job) {
+    // El índice solo se modifica desde loop()
+    if (job->ok) {
+        sdCard.registerPhoto(job->path, job->size);
+    }
+    delete job;
+}
+
+SdWriterStats SDWriter::getStats() {
+    SdWriterStats stats;
+    uint16_t sorted[SD_WRITER_LATENCY_SAMPLES];
+    int count;
+
+    portENTER_CRITICAL(&writerMux);
+    stats.depth = depth;
+    stats.maxDepth = maxDepth;
+    stats.queuedBytes = queuedBytes;
+    stats.written = written;
+    stats.failed = failed;
+    stats.syncFallbacks = syncFallbacks;
+    count = latencyCount;
+    memcpy(sorted, latencies, count * sizeof(uint16_t));
+    portEXIT_CRITICAL(&writerMux);
+
+    // Inserción: como mucho SD_WRITER_LATENCY_SAMPLES valores
+    for (int i = 1; i < count; i++) {
+        uint16_t value = sorted[i];
+        int j = i - 1;
+        while (j >= 0 && sorted[j] > value) {
+            sorted[j + 1] = sorted[j];
+            j--;
+        }
+        sorted[j + 1] = value;
+    }
+
+    if (count == 0) {
+        stats.p50Ms = stats.p95Ms = stats.p99Ms = stats.maxMs = 0;
+    } else {
+        stats.p50Ms = sorted[(count - 1) * 50 / 100];
+        stats.p95Ms = sorted[(count - 1) * 95 / 100];
+        stats.p99Ms = sorted[(count - 1) * 99 / 100];
+        stats.maxMs = sorted[count - 1];
+    }
+    return stats;
+}
+
+void SDWriter::taskEntry(void* arg) {
+    static_cast<SDWriter*>(arg)->run();
+}
+
+void SDWriter::run() {
+    for (;;) {
+        WriteJob* job;
+        if (xQueueReceive(pending, &job, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+
+        unsigned long start = millis();
+        job->ok = sdCard.writePhotoFile(job->data, job->size, job->path);
+        uint32_t elapsed = millis() - start;
+
+        free(job->data);
+        job->data = nullptr;
+
+        portENTER_CRITICAL(&writerMux);
+        depth--;
+        queuedBytes -= job->size;
+        if (job->ok) {
+            written++;
+        } else {
+            failed++;
+        }
+        portEXIT_CRITICAL(&writerMux);
+        recordLatency(elapsed);
+        setResult(job->ticket, job->ok ? SD_WRITE_DONE : SD_WRITE_FAILED);
+
+        xQueueSend(finished, &job, portMAX_DELAY);
+    }
+}
+
+void SDWriter::setResult(uint32_t ticket, SdWriteState state) {
+    portENTER_CRITICAL(&writerMux);
+    results[ticket % SD_WRITER_HISTORY] = { ticket, state };
+    portEXIT_CRITICAL(&writerMux);
+}
+
+void SDWriter::recordLatency(uint32_t ms) {
+    portENTER_CRITICAL(&writerMux);
+    latencies[latencyNext] = (uint16_t)min(ms, (uint32_t)UINT16_MAX);
+    latencyNext = (latencyNext + 1) % SD_WRITER_LATENCY_SAMPLES;
+    if (latencyCount < SD_WRITER_LATENCY_SAMPLES) latencyCount++;
+    portEXIT_CRITICAL(&writerMux);
+}
@@ -0,0 +1,100 @@
+#ifndef SD_WRITER_H
+#define SD_WRITER_H
+
+#include <Arduino.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "config.h"
+
+/*
+ * SDWriter - Escritura de fotos en la SD desde una tarea propia
+ *
+ * savePhoto() copia el JPEG a PSRAM, lo encola y retorna enseguida: el
+ * framebuffer vuelve al driver sin esperar a la SD. La tarea escribe la foto
+ * con SDHandler::writeFile() y genera su miniatura; después loop() (poll())
+ * la añade al índice, que solo se toca desde loop().
+ *
+ * Cada escritura tiene un ticket para consultar o esperar su resultado. Con
+ * la cola llena, sin memoria o con más de SD_WRITER_MAX_BYTES encolados se
+ * escribe en el momento, como antes.
+ */
+
+enum SdWriteState {
+    SD_WRITE_PENDING,
+    SD_WRITE_DONE,
+    SD_WRITE_FAILED,
+    SD_WRITE_UNKNOWN        // Ticket inválido o demasiado antiguo
+};
+
+struct SdWriterStats {
+    int depth;                      // Escrituras en cola o en curso
+    int maxDepth;
+    uint32_t queuedBytes;           // Bytes de las copias pendientes
+    uint32_t written;               // Escrituras terminadas en la tarea
+    uint32_t failed;
+    uint32_t syncFallbacks;         // Escritas en el momento (cola llena o sin memoria)
+    uint32_t p50Ms;                 // Tiempo de escritura (foto + miniatura)
+    uint32_t p95Ms;
+    uint32_t p99Ms;
+    uint32_t maxMs;
+};
+
+class SDWriter {
+public:
+    SDWriter();
+
+    bool begin();                   // Llamar tras sdCard.init()
+
+    // Encola una copia de la foto; retorna su ticket (0 = no se pudo guardar)
+    uint32_t savePhoto(const uint8_t* data, size_t size, const String& filename);
+
+    SdWriteState getState(uint32_t ticket);
+    bool wait(uint32_t ticket, uint32_t timeoutMs);   // true si quedó escrita
+
+    void poll();                    // En loop(): registra las fotos ya escritas
+    bool flush(uint32_t timeoutMs); // Espera a vaciar la cola y registra lo escrito (loop())
+
+    SdWriterStats getStats();
+
+private:
+    struct WriteJob {
+        uint32_t ticket;
+        uint8_t* data;
+        size_t size;
+        String path;
+        bool ok;
+    };
+
+    struct TicketResult {
+        uint32_t ticket;
+        SdWriteState state;
+    };
+
+    QueueHandle_t pending;          // WriteJob* hacia la tarea
+    QueueHandle_t finished;         // WriteJob* de vuelta a loop()
+    TaskHandle_t task;
+    uint32_t nextTicket;
+
+    TicketResult results[SD_WRITER_HISTORY];
+    uint16_t latencies[SD_WRITER_LATENCY_SAMPLES];
+    int latencyCount;
+    int latencyNext;
+
+    int depth;
+    int maxDepth;
+    size_t queuedBytes;
+    uint32_t written;
+    uint32_t failed;
+    uint32_t syncFallbacks;
+
+    static void taskEntry(void* arg);
+    void run();
+    void setResult(uint32_t ticket, SdWriteState state);
+    void recordLatency(uint32_t ms);
+    void finish(WriteJob* job);
+};
+
+extern SDWriter sdWriter;
+
+#endif // SD_WRITER_H
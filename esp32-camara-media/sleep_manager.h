@@ -56,7 +56,7 @@ public:
     unsigned long getIdleSeconds() const;
 
 private:
-    bool sleeping;
+    volatile bool sleeping;         // También lo lee la tarea de pre-roll
     unsigned long lastActivityTime;
     unsigned long inactivityTimeout;    // ms, 0 = auto-sleep desactivado
     unsigned long sleepPollInterval;    // intervalo de Telegram en sleep (ms)
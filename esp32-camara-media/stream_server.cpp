@@ -0,0 +1,386 @@
+#include "stream_server.h"
+#include "camera_handler.h"
+#include "frame_pipeline.h"
+#include <lwip/sockets.h>
+#include <errno.h>
+#include "esp_timer.h"
+
+StreamServer streamServer;
+
+static const char STREAM_TRAILER[] = "\r\n";
+
+// Cliente entregado por handleStream() a la tarea
+struct StreamRequest {
+    WiFiClient* client;
+    int fps;
+};
+
+StreamServer::StreamServer()
+    : task(nullptr), pendingClients(nullptr), activeClients(0),
+      latest(nullptr), nextSeq(0), lastSourceSeq(0), holdingFlash(false),
+      lastCaptureUs(0), avgIntervalUs(0), avgJitterUs(0), lateFrames(0) {
+    for (int i = 0; i < MAX_STREAM_CLIENTS; i++) {
+        clients[i].client = nullptr;
+        clients[i].frame = nullptr;
+    }
+    for (int i = 0; i < STREAM_FRAME_SLOTS; i++) {
+        frames[i].fb = nullptr;
+        frames[i].seq = 0;
+        frames[i].refs = 0;
+    }
+}
+
+bool StreamServer::begin() {
+    pendingClients = xQueueCreate(MAX_STREAM_CLIENTS, sizeof(StreamRequest));
+    if (!pendingClients) {
+        Serial.println("Error al crear cola de clientes de stream");
+        return false;
+    }
+
+    BaseType_t ok = xTaskCreatePinnedToCore(taskEntry, "stream", STREAM_TASK_STACK, this,
+                                            STREAM_TASK_PRIORITY, &task, STREAM_TASK_CORE);
+    if (ok != pdPASS) {
+        Serial.println("Error al crear tarea de streaming");
+        return false;
+    }
+
+    Serial.println("Tarea de streaming iniciada");
+    return true;
+}
+
+bool StreamServer::addClient(const WiFiClient& client, int fps) {
+    if (!pendingClients) {
+        return false;
+    }
+
+    StreamRequest req;
+    req.client = new WiFiClient(client);
+    req.fps = (fps > 0) ? constrain(fps, 1, STREAM_MAX_FPS) : 0;
+    if (xQueueSend(pendingClients, &req, 0) != pdTRUE) {
+        delete req.client;
+        return false;
+    }
+    return true;
+}
+
+bool StreamServer::isStreaming() const {
+    return activeClients > 0 || (pendingClients && uxQueueMessagesWaiting(pendingClients) > 0);
+}
+
+int StreamServer::getClientCount() const {
+    return activeClients;
+}
+
+StreamStats StreamServer::getStats() const {
+    StreamStats stats;
+    stats.clients = activeClients;
+    stats.targetFps = (int)(1000000LL / minIntervalUs());
+    stats.actualFps = (activeClients > 0 && avgIntervalUs > 0) ? 1000000.0f / avgIntervalUs : 0;
+    stats.jitterMs = (activeClients > 0) ? avgJitterUs / 1000.0f : 0;
+    stats.lateFrames = lateFrames;
+    return stats;
+}
+
+int64_t StreamServer::clientIntervalUs(const StreamClient& c) const {
+    int fps = c.fps > 0 ? c.fps : camera.getSettings().streamFps;
+    return 1000000LL / constrain(fps, 1, STREAM_MAX_FPS);
+}
+
+int64_t StreamServer::minIntervalUs() const {
+    int64_t best = 0;
+    for (int i = 0; i < MAX_STREAM_CLIENTS; i++) {
+        if (!clients[i].client) continue;
+        int64_t interval = clientIntervalUs(clients[i]);
+        if (best == 0 || interval < best) best = interval;
+    }
+    if (best == 0) {
+        best = 1000000LL / constrain(camera.getSettings().streamFps, 1, STREAM_MAX_FPS);
+    }
+    return best;
+}
+
+void StreamServer::taskEntry(void* arg) {
+    static_cast<StreamServer*>(arg)->run();
+}
+
+void StreamServer::run() {
+    for (;;) {
+        // Sin clientes la tarea duerme hasta que handleStream() entregue uno
+        StreamRequest incoming;
+        TickType_t wait = (activeClients == 0) ? portMAX_DELAY : 0;
+        while (xQueueReceive(pendingClients, &incoming, wait) == pdTRUE) {
+            acceptClient(incoming.client, incoming.fps);
+            wait = 0;
+        }
+        if (activeClients == 0) {
+            continue;
+        }
+
+        if (needsNewFrame(esp_timer_get_time())) {
+            if (!captureFrame()) {
+                Serial.println("Error en stream: captura fallida");
+                for (int i = 0; i < MAX_STREAM_CLIENTS; i++) {
+                    if (clients[i].client) dropClient(clients[i]);
+                }
+            }
+        }
+
+        assignFrames();
+
+        bool progress = false;
+        for (int i = 0; i < MAX_STREAM_CLIENTS; i++) {
+            if (clients[i].client && pumpClient(clients[i])) {
+                progress = true;
+            }
+        }
+
+        releaseIdleFrames();
+
+        if (activeClients == 0) {
+            // Soltar el flash LED al terminar el stream
+            if (holdingFlash) {
+                camera.releaseFlashLed();
+                holdingFlash = false;
+            }
+            if (framePipeline.isEnabled()) framePipeline.removeConsumer();
+            lastCaptureUs = 0;
+            Serial.println("Stream finalizado");
+        } else if (!progress) {
+            vTaskDelay(1);  // Todos los sockets llenos o esperando su deadline
+        }
+    }
+}
+
+void StreamServer::acceptClient(WiFiClient* client, int fps) {
+    StreamClient* slot = nullptr;
+    for (int i = 0; i < MAX_STREAM_CLIENTS; i++) {
+        if (!clients[i].client) {
+            slot = &clients[i];
+            break;
+        }
+    }
+
+    if (!slot) {
+        client->print("HTTP/1.1 503 Service Unavailable\r\n"
+                      "Content-Type: text/plain\r\n\r\n"
+                      "Maximo de clientes de stream alcanzado");
+        client->stop();
+        delete client;
+        return;
+    }
+
+    client->print("HTTP/1.1 200 OK\r\n"
+                  "Content-Type: multipart/x-mixed-replace; boundary=frame\r\n\r\n");
+
+    slot->client = client;
+    slot->frame = nullptr;
+    slot->sent = 0;
+    // Un cliente nuevo puede tomar el último frame si todavía está retenido
+    slot->lastSeq = latest ? latest->seq - 1 : nextSeq;
+    slot->fps = fps;
+    slot->nextDueUs = esp_timer_get_time();
+    slot->framesSent = 0;
+    slot->framesDropped = 0;
+    slot->lastProgress = millis();
+    activeClients++;
+
+    // Encender flash al inicio del stream si está habilitado
+    if (activeClients == 1) {
+        if (camera.getSettings().flashEnabled) {
+            camera.holdFlashLed();
+            holdingFlash = true;
+        }
+        // Ignorar el frame que el pipeline retuvo mientras estaba ocioso
+        if (framePipeline.isEnabled()) {
+            lastSourceSeq = framePipeline.getCapturedCount();
+            framePipeline.addConsumer();
+        }
+    }
+
+    Serial.printf("Cliente de stream conectado (%d/%d, %d FPS)\n", activeClients, MAX_STREAM_CLIENTS,
+                  (int)(1000000LL / clientIntervalUs(*slot)));
+}
+
+void StreamServer::dropClient(StreamClient& c) {
+    if (c.frame) {
+        c.frame->refs--;
+        c.frame = nullptr;
+    }
+    c.client->stop();
+    delete c.client;
+    c.client = nullptr;
+    activeClients--;
+
+    Serial.printf("Cliente de stream desconectado (enviados: %u, descartados: %u)\n",
+                  c.framesSent, c.framesDropped);
+}
+
+bool StreamServer::needsNewFrame(int64_t now) const {
+    // Hace falta capturar si algún cliente ocioso llegó a su deadline
+    // y ya envió el último frame
+    bool waiting = false;
+    for (int i = 0; i < MAX_STREAM_CLIENTS; i++) {
+        const StreamClient& c = clients[i];
+        if (c.client && !c.frame && now >= c.nextDueUs &&
+            (!latest || c.lastSeq >= latest->seq)) {
+            waiting = true;
+            break;
+        }
+    }
+    if (!waiting) return false;
+
+    // ...y queda un slot libre (los demás los retienen clientes lentos)
+    for (int i = 0; i < STREAM_FRAME_SLOTS; i++) {
+        if (frames[i].seq == 0) return true;
+    }
+    return false;
+}
+
+bool StreamServer::captureFrame() {
+    StreamFrame* slot = nullptr;
+    for (int i = 0; i < STREAM_FRAME_SLOTS; i++) {
+        if (frames[i].seq == 0) {
+            slot = &frames[i];
+            break;
+        }
+    }
+    if (!slot) return true;
+
+    camera_fb_t* fb = nullptr;
+    if (framePipeline.isEnabled()) {
+        // Tomar el frame ya capturado por la tarea del pipeline; mientras se
+        // envía, el driver ya está llenando el siguiente buffer
+        PipelineFrame* source = framePipeline.acquireNewer(lastSourceSeq);
+        if (!source) return !framePipeline.hasFailed();
+        lastSourceSeq = source->seq;
+        fb = source->fb;
+    } else {
+        // Capturar sin activar flash (ya está encendido si corresponde)
+        fb = camera.capturePhoto(false);
+        if (!fb) return false;
+    }
+
+    // FPS logrado y jitter: medias móviles del intervalo entre capturas
+    int64_t now = esp_timer_get_time();
+    if (lastCaptureUs > 0) {
+        float interval = (float)(now - lastCaptureUs);
+        float deviation = fabsf(interval - (float)minIntervalUs());
+        if (avgIntervalUs == 0) {
+            avgIntervalUs = interval;
+            avgJitterUs = deviation;
+        } else {
+            avgIntervalUs += (interval - avgIntervalUs) * 0.1f;
+            avgJitterUs += (deviation - avgJitterUs) * 0.1f;
+        }
+    } else {
+        avgIntervalUs = 0;
+        avgJitterUs = 0;
+    }
+    lastCaptureUs = now;
+
+    slot->fb = fb;
+    slot->seq = ++nextSeq;
+    slot->refs = 0;
+    slot->headerLen = snprintf(slot->header, sizeof(slot->header),
+                               "--frame\r\nContent-Type: image/jpeg\r\nContent-Length: %u\r\n\r\n",
+                               (unsigned)fb->len);
+    latest = slot;
+    return true;
+}
+
+void StreamServer::assignFrames() {
+    if (!latest) return;
+
+    int64_t now = esp_timer_get_time();
+    for (int i = 0; i < MAX_STREAM_CLIENTS; i++) {
+        StreamClient& c = clients[i];
+        if (!c.client || c.frame || c.lastSeq >= latest->seq || now < c.nextDueUs) continue;
+
+        // Política de descarte: el cliente salta directo al frame más reciente
+        c.framesDropped += latest->seq - c.lastSeq - 1;
+        c.frame = latest;
+        c.sent = 0;
+        latest->refs++;
+
+        // Próximo deadline; si va tarde más de un intervalo se saltan los
+        // frames perdidos en vez de acumular una ráfaga
+        int64_t interval = clientIntervalUs(c);
+        c.nextDueUs += interval;
+        if (c.nextDueUs < now) {
+            lateFrames += (uint32_t)((now - c.nextDueUs) / interval) + 1;
+            c.nextDueUs = now + interval;
+        }
+    }
+}
+
+bool StreamServer::pumpClient(StreamClient& c) {
+    if (!c.frame) {
+        if (!c.client->connected()) {
+            dropClient(c);
+        }
+        return false;
+    }
+
+    StreamFrame* f = c.frame;
+    const uint8_t* segPtr[3] = { (const uint8_t*)f->header, f->fb->buf, (const uint8_t*)STREAM_TRAILER };
+    const size_t segLen[3] = { f->headerLen, f->fb->len, sizeof(STREAM_TRAILER) - 1 };
+    size_t total = segLen[0] + segLen[1] + segLen[2];
+
+    // Armar el vector de escritura desde el cursor: cabecera, JPEG y cierre
+    // salen en un solo sendmsg() de hasta STREAM_SEND_CHUNK bytes
+    struct iovec iov[3];
+    int iovCount = 0;
+    size_t offset = c.sent;
+    size_t budget = STREAM_SEND_CHUNK;
+    for (int i = 0; i < 3 && budget > 0; i++) {
+        if (offset >= segLen[i]) {
+            offset -= segLen[i];
+            continue;
+        }
+        size_t len = min(segLen[i] - offset, budget);
+        iov[iovCount].iov_base = (void*)(segPtr[i] + offset);
+        iov[iovCount].iov_len = len;
+        iovCount++;
+        budget -= len;
+        offset = 0;
+    }
+
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = iov;
+    msg.msg_iovlen = iovCount;
+
+    int n = sendmsg(c.client->fd(), &msg, MSG_DONTWAIT);
+    if (n < 0) {
+        if (errno != EAGAIN && errno != EWOULDBLOCK) {
+            dropClient(c);
+        } else if (millis() - c.lastProgress > STREAM_CLIENT_STALL_TIMEOUT) {
+            Serial.println("Cliente de stream sin progreso, desconectando");
+            dropClient(c);
+        }
+        return false;
+    }
+
+    c.sent += n;
+    c.lastProgress = millis();
+    if (c.sent >= total) {
+        f->refs--;
+        c.lastSeq = f->seq;
+        c.frame = nullptr;
+        c.framesSent++;
+    }
+    return n > 0;
+}
+
+void StreamServer::releaseIdleFrames() {
+    // Devolver al driver los frames que ya nadie está enviando
+    for (int i = 0; i < STREAM_FRAME_SLOTS; i++) {
+        StreamFrame& f = frames[i];
+        if (f.seq == 0 || f.refs > 0) continue;
+
+        camera.releaseFrame(f.fb);
+        f.fb = nullptr;
+        f.seq = 0;
+        if (latest == &f) latest = nullptr;
+    }
+}
@@ -0,0 +1,129 @@
+#ifndef STREAM_SERVER_H
+#define STREAM_SERVER_H
+
+#include <Arduino.h>
+#include <WiFiClient.h>
+#include "esp_camera.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "config.h"
+
+/*
+ * StreamServer - Streaming MJPEG en una tarea FreeRTOS dedicada
+ *
+ * handleStream() del servidor web solo entrega el socket del cliente a esta
+ * tarea y retorna de inmediato, así loop() sigue atendiendo Telegram, la foto
+ * diaria, NTP y el chequeo de salud mientras alguien ve el stream.
+ *
+ * Difusión a varios clientes:
+ *   - Cada frame se captura UNA vez y se envía a todos los clientes suscritos.
+ *   - Cada cliente tiene su propio cursor de envío (escrituras no bloqueantes),
+ *     así un cliente lento no frena a los demás.
+ *   - Un cliente que se queda atrás termina su frame actual y salta al más
+ *     reciente; los frames intermedios se cuentan como descartados.
+ *
+ * Ritmo de frames:
+ *   - Cada cliente tiene un FPS objetivo (?fps=N o el guardado en CameraSettings)
+ *     y un deadline monotónico (esp_timer) para su próximo frame.
+ *   - Solo se captura cuando algún cliente está listo y en plazo, así el costo
+ *     de captura sigue al cliente más rápido y no a un delay() fijo.
+ *   - Si un cliente va tarde más de un intervalo, se saltan los frames perdidos
+ *     en lugar de intentar recuperarlos en ráfaga.
+ *
+ * Envío sin copias: la cabecera multipart de cada frame se formatea una vez en
+ * un buffer fijo (sin String) y cabecera + JPEG + cierre se envían juntos con
+ * sendmsg() (scatter/gather) en bloques de tamaño MSS, en vez de tres
+ * escrituras pequeñas por frame.
+ *
+ * Con el pipeline de captura habilitado los frames salen de FramePipeline (ya
+ * capturados en segundo plano) en lugar de capturarse aquí en frío.
+ *
+ * El WiFiClient se copia (comparte el socket por conteo de referencias), por lo
+ * que la conexión sigue abierta aunque WebServer descarte su propia copia.
+ */
+
+// "--frame\r\nContent-Type: image/jpeg\r\nContent-Length: NNNNNNNNNN\r\n\r\n"
+#define STREAM_HEADER_MAX 80
+
+// Frame compartido entre clientes (conteo de referencias)
+struct StreamFrame {
+    camera_fb_t* fb;
+    char header[STREAM_HEADER_MAX];  // Cabecera multipart preformateada
+    size_t headerLen;
+    uint32_t seq;       // Número de secuencia (0 = slot libre)
+    int refs;           // Clientes que aún lo están enviando
+};
+
+// Estado de envío de cada cliente suscrito
+struct StreamClient {
+    WiFiClient* client;         // nullptr = slot libre
+    StreamFrame* frame;         // Frame en curso (nullptr = esperando uno nuevo)
+    size_t sent;                // Cursor dentro de cabecera + JPEG + cierre
+    uint32_t lastSeq;           // Último frame enviado completo
+    int fps;                    // FPS pedido (0 = usar CameraSettings.streamFps)
+    int64_t nextDueUs;          // Deadline del próximo frame (esp_timer_get_time)
+    uint32_t framesSent;
+    uint32_t framesDropped;
+    unsigned long lastProgress; // millis() del último byte enviado
+};
+
+// Métricas del stream expuestas en /status
+struct StreamStats {
+    int clients;
+    int targetFps;          // FPS del cliente más exigente
+    float actualFps;        // FPS de captura logrado (media móvil)
+    float jitterMs;         // Desvío medio respecto del intervalo objetivo
+    uint32_t lateFrames;    // Frames saltados por ir tarde
+};
+
+class StreamServer {
+public:
+    StreamServer();
+
+    // Crear la tarea de streaming (llamar una vez desde setup)
+    bool begin();
+
+    // Entregar un cliente a la tarea. fps = 0 usa el FPS de la configuración.
+    // Retorna false si la cola de entrada está llena.
+    bool addClient(const WiFiClient& client, int fps = 0);
+
+    bool isStreaming() const;
+    int getClientCount() const;
+    StreamStats getStats() const;
+
+private:
+    TaskHandle_t task;
+    QueueHandle_t pendingClients;   // StreamRequest entregados por handleStream()
+    volatile int activeClients;
+
+    StreamClient clients[MAX_STREAM_CLIENTS];
+    StreamFrame frames[STREAM_FRAME_SLOTS];
+    StreamFrame* latest;            // Último frame capturado
+    uint32_t nextSeq;
+    uint32_t lastSourceSeq;         // Último frame tomado del pipeline
+    bool holdingFlash;              // El stream mantiene encendido el LED
+
+    // Medición de FPS logrado y jitter
+    int64_t lastCaptureUs;
+    float avgIntervalUs;
+    float avgJitterUs;
+    uint32_t lateFrames;
+
+    static void taskEntry(void* arg);
+    void run();
+
+    void acceptClient(WiFiClient* client, int fps);
+    void dropClient(StreamClient& c);
+    bool captureFrame();
+    void assignFrames();
+    bool pumpClient(StreamClient& c);
+    void releaseIdleFrames();
+    bool needsNewFrame(int64_t now) const;
+    int64_t clientIntervalUs(const StreamClient& c) const;
+    int64_t minIntervalUs() const;
+};
+
+extern StreamServer streamServer;
+
+#endif // STREAM_SERVER_H
@@ -4,6 +4,9 @@
 #include "config.h"
 #include "credentials_manager.h"
 #include "sleep_manager.h"
+#include "metrics.h"
+#include "sd_writer.h"
+#include "video_recorder.h"
 #include <WiFi.h>
 #include <Preferences.h>
 
@@ -53,8 +56,12 @@ static String formatPhotoCaption(int photoId, String photoPath, size_t photoSize
 }
 
 TelegramBot::TelegramBot()
-    : bot(nullptr), lastCheckTime(0), checkInterval(TELEGRAM_CHECK_INTERVAL), authorizedCount(0),
+    : checkInterval(TELEGRAM_CHECK_INTERVAL), nextUpdateId(0), inbox(nullptr), pollTask(nullptr),
+      pollReset(false), pollRequests(0), outBot(nullptr), outbox(nullptr), outboxTask(nullptr),
+      outboxActive(0), outboxReset(false), authorizedCount(0),
       tempAuthMode(false), tempAuthExpiry(0) {
+    memset(&uploadStats, 0, sizeof(uploadStats));
+    memset(&outboxStats, 0, sizeof(outboxStats));
     // Valores por defecto
     dailyConfig.hour = DAILY_PHOTO_HOUR;
     dailyConfig.minute = DAILY_PHOTO_MINUTE;
@@ -72,13 +79,29 @@ void TelegramBot::init() {
     client.setInsecure();  // No verificar certificado SSL
     client.setTimeout(10); // 10 segundos timeout para llamadas API de Telegram
 
-    bot = new UniversalTelegramBot(credentialsManager.getBotToken(), client);
-    bot->longPoll = 0;
+    // Cola de salida con su propia conexión: los envíos no bloquean loop()
+    outClient.setInsecure();
+    outClient.setTimeout(20);
+    outBot = new UniversalTelegramBot(credentialsManager.getBotToken(), outClient);
+    outbox = xQueueCreate(TELEGRAM_OUTBOX_DEPTH, sizeof(OutboxJob*));
+    if (!outbox || xTaskCreatePinnedToCore(outboxTaskEntry, "tg_out", TELEGRAM_OUTBOX_STACK, this,
+                                           TELEGRAM_OUTBOX_PRIORITY, &outboxTask,
+                                           TELEGRAM_OUTBOX_CORE) != pdPASS) {
+        Serial.println("Error al crear cola de salida de Telegram");
+    }
 
     // Cargar configuración guardada
     loadDailyPhotoConfig();
     loadAuthorizedIds();
 
+    // Recepción por long polling en su propia tarea
+    inbox = xQueueCreate(TELEGRAM_INBOX_DEPTH, sizeof(TelegramUpdate));
+    if (!inbox || xTaskCreatePinnedToCore(pollTaskEntry, "tg_poll", TELEGRAM_POLL_STACK, this,
+                                          TELEGRAM_POLL_PRIORITY, &pollTask,
+                                          TELEGRAM_POLL_CORE) != pdPASS) {
+        Serial.println("Error al crear tarea de polling de Telegram");
+    }
+
     Serial.println("Bot de Telegram inicializado");
     Serial.printf("Foto diaria: %s - %02d:%02d (Flash: %s)\n",
                   dailyConfig.enabled ? "ACTIVA" : "INACTIVA",
@@ -106,17 +129,13 @@ void TelegramBot::init() {
 }
 
 void TelegramBot::reinitBot() {
-    // Cerrar conexion SSL anterior y reconfigurar
-    client.stop();
-    client.setInsecure();
-    client.setTimeout(10);
+    // Cada tarea cierra su conexión SSL anterior antes de la próxima petición
+    pollReset = true;
+    outboxReset = true;
     Serial.println("Bot de Telegram reinicializado tras reconexion WiFi");
 }
 
 void TelegramBot::handleMessages() {
-    // No intentar si WiFi no esta conectado
-    if (WiFi.status() != WL_CONNECTED) return;
-
     // Verificar expiración del modo de autorización temporal
     if (tempAuthMode && tempAuthExpiry > 0 && millis() >= tempAuthExpiry) {
         tempAuthMode = false;
@@ -124,29 +143,206 @@ void TelegramBot::handleMessages() {
         sendMessage("⏰ Modo de autorización temporal expirado. Ya no se autorizan nuevos usuarios.");
     }
 
-    if (millis() - lastCheckTime > checkInterval) {
-        int numNewMessages = bot->getUpdates(bot->last_message_received + 1);
+    // Procesar los mensajes que entregó la tarea de polling (sin esperar red).
+    // Limitado por pasada para no demorar el resto del loop.
+    static TelegramUpdate msg;  // Fuera del stack de loop()
+    int processed = 0;
+    while (inbox && processed < TELEGRAM_MESSAGES_PER_LOOP && xQueueReceive(inbox, &msg, 0) == pdTRUE) {
+        processMessage(msg);
+        processed++;
+    }
 
-        // Limitar a 3 lotes para no bloquear el loop principal demasiado tiempo
-        int batches = 0;
-        while (numNewMessages && batches < 3) {
-            for (int i = 0; i < numNewMessages; i++) {
-                processMessage(bot->messages[i]);
+    // Avisar a quien pidió la grabación cuando la tarea cierra el archivo
+    RecorderStatus rec;
+    if (!recordChatId.isEmpty() && videoRecorder.takeFinished(rec)) {
+        if (rec.failed) {
+            reply(recordChatId, "❌ Error en la grabacion, no se guardo el video");
+        } else {
+            String url = "http://" + WiFi.localIP().toString() + "/recording?name=" + String(rec.name);
+            String preroll = rec.prerollMs > 0 ? " (" + String(rec.prerollMs / 1000.0, 1) + " s antes de /grabar)" : "";
+            reply(recordChatId, "🎬 Grabacion terminada: " + String(rec.name) + "\n⏱️ " +
+                                String(rec.durationMs / 1000.0, 1) + " s" + preroll + ", " + String(rec.frames) +
+                                " frames\n⚖️ " + String(rec.bytes / 1024.0 / 1024.0, 1) + " MB\n⬇️ " + url);
+        }
+        recordChatId = "";
+    }
+}
+
+void TelegramBot::pollTaskEntry(void* arg) {
+    static_cast<TelegramBot*>(arg)->runPoller();
+}
+
+// Long polling: Telegram retiene cada getUpdates hasta TELEGRAM_LONG_POLL s
+// y responde en cuanto llega un mensaje, así los comandos llegan al instante
+// y sin mensajes hay una petición cada ~25 s en vez de una por segundo.
+// En modo sleep se espera además checkInterval entre consultas.
+void TelegramBot::runPoller() {
+    for (;;) {
+        if (WiFi.status() != WL_CONNECTED) {
+            vTaskDelay(pdMS_TO_TICKS(1000));
+            continue;
+        }
+        unsigned long start = millis();
+        int numNewUpdates = fetchUpdates();
+        pollRequests++;
+
+        for (int i = 0; i < numNewUpdates; i++) {
+            // Si loop() va atrasado la cola se llena y no se piden más updates
+            const TelegramUpdate& update = updateParser.get(i);
+            if (update.hasMessage) {
+                xQueueSend(inbox, &update, portMAX_DELAY);
             }
-            numNewMessages = bot->getUpdates(bot->last_message_received + 1);
-            batches++;
+        }
+        if (numNewUpdates > 0) {
+            nextUpdateId = updateParser.getNextOffset(nextUpdateId);
+            continue;  // Puede haber más mensajes pendientes
         }
 
-        lastCheckTime = millis();
+        if (checkInterval > TELEGRAM_CHECK_INTERVAL) {
+            vTaskDelay(pdMS_TO_TICKS(checkInterval));
+        } else if (millis() - start < TELEGRAM_CHECK_INTERVAL) {
+            // getUpdates retornó antes del long poll (error de red o HTTP)
+            vTaskDelay(pdMS_TO_TICKS(TELEGRAM_CHECK_INTERVAL));
+        }
     }
 }
 
-void TelegramBot::processMessage(telegramMessage& msg) {
-    String chatId = String(msg.chat_id);
-    String text = msg.text;
-    String fromUser = msg.from_name;
+static uint8_t pollBuffer[TELEGRAM_POLL_CHUNK];
+
+// getUpdates propio sobre la conexión keep-alive de la tarea de polling.
+// A diferencia de UniversalTelegramBot::getUpdates, el cuerpo no se junta en
+// un String ni se parsea con un DynamicJsonDocument: se lee por bloques de
+// TELEGRAM_POLL_CHUNK y se vuelca a updateParser, que guarda cada update en
+// un slot fijo. Una ráfaga de mensajes o un texto de 4096 caracteres usan la
+// misma memoria que una respuesta vacía.
+// Retorna la cantidad de updates en updateParser, o -1 si falló.
+int TelegramBot::fetchUpdates() {
+    if (pollReset) {
+        client.stop();
+        pollReset = false;
+    }
+    if (!client.connected()) {
+        if (!client.connect("api.telegram.org", 443)) {
+            Serial.println("Error conectando a api.telegram.org (polling)");
+            return -1;
+        }
+    }
+
+    char query[160];
+    snprintf(query, sizeof(query),
+             "/getUpdates?offset=%lld&limit=%d&timeout=%d"
+             "&allowed_updates=%%5B%%22message%%22%%2C%%22edited_message%%22%%5D",
+             (long long)nextUpdateId, TELEGRAM_UPDATE_SLOTS, TELEGRAM_LONG_POLL);
+    client.print("GET /bot" + credentialsManager.getBotToken() + query + " HTTP/1.1\r\n"
+                 "Host: api.telegram.org\r\n"
+                 "Connection: keep-alive\r\n\r\n");
+
+    // Telegram retiene la respuesta hasta TELEGRAM_LONG_POLL s si no hay mensajes
+    unsigned long deadline = millis() + TELEGRAM_LONG_POLL * 1000UL + TELEGRAM_RESPONSE_TIMEOUT;
+    while (!client.available() && (long)(deadline - millis()) > 0) {
+        if (!client.connected() || pollReset) {
+            client.stop();
+            return -1;
+        }
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+    if (!client.available()) {
+        Serial.println("Telegram: getUpdates sin respuesta");
+        client.stop();
+        return -1;
+    }
+
+    String status = client.readStringUntil('\n');
+    int httpCode = status.startsWith("HTTP/1.") ? status.substring(9, 12).toInt() : 0;
+    if (httpCode == 0) {
+        client.stop();
+        return -1;
+    }
+
+    long contentLength = -1;
+    bool chunked = false;
+    bool keepAlive = true;
+    for (;;) {
+        String line = client.readStringUntil('\n');
+        line.trim();
+        if (line.isEmpty()) break;
+        line.toLowerCase();
+        if (line.startsWith("content-length:")) {
+            contentLength = line.substring(15).toInt();
+        } else if (line.startsWith("transfer-encoding:") && line.indexOf("chunked") > 0) {
+            chunked = true;
+        } else if (line.startsWith("connection:") && line.indexOf("close") > 0) {
+            keepAlive = false;
+        }
+    }
+
+    updateParser.begin();
+    bool complete = readUpdatesBody(contentLength, chunked, deadline);
+    if (!complete || (contentLength < 0 && !chunked) || !keepAlive) {
+        client.stop();  // Cuerpo sin terminar o hasta el cierre: no se reutiliza
+    }
 
-    Serial.printf("Mensaje de %s (ID: %s): %s\n", fromUser.c_str(), chatId.c_str(), text.c_str());
+    if (httpCode != 200 || !updateParser.finish()) {
+        Serial.printf("Telegram: getUpdates fallo (HTTP %d)\n", httpCode);
+        return -1;
+    }
+    return updateParser.getCount();
+}
+
+// Consume el cuerpo completo (Content-Length, chunked o hasta el cierre)
+// para dejar la conexión alineada con la próxima respuesta
+bool TelegramBot::readUpdatesBody(long contentLength, bool chunked, unsigned long deadline) {
+    if (!chunked) {
+        if (contentLength < 0) return feedUpdates(0, true, deadline);
+        return feedUpdates(contentLength, false, deadline);
+    }
+
+    for (;;) {
+        String sizeLine = client.readStringUntil('\n');
+        sizeLine.trim();
+        if (sizeLine.isEmpty()) return false;
+        long chunkSize = strtol(sizeLine.c_str(), nullptr, 16);
+        if (chunkSize <= 0) {
+            // Último chunk: descartar trailers hasta la línea vacía
+            for (;;) {
+                String trailer = client.readStringUntil('\n');
+                trailer.trim();
+                if (trailer.isEmpty()) return true;
+            }
+        }
+        if (!feedUpdates(chunkSize, false, deadline)) return false;
+        client.readStringUntil('\n');  // CRLF tras los datos del chunk
+    }
+}
+
+// Lee length bytes (o hasta el cierre) y los pasa al parser por bloques.
+// Si el JSON es inválido se sigue leyendo: la conexión queda reutilizable.
+bool TelegramBot::feedUpdates(size_t length, bool untilClose, unsigned long deadline) {
+    while (untilClose || length > 0) {
+        if ((long)(deadline - millis()) <= 0) return false;
+        int avail = client.available();
+        if (avail <= 0) {
+            if (!client.connected()) return untilClose;
+            vTaskDelay(pdMS_TO_TICKS(2));
+            continue;
+        }
+        size_t want = min((size_t)avail, sizeof(pollBuffer));
+        if (!untilClose) want = min(want, length);
+        int n = client.read(pollBuffer, want);
+        if (n <= 0) continue;
+        updateParser.feed(pollBuffer, n);
+        if (!untilClose) length -= n;
+    }
+    return true;
+}
+
+void TelegramBot::processMessage(const TelegramUpdate& msg) {
+    String chatId = String(msg.chatId);
+    String text = String(msg.text);
+    String fromUser = String(msg.fromName);
+
+    Serial.printf("Mensaje de %s (ID: %s): %s%s\n", fromUser.c_str(), chatId.c_str(), text.c_str(),
+                  msg.truncated ? " [truncado]" : "");
 
     // Si no hay usuarios autorizados, el primero que escriba se convierte en admin
     if (authorizedCount == 0) {
@@ -159,7 +355,7 @@ void TelegramBot::processMessage(telegramMessage& msg) {
         welcomeMsg += "/add ID - Agregar\n";
         welcomeMsg += "/remove ID - Eliminar\n\n";
         welcomeMsg += "Usa /ayuda para ver todos los comandos.";
-        bot->sendMessage(chatId, welcomeMsg, "");
+        reply(chatId, welcomeMsg);
         return;
     }
 
@@ -170,26 +366,26 @@ void TelegramBot::processMessage(telegramMessage& msg) {
             String welcomeMsg = "✅ Acceso autorizado automáticamente (modo temporal activo).\n\n";
             welcomeMsg += "🆔 Tu ID: " + chatId + "\n";
             welcomeMsg += "Usa /ayuda para ver los comandos disponibles.";
-            bot->sendMessage(chatId, welcomeMsg, "");
+            reply(chatId, welcomeMsg);
             // Notificar al primer admin
             for (int i = 0; i < authorizedCount; i++) {
                 if (adminFlags[i] && authorizedIds[i] != chatId) {
-                    bot->sendMessage(authorizedIds[i],
+                    reply(authorizedIds[i],
                         "👤 Nuevo usuario autorizado en modo temporal:\n" + fromUser + "\n🆔 ID: " + chatId +
-                        "\nTotal: " + String(authorizedCount) + " usuarios", "");
+                        "\nTotal: " + String(authorizedCount) + " usuarios");
                     break;
                 }
             }
         } else {
             // Lista llena — no se puede autorizar
-            bot->sendMessage(chatId, "⚠️ Limite de usuarios alcanzado. Contacta al administrador.", "");
+            reply(chatId, "⚠️ Limite de usuarios alcanzado. Contacta al administrador.");
             return;
         }
     }
 
     // Verificar que el usuario está autorizado
     if (!isAuthorized(chatId)) {
-        bot->sendMessage(chatId, "🔒 No tienes permiso para usar este bot.\nContacta al administrador.", "");
+        reply(chatId, "🔒 No tienes permiso para usar este bot.\nContacta al administrador.");
         Serial.println("Intento de acceso no autorizado desde: " + chatId + " (" + fromUser + ")");
         return;
     }
@@ -201,7 +397,7 @@ void TelegramBot::processMessage(telegramMessage& msg) {
     if (text.startsWith("/")) {
         handleCommand(text, chatId);
     } else {
-        bot->sendMessage(chatId, "ℹ️ Usa /ayuda para ver los comandos disponibles.", "");
+        reply(chatId, "ℹ️ Usa /ayuda para ver los comandos disponibles.");
     }
 }
 
@@ -228,74 +424,40 @@ void TelegramBot::handleCommand(String command, String chatId) {
             int photoId = args.toInt();
             if (photoId < 1) {
                 int total = sdCard.countAllPhotos();
-                bot->sendMessage(chatId, "Uso: /foto N\n\nDonde N es el numero de foto (1-" + String(total) + ")\nUsa /carpeta para ver la lista", "");
+                reply(chatId, "Uso: /foto N\n\nDonde N es el numero de foto (1-" + String(total) + ")\nUsa /carpeta para ver la lista");
             } else {
                 if (!sdCard.isInitialized()) {
-                    bot->sendMessage(chatId, "SD Card no disponible", "");
+                    reply(chatId, "SD Card no disponible");
                 } else {
                     String photoPath = sdCard.getPhotoPathByIndex(photoId);
                     if (photoPath.isEmpty()) {
                         int total = sdCard.countAllPhotos();
-                        bot->sendMessage(chatId, "Foto #" + String(photoId) + " no encontrada.\nHay " + String(total) + " fotos. Usa /carpeta para ver la lista.", "");
+                        reply(chatId, "Foto #" + String(photoId) + " no encontrada.\nHay " + String(total) + " fotos. Usa /carpeta para ver la lista.");
                     } else {
-                        bot->sendMessage(chatId, "📤 Enviando foto #" + String(photoId) + "...", "");
-                        size_t photoSize = 0;
-                        uint8_t* photoData = sdCard.readPhoto(photoPath, photoSize);
-                        if (photoData && photoSize > 0) {
-                            sendPhoto(photoData, photoSize, formatPhotoCaption(photoId, photoPath, photoSize));
-                            sdCard.freePhotoBuffer(photoData);
+                        reply(chatId, "📤 Enviando foto #" + String(photoId) + "...");
+                        File photo = SD_MMC.open(photoPath, FILE_READ);
+                        size_t photoSize = photo ? photo.size() : 0;
+                        if (photo) photo.close();
+                        if (photoSize > 0) {
+                            sendPhotoFile(photoPath, formatPhotoCaption(photoId, photoPath, photoSize));
                         } else {
-                            bot->sendMessage(chatId, "Error al leer foto de SD", "");
+                            reply(chatId, "Error al leer foto de SD");
                         }
                     }
                 }
             }
         } else {
             // Sin argumentos: capturar foto actual
-            bot->sendMessage(chatId, "📸 Capturando foto...", "");
-
-            camera_fb_t* fb = camera.capturePhoto();
-            if (fb) {
-                // Guardar en SD en carpeta fotos_telegram
-                if (sdCard.isInitialized()) {
-                    struct tm timeinfo;
-                    String filename;
-                    if (getLocalTime(&timeinfo)) {
-                        char buf[80];
-                        snprintf(buf, sizeof(buf), "/%s/%04d-%02d-%02d_%02d-%02d-%02d.jpg",
-                                 TELEGRAM_PHOTOS_FOLDER,
-                                 timeinfo.tm_year + 1900, timeinfo.tm_mon + 1, timeinfo.tm_mday,
-                                 timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_sec);
-                        filename = String(buf);
-                    } else {
-                        filename = "/" + String(TELEGRAM_PHOTOS_FOLDER) + "/foto_" + String(millis()) + ".jpg";
-                    }
-                    if (!SD_MMC.exists("/" + String(TELEGRAM_PHOTOS_FOLDER))) {
-                        SD_MMC.mkdir("/" + String(TELEGRAM_PHOTOS_FOLDER));
-                    }
-                    sdCard.savePhoto(fb->buf, fb->len, filename);
-                }
-
-                // Construir caption con fecha/hora y peso
-                String caption = "📷 Foto capturada";
-                struct tm captureTime;
-                if (getLocalTime(&captureTime)) {
-                    char timeBuf[32];
-                    strftime(timeBuf, sizeof(timeBuf), "%d/%m/%Y %H:%M:%S", &captureTime);
-                    caption += "\n" + String(timeBuf);
-                }
-                // Mostrar peso de la foto
-                if (fb->len >= 1024) {
-                    caption += "\n⚖️ Peso: " + String(fb->len / 1024.0, 1) + " KB";
-                } else {
-                    caption += "\n⚖️ Peso: " + String(fb->len) + " bytes";
-                }
-
-                // Enviar por Telegram
-                sendPhoto(fb->buf, fb->len, caption);
-                camera.releaseFrame(fb);
-            } else {
-                bot->sendMessage(chatId, "Error al capturar la foto", "");
+            reply(chatId, "📸 Capturando foto...");
+
+            // Con flash la captura termina en loop() (camera.poll()) cuando la
+            // exposición se estabiliza; sin flash el callback corre de inmediato
+            bool useFlash = camera.getSettings().flashEnabled;
+            bool queued = camera.requestCapture(useFlash, [this, chatId](camera_fb_t* fb) {
+                deliverCapturedPhoto(fb, chatId);
+            });
+            if (!queued) {
+                reply(chatId, "Captura con flash en curso, intenta de nuevo");
             }
         }
     }
@@ -317,18 +479,18 @@ void TelegramBot::handleCommand(String command, String chatId) {
             dailyConfig.useFlash = true;
             saveDailyPhotoConfig();
             String msg = "⚡ Flash: ACTIVADO\n(Aplica a fotos y foto diaria)";
-            bot->sendMessage(chatId, msg, "");
+            reply(chatId, msg);
         } else if (args == "off") {
             camera.setFlash(false);
             camera.saveSettings();
             dailyConfig.useFlash = false;
             saveDailyPhotoConfig();
             String msg = "🌑 Flash: DESACTIVADO\n(Aplica a fotos y foto diaria)";
-            bot->sendMessage(chatId, msg, "");
+            reply(chatId, msg);
         } else {
             CameraSettings currentSettings = camera.getSettings();
             String estado = currentSettings.flashEnabled ? "ACTIVADO" : "DESACTIVADO";
-            bot->sendMessage(chatId, "Uso: /flash on o /flash off\nEstado actual: " + estado, "");
+            reply(chatId, "Uso: /flash on o /flash off\nEstado actual: " + estado);
         }
     }
     // Comando /fan on|off: controla ventilador en GPIO FAN_GPIO_NUM
@@ -342,14 +504,14 @@ void TelegramBot::handleCommand(String command, String chatId) {
 
         if (args == "on") {
             digitalWrite(FAN_GPIO_NUM, HIGH);
-            bot->sendMessage(chatId, "💨 Ventilador: ENCENDIDO", "");
+            reply(chatId, "💨 Ventilador: ENCENDIDO");
         } else if (args == "off") {
             digitalWrite(FAN_GPIO_NUM, LOW);
-            bot->sendMessage(chatId, "🌬️ Ventilador: APAGADO", "");
+            reply(chatId, "🌬️ Ventilador: APAGADO");
         } else {
             bool isOn = digitalRead(FAN_GPIO_NUM) == HIGH;
             String estado = isOn ? "ENCENDIDO" : "APAGADO";
-            bot->sendMessage(chatId, "Uso: /fan on o /fan off\nEstado actual: " + estado, "");
+            reply(chatId, "Uso: /fan on o /fan off\nEstado actual: " + estado);
         }
     }
     // Comando para ver configuración de foto diaria
@@ -375,9 +537,9 @@ void TelegramBot::handleCommand(String command, String chatId) {
 
                     String msg = "Hora de foto diaria actualizada a: ";
                     msg += String(newHour) + ":" + (newMinute < 10 ? "0" : "") + String(newMinute);
-                    bot->sendMessage(chatId, msg, "");
+                    reply(chatId, msg);
                 } else {
-                    bot->sendMessage(chatId, "Hora invalida. Usa formato 24h (0-23:0-59)\nEjemplo: /hora 11:30", "");
+                    reply(chatId, "Hora invalida. Usa formato 24h (0-23:0-59)\nEjemplo: /hora 11:30");
                 }
             } else {
                 // Solo hora sin minutos
@@ -388,13 +550,13 @@ void TelegramBot::handleCommand(String command, String chatId) {
 
                     String msg = "Hora de foto diaria actualizada a: ";
                     msg += String(newHour) + ":00";
-                    bot->sendMessage(chatId, msg, "");
+                    reply(chatId, msg);
                 } else {
-                    bot->sendMessage(chatId, "Hora invalida. Usa formato 24h (0-23)\nEjemplo: /hora 11", "");
+                    reply(chatId, "Hora invalida. Usa formato 24h (0-23)\nEjemplo: /hora 11");
                 }
             }
         } else {
-            bot->sendMessage(chatId, "Uso: /hora HH:MM\nEjemplo: /hora 11:30", "");
+            reply(chatId, "Uso: /hora HH:MM\nEjemplo: /hora 11:30");
         }
     }
     // Comando /fotodiaria con argumentos
@@ -414,27 +576,27 @@ void TelegramBot::handleCommand(String command, String chatId) {
             String msg = "✅ Envio automatico de foto diaria: ACTIVADO\n";
             msg += "🕐 Proxima foto a las " + String(dailyConfig.hour) + ":" +
                    (dailyConfig.minute < 10 ? "0" : "") + String(dailyConfig.minute);
-            bot->sendMessage(chatId, msg, "");
+            reply(chatId, msg);
         }
         else if (args == "off") {
             // Desactivar envío automático
             dailyConfig.enabled = false;
             saveDailyPhotoConfig();
-            bot->sendMessage(chatId, "⛔ Envio automatico de foto diaria: DESACTIVADO\n💾 (La foto se seguira guardando en SD)", "");
+            reply(chatId, "⛔ Envio automatico de foto diaria: DESACTIVADO\n💾 (La foto se seguira guardando en SD)");
         }
         else if (args == "") {
             // Sin argumentos: enviar la foto del día guardada en SD
-            bot->sendMessage(chatId, "📤 Enviando foto del dia guardada...", "");
+            reply(chatId, "📤 Enviando foto del dia guardada...");
             sendSavedDailyPhoto();
         }
         else {
-            bot->sendMessage(chatId, "Uso: /fotodiaria [on|off]\n- Sin argumento: envia foto guardada en SD\n- on: activa envio automatico\n- off: desactiva envio automatico", "");
+            reply(chatId, "Uso: /fotodiaria [on|off]\n- Sin argumento: envia foto guardada en SD\n- on: activa envio automatico\n- off: desactiva envio automatico");
         }
     }
     // Comando /carpeta para listar fotos guardadas (TODAS las carpetas)
     else if (command.startsWith("/carpeta") || command.startsWith("/folder")) {
         if (!sdCard.isInitialized()) {
-            bot->sendMessage(chatId, "SD Card no disponible", "");
+            reply(chatId, "SD Card no disponible");
         } else {
             // Parsear numero de pagina
             int page = 1;
@@ -454,7 +616,7 @@ void TelegramBot::handleCommand(String command, String chatId) {
             if (totalPages > 0 && page > totalPages) page = totalPages;
 
             if (list.isEmpty()) {
-                bot->sendMessage(chatId, "No hay fotos guardadas en la SD", "");
+                reply(chatId, "No hay fotos guardadas en la SD");
             } else {
                 String msg = "💾 SD Card - Todas las fotos:\n\n";
                 msg += list;
@@ -463,14 +625,14 @@ void TelegramBot::handleCommand(String command, String chatId) {
                     msg += "  /carpeta N = otra pagina";
                 }
                 msg += "\n\n📤 Enviar foto: /enviar N";
-                bot->sendMessage(chatId, msg, "");
+                reply(chatId, msg);
             }
         }
     }
     // Comando /enviar N - enviar foto por número de la lista
     else if (command.startsWith("/enviar") || command.startsWith("/send")) {
         if (!sdCard.isInitialized()) {
-            bot->sendMessage(chatId, "SD Card no disponible", "");
+            reply(chatId, "SD Card no disponible");
         } else {
             String args = "";
             int spaceIndex = command.indexOf(' ');
@@ -482,21 +644,21 @@ void TelegramBot::handleCommand(String command, String chatId) {
             int photoIndex = args.toInt();
             if (photoIndex < 1) {
                 int total = sdCard.countAllPhotos();
-                bot->sendMessage(chatId, "Uso: /enviar N\n\nDonde N es el numero de foto (1-" + String(total) + ")\nUsa /carpeta para ver la lista", "");
+                reply(chatId, "Uso: /enviar N\n\nDonde N es el numero de foto (1-" + String(total) + ")\nUsa /carpeta para ver la lista");
             } else {
                 String photoPath = sdCard.getPhotoPathByIndex(photoIndex);
                 if (photoPath.isEmpty()) {
                     int total = sdCard.countAllPhotos();
-                    bot->sendMessage(chatId, "Foto #" + String(photoIndex) + " no encontrada.\nHay " + String(total) + " fotos. Usa /carpeta para ver la lista.", "");
+                    reply(chatId, "Foto #" + String(photoIndex) + " no encontrada.\nHay " + String(total) + " fotos. Usa /carpeta para ver la lista.");
                 } else {
-                    bot->sendMessage(chatId, "📤 Enviando foto #" + String(photoIndex) + "...", "");
-                    size_t photoSize = 0;
-                    uint8_t* photoData = sdCard.readPhoto(photoPath, photoSize);
-                    if (photoData && photoSize > 0) {
-                        sendPhoto(photoData, photoSize, formatPhotoCaption(photoIndex, photoPath, photoSize));
-                        sdCard.freePhotoBuffer(photoData);
+                    reply(chatId, "📤 Enviando foto #" + String(photoIndex) + "...");
+                    File photo = SD_MMC.open(photoPath, FILE_READ);
+                    size_t photoSize = photo ? photo.size() : 0;
+                    if (photo) photo.close();
+                    if (photoSize > 0) {
+                        sendPhotoFile(photoPath, formatPhotoCaption(photoIndex, photoPath, photoSize));
                     } else {
-                        bot->sendMessage(chatId, "Error al leer foto de SD", "");
+                        reply(chatId, "Error al leer foto de SD");
                     }
                 }
             }
@@ -505,21 +667,57 @@ void TelegramBot::handleCommand(String command, String chatId) {
     else if (command == "/stream") {
         String ip = WiFi.localIP().toString();
         String msg = "🎥 Streaming en:\nhttp://" + ip + "/stream\n\n🌐 Dashboard:\nhttp://" + ip + "/";
-        bot->sendMessage(chatId, msg, "");
+        reply(chatId, msg);
+    }
+    // Grabación de video en la SD: /grabar [segundos] y /detener
+    else if (command == "/grabar" || command.startsWith("/grabar ") || command.startsWith("/record")) {
+        uint32_t seconds = RECORD_DEFAULT_SECONDS;
+        int spaceIndex = command.indexOf(' ');
+        if (spaceIndex > 0) {
+            seconds = command.substring(spaceIndex + 1).toInt();
+        }
+
+        String error;
+        if (videoRecorder.start(seconds, RECORD_DEFAULT_FPS, error)) {
+            RecorderStatus rec = videoRecorder.getStatus();
+            recordChatId = chatId;
+            reply(chatId, "🔴 Grabando " + String(rec.maxSeconds) + " s a " + String(rec.fps) +
+                          " FPS\n📁 " + String(rec.name) + "\nUsa /detener para terminar antes");
+        } else {
+            reply(chatId, "❌ " + error);
+        }
+    }
+    else if (command == "/detener" || command == "/stop") {
+        if (videoRecorder.isRecording()) {
+            videoRecorder.stop();
+            // Sin chat guardado (grabación iniciada desde la web) avisa quien la detiene
+            if (recordChatId.isEmpty()) recordChatId = chatId;
+            reply(chatId, "⏹️ Deteniendo grabacion...");
+        } else {
+            reply(chatId, "No hay ninguna grabacion en curso");
+        }
     }
     else if (command == "/ip") {
         String ip = WiFi.localIP().toString();
-        bot->sendMessage(chatId, "🌐 IP: " + ip, "");
+        reply(chatId, "🌐 IP: " + ip);
     }
     else if (command == "/reiniciar" || command == "/restart" || command == "/reboot") {
-        bot->sendMessage(chatId, "🔄 Reiniciando ESP32-CAM...", "");
-        delay(1000);
+        reply(chatId, "🔄 Reiniciando ESP32-CAM...");
+        // Fotos que siguen en la cola de la SD: escribirlas y registrarlas en
+        // el índice (los envíos que las esperan quedan listos para salir)
+        sdWriter.flush(SD_WRITER_FLUSH_TIMEOUT);
+        // El aviso sale por la tarea de salida (quizás detrás de otros envíos
+        // o de un handshake TLS): esperar a que la cola se vacíe, con tope
+        unsigned long start = millis();
+        while (getOutboxStats().depth > 0 && millis() - start < TELEGRAM_RESTART_WAIT) {
+            delay(50);
+        }
         ESP.restart();
     }
     // Comandos de gestión de usuarios (solo admin)
     else if (command.startsWith("/add ") || command.startsWith("/adduser ")) {
         if (!isAdmin(chatId)) {
-            bot->sendMessage(chatId, "Solo el administrador puede agregar usuarios.", "");
+            reply(chatId, "Solo el administrador puede agregar usuarios.");
             return;
         }
 
@@ -527,22 +725,22 @@ void TelegramBot::handleCommand(String command, String chatId) {
         args.trim();
 
         if (args == "" || args == "/add" || args == "/adduser") {
-            bot->sendMessage(chatId, "Uso: /add ID\n\nEl usuario puede obtener su ID con @userinfobot", "");
+            reply(chatId, "Uso: /add ID\n\nEl usuario puede obtener su ID con @userinfobot");
         } else {
             if (isAuthorized(args)) {
-                bot->sendMessage(chatId, "El ID " + args + " ya esta autorizado.", "");
+                reply(chatId, "El ID " + args + " ya esta autorizado.");
             } else if (addAuthorizedId(args)) {
-                bot->sendMessage(chatId, "Usuario " + args + " agregado.\nTotal: " + String(authorizedCount) + " usuarios", "");
+                reply(chatId, "Usuario " + args + " agregado.\nTotal: " + String(authorizedCount) + " usuarios");
                 // Notificar al nuevo usuario
-                bot->sendMessage(args, "✅ Has sido autorizado para usar este bot.\nUsa /ayuda para ver los comandos.", "");
+                reply(args, "✅ Has sido autorizado para usar este bot.\nUsa /ayuda para ver los comandos.");
             } else {
-                bot->sendMessage(chatId, "No se pudo agregar. Maximo " + String(MAX_AUTHORIZED_IDS) + " usuarios.", "");
+                reply(chatId, "No se pudo agregar. Maximo " + String(MAX_AUTHORIZED_IDS) + " usuarios.");
             }
         }
     }
     else if (command.startsWith("/remove ") || command.startsWith("/removeuser ") || command.startsWith("/del ")) {
         if (!isAdmin(chatId)) {
-            bot->sendMessage(chatId, "Solo el administrador puede eliminar usuarios.", "");
+            reply(chatId, "Solo el administrador puede eliminar usuarios.");
             return;
         }
 
@@ -550,20 +748,20 @@ void TelegramBot::handleCommand(String command, String chatId) {
         args.trim();
 
         if (args == "" || args == "/remove" || args == "/del") {
-            bot->sendMessage(chatId, "Uso: /remove ID\n\nUsa /users para ver la lista", "");
+            reply(chatId, "Uso: /remove ID\n\nUsa /users para ver la lista");
         } else if (args == chatId) {
-            bot->sendMessage(chatId, "No puedes eliminarte a ti mismo (admin).", "");
+            reply(chatId, "No puedes eliminarte a ti mismo (admin).");
         } else {
             if (removeAuthorizedId(args)) {
-                bot->sendMessage(chatId, "Usuario " + args + " eliminado.\nTotal: " + String(authorizedCount) + " usuarios", "");
+                reply(chatId, "Usuario " + args + " eliminado.\nTotal: " + String(authorizedCount) + " usuarios");
             } else {
-                bot->sendMessage(chatId, "ID " + args + " no encontrado.", "");
+                reply(chatId, "ID " + args + " no encontrado.");
             }
         }
     }
     else if (command.startsWith("/admin ")) {
         if (!isAdmin(chatId)) {
-            bot->sendMessage(chatId, "Solo los administradores pueden usar este comando.", "");
+            reply(chatId, "Solo los administradores pueden usar este comando.");
             return;
         }
 
@@ -571,19 +769,19 @@ void TelegramBot::handleCommand(String command, String chatId) {
         args.trim();
 
         if (args == "" || args == "/admin") {
-            bot->sendMessage(chatId, "Uso: /admin ID\n\nHace administrador a un usuario autorizado.\nLimite: " + String(MAX_ADMINS) + " admins.\nAdmins actuales: " + String(getAdminCount()) + "/" + String(MAX_ADMINS), "");
+            reply(chatId, "Uso: /admin ID\n\nHace administrador a un usuario autorizado.\nLimite: " + String(MAX_ADMINS) + " admins.\nAdmins actuales: " + String(getAdminCount()) + "/" + String(MAX_ADMINS));
         } else if (!isAuthorized(args)) {
-            bot->sendMessage(chatId, "El ID " + args + " no es un usuario autorizado.\nPrimero usa /add " + args, "");
+            reply(chatId, "El ID " + args + " no es un usuario autorizado.\nPrimero usa /add " + args);
         } else if (isAdmin(args)) {
-            bot->sendMessage(chatId, "El usuario " + args + " ya es administrador.", "");
+            reply(chatId, "El usuario " + args + " ya es administrador.");
         } else if (getAdminCount() >= MAX_ADMINS) {
-            bot->sendMessage(chatId, "Limite de administradores alcanzado (" + String(MAX_ADMINS) + "/" + String(MAX_ADMINS) + ").\nNo se pueden agregar mas admins.", "");
+            reply(chatId, "Limite de administradores alcanzado (" + String(MAX_ADMINS) + "/" + String(MAX_ADMINS) + ").\nNo se pueden agregar mas admins.");
         } else {
             if (makeAdmin(args)) {
-                bot->sendMessage(chatId, "Usuario " + args + " ahora es administrador.\nAdmins: " + String(getAdminCount()) + "/" + String(MAX_ADMINS), "");
-                bot->sendMessage(args, "👑 Ahora eres administrador del bot.\nPuedes usar /add, /remove y /admin.", "");
+                reply(chatId, "Usuario " + args + " ahora es administrador.\nAdmins: " + String(getAdminCount()) + "/" + String(MAX_ADMINS));
+                reply(args, "👑 Ahora eres administrador del bot.\nPuedes usar /add, /remove y /admin.");
             } else {
-                bot->sendMessage(chatId, "Error al hacer admin al usuario.", "");
+                reply(chatId, "Error al hacer admin al usuario.");
             }
         }
     }
@@ -594,10 +792,10 @@ void TelegramBot::handleCommand(String command, String chatId) {
         if (isAdmin(chatId)) {
             msg += "\n/add ID - Agregar\n/remove ID - Eliminar\n/admin ID - Hacer admin";
         }
-        bot->sendMessage(chatId, msg, "");
+        reply(chatId, msg);
     }
     else if (command == "/myid") {
-        bot->sendMessage(chatId, "🆔 Tu ID: " + chatId, "");
+        reply(chatId, "🆔 Tu ID: " + chatId);
     }
     // ----- MODO SLEEP -----
     else if (command == "/dormir" || command == "/sleep" ||
@@ -609,7 +807,7 @@ void TelegramBot::handleCommand(String command, String chatId) {
             args.trim();
             int mins = args.toInt();
             if (mins < 0 || mins > 1440) {
-                bot->sendMessage(chatId, "Valor invalido. Usa /dormir N (0-1440 minutos).", "");
+                reply(chatId, "Valor invalido. Usa /dormir N (0-1440 minutos).");
                 return;
             }
             sleepManager.setTimeout(mins == 0 ? 0 : (unsigned long)mins * 60000UL);
@@ -618,22 +816,22 @@ void TelegramBot::handleCommand(String command, String chatId) {
         String msg = "😴 Entrando en modo sleep.\n";
         msg += "🔋 Consumo reducido. Poll Telegram cada " + String(sleepManager.getSleepPollInterval() / 1000UL) + " s.\n";
         msg += "💬 Escribe cualquier comando o conéctate al dashboard para activarme.";
-        bot->sendMessage(chatId, msg, "");
+        reply(chatId, msg);
         sleepManager.enterSleep();
     }
     else if (command == "/despertar" || command == "/wake") {
         if (sleepManager.isSleeping()) {
             sleepManager.exitSleep();
-            bot->sendMessage(chatId, "⚡ Sistema activo!\n\n" + sleepManager.getStatus(), "");
+            reply(chatId, "⚡ Sistema activo!\n\n" + sleepManager.getStatus());
         } else {
-            bot->sendMessage(chatId, "Ya estoy activo.\n\n" + sleepManager.getStatus(), "");
+            reply(chatId, "Ya estoy activo.\n\n" + sleepManager.getStatus());
         }
     }
     else if (command == "/sleepconfig" || command.startsWith("/sleepconfig ")) {
         int spaceIndex = command.indexOf(' ');
         if (spaceIndex < 0) {
             // Sin argumentos: mostrar config actual
-            bot->sendMessage(chatId, sleepManager.getStatus(), "");
+            reply(chatId, sleepManager.getStatus());
         } else {
             String args = originalCommand.substring(spaceIndex + 1);
             args.trim();
@@ -646,26 +844,26 @@ void TelegramBot::handleCommand(String command, String chatId) {
                 pollArg.trim();
                 int secs = pollArg.toInt();
                 if (secs < 1 || secs > 300) {
-                    bot->sendMessage(chatId, "Valor invalido. Usa /sleepconfig poll N (1-300 segundos).", "");
+                    reply(chatId, "Valor invalido. Usa /sleepconfig poll N (1-300 segundos).");
                 } else {
                     sleepManager.setSleepPollInterval((unsigned long)secs * 1000UL);
                     sleepManager.saveSleepPollInterval();
-                    bot->sendMessage(chatId, "Poll de Telegram en sleep: " + String(secs) + " s\n\n" + sleepManager.getStatus(), "");
+                    reply(chatId, "Poll de Telegram en sleep: " + String(secs) + " s\n\n" + sleepManager.getStatus());
                 }
             } else if (argsLower == "off" || argsLower == "0") {
                 // /sleepconfig off o /sleepconfig 0 → desactivar auto-sleep
                 sleepManager.setTimeout(0);
                 sleepManager.saveTimeout();
-                bot->sendMessage(chatId, "Auto-sleep desactivado.\n\n" + sleepManager.getStatus(), "");
+                reply(chatId, "Auto-sleep desactivado.\n\n" + sleepManager.getStatus());
             } else {
                 // /sleepconfig N → timeout de inactividad en minutos
                 int mins = args.toInt();
                 if (mins < 1 || mins > 1440) {
-                    bot->sendMessage(chatId, "Uso:\n/sleepconfig - Ver estado\n/sleepconfig N - Timeout (1-1440 min)\n/sleepconfig off - Desactivar auto-sleep\n/sleepconfig poll N - Poll en sleep (1-300 s)", "");
+                    reply(chatId, "Uso:\n/sleepconfig - Ver estado\n/sleepconfig N - Timeout (1-1440 min)\n/sleepconfig off - Desactivar auto-sleep\n/sleepconfig poll N - Poll en sleep (1-300 s)");
                 } else {
                     sleepManager.setTimeout((unsigned long)mins * 60000UL);
                     sleepManager.saveTimeout();
-                    bot->sendMessage(chatId, "Timeout de inactividad: " + String(mins) + " min\n\n" + sleepManager.getStatus(), "");
+                    reply(chatId, "Timeout de inactividad: " + String(mins) + " min\n\n" + sleepManager.getStatus());
                 }
             }
         }
@@ -673,7 +871,7 @@ void TelegramBot::handleCommand(String command, String chatId) {
     // ----- MODO AUTORIZACIÓN TEMPORAL -----
     else if (command == "/acceso" || command.startsWith("/acceso ")) {
         if (!isAdmin(chatId)) {
-            bot->sendMessage(chatId, "🔒 Solo los administradores pueden usar este comando.", "");
+            reply(chatId, "🔒 Solo los administradores pueden usar este comando.");
             return;
         }
 
@@ -700,17 +898,17 @@ void TelegramBot::handleCommand(String command, String chatId) {
                 msg += "*INACTIVO*\n";
                 msg += "Usa /acceso on para activar.";
             }
-            bot->sendMessage(chatId, msg, "");
+            reply(chatId, msg);
         }
         else if (args == "on") {
             tempAuthMode = true;
             tempAuthExpiry = 0;
-            bot->sendMessage(chatId, "🔓 Modo autorización temporal ACTIVADO.\nCualquier usuario que escriba al bot quedará autorizado automáticamente.\nUsa /acceso off para desactivar.", "");
+            reply(chatId, "🔓 Modo autorización temporal ACTIVADO.\nCualquier usuario que escriba al bot quedará autorizado automáticamente.\nUsa /acceso off para desactivar.");
         }
         else if (args == "off") {
             tempAuthMode = false;
             tempAuthExpiry = 0;
-            bot->sendMessage(chatId, "🔒 Modo autorización temporal DESACTIVADO.\nNo se autorizarán nuevos usuarios automáticamente.", "");
+            reply(chatId, "🔒 Modo autorización temporal DESACTIVADO.\nNo se autorizarán nuevos usuarios automáticamente.");
         }
         else {
             // Intentar parsear como minutos
@@ -721,17 +919,73 @@ void TelegramBot::handleCommand(String command, String chatId) {
                 String msg = "🔓 Modo autorización temporal ACTIVADO por " + String(mins) + " minuto";
                 if (mins != 1) msg += "s";
                 msg += ".\nSe desactivará automáticamente. Usa /acceso off para cancelar antes.";
-                bot->sendMessage(chatId, msg, "");
+                reply(chatId, msg);
             } else {
-                bot->sendMessage(chatId, "Uso:\n/acceso - Ver estado\n/acceso on - Activar (sin límite)\n/acceso off - Desactivar\n/acceso N - Activar por N minutos (1–1440)", "");
+                reply(chatId, "Uso:\n/acceso - Ver estado\n/acceso on - Activar (sin límite)\n/acceso off - Desactivar\n/acceso N - Activar por N minutos (1–1440)");
             }
         }
     }
     else {
-        bot->sendMessage(chatId, "Comando no reconocido. Usa /ayuda", "");
+        reply(chatId, "Comando no reconocido. Usa /ayuda");
     }
 }
 
+void TelegramBot::deliverCapturedPhoto(camera_fb_t* fb, String chatId) {
+    if (!fb) {
+        reply(chatId, "Error al capturar la foto");
+        return;
+    }
+
+    // Guardar en SD en carpeta fotos_telegram
+    String filename;
+    uint32_t sdTicket = 0;
+    if (sdCard.isInitialized()) {
+        struct tm timeinfo;
+        if (getLocalTime(&timeinfo)) {
+            char buf[80];
+            snprintf(buf, sizeof(buf), "/%s/%04d-%02d-%02d_%02d-%02d-%02d.jpg",
+                     TELEGRAM_PHOTOS_FOLDER,
+                     timeinfo.tm_year + 1900, timeinfo.tm_mon + 1, timeinfo.tm_mday,
+                     timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_sec);
+            filename = String(buf);
+        } else {
+            filename = "/" + String(TELEGRAM_PHOTOS_FOLDER) + "/foto_" + String(millis()) + ".jpg";
+        }
+        if (!SD_MMC.exists("/" + String(TELEGRAM_PHOTOS_FOLDER))) {
+            SD_MMC.mkdir("/" + String(TELEGRAM_PHOTOS_FOLDER));
+        }
+        sdTicket = sdWriter.savePhoto(fb->buf, fb->len, filename);
+        if (!sdTicket) {
+            filename = "";
+        }
+    }
+
+    // Construir caption con fecha/hora y peso
+    String caption = "📷 Foto capturada";
+    struct tm captureTime;
+    if (getLocalTime(&captureTime)) {
+        char timeBuf[32];
+        strftime(timeBuf, sizeof(timeBuf), "%d/%m/%Y %H:%M:%S", &captureTime);
+        caption += "\n" + String(timeBuf);
+    }
+    // Mostrar peso de la foto
+    if (fb->len >= 1024) {
+        caption += "\n⚖️ Peso: " + String(fb->len / 1024.0, 1) + " KB";
+    } else {
+        caption += "\n⚖️ Peso: " + String(fb->len) + " bytes";
+    }
+
+    // Encolar el envío: si quedó en SD se lee de ahí (cuando termine de
+    // escribirse), si no se copia el frame. En ambos casos el frame vuelve
+    // a la cámara de inmediato.
+    if (!filename.isEmpty()) {
+        sendPhotoFile(filename, caption, sdTicket);
+    } else {
+        sendPhoto(fb->buf, fb->len, caption);
+    }
+    camera.releaseFrame(fb);
+}
+
 void TelegramBot::sendHelpMessage(String chatId) {
     String helpMsg = "📋 Comandos disponibles:\n\n";
     helpMsg += "📸 FOTOS:\n";
@@ -740,6 +994,11 @@ void TelegramBot::sendHelpMessage(String chatId) {
     helpMsg += "/carpeta - Ver todas las fotos guardadas\n";
     helpMsg += "/enviar N - Enviar foto N de la lista\n\n";
 
+    helpMsg += "🎬 VIDEO:\n";
+    helpMsg += "/grabar - Grabar " + String(RECORD_DEFAULT_SECONDS) + " s de video en la SD\n";
+    helpMsg += "/grabar N - Grabar N segundos (max " + String(RECORD_MAX_SECONDS) + ")\n";
+    helpMsg += "/detener - Terminar la grabacion\n\n";
+
     helpMsg += "⚡ FLASH:\n";
     helpMsg += "/flash on - Activar flash\n";
     helpMsg += "/flash off - Desactivar flash\n";
@@ -784,24 +1043,25 @@ void TelegramBot::sendHelpMessage(String chatId) {
     helpMsg += "/sleepconfig off - Desactivar auto-sleep\n";
     helpMsg += "/sleepconfig poll N - Poll en sleep (seg)";
 
-    bot->sendMessage(chatId, helpMsg, "");
+    reply(chatId, helpMsg);
 }
 
 void TelegramBot::sendStatusMessage(String chatId) {
     String status = "📊 Estado del Sistema:\n\n";
 
-    // Memoria
-    status += "🔋 RAM libre: " + String(ESP.getFreeHeap() / 1024) + " KB\n";
-    status += "💾 PSRAM libre: " + String(ESP.getFreePsram() / 1024) + " KB\n";
+    // Memoria, WiFi y SD desde la copia de métricas (no recorre la FAT)
+    MetricsSnapshot m = systemMetrics.get();
+    status += "🔋 RAM libre: " + String(m.freeHeap / 1024) + " KB\n";
+    status += "💾 PSRAM libre: " + String(m.freePsram / 1024) + " KB\n";
 
     // WiFi
-    status += "📶 WiFi RSSI: " + String(WiFi.RSSI()) + " dBm\n";
-    status += "🌐 IP: " + WiFi.localIP().toString() + "\n";
+    status += "📶 WiFi RSSI: " + String(m.rssi) + " dBm\n";
+    status += "🌐 IP: " + String(m.ip) + "\n";
 
     // SD Card
-    if (sdCard.isInitialized()) {
-        float sdFreeGB = sdCard.getFreeSpace() / (1024.0 * 1024.0 * 1024.0);
-        float sdTotalGB = sdCard.getTotalSpace() / (1024.0 * 1024.0 * 1024.0);
+    if (m.sdInitialized) {
+        float sdFreeGB = (m.sdTotal - m.sdUsed) / (1024.0 * 1024.0 * 1024.0);
+        float sdTotalGB = m.sdTotal / (1024.0 * 1024.0 * 1024.0);
         status += "💿 SD: " + String(sdFreeGB, 1) + "/" + String(sdTotalGB, 1) + " GB Libres\n";
         status += "📁 Carpeta: /" + sdCard.getPhotosFolder() + "\n";
     } else {
@@ -822,10 +1082,18 @@ void TelegramBot::sendStatusMessage(String chatId) {
     status += "📨 Envio Telegram: " + String(dailyConfig.enabled ? "ON" : "OFF") + "\n";
     status += "💾 Guardar SD: SIEMPRE\n";
 
+    // Cola de salida de Telegram
+    OutboxStats outboxSt = getOutboxStats();
+    status += "\n📤 Cola Telegram: " + String(outboxSt.depth) + "/" + String(TELEGRAM_OUTBOX_DEPTH) +
+              " (enviados: " + String(outboxSt.completed) + ", fallidos: " + String(outboxSt.failed) +
+              ", sin confirmar: " + String(outboxSt.unconfirmed) + ")\n";
+    status += "⏱️ Latencia envio: " + String(outboxSt.avgLatencyMs / 1000.0, 1) + " s prom, " +
+              String(outboxSt.maxLatencyMs / 1000.0, 1) + " s max\n";
+
     // Modo sleep
     status += "\n" + sleepManager.getStatus();
 
-    bot->sendMessage(chatId, status, "");
+    reply(chatId, status);
 }
 
 void TelegramBot::sendDailyConfigMessage(String chatId) {
@@ -850,12 +1118,100 @@ void TelegramBot::sendDailyConfigMessage(String chatId) {
     msg += "/hora HH:MM - Cambiar hora\n";
     msg += "/flash on|off - Activar/desactivar flash";
 
-    bot->sendMessage(chatId, msg, "");
+    reply(chatId, msg);
+}
+
+// Buffer reutilizable para subir fotos leídas de SD (sin ps_malloc por foto)
+static uint8_t uploadBuffer[TELEGRAM_UPLOAD_CHUNK];
+
+// file_id de la versión más grande: es la última del arreglo "photo"
+static String extractFileId(const String& response) {
+    const char key[] = "\"file_id\":\"";
+    int pos = response.lastIndexOf(key);
+    if (pos < 0) return "";
+    pos += sizeof(key) - 1;
+    int endPos = response.indexOf('"', pos);
+    if (endPos < 0) return "";  // Respuesta truncada
+    return response.substring(pos, endPos);
+}
+
+// Leer una respuesta HTTP completa de la conexión de salida respetando
+// Content-Length, para dejar el socket listo para la siguiente petición.
+// Guarda hasta TELEGRAM_RESPONSE_MAX bytes del cuerpo en body.
+// closedUnanswered indica que el servidor cerró sin enviar un solo byte.
+bool TelegramBot::readResponse(String& body, bool& keepAlive, bool& closedUnanswered) {
+    body = "";
+    keepAlive = false;
+    closedUnanswered = false;
+
+    unsigned long timeout = millis() + TELEGRAM_RESPONSE_TIMEOUT;
+    while (!outClient.available() && millis() < timeout) {
+        if (!outClient.connected()) {
+            closedUnanswered = true;
+            return false;
+        }
+        delay(5);
+    }
+    if (!outClient.available()) {
+        Serial.println("Telegram: sin respuesta");
+        return false;
+    }
+
+    String status = outClient.readStringUntil('\n');
+    if (!status.startsWith("HTTP/1.1")) {
+        return false;
+    }
+    keepAlive = true;
+
+    long contentLength = -1;
+    for (;;) {
+        String line = outClient.readStringUntil('\n');
+        line.trim();
+        if (line.isEmpty()) break;
+        line.toLowerCase();
+        if (line.startsWith("content-length:")) {
+            contentLength = line.substring(15).toInt();
+        } else if (line.startsWith("connection:") && line.indexOf("close") > 0) {
+            keepAlive = false;
+        } else if (line.startsWith("transfer-encoding:")) {
+            keepAlive = false;  // Sin Content-Length: leer hasta el cierre
+        }
+    }
+    if (contentLength < 0) {
+        keepAlive = false;
+    }
+
+    // Consumir el cuerpo completo aunque solo se guarde el principio
+    long remaining = contentLength;
+    while ((contentLength < 0 || remaining > 0) && millis() < timeout) {
+        if (!outClient.available()) {
+            if (!outClient.connected()) break;
+            delay(2);
+            continue;
+        }
+        char c = (char)outClient.read();
+        if (body.length() < TELEGRAM_RESPONSE_MAX) body += c;
+        remaining--;
+    }
+    if (contentLength >= 0 && remaining > 0) {
+        keepAlive = false;  // Respuesta truncada: el socket quedó desalineado
+    }
+    return true;
 }
 
 // Envío directo de foto via HTTP POST multipart a Telegram API
-// Reemplaza sendPhotoByBinary que falla en ESP32-CAM
-bool TelegramBot::sendPhotoToChat(const uint8_t* imageData, size_t imageSize, String chatId, String caption) {
+// Reemplaza sendPhotoByBinary que falla en ESP32-CAM.
+// La imagen sale de memoria (imageData) o se lee de SD por bloques (file);
+// cabecera, cola y Content-Length son idénticos en ambos casos.
+//
+// Usa la conexión TLS de la cola de salida (la misma de outBot) con
+// keep-alive: enviar a varios chats o trabajos seguidos no repite el
+// handshake. Si la conexión reutilizada estaba cerrada por el servidor (falla
+// la escritura o se cierra sin responder), se reintenta una vez con una nueva.
+// Si la foto salió completa y solo falta la respuesta no se repite nunca:
+// Telegram pudo haberla aceptado y se duplicaría en el chat.
+bool TelegramBot::uploadPhoto(const uint8_t* imageData, File* file, size_t imageSize, String chatId, String caption,
+                              String* fileId, bool* unconfirmed) {
     String token = credentialsManager.getBotToken();
     String boundary = "----ESP32CAMBoundary";
 
@@ -878,97 +1234,364 @@ bool TelegramBot::sendPhotoToChat(const uint8_t* imageData, size_t imageSize, St
 
     size_t totalLen = head.length() + imageSize + tail.length();
 
-    WiFiClientSecure sendClient;
-    sendClient.setInsecure();
-    sendClient.setTimeout(20);
-
-    Serial.printf("Conectando a Telegram API para chat %s...\n", chatId.c_str());
+    for (int attempt = 0; attempt < 2; attempt++) {
+        unsigned long t0 = millis();
+        bool reused = outClient.connected();
+        if (!reused) {
+            Serial.printf("Conectando a Telegram API para chat %s...\n", chatId.c_str());
+            // connect() de WiFiClientSecure incluye TCP + handshake TLS
+            if (!outClient.connect("api.telegram.org", 443)) {
+                Serial.println("Error conectando a api.telegram.org");
+                return false;
+            }
+            uploadStats.handshakes++;
+        }
+        unsigned long t1 = millis();
+
+        // Enviar request HTTP POST
+        outClient.print("POST /bot" + token + "/sendPhoto HTTP/1.1\r\n"
+                     "Host: api.telegram.org\r\n"
+                     "Content-Length: " + String(totalLen) + "\r\n"
+                     "Content-Type: multipart/form-data; boundary=" + boundary + "\r\n"
+                     "Connection: keep-alive\r\n\r\n");
+
+        // Enviar cabecera multipart
+        bool ok = outClient.print(head) == head.length();
+
+        // Enviar datos de imagen en bloques de TELEGRAM_UPLOAD_CHUNK bytes
+        if (file) file->seek(0);
+        size_t sent = 0;
+        while (ok && sent < imageSize) {
+            size_t chunk = imageSize - sent;
+            if (chunk > TELEGRAM_UPLOAD_CHUNK) chunk = TELEGRAM_UPLOAD_CHUNK;
+
+            const uint8_t* data = imageData + sent;
+            if (file) {
+                if (file->read(uploadBuffer, chunk) != chunk) {
+                    Serial.println("Error leyendo foto de SD");
+                    outClient.stop();
+                    return false;
+                }
+                data = uploadBuffer;
+            }
 
-    if (!sendClient.connect("api.telegram.org", 443)) {
-        Serial.println("Error conectando a api.telegram.org");
-        return false;
-    }
+            size_t written = outClient.write(data, chunk);
+            if (written != chunk) {
+                ok = false;
+                break;
+            }
+            sent += written;
+            delay(1); // Yield para watchdog
+        }
 
-    // Enviar request HTTP POST
-    sendClient.println("POST /bot" + token + "/sendPhoto HTTP/1.1");
-    sendClient.println("Host: api.telegram.org");
-    sendClient.println("Content-Length: " + String(totalLen));
-    sendClient.println("Content-Type: multipart/form-data; boundary=" + boundary);
-    sendClient.println("Connection: close");
-    sendClient.println();
-
-    // Enviar cabecera multipart
-    sendClient.print(head);
-
-    // Enviar datos de imagen en chunks de 1024 bytes
-    size_t sent = 0;
-    while (sent < imageSize) {
-        size_t chunk = imageSize - sent;
-        if (chunk > 1024) chunk = 1024;
-        size_t written = sendClient.write(imageData + sent, chunk);
-        if (written == 0) {
+        // Enviar cola multipart
+        if (ok) ok = outClient.print(tail) == tail.length();
+        unsigned long t2 = millis();
+
+        String response;
+        bool keepAlive = false;
+        bool closedUnanswered = false;
+        bool bodySent = ok;
+        if (ok) ok = readResponse(response, keepAlive, closedUnanswered);
+        unsigned long t3 = millis();
+
+        if (!ok) {
+            outClient.stop();
+            if (bodySent && !closedUnanswered) {
+                // Sin confirmación: no se repite (tampoco en los reintentos de
+                // la cola de salida) pero se cuenta aparte; write() solo dice
+                // que los bytes quedaron en el buffer de lwIP
+                Serial.println("Telegram: foto enviada sin confirmacion a: " + chatId);
+                uploadStats.unconfirmed++;
+                if (unconfirmed) *unconfirmed = true;
+                return true;
+            }
+            if (reused) {
+                // El servidor cerró la conexión ociosa: reintentar con una nueva
+                continue;
+            }
             Serial.println("Error escribiendo datos de foto");
-            sendClient.stop();
             return false;
         }
-        sent += written;
-        delay(1); // Yield para watchdog
-    }
+        if (!keepAlive) {
+            outClient.stop();
+        }
 
-    // Enviar cola multipart
-    sendClient.print(tail);
+        recordUploadTiming(reused ? 0 : t1 - t0, t2 - t1, t3 - t2, reused);
+        Serial.printf("Telegram sendPhoto: conexion %lu ms%s, subida %lu ms, respuesta %lu ms\n",
+                      t1 - t0, reused ? " (reutilizada)" : "", t2 - t1, t3 - t2);
 
-    // Leer respuesta con timeout
-    unsigned long timeout = millis() + 15000;
-    while (!sendClient.available() && millis() < timeout) {
-        delay(10);
+        bool success = response.indexOf("\"ok\":true") >= 0;
+        if (success) {
+            Serial.println("Foto enviada a: " + chatId);
+            if (fileId) {
+                *fileId = extractFileId(response);
+            }
+        } else {
+            Serial.println("Error respuesta Telegram: " + response.substring(0, 200));
+        }
+        return success;
     }
+    return false;
+}
+
+void TelegramBot::recordUploadTiming(unsigned long connectMs, unsigned long uploadMs,
+                                     unsigned long responseMs, bool reused) {
+    TelegramUploadStats& st = uploadStats;
+    st.uploads++;
+    if (reused) st.reusedConnections++;
+    else st.avgConnectMs = (st.handshakes <= 1) ? connectMs : st.avgConnectMs + ((float)connectMs - st.avgConnectMs) * 0.2f;
+    st.avgUploadMs = (st.uploads == 1) ? uploadMs : st.avgUploadMs + ((float)uploadMs - st.avgUploadMs) * 0.2f;
+    st.avgResponseMs = (st.uploads == 1) ? responseMs : st.avgResponseMs + ((float)responseMs - st.avgResponseMs) * 0.2f;
+    st.lastConnectMs = connectMs;
+    st.lastUploadMs = uploadMs;
+    st.lastResponseMs = responseMs;
+}
 
-    String response = "";
-    while (sendClient.available()) {
-        response += (char)sendClient.read();
+TelegramUploadStats TelegramBot::getUploadStats() const {
+    return uploadStats;
+}
+
+bool TelegramBot::sendPhoto(const uint8_t* imageData, size_t imageSize, String caption) {
+    if (authorizedCount == 0 || !imageData || imageSize == 0) return false;
+
+    // Copia propia: el llamador puede liberar su buffer (p. ej. el frame de
+    // la cámara) en cuanto esto retorna
+    uint8_t* copy = (uint8_t*)(psramFound() ? ps_malloc(imageSize) : malloc(imageSize));
+    if (!copy) {
+        Serial.println("Sin memoria para encolar foto de Telegram");
+        return false;
     }
+    memcpy(copy, imageData, imageSize);
+
+    OutboxJob* job = newJob(OUTBOX_PHOTO_DATA, caption, "");
+    job->data = copy;
+    job->size = imageSize;
+    Serial.printf("Foto encolada para Telegram (%u bytes, %d usuarios)\n", (unsigned)imageSize, authorizedCount);
+    return enqueue(job);
+}
 
-    sendClient.stop();
+bool TelegramBot::sendPhotoFile(const String& path, String caption, uint32_t sdTicket) {
+    if (authorizedCount == 0 || path.isEmpty()) return false;
 
-    bool success = response.indexOf("\"ok\":true") >= 0;
-    if (success) {
-        Serial.println("Foto enviada a: " + chatId);
+    OutboxJob* job = newJob(OUTBOX_PHOTO_FILE, caption, "");
+    job->path = path;
+    job->sdTicket = sdTicket;
+    Serial.printf("Foto de SD encolada para Telegram: %s (%d usuarios)\n", path.c_str(), authorizedCount);
+    return enqueue(job);
+}
+
+bool TelegramBot::sendMessage(String message) {
+    if (!outbox || authorizedCount == 0) return false;
+    return enqueue(newJob(OUTBOX_MESSAGE, message, ""));
+}
+
+bool TelegramBot::reply(String chatId, String message) {
+    return enqueue(newJob(OUTBOX_MESSAGE, message, chatId));
+}
+
+// ============================================
+// Cola de salida
+// ============================================
+
+OutboxJob* TelegramBot::newJob(OutboxJobType type, const String& text, const String& chatId) {
+    OutboxJob* job = new OutboxJob();
+    job->type = type;
+    job->text = text;
+    job->data = nullptr;
+    job->size = 0;
+    job->sdTicket = 0;
+
+    // Los destinatarios se copian ahora: la lista de autorizados puede
+    // cambiar desde loop() mientras la tarea envía
+    job->chatCount = 0;
+    if (chatId.isEmpty()) {
+        for (int i = 0; i < authorizedCount; i++) {
+            job->chats[job->chatCount++] = authorizedIds[i];
+        }
     } else {
-        Serial.println("Error respuesta Telegram: " + response.substring(0, 200));
+        job->chats[job->chatCount++] = chatId;
     }
-    return success;
+    job->pendingMask = (1 << job->chatCount) - 1;
+
+    job->attempts = 0;
+    job->enqueuedMs = millis();
+    job->nextAttemptMs = job->enqueuedMs;
+    job->unconfirmed = false;
+    return job;
 }
 
-bool TelegramBot::sendPhoto(const uint8_t* imageData, size_t imageSize, String caption) {
-    if (authorizedCount == 0) return false;
+bool TelegramBot::enqueue(OutboxJob* job) {
+    if (!outbox || job->chatCount == 0 || xQueueSend(outbox, &job, 0) != pdTRUE) {
+        outboxStats.dropped++;
+        Serial.println("Cola de Telegram llena, envio descartado");
+        freeJob(job);
+        return false;
+    }
+    return true;
+}
 
-    Serial.printf("Enviando foto por Telegram (%d bytes) a %d usuarios...\n", imageSize, authorizedCount);
+void TelegramBot::freeJob(OutboxJob* job) {
+    if (job->data) {
+        free(job->data);
+    }
+    delete job;
+}
 
-    bool anySuccess = false;
+void TelegramBot::outboxTaskEntry(void* arg) {
+    static_cast<TelegramBot*>(arg)->runOutbox();
+}
 
-    for (int i = 0; i < authorizedCount; i++) {
-        if (sendPhotoToChat(imageData, imageSize, authorizedIds[i], caption)) {
-            anySuccess = true;
+void TelegramBot::runOutbox() {
+    OutboxJob* active[TELEGRAM_OUTBOX_DEPTH];
+    int count = 0;
+    TickType_t idleWait = 0;   // Hasta el próximo backoff si nada estaba listo
+
+    for (;;) {
+        // Sin trabajos pendientes la tarea duerme hasta que llegue uno; con
+        // todos en backoff, hasta que venza el primero o llegue otro
+        TickType_t wait = (count == 0) ? portMAX_DELAY : idleWait;
+        idleWait = 0;
+        if (count == TELEGRAM_OUTBOX_DEPTH) {
+            // Cola llena: no se aceptan trabajos y xQueueReceive no bloquearía
+            if (wait > 0) vTaskDelay(wait);
+        } else {
+            OutboxJob* incoming;
+            while (count < TELEGRAM_OUTBOX_DEPTH && xQueueReceive(outbox, &incoming, wait) == pdTRUE) {
+                active[count++] = incoming;
+                wait = 0;
+            }
+        }
+        outboxActive = count;
+
+        if (outboxReset) {
+            outClient.stop();
+            outboxReset = false;
+        }
+        if (count == 0) continue;
+        if (WiFi.status() != WL_CONNECTED) {
+            vTaskDelay(pdMS_TO_TICKS(500));
+            continue;
         }
+
+        // Primer trabajo en orden de llegada cuyo backoff ya venció (las
+        // fotos de SD esperan además a que la tarea de escritura las termine).
+        // Si ninguno está listo se espera al primer backoff, sin pasar de
+        // 100 ms para volver a mirar las escrituras de SD
+        int next = -1;
+        unsigned long waitMs = 100;
+        unsigned long now = millis();
+        for (int i = 0; i < count; i++) {
+            long left = (long)(active[i]->nextAttemptMs - now);
+            if (left > 0) {
+                if ((unsigned long)left < waitMs) waitMs = left;
+            } else if (sdWriter.getState(active[i]->sdTicket) != SD_WRITE_PENDING) {
+                next = i;
+                break;
+            }
+        }
+        if (next < 0) {
+            idleWait = pdMS_TO_TICKS(waitMs);
+            if (idleWait == 0) idleWait = 1;
+            continue;
+        }
+
+        OutboxJob* job = active[next];
+        if (processJob(*job)) {
+            if (job->unconfirmed) {
+                outboxStats.unconfirmed++;      // Fuera de completed y de la latencia
+            } else {
+                recordJobLatency(millis() - job->enqueuedMs);
+            }
+        } else if (++job->attempts <= TELEGRAM_OUTBOX_RETRIES) {
+            unsigned long backoff = (unsigned long)TELEGRAM_OUTBOX_BACKOFF << (job->attempts - 1);
+            job->nextAttemptMs = millis() + backoff;
+            outboxStats.retries++;
+            Serial.printf("Telegram: reintento %d/%d en %lu ms\n", job->attempts, TELEGRAM_OUTBOX_RETRIES, backoff);
+            continue;
+        } else {
+            outboxStats.failed++;
+            Serial.println("Telegram: envio descartado tras agotar reintentos");
+        }
+
+        freeJob(job);
+        for (int i = next; i < count - 1; i++) {
+            active[i] = active[i + 1];
+        }
+        count--;
+        outboxActive = count;
     }
+}
 
-    return anySuccess;
+// Envía el trabajo a los chats que todavía no lo recibieron. En un reintento
+// solo se repiten los que fallaron.
+bool TelegramBot::processJob(OutboxJob& job) {
+    String fileId;
+    for (int i = 0; i < job.chatCount; i++) {
+        if (!(job.pendingMask & (1 << i))) continue;
+
+        bool sent;
+        if (job.type == OUTBOX_MESSAGE) {
+            sent = outBot->sendMessage(job.chats[i], job.text, "");
+        } else {
+            sent = sendJobPhoto(job, job.chats[i], fileId);
+        }
+        if (sent) {
+            job.pendingMask &= ~(1 << i);
+        }
+    }
+    return job.pendingMask == 0;
 }
 
-bool TelegramBot::sendMessage(String message) {
-    if (!bot || authorizedCount == 0) return false;
+// Difusión: la foto se sube completa solo una vez. Con el file_id que devuelve
+// Telegram, el resto de los chats recibe un sendPhoto de pocos bytes. Si el
+// envío por file_id falla para un chat, se sube la imagen completa a ese chat.
+bool TelegramBot::sendJobPhoto(OutboxJob& job, const String& chatId, String& fileId) {
+    if (!fileId.isEmpty() && sendPhotoById(chatId, fileId, job.text)) {
+        return true;
+    }
+    String* fileIdOut = fileId.isEmpty() ? &fileId : nullptr;
 
-    bool anySuccess = false;
+    if (job.type == OUTBOX_PHOTO_DATA) {
+        return uploadPhoto(job.data, nullptr, job.size, chatId, job.text, fileIdOut, &job.unconfirmed);
+    }
 
-    // Enviar a todos los usuarios autorizados
-    for (int i = 0; i < authorizedCount; i++) {
-        if (bot->sendMessage(authorizedIds[i], message, "")) {
-            anySuccess = true;
-        }
+    File file = SD_MMC.open(job.path, FILE_READ);
+    if (!file || file.size() == 0) {
+        if (file) file.close();
+        Serial.println("Error al leer foto de SD: " + job.path);
+        return false;
     }
+    bool sent = uploadPhoto(nullptr, &file, file.size(), chatId, job.text, fileIdOut, &job.unconfirmed);
+    file.close();
+    return sent;
+}
 
-    return anySuccess;
+void TelegramBot::recordJobLatency(unsigned long ms) {
+    OutboxStats& st = outboxStats;
+    st.completed++;
+    st.lastLatencyMs = ms;
+    if (ms > st.maxLatencyMs) st.maxLatencyMs = ms;
+    st.avgLatencyMs = (st.completed == 1) ? ms : st.avgLatencyMs + ((float)ms - st.avgLatencyMs) * 0.2f;
+}
+
+OutboxStats TelegramBot::getOutboxStats() const {
+    OutboxStats st = outboxStats;
+    st.depth = (outbox ? uxQueueMessagesWaiting(outbox) : 0) + outboxActive;
+    return st;
+}
+
+bool TelegramBot::sendPhotoById(String chatId, String fileId, String caption) {
+    unsigned long start = millis();
+    String response = outBot->sendPhoto(chatId, fileId, caption);
+    bool success = response.indexOf("\"ok\":true") >= 0;
+    if (success) {
+        uploadStats.fileIdSends++;
+        Serial.printf("Foto reenviada por file_id a %s (%lu ms)\n", chatId.c_str(), millis() - start);
+    } else {
+        Serial.println("Error reenviando por file_id a " + chatId);
+    }
+    return success;
 }
 
 bool TelegramBot::takeDailyPhoto(bool sendToTelegram) {
@@ -986,13 +1609,16 @@ bool TelegramBot::takeDailyPhoto(bool sendToTelegram) {
         return false;
     }
 
-    // Siempre guardar como foto del día en SD
+    // Siempre guardar como foto del día en SD (en segundo plano)
     bool savedToSD = false;
+    uint32_t sdTicket = 0;
+    String dailyPath;
     if (sdCard.isInitialized()) {
-        String dailyPath = sdCard.getDailyPhotoPath();
-        savedToSD = sdCard.savePhoto(fb->buf, fb->len, dailyPath);
+        dailyPath = sdCard.getDailyPhotoPath();
+        sdTicket = sdWriter.savePhoto(fb->buf, fb->len, dailyPath);
+        savedToSD = sdTicket != 0;
         if (savedToSD) {
-            Serial.println("Foto del dia guardada en SD: " + dailyPath);
+            Serial.println("Foto del dia encolada para la SD: " + dailyPath);
         }
     }
 
@@ -1011,7 +1637,9 @@ bool TelegramBot::takeDailyPhoto(bool sendToTelegram) {
             }
         }
 
-        sentToTelegram = sendPhoto(fb->buf, fb->len, dateStr);
+        // Encolado: la subida la hace la tarea de salida
+        sentToTelegram = savedToSD ? sendPhotoFile(dailyPath, dateStr, sdTicket)
+                                   : sendPhoto(fb->buf, fb->len, dateStr);
     }
 
     camera.releaseFrame(fb);
@@ -1040,12 +1668,13 @@ bool TelegramBot::sendSavedDailyPhoto() {
         return false;
     }
 
-    // Leer foto de la SD
+    // Verificar la foto en SD (se lee al enviarla)
     String dailyPath = sdCard.getDailyPhotoPath();
-    size_t photoSize = 0;
-    uint8_t* photoData = sdCard.readPhoto(dailyPath, photoSize);
+    File photo = SD_MMC.open(dailyPath, FILE_READ);
+    size_t photoSize = photo ? photo.size() : 0;
+    if (photo) photo.close();
 
-    if (!photoData || photoSize == 0) {
+    if (photoSize == 0) {
         sendMessage("Error al leer foto del dia desde SD");
         return false;
     }
@@ -1059,13 +1688,8 @@ bool TelegramBot::sendSavedDailyPhoto() {
         dateStr = "Foto del dia: " + String(buffer);
     }
 
-    // Enviar por Telegram
-    bool success = sendPhoto(photoData, photoSize, dateStr);
-
-    // Liberar memoria
-    sdCard.freePhotoBuffer(photoData);
-
-    return success;
+    // Encolar el envío; la tarea de salida lo lee directamente de SD
+    return sendPhotoFile(dailyPath, dateStr);
 }
 
 void TelegramBot::setCheckInterval(unsigned long interval) {
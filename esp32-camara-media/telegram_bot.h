@@ -4,7 +4,13 @@
 #include <Arduino.h>
 #include <WiFiClientSecure.h>
 #include <UniversalTelegramBot.h>
+#include <FS.h>
+#include "esp_camera.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
 #include "config.h"
+#include "telegram_updates.h"
 
 // Máximo de usuarios autorizados
 #define MAX_AUTHORIZED_IDS 10
@@ -18,6 +24,53 @@ struct DailyPhotoConfig {
     bool enabled;
 };
 
+// Tiempos de subida de fotos (ms) sobre la conexión de la cola de salida
+struct TelegramUploadStats {
+    uint32_t uploads;
+    uint32_t handshakes;        // Conexiones TLS nuevas
+    uint32_t reusedConnections; // Subidas sobre una conexión keep-alive
+    uint32_t fileIdSends;       // Envíos por file_id (sin subir la imagen)
+    uint32_t unconfirmed;       // Subidas completas sin respuesta (no se repiten)
+    float avgConnectMs;         // TCP + handshake TLS (solo conexiones nuevas)
+    float avgUploadMs;
+    float avgResponseMs;
+    uint32_t lastConnectMs;
+    uint32_t lastUploadMs;
+    uint32_t lastResponseMs;
+};
+
+// Trabajo de envío procesado por la tarea de salida
+enum OutboxJobType { OUTBOX_MESSAGE, OUTBOX_PHOTO_DATA, OUTBOX_PHOTO_FILE };
+
+struct OutboxJob {
+    OutboxJobType type;
+    String text;                        // Mensaje o caption
+    uint8_t* data;                      // Copia propia de la foto (PSRAM si hay)
+    size_t size;
+    String path;                        // Foto en SD (se lee al enviar)
+    uint32_t sdTicket;                  // Escritura de path a esperar (0 = ya está en la SD)
+    String chats[MAX_AUTHORIZED_IDS];   // Destinatarios, copiados al encolar
+    int chatCount;
+    uint16_t pendingMask;               // Bit i = chats[i] todavía no lo recibió
+    int attempts;
+    unsigned long enqueuedMs;
+    unsigned long nextAttemptMs;        // Backoff exponencial entre reintentos
+    bool unconfirmed;                   // Alguna foto salió sin respuesta de Telegram
+};
+
+// Estado de la cola de salida (expuesto en /estado y /status)
+struct OutboxStats {
+    int depth;                  // Trabajos en cola o en curso
+    uint32_t completed;
+    uint32_t failed;            // Descartados tras agotar los reintentos
+    uint32_t unconfirmed;       // Terminados con alguna foto sin confirmar (no cuentan en completed)
+    uint32_t retries;
+    uint32_t dropped;           // Rechazados por cola llena
+    float avgLatencyMs;         // Desde que se encola hasta que se entrega
+    uint32_t maxLatencyMs;
+    uint32_t lastLatencyMs;
+};
+
 class TelegramBot {
 public:
     TelegramBot();
@@ -25,8 +78,10 @@ public:
     void init();
     void reinitBot();  // Reinicializar conexion del bot (tras reconexion WiFi)
     void handleMessages();
-    bool sendPhoto(const uint8_t* imageData, size_t imageSize, String caption = "");
-    bool sendPhotoToChat(const uint8_t* imageData, size_t imageSize, String chatId, String caption = "");
+
+    // Envíos asíncronos a todos los chats autorizados: retornan al encolar
+    bool sendPhoto(const uint8_t* imageData, size_t imageSize, String caption = "");  // Copia los datos
+    bool sendPhotoFile(const String& path, String caption = "", uint32_t sdTicket = 0);  // Se lee de SD al enviar
     bool sendMessage(String message);
     bool sendDailyPhoto();                        // Envía la foto diaria guardada en SD
     bool takeDailyPhoto(bool sendToTelegram);     // Toma foto, guarda en SD, envía a Telegram si se indica
@@ -51,11 +106,31 @@ public:
     String getAuthorizedIdsList();
     int getAuthorizedCount();
 
+    TelegramUploadStats getUploadStats() const;
+    OutboxStats getOutboxStats() const;
+    uint32_t getPollRequests() const { return pollRequests; }
+    int getInboxDepth() const { return inbox ? (int)uxQueueMessagesWaiting(inbox) : 0; }
+
 private:
-    WiFiClientSecure client;
-    UniversalTelegramBot* bot;
-    unsigned long lastCheckTime;
-    unsigned long checkInterval;
+    WiFiClientSecure client;        // getUpdates (tarea de long polling)
+    volatile unsigned long checkInterval;   // Pausa entre consultas en modo sleep
+
+    // Recepción: la tarea de polling entrega TelegramUpdate (por valor) a loop()
+    TelegramUpdateParser updateParser;
+    int64_t nextUpdateId;           // offset del próximo getUpdates
+    QueueHandle_t inbox;
+    TaskHandle_t pollTask;
+    volatile bool pollReset;        // Cerrar la conexión de polling (reconexión WiFi)
+    volatile uint32_t pollRequests;
+
+    // Cola de salida: tarea, conexión y bot propios
+    WiFiClientSecure outClient;
+    UniversalTelegramBot* outBot;
+    QueueHandle_t outbox;           // OutboxJob* pendientes de tomar por la tarea
+    TaskHandle_t outboxTask;
+    volatile int outboxActive;      // Trabajos tomados por la tarea sin terminar
+    volatile bool outboxReset;      // Cerrar la conexión de salida (reconexión WiFi)
+    OutboxStats outboxStats;
 
     // Configuración de foto diaria
     DailyPhotoConfig dailyConfig;
@@ -69,8 +144,38 @@ private:
     bool tempAuthMode;
     unsigned long tempAuthExpiry;  // millis() de expiración; 0 = sin límite de tiempo
 
-    void processMessage(telegramMessage& msg);
+    TelegramUploadStats uploadStats;
+
+    String recordChatId;            // Chat que pidió la grabación en curso (/grabar)
+
+    void processMessage(const TelegramUpdate& msg);
     void handleCommand(String command, String chatId);
+    void deliverCapturedPhoto(camera_fb_t* fb, String chatId);
+    bool reply(String chatId, String message);  // Respuesta encolada a un chat
+
+    static void pollTaskEntry(void* arg);
+    void runPoller();
+    int fetchUpdates();
+    bool readUpdatesBody(long contentLength, bool chunked, unsigned long deadline);
+    bool feedUpdates(size_t length, bool untilClose, unsigned long deadline);
+
+    // Cola de salida
+    OutboxJob* newJob(OutboxJobType type, const String& text, const String& chatId);
+    bool enqueue(OutboxJob* job);
+    void freeJob(OutboxJob* job);
+    static void outboxTaskEntry(void* arg);
+    void runOutbox();
+    bool processJob(OutboxJob& job);
+    bool sendJobPhoto(OutboxJob& job, const String& chatId, String& fileId);
+    void recordJobLatency(unsigned long ms);
+
+    // Solo desde la tarea de salida (usan outClient/outBot)
+    bool uploadPhoto(const uint8_t* imageData, File* file, size_t imageSize, String chatId, String caption,
+                     String* fileId = nullptr, bool* unconfirmed = nullptr);
+    bool sendPhotoById(String chatId, String fileId, String caption);
+    bool readResponse(String& body, bool& keepAlive, bool& closedUnanswered);
+    void recordUploadTiming(unsigned long connectMs, unsigned long uploadMs,
+                            unsigned long responseMs, bool reused);
     void sendHelpMessage(String chatId);
     void sendStatusMessage(String chatId);
     void sendDailyConfigMessage(String chatId);
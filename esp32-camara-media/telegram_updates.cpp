@@ -0,0 +1,384 @@
+#include "telegram_updates.h"
+
+static bool isJsonSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+static bool isLiteralChar(char c) {
+    return isalnum((unsigned char)c) || c == '-' || c == '+' || c == '.';
+}
+
+static int hexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+TelegramUpdateParser::TelegramUpdateParser() {
+    begin();
+}
+
+void TelegramUpdateParser::begin() {
+    count = 0;
+    current = nullptr;
+    ok = false;
+    state = P_VALUE;
+    depth = 0;
+    objectBits = 0;
+    readingKey = false;
+    field = F_NONE;
+    dest = nullptr;
+    destCap = 0;
+    destLen = 0;
+    destFull = false;
+    literalLen = 0;
+    unicode = 0;
+    unicodeDigits = 0;
+    highSurrogate = 0;
+}
+
+bool TelegramUpdateParser::feed(const uint8_t* data, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        if (state == P_ERROR) return false;
+        if (!step((char)data[i])) {
+            state = P_ERROR;
+            return false;
+        }
+    }
+    return state != P_ERROR;
+}
+
+bool TelegramUpdateParser::finish() {
+    return state == P_DONE && ok;
+}
+
+int TelegramUpdateParser::getCount() const {
+    return count;
+}
+
+const TelegramUpdate& TelegramUpdateParser::get(int index) const {
+    return slots[index];
+}
+
+int64_t TelegramUpdateParser::getNextOffset(int64_t currentOffset) const {
+    // Solo se confirman los updates guardados: si la respuesta traía más de
+    // los que entran, el siguiente getUpdates los vuelve a pedir
+    if (count == 0) return currentOffset;
+    return slots[count - 1].updateId + 1;
+}
+
+bool TelegramUpdateParser::step(char c) {
+    switch (state) {
+    case P_VALUE:
+        if (isJsonSpace(c)) return true;
+        return startValue(c);
+
+    case P_VALUE_OR_END:
+        if (isJsonSpace(c)) return true;
+        if (c == ']') return pop(false);
+        return startValue(c);
+
+    case P_KEY_OR_END:
+        if (isJsonSpace(c)) return true;
+        if (c == '}') return pop(true);
+        if (c != '"') return false;
+        beginString(true);
+        return true;
+
+    case P_KEY:
+        if (isJsonSpace(c)) return true;
+        if (c != '"') return false;
+        beginString(true);
+        return true;
+
+    case P_COLON:
+        if (isJsonSpace(c)) return true;
+        if (c != ':') return false;
+        state = P_VALUE;
+        return true;
+
+    case P_AFTER_VALUE:
+        if (isJsonSpace(c)) return true;
+        if (c == ',') {
+            state = (objectBits >> (depth - 1)) & 1 ? P_KEY : P_VALUE;
+            return true;
+        }
+        if (c == '}') return pop(true);
+        if (c == ']') return pop(false);
+        return false;
+
+    case P_STRING:
+        if (c == '\\') {
+            state = P_ESCAPE;
+            return true;
+        }
+        if (highSurrogate) {
+            emitCodepoint(0xFFFD);  // Surrogate alto sin pareja
+            highSurrogate = 0;
+        }
+        if (c == '"') {
+            if (readingKey) {
+                state = P_COLON;
+            } else {
+                endValue();
+            }
+            return true;
+        }
+        if ((uint8_t)c < 0x20) return false;  // Control sin escapar
+        emitByte((uint8_t)c);
+        return true;
+
+    case P_ESCAPE: {
+        if (c == 'u') {
+            unicode = 0;
+            unicodeDigits = 0;
+            state = P_UNICODE;
+            return true;
+        }
+        char out;
+        switch (c) {
+            case '"':  out = '"';  break;
+            case '\\': out = '\\'; break;
+            case '/':  out = '/';  break;
+            case 'b':  out = '\b'; break;
+            case 'f':  out = '\f'; break;
+            case 'n':  out = '\n'; break;
+            case 'r':  out = '\r'; break;
+            case 't':  out = '\t'; break;
+            default:   return false;
+        }
+        if (highSurrogate) {
+            emitCodepoint(0xFFFD);
+            highSurrogate = 0;
+        }
+        emitByte((uint8_t)out);
+        state = P_STRING;
+        return true;
+    }
+
+    case P_UNICODE: {
+        int v = hexValue(c);
+        if (v < 0) return false;
+        unicode = (unicode << 4) | v;
+        if (++unicodeDigits < 4) return true;
+
+        if (unicode >= 0xD800 && unicode <= 0xDBFF) {
+            if (highSurrogate) emitCodepoint(0xFFFD);
+            highSurrogate = unicode;
+        } else if (unicode >= 0xDC00 && unicode <= 0xDFFF) {
+            if (highSurrogate) {
+                emitCodepoint(0x10000 + (((uint32_t)highSurrogate - 0xD800) << 10) + (unicode - 0xDC00));
+                highSurrogate = 0;
+            } else {
+                emitCodepoint(0xFFFD);
+            }
+        } else {
+            if (highSurrogate) {
+                emitCodepoint(0xFFFD);
+                highSurrogate = 0;
+            }
+            emitCodepoint(unicode);
+        }
+        state = P_STRING;
+        return true;
+    }
+
+    case P_LITERAL:
+        if (isLiteralChar(c)) {
+            // Un literal más largo que el buffer no es un valor que se use
+            if (literalLen < sizeof(literal) - 1) literal[literalLen++] = c;
+            return true;
+        }
+        if (!endLiteral()) return false;
+        return step(c);  // El delimitador pertenece al siguiente estado
+
+    case P_DONE:
+        return isJsonSpace(c);
+
+    case P_ERROR:
+    default:
+        return false;
+    }
+}
+
+bool TelegramUpdateParser::startValue(char c) {
+    if (c == '{') return push(true);
+    if (c == '[') return push(false);
+    if (c == '"') {
+        beginString(false);
+        return true;
+    }
+    if (c == '-' || (c >= '0' && c <= '9') || c == 't' || c == 'f' || c == 'n') {
+        field = fieldForValue();
+        literal[0] = c;
+        literalLen = 1;
+        state = P_LITERAL;
+        return true;
+    }
+    return false;
+}
+
+void TelegramUpdateParser::beginString(bool isKey) {
+    readingKey = isKey;
+    destLen = 0;
+    destFull = false;
+    highSurrogate = 0;
+
+    if (isKey) {
+        field = F_NONE;
+        int level = depth - 1;
+        dest = level < KEY_DEPTH ? keys[level] : nullptr;
+        destCap = KEY_MAX;
+    } else {
+        field = fieldForValue();
+        switch (field) {
+            case F_CHAT_ID:   dest = current->chatId;   destCap = sizeof(current->chatId);   break;
+            case F_FROM_ID:   dest = current->fromId;   destCap = sizeof(current->fromId);   break;
+            case F_FROM_NAME: dest = current->fromName; destCap = sizeof(current->fromName); break;
+            case F_TEXT:      dest = current->text;     destCap = sizeof(current->text);     break;
+            default:          dest = nullptr;           destCap = 0;                         break;
+        }
+    }
+    if (dest) dest[0] = '\0';
+    state = P_STRING;
+}
+
+bool TelegramUpdateParser::push(bool isObject) {
+    if (depth >= MAX_DEPTH) return false;
+
+    if (isObject) {
+        // Elemento de "result": un update nuevo, si queda slot libre
+        if (depth == 2 && keyIs(0, "result") && !((objectBits >> 1) & 1)) {
+            current = count < TELEGRAM_UPDATE_SLOTS ? &slots[count] : nullptr;
+            if (current) {
+                memset(current, 0, sizeof(*current));
+                current->updateId = -1;
+            }
+        } else if (depth == 3 && current && isMessageKey(2)) {
+            current->hasMessage = true;
+        }
+        objectBits |= (1UL << depth);
+    } else {
+        objectBits &= ~(1UL << depth);
+    }
+    if (depth < KEY_DEPTH) keys[depth][0] = '\0';
+    depth++;
+    state = isObject ? P_KEY_OR_END : P_VALUE_OR_END;
+    return true;
+}
+
+bool TelegramUpdateParser::pop(bool isObject) {
+    if (depth == 0) return false;
+    bool topIsObject = (objectBits >> (depth - 1)) & 1;
+    if (topIsObject != isObject) return false;
+
+    if (isObject && depth == 3 && current) {
+        if (current->updateId >= 0) count++;
+        current = nullptr;
+    }
+    depth--;
+    endValue();
+    return true;
+}
+
+void TelegramUpdateParser::endValue() {
+    state = depth == 0 ? P_DONE : P_AFTER_VALUE;
+}
+
+bool TelegramUpdateParser::endLiteral() {
+    literal[literalLen] = '\0';
+
+    if (literal[0] == 't') {
+        if (strcmp(literal, "true") != 0) return false;
+    } else if (literal[0] == 'f') {
+        if (strcmp(literal, "false") != 0) return false;
+    } else if (literal[0] == 'n') {
+        if (strcmp(literal, "null") != 0) return false;
+    } else {
+        for (size_t i = 0; i < literalLen; i++) {
+            char c = literal[i];
+            if (!isdigit((unsigned char)c) && c != '-' && c != '+' && c != '.' && c != 'e' && c != 'E') {
+                return false;
+            }
+        }
+    }
+
+    switch (field) {
+        case F_OK:
+            ok = strcmp(literal, "true") == 0;
+            break;
+        case F_UPDATE_ID:
+            current->updateId = strtoll(literal, nullptr, 10);
+            break;
+        case F_CHAT_ID:
+            snprintf(current->chatId, sizeof(current->chatId), "%s", literal);
+            break;
+        case F_FROM_ID:
+            snprintf(current->fromId, sizeof(current->fromId), "%s", literal);
+            break;
+        default:
+            break;
+    }
+    endValue();
+    return true;
+}
+
+// Ruta del valor que empieza: depth es la cantidad de contenedores abiertos
+// y keys[depth - 1] la clave dentro del contenedor actual
+TelegramUpdateParser::Field TelegramUpdateParser::fieldForValue() const {
+    if (depth == 1 && keyIs(0, "ok")) return F_OK;
+    if (!current || depth < 3) return F_NONE;
+    if (depth == 3) return keyIs(2, "update_id") ? F_UPDATE_ID : F_NONE;
+    if (!isMessageKey(2)) return F_NONE;
+    if (depth == 4) return keyIs(3, "text") ? F_TEXT : F_NONE;
+    if (depth == 5 && keyIs(3, "chat") && keyIs(4, "id")) return F_CHAT_ID;
+    if (depth == 5 && keyIs(3, "from") && keyIs(4, "id")) return F_FROM_ID;
+    if (depth == 5 && keyIs(3, "from") && keyIs(4, "first_name")) return F_FROM_NAME;
+    return F_NONE;
+}
+
+bool TelegramUpdateParser::keyIs(int level, const char* key) const {
+    return level < KEY_DEPTH && level < depth && ((objectBits >> level) & 1) &&
+           strcmp(keys[level], key) == 0;
+}
+
+bool TelegramUpdateParser::isMessageKey(int level) const {
+    return keyIs(level, "message") || keyIs(level, "edited_message");
+}
+
+// Copia un byte UTF-8 al destino; al inicio de cada carácter se comprueba
+// que entre completo, así un texto truncado nunca queda con un carácter a medias
+void TelegramUpdateParser::emitByte(uint8_t b) {
+    if (!dest || destFull) return;
+
+    size_t need = 1;
+    if ((b & 0xC0) != 0x80) {
+        need = b < 0x80 ? 1 : b >= 0xF0 ? 4 : b >= 0xE0 ? 3 : 2;
+    }
+    if (destLen + need >= destCap) {
+        destFull = true;
+        if (current && field != F_NONE) current->truncated = true;
+        return;
+    }
+    dest[destLen++] = (char)b;
+    dest[destLen] = '\0';
+}
+
+void TelegramUpdateParser::emitCodepoint(uint32_t cp) {
+    if (cp < 0x80) {
+        emitByte(cp);
+    } else if (cp < 0x800) {
+        emitByte(0xC0 | (cp >> 6));
+        emitByte(0x80 | (cp & 0x3F));
+    } else if (cp < 0x10000) {
+        emitByte(0xE0 | (cp >> 12));
+        emitByte(0x80 | ((cp >> 6) & 0x3F));
+        emitByte(0x80 | (cp & 0x3F));
+    } else {
+        emitByte(0xF0 | (cp >> 18));
+        emitByte(0x80 | ((cp >> 12) & 0x3F));
+        emitByte(0x80 | ((cp >> 6) & 0x3F));
+        emitByte(0x80 | (cp & 0x3F));
+    }
+}
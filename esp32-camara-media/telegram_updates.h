@@ -0,0 +1,104 @@
+#ifndef TELEGRAM_UPDATES_H
+#define TELEGRAM_UPDATES_H
+
+#include <Arduino.h>
+#include "config.h"
+
+/*
+ * TelegramUpdateParser - Parser incremental de respuestas de getUpdates
+ *
+ * Recibe el cuerpo HTTP por bloques de cualquier tamaño (feed) y extrae de
+ * cada update solo lo que usa el bot: update_id, chat.id, from.id,
+ * from.first_name y text de "message" o "edited_message". Los valores se
+ * escriben directo en TELEGRAM_UPDATE_SLOTS slots de tamaño fijo; los textos
+ * largos se truncan en un límite de carácter UTF-8 y el resto del JSON se
+ * recorre sin guardarlo.
+ *
+ * No usa heap: la memoria es la misma para una respuesta vacía que para una
+ * ráfaga de mensajes de 4096 caracteres. Un JSON inválido o con más de 32
+ * niveles de anidamiento hace que feed() retorne false.
+ */
+
+struct TelegramUpdate {
+    int64_t updateId;
+    bool hasMessage;            // false = update sin mensaje de texto (se confirma igual)
+    bool truncated;             // Algún campo no entró en su buffer
+    char chatId[24];
+    char fromId[24];
+    char fromName[TELEGRAM_NAME_MAX];
+    char text[TELEGRAM_TEXT_MAX];
+};
+
+class TelegramUpdateParser {
+public:
+    TelegramUpdateParser();
+
+    void begin();                               // Preparar para una respuesta nueva
+    bool feed(const uint8_t* data, size_t len); // false = JSON inválido (descartar)
+    bool finish();                              // true si el JSON terminó y "ok" era true
+
+    int getCount() const;                       // Updates completos en los slots
+    const TelegramUpdate& get(int index) const;
+    int64_t getNextOffset(int64_t current) const;  // offset para el próximo getUpdates
+
+private:
+    enum State {
+        P_VALUE,            // Se espera un valor
+        P_VALUE_OR_END,     // Primer elemento de un array (o ']')
+        P_KEY_OR_END,       // Primera clave de un objeto (o '}')
+        P_KEY,              // Clave tras una coma
+        P_COLON,
+        P_AFTER_VALUE,      // ',' o cierre del contenedor
+        P_STRING,
+        P_ESCAPE,
+        P_UNICODE,
+        P_LITERAL,          // Número, true, false o null
+        P_DONE,
+        P_ERROR
+    };
+
+    // Valores que interesan, según la ruta de claves
+    enum Field { F_NONE, F_OK, F_UPDATE_ID, F_CHAT_ID, F_FROM_ID, F_FROM_NAME, F_TEXT };
+
+    static const int MAX_DEPTH = 32;            // Tipos de contenedor en un bitmap
+    static const int KEY_DEPTH = 5;             // Niveles con clave guardada (hasta message.chat.id)
+    static const int KEY_MAX = 16;
+
+    TelegramUpdate slots[TELEGRAM_UPDATE_SLOTS];
+    int count;
+    TelegramUpdate* current;                    // Slot del update en curso (nullptr = sin lugar)
+    bool ok;
+
+    State state;
+    int depth;
+    uint32_t objectBits;                        // Bit i = el nivel i es un objeto
+    char keys[KEY_DEPTH][KEY_MAX];              // Clave actual de cada nivel
+    bool readingKey;
+
+    // String o literal en curso
+    Field field;
+    char* dest;
+    size_t destCap;
+    size_t destLen;
+    bool destFull;
+    char literal[24];
+    size_t literalLen;
+    uint16_t unicode;
+    int unicodeDigits;
+    uint16_t highSurrogate;                     // Primera mitad de un par \uD83D\uDE00
+
+    bool step(char c);
+    bool startValue(char c);
+    bool push(bool isObject);
+    bool pop(bool isObject);
+    void endValue();
+    bool endLiteral();
+    void beginString(bool isKey);
+    Field fieldForValue() const;
+    bool keyIs(int level, const char* key) const;
+    bool isMessageKey(int level) const;
+    void emitByte(uint8_t b);
+    void emitCodepoint(uint32_t cp);
+};
+
+#endif // TELEGRAM_UPDATES_H
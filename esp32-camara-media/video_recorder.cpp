@@ -0,0 +1,527 @@
+#include "video_recorder.h"
+#include "sd_handler.h"
+#include "frame_pipeline.h"
+#include "replay_buffer.h"
+#include "camera_handler.h"
+#include "esp_timer.h"
+#include "SD_MMC.h"
+#include <unistd.h>
+#include <time.h>
+
+VideoRecorder videoRecorder;
+
+// Protege el estado compartido con loop() (/record, Telegram, métricas)
+static portMUX_TYPE recorderMux = portMUX_INITIALIZER_UNLOCKED;
+
+// Punto de montaje de SD_MMC (ver SDHandler::init) para truncate()
+#define SD_MOUNT_POINT "/sdcard"
+
+#define AVI_KEYFRAME      0x10      // AVIIF_KEYFRAME: todos los JPEG lo son
+#define AVI_HAS_INDEX     0x10      // AVIF_HASINDEX
+#define AVI_MAX_BYTES     0x3F000000UL  // AVI 1.0: los reproductores fallan cerca de 1 GB
+
+static constexpr uint32_t fourcc(const char* s) {
+    return (uint32_t)s[0] | ((uint32_t)s[1] << 8) | ((uint32_t)s[2] << 16) | ((uint32_t)s[3] << 24);
+}
+
+static uint8_t* put32(uint8_t* p, uint32_t v) {
+    p[0] = v;
+    p[1] = v >> 8;
+    p[2] = v >> 16;
+    p[3] = v >> 24;
+    return p + 4;
+}
+
+static uint8_t* put16(uint8_t* p, uint16_t v) {
+    p[0] = v;
+    p[1] = v >> 8;
+    return p + 2;
+}
+
+VideoRecorder::VideoRecorder()
+    : task(nullptr), stopRequested(false), finishedPending(false), pos(0), allocated(0),
+      width(0), height(0), maxFrameSize(0), entryCount(0), indexed(0), startUs(0),
+      intervalUs(0), nextSlot(0), maxSlots(0), frames(0), prevOffset(0), prevSize(0) {
+    memset(&status, 0, sizeof(status));
+}
+
+bool VideoRecorder::begin() {
+    BaseType_t ok = xTaskCreatePinnedToCore(taskEntry, "record", RECORD_TASK_STACK, this,
+                                            RECORD_TASK_PRIORITY, &task, RECORD_TASK_CORE);
+    if (ok != pdPASS) {
+        Serial.println("Error al crear tarea de grabacion");
+        task = nullptr;
+        return false;
+    }
+    return true;
+}
+
+bool VideoRecorder::start(uint32_t seconds, int fps, String& error) {
+    if (!task) {
+        error = "Grabacion no disponible";
+        return false;
+    }
+    if (isRecording()) {
+        error = "Ya hay una grabacion en curso";
+        return false;
+    }
+    if (!sdCard.isInitialized()) {
+        error = "SD no disponible";
+        return false;
+    }
+    if (!framePipeline.isEnabled()) {
+        error = "Grabar requiere PSRAM (pipeline de captura)";
+        return false;
+    }
+
+    if (!SD_MMC.exists("/" RECORDINGS_FOLDER)) {
+        SD_MMC.mkdir("/" RECORDINGS_FOLDER);
+    }
+
+    char name[40];
+    struct tm timeinfo;
+    if (getLocalTime(&timeinfo, 0)) {
+        strftime(name, sizeof(name), "%Y-%m-%d_%H-%M-%S.avi", &timeinfo);
+    } else {
+        snprintf(name, sizeof(name), "video_%lu.avi", millis());
+    }
+    path = "/" RECORDINGS_FOLDER "/" + String(name);
+    indexPath = "/" RECORDINGS_FOLDER "/." + String(name) + ".idx";
+
+    RecorderStatus next;
+    memset(&next, 0, sizeof(next));
+    next.recording = true;
+    snprintf(next.name, sizeof(next.name), "%s", name);
+    next.fps = constrain(fps, 1, RECORD_MAX_FPS);
+    next.maxSeconds = constrain(seconds, (uint32_t)1, (uint32_t)RECORD_MAX_SECONDS);
+
+    portENTER_CRITICAL(&recorderMux);
+    status = next;
+    finishedPending = false;
+    portEXIT_CRITICAL(&recorderMux);
+    stopRequested = false;
+
+    Serial.printf("Grabacion iniciada: %s (%d FPS, max %lu s)\n", path.c_str(), next.fps,
+                  (unsigned long)next.maxSeconds);
+    xTaskNotifyGive(task);
+    return true;
+}
+
+void VideoRecorder::stop() {
+    if (isRecording()) {
+        stopRequested = true;
+    }
+}
+
+bool VideoRecorder::isRecording() const {
+    portENTER_CRITICAL(&recorderMux);
+    bool recording = status.recording;
+    portEXIT_CRITICAL(&recorderMux);
+    return recording;
+}
+
+bool VideoRecorder::isRecordingFile(const String& name) const {
+    RecorderStatus current = getStatus();
+    return current.recording && name == current.name;
+}
+
+RecorderStatus VideoRecorder::getStatus() const {
+    RecorderStatus copy;
+    portENTER_CRITICAL(&recorderMux);
+    copy = status;
+    portEXIT_CRITICAL(&recorderMux);
+    return copy;
+}
+
+bool VideoRecorder::takeFinished(RecorderStatus& out) {
+    bool taken = false;
+    portENTER_CRITICAL(&recorderMux);
+    if (finishedPending) {
+        out = status;
+        finishedPending = false;
+        taken = true;
+    }
+    portEXIT_CRITICAL(&recorderMux);
+    return taken;
+}
+
+void VideoRecorder::taskEntry(void* arg) {
+    static_cast<VideoRecorder*>(arg)->run();
+}
+
+void VideoRecorder::run() {
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        record();
+    }
+}
+
+void VideoRecorder::record() {
+    RecorderStatus params = getStatus();
+    intervalUs = 1000000LL / params.fps;
+    maxSlots = params.fps * params.maxSeconds;
+
+    pos = 0;
+    allocated = 0;
+    width = 0;
+    height = 0;
+    maxFrameSize = 0;
+    entryCount = 0;
+    indexed = 0;
+    startUs = 0;
+    nextSlot = 0;
+    frames = 0;
+    prevOffset = 0;
+    prevSize = 0;
+
+    file = SD_MMC.open(path, FILE_WRITE);
+    indexFile = SD_MMC.open(indexPath, FILE_WRITE);
+    bool ok = file && indexFile;
+    if (ok) {
+        // La cabecera se completa al cerrar; de momento se reserva su espacio
+        writeHeader(0, 0, 0, 4);
+        pos = AVI_HEADER_SIZE;
+        ok = reserve(0);
+    }
+
+    bool holdingFlash = ok && camera.getSettings().flashEnabled;
+    if (holdingFlash) {
+        camera.holdFlashLed();
+    }
+    framePipeline.addConsumer();
+    uint32_t lastSeq = framePipeline.getCapturedCount();
+
+    uint32_t prerollMs = 0;
+    if (ok) {
+        prerollMs = writePreroll();
+        ok = prerollMs != UINT32_MAX;
+    }
+
+    while (ok && !stopRequested && nextSlot < maxSlots) {
+        PipelineFrame* frame = framePipeline.acquireNewer(lastSeq);
+        if (!frame) {
+            if (framePipeline.hasFailed()) {
+                Serial.println("Grabacion: la camara dejo de entregar frames");
+                ok = false;
+                break;
+            }
+            vTaskDelay(pdMS_TO_TICKS(5));
+            continue;
+        }
+        lastSeq = frame->seq;
+
+        PlaceResult result = placeFrame(frame->fb->buf, frame->fb->len, frame->timestampUs,
+                                        frame->fb->width, frame->fb->height);
+        framePipeline.release(frame);
+
+        if (result == PLACE_EARLY) {
+            // Llegó antes de su turno: esperar al siguiente
+            int64_t dueUs = startUs + nextSlot * intervalUs - intervalUs / 2;
+            int64_t waitMs = (dueUs - esp_timer_get_time()) / 1000;
+            vTaskDelay(pdMS_TO_TICKS(max((int64_t)1, waitMs)));
+            continue;
+        }
+        if (result != PLACE_WRITTEN) {
+            ok = result == PLACE_FULL;
+            break;
+        }
+        updateStatus();
+    }
+
+    framePipeline.removeConsumer();
+    if (holdingFlash) {
+        camera.releaseFlashLed();
+    }
+
+    uint32_t durationMs = (uint32_t)(nextSlot * intervalUs / 1000);
+    bool saved = file && indexFile && frames > 0 && finalize(durationMs);
+    if (file) file.close();
+    if (indexFile) indexFile.close();
+    SD_MMC.remove(indexPath);
+
+    if (saved) {
+        // Quitar lo reservado de más; si no se puede, queda dentro de un chunk JUNK
+        if (allocated > pos + 8 && truncate((SD_MOUNT_POINT + path).c_str(), pos) != 0) {
+            File tail = SD_MMC.open(path, "r+");
+            if (tail) {
+                uint8_t junk[8];
+                buildAviChunk(junk, "JUNK", allocated - pos - 8);
+                uint8_t riff[4];
+                put32(riff, allocated - 8);
+                tail.seek(pos);
+                tail.write(junk, sizeof(junk));
+                tail.seek(4);
+                tail.write(riff, sizeof(riff));
+                tail.close();
+            }
+        }
+        Serial.printf("Grabacion guardada: %s (%lu frames, %lu s, %lu bytes)\n", path.c_str(),
+                      (unsigned long)frames, (unsigned long)(durationMs / 1000), (unsigned long)pos);
+    } else {
+        SD_MMC.remove(path);
+        Serial.println("Error en la grabacion, archivo descartado");
+    }
+
+    portENTER_CRITICAL(&recorderMux);
+    status.recording = false;
+    status.failed = !saved;
+    status.frames = frames;
+    status.indexFrames = indexed;
+    status.durationMs = durationMs;
+    status.prerollMs = saved ? prerollMs : 0;
+    status.bytes = saved ? pos : 0;
+    finishedPending = true;
+    portEXIT_CRITICAL(&recorderMux);
+}
+
+// Frames del anillo de pre-roll al principio del video; retorna los ms que
+// ocupan (UINT32_MAX si falló la escritura)
+uint32_t VideoRecorder::writePreroll() {
+    ReplayFrame preroll[REPLAY_MAX_FRAMES];
+    int count = replayBuffer.acquire(preroll, REPLAY_MAX_FRAMES);
+    if (count == 0) {
+        return 0;
+    }
+
+    // La duración pedida se cuenta desde start(): el pre-roll va aparte
+    startUs = preroll[0].timestampUs;
+    uint32_t prerollSlots = (uint32_t)((esp_timer_get_time() - startUs + intervalUs / 2) / intervalUs);
+    maxSlots += prerollSlots;
+
+    bool ok = true;
+    for (int i = 0; ok && i < count; i++) {
+        PlaceResult result = placeFrame(preroll[i].data, preroll[i].size, preroll[i].timestampUs,
+                                        preroll[i].width, preroll[i].height);
+        ok = result != PLACE_ERROR;
+    }
+    replayBuffer.release(preroll, count);
+    if (!ok) {
+        return UINT32_MAX;
+    }
+
+    uint32_t prerollMs = (uint32_t)(nextSlot * intervalUs / 1000);
+    updateStatus();
+    portENTER_CRITICAL(&recorderMux);
+    status.prerollMs = prerollMs;
+    portEXIT_CRITICAL(&recorderMux);
+    Serial.printf("Grabacion: %d frames de pre-roll (%lu ms)\n", count, (unsigned long)prerollMs);
+    return prerollMs;
+}
+
+// Escribe el frame en la posición que le toca según su timestamp; los huecos
+// (frames perdidos o SD lenta) repiten el anterior en el índice
+VideoRecorder::PlaceResult VideoRecorder::placeFrame(const uint8_t* data, size_t size, int64_t timestampUs,
+                                                     uint16_t frameWidth, uint16_t frameHeight) {
+    if (frames == 0) {
+        if (startUs == 0) startUs = timestampUs;
+        width = frameWidth;
+        height = frameHeight;
+    }
+
+    int64_t elapsedUs = timestampUs - startUs + intervalUs / 2;
+    uint32_t slot = elapsedUs > 0 ? (uint32_t)(elapsedUs / intervalUs) : 0;
+    if (slot < nextSlot) {
+        return PLACE_EARLY;
+    }
+
+    while (nextSlot < slot && nextSlot < maxSlots && prevSize > 0) {
+        if (!addIndex(prevOffset, prevSize)) {
+            return PLACE_ERROR;
+        }
+        nextSlot++;
+    }
+    if (nextSlot >= maxSlots) {
+        return PLACE_FULL;
+    }
+
+    uint32_t offset;
+    if (!writeFrame(data, size, offset) || !addIndex(offset, size)) {
+        return PLACE_ERROR;
+    }
+    prevOffset = offset;
+    prevSize = size;
+    nextSlot = max(nextSlot, slot) + 1;
+    frames++;
+    return PLACE_WRITTEN;
+}
+
+// Amplía la reserva del archivo si los próximos bytes no caben
+bool VideoRecorder::reserve(uint32_t bytes) {
+    if (pos + bytes <= allocated) {
+        return true;
+    }
+    if ((uint64_t)pos + bytes > AVI_MAX_BYTES) {
+        Serial.println("Grabacion: tamaño maximo del AVI alcanzado");
+        return false;
+    }
+    allocated = min((uint64_t)pos + bytes + RECORD_PREALLOC_STEP, (uint64_t)AVI_MAX_BYTES);
+    // Seek más allá del final: FATFS asigna toda la cadena de clusters
+    return file.seek(allocated) && file.seek(pos);
+}
+
+bool VideoRecorder::writeFrame(const uint8_t* data, size_t size, uint32_t& offset) {
+    uint32_t padded = size + (size & 1);
+    if (!reserve(8 + padded)) {
+        return false;
+    }
+
+    uint8_t chunk[8];
+    buildAviChunk(chunk, "00dc", size);
+    offset = pos - AVI_MOVI_FOURCC;
+    bool ok = file.write(chunk, sizeof(chunk)) == sizeof(chunk) &&
+              sdCard.writeData(file, data, size) == size;
+    if (ok && (size & 1)) {
+        uint8_t pad = 0;
+        ok = file.write(&pad, 1) == 1;
+    }
+    if (!ok) {
+        Serial.println("Grabacion: error de escritura en la SD");
+        return false;
+    }
+
+    pos += 8 + padded;
+    if (size > maxFrameSize) maxFrameSize = size;
+    return true;
+}
+
+bool VideoRecorder::addIndex(uint32_t offset, uint32_t size) {
+    entries[entryCount++] = aviIndexEntry(offset, size);
+    indexed++;
+    return entryCount < RECORD_INDEX_CHUNK || flushIndex();
+}
+
+// El índice se acumula en un archivo aparte hasta el final de la grabación
+bool VideoRecorder::flushIndex() {
+    size_t bytes = entryCount * sizeof(AviIndexEntry);
+    bool ok = entryCount == 0 || indexFile.write((const uint8_t*)entries, bytes) == bytes;
+    entryCount = 0;
+    if (!ok) {
+        Serial.println("Grabacion: error al escribir el indice");
+    }
+    return ok;
+}
+
+bool VideoRecorder::finalize(uint32_t durationMs) {
+    if (!flushIndex()) {
+        return false;
+    }
+    indexFile.close();
+    indexFile = SD_MMC.open(indexPath, FILE_READ);
+
+    // idx1 al final del movi, copiado por bloques del archivo auxiliar
+    uint32_t indexBytes = indexed * sizeof(AviIndexEntry);
+    if (!indexFile || !reserve(8 + indexBytes)) {
+        return false;
+    }
+    uint8_t chunk[8];
+    buildAviChunk(chunk, "idx1", indexBytes);
+    bool ok = file.write(chunk, sizeof(chunk)) == sizeof(chunk);
+
+    uint8_t buffer[RECORD_INDEX_CHUNK * sizeof(AviIndexEntry)];
+    uint32_t copied = 0;
+    while (ok && copied < indexBytes) {
+        size_t n = indexFile.read(buffer, min((uint32_t)sizeof(buffer), indexBytes - copied));
+        ok = n > 0 && file.write(buffer, n) == n;
+        copied += n;
+    }
+    if (!ok) {
+        Serial.println("Grabacion: error al copiar el indice");
+        return false;
+    }
+    uint32_t moviEnd = pos;
+    pos += 8 + indexBytes;
+
+    // Cabecera definitiva con los totales; LIST movi llega hasta idx1
+    return file.seek(0) && writeHeader(indexed, durationMs, pos - 8, moviEnd - AVI_MOVI_FOURCC);
+}
+
+bool VideoRecorder::writeHeader(uint32_t totalFrames, uint32_t durationMs, uint32_t riffSize, uint32_t moviSize) {
+    AviInfo info = { status.fps, width, height, totalFrames, maxFrameSize, durationMs, riffSize, moviSize };
+    uint8_t header[AVI_HEADER_SIZE];
+    buildAviHeader(header, info);
+    return file.write(header, sizeof(header)) == sizeof(header);
+}
+
+void VideoRecorder::buildAviChunk(uint8_t* chunk, const char* id, uint32_t size) {
+    put32(put32(chunk, fourcc(id)), size);
+}
+
+AviIndexEntry VideoRecorder::aviIndexEntry(uint32_t offset, uint32_t size) {
+    return { fourcc("00dc"), AVI_KEYFRAME, offset, size };
+}
+
+void VideoRecorder::buildAviHeader(uint8_t* header, const AviInfo& info) {
+    memset(header, 0, AVI_HEADER_SIZE);
+    uint32_t bytesPerSec = info.durationMs > 0 ? (uint32_t)((uint64_t)info.riffSize * 1000 / info.durationMs) : 0;
+
+    uint8_t* p = header;
+    p = put32(p, fourcc("RIFF"));
+    p = put32(p, info.riffSize);
+    p = put32(p, fourcc("AVI "));
+
+    p = put32(p, fourcc("LIST"));
+    p = put32(p, 192);                        // hdrl: de 'hdrl' al final de strf
+    p = put32(p, fourcc("hdrl"));
+
+    p = put32(p, fourcc("avih"));
+    p = put32(p, 56);
+    p = put32(p, 1000000 / info.fps);         // dwMicroSecPerFrame
+    p = put32(p, bytesPerSec);                // dwMaxBytesPerSec
+    p = put32(p, 0);                          // dwPaddingGranularity
+    p = put32(p, AVI_HAS_INDEX);              // dwFlags
+    p = put32(p, info.totalFrames);           // dwTotalFrames
+    p = put32(p, 0);                          // dwInitialFrames
+    p = put32(p, 1);                          // dwStreams
+    p = put32(p, info.maxFrameSize + 8);      // dwSuggestedBufferSize
+    p = put32(p, info.width);
+    p = put32(p, info.height);
+    p += 16;                                  // dwReserved[4]
+
+    p = put32(p, fourcc("LIST"));
+    p = put32(p, 116);                        // strl: strh + strf
+    p = put32(p, fourcc("strl"));
+
+    p = put32(p, fourcc("strh"));
+    p = put32(p, 56);
+    p = put32(p, fourcc("vids"));
+    p = put32(p, fourcc("MJPG"));
+    p = put32(p, 0);                          // dwFlags
+    p = put16(p, 0);                          // wPriority
+    p = put16(p, 0);                          // wLanguage
+    p = put32(p, 0);                          // dwInitialFrames
+    p = put32(p, 1);                          // dwScale
+    p = put32(p, info.fps);                   // dwRate: fps = rate / scale
+    p = put32(p, 0);                          // dwStart
+    p = put32(p, info.totalFrames);           // dwLength
+    p = put32(p, info.maxFrameSize + 8);      // dwSuggestedBufferSize
+    p = put32(p, 0xFFFFFFFF);                 // dwQuality (por defecto)
+    p = put32(p, 0);                          // dwSampleSize
+    p = put16(p, 0);                          // rcFrame
+    p = put16(p, 0);
+    p = put16(p, info.width);
+    p = put16(p, info.height);
+
+    p = put32(p, fourcc("strf"));
+    p = put32(p, 40);
+    p = put32(p, 40);                         // BITMAPINFOHEADER.biSize
+    p = put32(p, info.width);
+    p = put32(p, info.height);
+    p = put16(p, 1);                          // biPlanes
+    p = put16(p, 24);                         // biBitCount
+    p = put32(p, fourcc("MJPG"));             // biCompression
+    p = put32(p, (uint32_t)info.width * info.height * 3);
+    p += 16;                                  // Resolución y paleta
+
+    p = put32(p, fourcc("LIST"));
+    p = put32(p, info.moviSize);              // Desde 'movi' hasta el final de los frames
+    put32(p, fourcc("movi"));
+}
+
+void VideoRecorder::updateStatus() {
+    portENTER_CRITICAL(&recorderMux);
+    status.frames = frames;
+    status.indexFrames = indexed;
+    status.durationMs = (uint32_t)(nextSlot * intervalUs / 1000);
+    status.bytes = pos;
+    portEXIT_CRITICAL(&recorderMux);
+}
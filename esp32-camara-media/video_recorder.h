@@ -0,0 +1,144 @@
+#ifndef VIDEO_RECORDER_H
+#define VIDEO_RECORDER_H
+
+#include <Arduino.h>
+#include "FS.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "config.h"
+
+/*
+ * VideoRecorder - Grabación de video en la SD como AVI (MJPEG)
+ *
+ * Una tarea toma los JPEG del pipeline de captura y los añade como chunks
+ * '00dc' a un AVI en /grabaciones. El archivo crece por reservas de
+ * RECORD_PREALLOC_STEP (FATFS asigna los clusters de una vez) y al cerrar se
+ * recorta a su tamaño real.
+ *
+ * El índice (idx1) se va escribiendo por bloques en un archivo auxiliar y se
+ * copia al final del AVI al terminar, así la RAM usada no depende de la
+ * duración. Los tiempos son reales: cada frame ocupa la posición que le toca
+ * según su timestamp y los huecos repiten en el índice el frame anterior (sin
+ * volver a escribir datos), el video dura lo mismo que la grabación.
+ *
+ * Cada grabación empieza con los frames del pre-roll (ReplayBuffer): el video
+ * incluye los REPLAY_SECONDS anteriores a start().
+ *
+ * start() y stop() se llaman desde loop() (/record y /grabar de Telegram).
+ * El formato AVI (cabecera, chunks e índice) es público para /replay.
+ */
+
+// Estructura fija del AVI: RIFF, LIST hdrl (avih, LIST strl con strh y strf)
+// y la cabecera de LIST movi. Los frames empiezan en AVI_HEADER_SIZE
+#define AVI_HEADER_SIZE   224
+#define AVI_MOVI_FOURCC   220       // Posición de 'movi': base de los offsets de idx1
+
+struct AviInfo {
+    int fps;
+    uint16_t width;
+    uint16_t height;
+    uint32_t totalFrames;           // Entradas del índice
+    uint32_t maxFrameSize;
+    uint32_t durationMs;
+    uint32_t riffSize;              // Tamaño del archivo - 8
+    uint32_t moviSize;              // Desde 'movi' hasta el final de los frames
+};
+
+struct AviIndexEntry {
+    uint32_t ckid;
+    uint32_t flags;
+    uint32_t offset;                // Relativo al FOURCC 'movi'
+    uint32_t size;
+};
+
+struct RecorderStatus {
+    bool recording;
+    bool failed;                    // La última grabación terminó por un error
+    char name[40];                  // Archivo en RECORDINGS_FOLDER
+    int fps;
+    uint32_t maxSeconds;
+    uint32_t frames;                // Frames escritos
+    uint32_t indexFrames;           // Entradas del índice (incluye repetidos)
+    uint32_t durationMs;
+    uint32_t prerollMs;             // Parte de durationMs anterior a start()
+    uint32_t bytes;                 // Tamaño del AVI
+};
+
+class VideoRecorder {
+public:
+    VideoRecorder();
+
+    bool begin();                   // Crea la tarea (espera a start())
+
+    // Empieza a grabar; seconds y fps se limitan a RECORD_MAX_*. false si ya
+    // graba, no hay SD o no hay pipeline de captura (sin PSRAM)
+    bool start(uint32_t seconds, int fps, String& error);
+    void stop();                    // La tarea cierra el archivo enseguida
+
+    bool isRecording() const;
+    bool isRecordingFile(const String& name) const;
+    RecorderStatus getStatus() const;
+
+    // Una vez por grabación terminada (para avisar a quien la pidió)
+    bool takeFinished(RecorderStatus& status);
+
+    // Formato AVI MJPEG: cabecera completa, cabecera de chunk ('00dc', 'idx1')
+    // y entrada de idx1 para un frame
+    static void buildAviHeader(uint8_t* header, const AviInfo& info);
+    static void buildAviChunk(uint8_t* chunk, const char* id, uint32_t size);
+    static AviIndexEntry aviIndexEntry(uint32_t offset, uint32_t size);
+
+private:
+    enum PlaceResult {
+        PLACE_WRITTEN,
+        PLACE_EARLY,                // Antes de su posición: se descarta
+        PLACE_FULL,                 // Se alcanzó la duración máxima
+        PLACE_ERROR
+    };
+
+    TaskHandle_t task;
+    RecorderStatus status;
+    volatile bool stopRequested;
+    bool finishedPending;
+
+    // Estado de la grabación en curso (solo lo toca la tarea)
+    File file;
+    File indexFile;
+    String path;
+    String indexPath;
+    uint32_t pos;                   // Siguiente byte a escribir
+    uint32_t allocated;             // Bytes reservados en la SD
+    uint16_t width;
+    uint16_t height;
+    uint32_t maxFrameSize;
+    AviIndexEntry entries[RECORD_INDEX_CHUNK];
+    int entryCount;
+    uint32_t indexed;
+
+    // Posición de los frames según su timestamp
+    int64_t startUs;                // Timestamp del primer frame (slot 0)
+    int64_t intervalUs;
+    uint32_t nextSlot;
+    uint32_t maxSlots;
+    uint32_t frames;
+    uint32_t prevOffset;            // Último frame escrito (para repetirlo en huecos)
+    uint32_t prevSize;
+
+    static void taskEntry(void* arg);
+    void run();
+    void record();
+    uint32_t writePreroll();
+    PlaceResult placeFrame(const uint8_t* data, size_t size, int64_t timestampUs,
+                           uint16_t frameWidth, uint16_t frameHeight);
+    bool reserve(uint32_t bytes);
+    bool writeFrame(const uint8_t* data, size_t size, uint32_t& offset);
+    bool addIndex(uint32_t offset, uint32_t size);
+    bool flushIndex();
+    bool finalize(uint32_t durationMs);
+    bool writeHeader(uint32_t totalFrames, uint32_t durationMs, uint32_t riffSize, uint32_t moviSize);
+    void updateStatus();
+};
+
+extern VideoRecorder videoRecorder;
+
+#endif // VIDEO_RECORDER_H
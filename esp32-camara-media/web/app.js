@@ -0,0 +1,613 @@
+let streaming = false;
+let captureFlash = false;
+let photoList = [];
+let currentPhotoIndex = -1;
+let currentFolder = 'fotos_web';
+let folderList = [];
+
+function showToast(message) {
+    const toast = document.getElementById('toast');
+    toast.textContent = message;
+    toast.classList.add('show');
+    setTimeout(() => toast.classList.remove('show'), 3000);
+}
+
+function toggleStream() {
+    const img = document.getElementById('stream');
+    const btn = document.getElementById('streamBtn');
+    streaming = !streaming;
+
+    if (streaming) {
+        img.src = '/stream?' + Date.now();
+        btn.innerHTML = '&#9209; Detener Stream';
+    } else {
+        img.src = '';
+        const parent = img.parentNode;
+        const newImg = document.createElement('img');
+        newImg.id = 'stream';
+        newImg.alt = 'Stream';
+        parent.replaceChild(newImg, img);
+        btn.innerHTML = '&#9654; Iniciar Stream';
+        setTimeout(() => {
+            const currentImg = document.getElementById('stream');
+            if (currentImg && !streaming) {
+                currentImg.src = '/capture?' + Date.now();
+            }
+        }, 500);
+    }
+}
+
+function toggleCaptureFlash() {
+    captureFlash = !captureFlash;
+    const btn = document.getElementById('flashToggleBtn');
+    if (captureFlash) {
+        btn.innerHTML = '&#9889; Con Flash';
+        btn.style.background = 'linear-gradient(135deg,#e0c000,#a08000)';
+        btn.style.color = '#000';
+        btn.style.border = '1px solid rgba(255,220,0,0.6)';
+        btn.style.boxShadow = '0 0 10px rgba(255,220,0,0.4)';
+    } else {
+        btn.innerHTML = '&#9889; Sin Flash';
+        btn.style.background = 'rgba(255,255,255,0.07)';
+        btn.style.color = '#888';
+        btn.style.border = '1px solid rgba(255,220,0,0.3)';
+        btn.style.boxShadow = 'none';
+    }
+}
+
+async function toggleFan() {
+    const btn = document.getElementById('fanToggleBtn');
+    const isOn = btn.dataset.fanOn === '1';
+    const newState = isOn ? 'off' : 'on';
+    try {
+        const r = await fetch('/fan?state=' + newState);
+        const data = await r.json();
+        const on = data.fan;
+        btn.dataset.fanOn = on ? '1' : '0';
+        if (on) {
+            btn.innerHTML = '&#128168; Fan ON';
+            btn.style.background = 'linear-gradient(135deg,#0090c0,#005080)';
+            btn.style.color = '#fff';
+            btn.style.border = '1px solid rgba(0,200,255,0.6)';
+            btn.style.boxShadow = '0 0 10px rgba(0,200,255,0.4)';
+        } else {
+            btn.innerHTML = '&#128168; Fan OFF';
+            btn.style.background = 'rgba(255,255,255,0.07)';
+            btn.style.color = '#888';
+            btn.style.border = '1px solid rgba(0,200,255,0.3)';
+            btn.style.boxShadow = 'none';
+        }
+    } catch(e) {
+        showToast('Error al controlar el ventilador');
+    }
+}
+
+async function doCapture() {
+    try {
+        const flashParam = captureFlash ? '&flash=1' : '&flash=0';
+        const response = await fetch('/web-capture?' + Date.now() + flashParam);
+        if (!response.ok) {
+            showToast('Error al capturar');
+            return;
+        }
+        const photoName = response.headers.get('X-Photo-Name');
+        const img = document.getElementById('stream');
+        if (photoName) {
+            img.src = '/photo?folder=fotos_web&name=' + encodeURIComponent(photoName);
+            showToast('Foto guardada: ' + photoName);
+            if (currentFolder === 'fotos_web') {
+                await loadPhotos();
+                if (photoList.length > 0) showViewer(0);
+            } else {
+                selectFolder('fotos_web');
+            }
+        } else {
+            const blob = await response.blob();
+            img.src = URL.createObjectURL(blob);
+            showToast('Foto capturada (sin SD)');
+        }
+    } catch (error) {
+        showToast('Error al capturar');
+    }
+}
+
+function capturePhoto() {
+    const btn = document.getElementById('streamBtn');
+
+    if (streaming) {
+        const img = document.getElementById('stream');
+        streaming = false;
+        img.src = '';
+        const parent = img.parentNode;
+        const newImg = document.createElement('img');
+        newImg.id = 'stream';
+        newImg.alt = 'Stream';
+        parent.replaceChild(newImg, img);
+        btn.innerHTML = '&#9654; Iniciar Stream';
+        setTimeout(doCapture, 500);
+    } else {
+        doCapture();
+    }
+}
+
+async function updateSetting(name, value) {
+    const slider = document.getElementById(name + 'Val');
+    if (slider) slider.textContent = value;
+
+    if (name === 'frameSize' && streaming) {
+        const img = document.getElementById('stream');
+        const btn = document.getElementById('streamBtn');
+        streaming = false;
+        img.src = '';
+        const parent = img.parentNode;
+        const newImg = document.createElement('img');
+        newImg.id = 'stream';
+        newImg.alt = 'Stream';
+        parent.replaceChild(newImg, img);
+
+        await new Promise(r => setTimeout(r, 500));
+        try {
+            await fetch('/settings', {
+                method: 'POST',
+                headers: { 'Content-Type': 'application/json' },
+                body: JSON.stringify({ [name]: value })
+            });
+        } catch (error) {
+            showToast('Error al actualizar');
+            btn.innerHTML = '&#9654; Iniciar Stream';
+            return;
+        }
+
+        streaming = true;
+        btn.innerHTML = '&#9209; Detener Stream';
+        document.getElementById('stream').src = '/stream?' + Date.now();
+        return;
+    }
+
+    try {
+        await fetch('/settings', {
+            method: 'POST',
+            headers: { 'Content-Type': 'application/json' },
+            body: JSON.stringify({ [name]: value })
+        });
+    } catch (error) {
+        showToast('Error al actualizar');
+    }
+}
+
+async function saveSettings() {
+    try {
+        const response = await fetch('/settings', {
+            method: 'POST',
+            headers: { 'Content-Type': 'application/json' },
+            body: JSON.stringify({ save: true })
+        });
+        if (response.ok) {
+            showToast('Configuracion guardada');
+        }
+    } catch (error) {
+        showToast('Error al guardar');
+    }
+}
+
+async function loadSettings() {
+    try {
+        const response = await fetch('/settings');
+        const settings = await response.json();
+
+        document.getElementById('brightness').value = settings.brightness;
+        document.getElementById('brightnessVal').textContent = settings.brightness;
+        document.getElementById('contrast').value = settings.contrast;
+        document.getElementById('contrastVal').textContent = settings.contrast;
+        document.getElementById('saturation').value = settings.saturation;
+        document.getElementById('saturationVal').textContent = settings.saturation;
+        document.getElementById('quality').value = settings.quality;
+        document.getElementById('qualityVal').textContent = settings.quality;
+        document.getElementById('frameSize').value = settings.frameSize;
+        document.getElementById('streamFps').value = settings.streamFps;
+        document.getElementById('streamFpsVal').textContent = settings.streamFps;
+        document.getElementById('specialEffect').value = settings.specialEffect;
+        document.getElementById('whiteBalance').value = settings.whiteBalance;
+        document.getElementById('flash').checked = settings.flash;
+        document.getElementById('exposureCtrl').checked = settings.exposureCtrl;
+        document.getElementById('gainCtrl').checked = settings.gainCtrl;
+    } catch (error) {
+        console.error('Error loading settings:', error);
+    }
+}
+
+// Una sola consulta periódica: /metrics trae memoria, SD y WiFi de la copia
+// que el ESP32 refresca en segundo plano
+async function loadStatus() {
+    try {
+        const response = await fetch('/metrics?format=json');
+        const m = await response.json();
+
+        document.getElementById('heapValue').textContent = Math.round(m.heap.free / 1024);
+        document.getElementById('psramValue').textContent = Math.round(m.psram.free / 1024);
+        showWifiStatus(m.wifi);
+
+        if (m.sd.ok && m.sd.totalMB > 0) {
+            var freeGB = (m.sd.freeMB / 1024).toFixed(1);
+            var totalGB = (m.sd.totalMB / 1024).toFixed(1);
+            document.getElementById('sdValue').textContent = freeGB + '/' + totalGB + ' GB Libres';
+            var usedPct = ((m.sd.usedMB / m.sd.totalMB) * 100).toFixed(1);
+            var bar = document.getElementById('sdBarFill');
+            bar.style.width = usedPct + '%';
+            if (usedPct > 90) bar.style.background = 'linear-gradient(90deg,#ff00ff,#aa00aa)';
+            else if (usedPct > 70) bar.style.background = 'linear-gradient(90deg,#e0ff00,#aacc00)';
+            else bar.style.background = 'linear-gradient(90deg,#00f0ff,#0099aa)';
+            document.getElementById('sdBarContainer').style.display = 'block';
+        } else {
+            document.getElementById('sdValue').textContent = '--';
+            document.getElementById('sdBarContainer').style.display = 'none';
+        }
+    } catch (error) {
+        console.error('Error loading status:', error);
+    }
+}
+
+function getFolderDisplayName(name) {
+    if (name === 'fotos_diarias') return 'Diarias';
+    if (name === 'fotos_telegram') return 'Telegram';
+    if (name === 'fotos_web') return 'Web';
+    return name;
+}
+
+async function loadFolders() {
+    try {
+        const response = await fetch('/folders');
+        const folders = await response.json();
+        folderList = folders;
+        const container = document.getElementById('folderTabs');
+
+        if (folders.length === 0) {
+            container.innerHTML = '<p style="color:#888;font-size:0.85em;">No hay carpetas</p>';
+            return;
+        }
+
+        let html = '';
+        folders.forEach(f => {
+            const isActive = f.name === currentFolder ? ' active' : '';
+            html += '<button class="folder-tab' + isActive + '" onclick="selectFolder(\'' + f.name + '\')">';
+            html += getFolderDisplayName(f.name) + ' (' + f.count + ')';
+            html += '</button>';
+        });
+        container.innerHTML = html;
+    } catch (error) {
+        console.error('Error loading folders:', error);
+    }
+}
+
+function selectFolder(folder) {
+    currentFolder = folder;
+    closeViewer();
+    // Update tab active state
+    document.querySelectorAll('.folder-tab').forEach(tab => {
+        tab.classList.remove('active');
+        if (tab.textContent.startsWith(getFolderDisplayName(folder))) {
+            tab.classList.add('active');
+        }
+    });
+    loadPhotos();
+}
+
+function formatPhotoDate(name) {
+    var d = name;
+    if (d.startsWith('web_')) d = d.substring(4);
+    if (d.length >= 16) {
+        var s = d.substring(8,10)+'/'+d.substring(5,7)+'/'+d.substring(0,4)+' '+d.substring(11,13)+':'+d.substring(14,16);
+        if (d.length >= 19 && d.charAt(16) === '-') s += ':'+d.substring(17,19);
+        return s;
+    }
+    return name;
+}
+
+async function loadPhotos() {
+    try {
+        const response = await fetch('/photos?folder=' + encodeURIComponent(currentFolder));
+        const photos = await response.json();
+        const gallery = document.getElementById('photoGallery');
+
+        if (photos.length === 0) {
+            photoList = [];
+            gallery.innerHTML = '<p style="color:#888;text-align:center;">No hay fotos en ' + getFolderDisplayName(currentFolder) + '</p>';
+            return;
+        }
+
+        photos.sort((a, b) => b.name.localeCompare(a.name));
+        photoList = photos;
+        let html = '';
+        photos.forEach(photo => {
+            const sizeKB = Math.round(photo.size / 1024);
+            const thumbUrl = '/thumb?folder=' + encodeURIComponent(currentFolder) + '&name=' + encodeURIComponent(photo.name) + '&v=' + photo.size;
+            html += '<div style="display:flex;align-items:center;justify-content:space-between;padding:8px 5px;border-bottom:1px solid rgba(0,255,255,0.1);">';
+            html += '<img src="' + thumbUrl + '" loading="lazy" alt="" onclick="viewPhoto(\'' + photo.name + '\')" onerror="this.style.visibility=\'hidden\'" style="width:64px;height:48px;object-fit:cover;border-radius:4px;margin-right:10px;flex-shrink:0;cursor:pointer;background:#111;">';
+            html += '<div style="flex:1;overflow:hidden;min-width:0;">';
+            html += '<div style="color:#0ff;font-size:0.85em;white-space:nowrap;overflow:hidden;text-overflow:ellipsis;">' + formatPhotoDate(photo.name) + ' <span style="color:#888;">(' + sizeKB + 'KB)</span></div>';
+            html += '<div style="color:#555;font-size:0.7em;white-space:nowrap;overflow:hidden;text-overflow:ellipsis;">' + photo.name + '</div>';
+            html += '</div>';
+            html += '<div style="display:flex;gap:5px;flex-shrink:0;margin-left:10px;">';
+            html += '<button onclick="viewPhoto(\'' + photo.name + '\')" style="padding:5px 10px;background:linear-gradient(135deg,#00f0ff,#0099aa);color:#000;border:none;border-radius:5px;cursor:pointer;font-size:0.8em;font-weight:600;">Ver</button>';
+            html += '<button onclick="downloadPhoto(\'' + photo.name + '\')" style="padding:5px 10px;background:linear-gradient(135deg,#e0ff00,#aacc00);color:#000;border:none;border-radius:5px;cursor:pointer;font-size:0.8em;font-weight:600;">&#128229; Descargar</button>';
+            html += '<button onclick="deletePhoto(\'' + photo.name + '\')" style="padding:5px 10px;background:linear-gradient(135deg,#ff0055,#aa0033);color:#fff;border:none;border-radius:5px;cursor:pointer;font-size:0.8em;font-weight:600;">Eliminar</button>';
+            html += '</div></div>';
+        });
+        gallery.innerHTML = html;
+    } catch (error) {
+        console.error('Error loading photos:', error);
+    }
+}
+
+function viewPhoto(name) {
+    const idx = photoList.findIndex(p => p.name === name);
+    if (idx >= 0) {
+        showViewer(idx);
+    } else {
+        window.open('/photo?folder=' + encodeURIComponent(currentFolder) + '&name=' + encodeURIComponent(name), '_blank');
+    }
+}
+
+function showViewer(index) {
+    if (index < 0 || index >= photoList.length) return;
+    currentPhotoIndex = index;
+    const photo = photoList[index];
+    const viewer = document.getElementById('photoViewer');
+    const img = document.getElementById('viewerImg');
+    const nameEl = document.getElementById('viewerName');
+    const rawEl = document.getElementById('viewerRaw');
+    const counterEl = document.getElementById('viewerCounter');
+    img.src = '/photo?folder=' + encodeURIComponent(currentFolder) + '&name=' + encodeURIComponent(photo.name);
+    nameEl.textContent = formatPhotoDate(photo.name);
+    rawEl.textContent = photo.name;
+    counterEl.textContent = (index + 1) + ' / ' + photoList.length;
+    document.getElementById('prevBtn').disabled = (index === 0);
+    document.getElementById('nextBtn').disabled = (index === photoList.length - 1);
+    viewer.classList.add('active');
+}
+
+function prevPhoto() {
+    if (currentPhotoIndex > 0) showViewer(currentPhotoIndex - 1);
+}
+
+function nextPhoto() {
+    if (currentPhotoIndex < photoList.length - 1) showViewer(currentPhotoIndex + 1);
+}
+
+function closeViewer() {
+    document.getElementById('photoViewer').classList.remove('active');
+    currentPhotoIndex = -1;
+}
+
+function downloadPhoto(name) {
+    const a = document.createElement('a');
+    a.href = '/photo?folder=' + encodeURIComponent(currentFolder) + '&name=' + encodeURIComponent(name) + '&dl=1';
+    a.download = name;
+    document.body.appendChild(a);
+    a.click();
+    document.body.removeChild(a);
+}
+
+async function deletePhoto(name) {
+    if (!confirm('Eliminar ' + name + '?')) return;
+    try {
+        const response = await fetch('/delete-photo', {
+            method: 'POST',
+            headers: { 'Content-Type': 'application/json' },
+            body: JSON.stringify({ name: name, folder: currentFolder })
+        });
+        if (response.ok) {
+            showToast('Foto eliminada');
+            loadPhotos();
+            loadFolders();
+        }
+    } catch (error) {
+        showToast('Error al eliminar');
+    }
+}
+
+// === Reloj en tiempo real (formato 12 h) ===
+function updateClock() {
+    const now = new Date();
+    let h = now.getHours();
+    const ampm = h >= 12 ? 'PM' : 'AM';
+    h = h % 12 || 12;
+    const m = String(now.getMinutes()).padStart(2, '0');
+    const s = String(now.getSeconds()).padStart(2, '0');
+    document.getElementById('headerClock').innerHTML =
+        '&#128336;&nbsp;' + String(h).padStart(2, '0') + ':' + m + ':' + s + '&nbsp;<span style="font-size:0.7em;letter-spacing:1px;">' + ampm + '</span>';
+}
+setInterval(updateClock, 1000);
+updateClock();
+
+// === Link al Bot de Telegram ===
+function loadBotLink() {
+    const username = localStorage.getItem('tg_bot_username');
+    if (username) {
+        const link = document.getElementById('botLink');
+        link.href = 'https://t.me/' + username;
+        link.textContent = '\u2708 @' + username;
+        document.getElementById('botLinkDisplay').style.display = 'flex';
+        document.getElementById('botInputArea').style.display = 'none';
+    } else {
+        document.getElementById('botLinkDisplay').style.display = 'none';
+        document.getElementById('botInputArea').style.display = 'flex';
+    }
+}
+function saveBotLink() {
+    let username = document.getElementById('botUsernameInput').value.trim();
+    if (!username) return;
+    username = username.replace(/^@/, '');
+    localStorage.setItem('tg_bot_username', username);
+    loadBotLink();
+}
+function editBotLink() {
+    const username = localStorage.getItem('tg_bot_username') || '';
+    document.getElementById('botUsernameInput').value = username;
+    document.getElementById('botLinkDisplay').style.display = 'none';
+    document.getElementById('botInputArea').style.display = 'flex';
+    document.getElementById('botUsernameInput').focus();
+}
+document.getElementById('botUsernameInput').addEventListener('keydown', function(e) {
+    if (e.key === 'Enter') saveBotLink();
+});
+loadBotLink();
+
+// === Gestión de redes WiFi ===
+
+function togglePass(inputId, btn) {
+    const inp = document.getElementById(inputId);
+    if (inp.type === 'password') { inp.type = 'text'; btn.style.color = '#0ff'; }
+    else                         { inp.type = 'password'; btn.style.color = '#555'; }
+}
+
+function showWifiStatus(d) {
+    const badge = document.getElementById('wifiStatusBadge');
+    if (d.connected) {
+        badge.textContent = '\u2022 ' + d.ssid + ' \u2014 ' + d.ip;
+        badge.style.background = 'rgba(0,255,0,0.1)';
+        badge.style.borderColor = 'rgba(0,255,0,0.3)';
+        badge.style.color = '#00ff88';
+    } else {
+        badge.textContent = '\u25cb Desconectado';
+        badge.style.background = 'rgba(255,0,0,0.1)';
+        badge.style.borderColor = 'rgba(255,0,0,0.3)';
+        badge.style.color = '#ff5555';
+    }
+}
+
+// Estado inmediato tras cambiar redes (el periódico llega con loadStatus)
+async function loadWifiStatus() {
+    try {
+        const r = await fetch('/wifi/status');
+        showWifiStatus(await r.json());
+    } catch(e) {}
+}
+
+async function loadWifiNetworks() {
+    try {
+        const r = await fetch('/wifi/networks');
+        const nets = await r.json();
+        const container = document.getElementById('wifiNetworkList');
+        if (nets.length === 0) {
+            container.innerHTML = '<p style="color:#888;text-align:center;">No hay redes guardadas.</p>';
+            return;
+        }
+        let html = '<div style="display:flex;flex-direction:column;gap:8px;">';
+        nets.forEach(n => {
+            const activeBadge = n.active
+                ? '<span style="font-size:0.75em;padding:2px 8px;background:rgba(0,255,136,0.15);border:1px solid rgba(0,255,136,0.3);color:#00ff88;border-radius:10px;font-weight:600;">ACTIVA</span>'
+                : '';
+            html += `<div id="wifiRow${n.index}" style="display:flex;align-items:center;gap:10px;padding:10px 14px;background:rgba(0,255,255,0.03);border:1px solid rgba(0,255,255,0.1);border-radius:8px;flex-wrap:wrap;">
+                <span style="flex:1;min-width:100px;color:#e0e0e0;font-size:0.95em;">${n.ssid}</span>
+                ${activeBadge}
+                <button onclick="showEditForm(${n.index},'${n.ssid.replace(/'/g,"\\'")}')"
+                        style="padding:5px 12px;background:rgba(224,255,0,0.1);border:1px solid rgba(224,255,0,0.3);color:#e0ff00;border-radius:6px;cursor:pointer;font-size:0.8em;font-weight:600;">Editar</button>
+                <button onclick="deleteWifiNetwork(${n.index},'${n.ssid.replace(/'/g,"\\'")}')"
+                        style="padding:5px 12px;background:rgba(255,0,85,0.1);border:1px solid rgba(255,0,85,0.3);color:#ff5588;border-radius:6px;cursor:pointer;font-size:0.8em;font-weight:600;">Eliminar</button>
+            </div>
+            <div id="editForm${n.index}" style="display:none;padding:12px 14px;background:rgba(0,255,255,0.03);border:1px solid rgba(224,255,0,0.2);border-radius:8px;flex-direction:column;gap:8px;">
+                <p style="color:#e0ff00;font-size:0.8em;font-weight:600;margin-bottom:4px;">Editar red [${n.index}]</p>
+                <div style="display:flex;gap:8px;flex-wrap:wrap;align-items:center;">
+                    <input id="editSsid${n.index}" type="text" value="${n.ssid}" maxlength="32" placeholder="SSID"
+                           style="flex:1;min-width:120px;padding:8px 10px;background:rgba(10,10,30,0.8);border:1px solid rgba(0,255,255,0.3);border-radius:7px;color:#e0e0e0;font-size:0.9em;outline:none;">
+                    <div style="position:relative;flex:1;min-width:120px;">
+                        <input id="editPass${n.index}" type="password" placeholder="Nueva contraseña" maxlength="63"
+                               style="width:100%;padding:8px 32px 8px 10px;background:rgba(10,10,30,0.8);border:1px solid rgba(0,255,255,0.3);border-radius:7px;color:#e0e0e0;font-size:0.9em;outline:none;">
+                        <button onclick="togglePass('editPass${n.index}',this)" title="Mostrar/ocultar"
+                                style="position:absolute;right:5px;top:50%;transform:translateY(-50%);background:none;border:none;color:#555;cursor:pointer;font-size:0.9em;">&#128065;</button>
+                    </div>
+                    <button onclick="updateWifiNetwork(${n.index})"
+                            style="padding:8px 14px;background:linear-gradient(135deg,#e0ff00,#aacc00);color:#000;border:none;border-radius:7px;cursor:pointer;font-size:0.85em;font-weight:600;">Guardar</button>
+                    <button onclick="hideEditForm(${n.index})"
+                            style="padding:8px 10px;background:rgba(255,255,255,0.05);border:1px solid rgba(255,255,255,0.1);color:#888;border-radius:7px;cursor:pointer;font-size:0.85em;">Cancelar</button>
+                </div>
+            </div>`;
+        });
+        html += '</div>';
+        container.innerHTML = html;
+    } catch(e) {
+        document.getElementById('wifiNetworkList').innerHTML = '<p style="color:#ff5555;text-align:center;">Error al cargar redes.</p>';
+    }
+}
+
+function showEditForm(index, ssid) {
+    document.getElementById('editForm' + index).style.display = 'flex';
+    document.getElementById('editForm' + index).style.flexDirection = 'column';
+}
+
+function hideEditForm(index) {
+    document.getElementById('editForm' + index).style.display = 'none';
+}
+
+async function addWifiNetwork() {
+    const ssid = document.getElementById('newSsid').value.trim();
+    const pass = document.getElementById('newPass').value;
+    if (!ssid) { showToast('Ingresa el nombre de la red'); return; }
+    try {
+        const r = await fetch('/wifi/add', {
+            method: 'POST',
+            headers: { 'Content-Type': 'application/json' },
+            body: JSON.stringify({ ssid: ssid, password: pass })
+        });
+        const d = await r.json();
+        if (d.success) {
+            document.getElementById('newSsid').value = '';
+            document.getElementById('newPass').value = '';
+            showToast('Red \'' + ssid + '\' guardada');
+            loadWifiNetworks();
+        } else {
+            showToast(d.error || 'Error al guardar');
+        }
+    } catch(e) { showToast('Error al guardar red'); }
+}
+
+async function updateWifiNetwork(index) {
+    const ssid = document.getElementById('editSsid' + index).value.trim();
+    const pass = document.getElementById('editPass' + index).value;
+    if (!ssid) { showToast('El SSID no puede estar vacio'); return; }
+    try {
+        const r = await fetch('/wifi/update', {
+            method: 'POST',
+            headers: { 'Content-Type': 'application/json' },
+            body: JSON.stringify({ index: index, ssid: ssid, password: pass })
+        });
+        const d = await r.json();
+        if (d.success) {
+            showToast('Red actualizada');
+            loadWifiNetworks();
+            loadWifiStatus();
+        } else {
+            showToast(d.error || 'Error al actualizar');
+        }
+    } catch(e) { showToast('Error al actualizar red'); }
+}
+
+async function deleteWifiNetwork(index, ssid) {
+    if (!confirm('Eliminar la red \'' + ssid + '\'?')) return;
+    try {
+        const r = await fetch('/wifi/delete', {
+            method: 'POST',
+            headers: { 'Content-Type': 'application/json' },
+            body: JSON.stringify({ index: index })
+        });
+        const d = await r.json();
+        if (d.success) {
+            showToast('Red eliminada');
+            loadWifiNetworks();
+            loadWifiStatus();
+        } else {
+            showToast(d.error || 'Error al eliminar');
+        }
+    } catch(e) { showToast('Error al eliminar red'); }
+}
+
+// Cargar configuracion al inicio
+loadSettings();
+loadStatus();
+loadFolders();
+loadPhotos();
+loadWifiNetworks();
+
+// Actualizar estado cada 5 segundos (incluye el WiFi)
+setInterval(loadStatus, 5000);
@@ -0,0 +1,757 @@
+// Generado por tools/gen_web_assets.py a partir de web/ - no editar a mano
+//
+// Bytes transferidos (sin comprimir -> gzip):
+//   app.css        10813 ->   2341
+//   app.js         25966 ->   5855
+//   index.html     14954 ->   3255
+//   total          51733 ->  11451
+
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+#include <Arduino.h>
+
+struct WebAsset {
+    const char* path;
+    const char* contentType;
+    const uint8_t* data;        // Contenido gzip en flash
+    size_t length;
+    const char* etag;
+    bool immutable;             // La URL lleva el hash: caché sin revalidar
+};
+
+static const uint8_t WEB_APP_CSS[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xbd, 0x5a, 0x5d, 0x8f, 0xa3, 0x38,
+    0x16, 0x7d, 0xaf, 0x5f, 0x81, 0xba, 0xd5, 0x9a, 0xca, 0x6e, 0x11, 0x39, 0x24, 0xa4, 0x53, 0x94,
+    0x46, 0x1a, 0x69, 0x1e, 0x46, 0xfb, 0xb2, 0x2f, 0xbb, 0x3b, 0x9a, 0xd5, 0x6a, 0x1f, 0x0c, 0x98,
+    0xc4, 0x53, 0x04, 0x23, 0x30, 0x95, 0xaa, 0x19, 0xd5, 0x7f, 0xdf, 0x6b, 0x83, 0xc1, 0x18, 0x9b,
+    0x90, 0xae, 0xd6, 0x4e, 0x4f, 0x75, 0xa7, 0xc0, 0xd8, 0xf7, 0xf3, 0xdc, 0x73, 0x2f, 0xf9, 0x8b,
+    0xf7, 0xa7, 0x17, 0xb3, 0x57, 0xbf, 0xa6, 0x7f, 0xd0, 0xe2, 0x18, 0xc1, 0xe7, 0x2a, 0x25, 0x95,
+    0x0f, 0x97, 0x9e, 0xbc, 0x33, 0xae, 0x8e, 0xb4, 0x88, 0x3c, 0xf4, 0xe4, 0x95, 0x38, 0x4d, 0xe5,
+    0x7d, 0xf8, 0xfc, 0x7e, 0x17, 0xb3, 0xf4, 0xcd, 0xfb, 0xf3, 0xce, 0x83, 0xff, 0x32, 0x56, 0x70,
+    0x3f, 0xc3, 0x67, 0x9a, 0xbf, 0x45, 0xde, 0x0f, 0xff, 0x20, 0x47, 0x46, 0xbc, 0x7f, 0xfd, 0xed,
+    0x87, 0x07, 0xef, 0x9f, 0xf8, 0xc4, 0xce, 0xf8, 0xc1, 0xfb, 0x85, 0x14, 0xe4, 0x05, 0xfe, 0xfd,
+    0x95, 0x54, 0x29, 0x2e, 0xe0, 0x43, 0x8d, 0x8b, 0xda, 0xaf, 0x49, 0x45, 0xb3, 0x27, 0xb9, 0x43,
+    0x8c, 0x93, 0xe7, 0x63, 0xc5, 0x9a, 0x22, 0x8d, 0xbc, 0x9c, 0x16, 0x04, 0x57, 0xfe, 0xb1, 0xc2,
+    0x29, 0x25, 0x05, 0xbf, 0xdf, 0x6c, 0xc3, 0x94, 0x1c, 0x1f, 0xbc, 0xcf, 0x08, 0x23, 0xbc, 0xc1,
+    0x1e, 0xfa, 0x22, 0x3e, 0xa7, 0x28, 0x0d, 0x62, 0x2f, 0x6c, 0x7f, 0x69, 0x6f, 0x6c, 0x10, 0xfa,
+    0xb2, 0x6a, 0xf7, 0x3b, 0xd3, 0xc2, 0x3f, 0x11, 0x7a, 0x3c, 0xf1, 0x48, 0x5c, 0x7e, 0x39, 0xb5,
+    0x97, 0x13, 0x96, 0xb3, 0x2a, 0xf2, 0x3e, 0x13, 0x24, 0xfe, 0xb4, 0xd7, 0x7a, 0xad, 0x02, 0x54,
+    0xbe, 0x3e, 0xdd, 0xbd, 0xdf, 0xad, 0x13, 0x50, 0x07, 0x83, 0x10, 0x15, 0x98, 0xe5, 0x8c, 0x5f,
+    0xfd, 0x0b, 0x4d, 0xf9, 0x09, 0xf6, 0x09, 0x90, 0x58, 0x31, 0x58, 0xc4, 0xc3, 0x0d, 0x67, 0xc2,
+    0x14, 0xeb, 0x9a, 0x72, 0x02, 0xe7, 0xe1, 0x54, 0x3c, 0x23, 0x77, 0x4d, 0x69, 0x5d, 0xe6, 0x18,
+    0xcc, 0x91, 0xe5, 0xe4, 0xb5, 0x3d, 0x08, 0xe7, 0xf4, 0x58, 0xf8, 0xb0, 0xf2, 0x5c, 0x47, 0x5e,
+    0x02, 0x9a, 0x91, 0xaa, 0xbd, 0xf1, 0x7b, 0x53, 0x73, 0x9a, 0xbd, 0xf9, 0xe2, 0x5c, 0xb8, 0x1c,
+    0x79, 0x75, 0x89, 0x13, 0xe2, 0xc7, 0x84, 0x5f, 0x08, 0x29, 0x3a, 0x85, 0xe4, 0xa1, 0xe0, 0x12,
+    0xce, 0xd9, 0x39, 0xf2, 0xb6, 0x52, 0xd6, 0x91, 0xf8, 0x9b, 0xb0, 0x7c, 0xf5, 0x82, 0x50, 0x5d,
+    0xd7, 0x2d, 0x5a, 0x1d, 0x63, 0x7c, 0xbf, 0x41, 0x0f, 0x9e, 0xf8, 0xd9, 0xc2, 0x0f, 0x5a, 0x1f,
+    0xc2, 0xd5, 0xb0, 0x2e, 0xad, 0x58, 0xe9, 0x67, 0x34, 0x07, 0x89, 0xc0, 0xf9, 0x79, 0x53, 0xdd,
+    0x8b, 0xcd, 0xd4, 0x02, 0x19, 0x0c, 0xb0, 0x3f, 0x6c, 0x5f, 0xb3, 0x9c, 0xa6, 0xed, 0x76, 0xb0,
+    0x4b, 0x10, 0x86, 0xdd, 0x5f, 0x68, 0x1d, 0x8c, 0x56, 0xfb, 0xc2, 0x77, 0x4d, 0xdd, 0x0a, 0xa5,
+    0x6e, 0x40, 0x7c, 0x9d, 0x70, 0xca, 0x2e, 0xc2, 0x72, 0x48, 0x5a, 0xdb, 0xba, 0x13, 0x3a, 0xac,
+    0x1e, 0x3c, 0x5a, 0xd4, 0x84, 0x5f, 0x59, 0xa7, 0x8e, 0x14, 0x16, 0xf6, 0x2f, 0x15, 0x2e, 0x23,
+    0x4f, 0xfc, 0xdd, 0x5e, 0x3c, 0x8a, 0x5f, 0x37, 0xca, 0xa3, 0xad, 0x6b, 0x7c, 0x4e, 0x79, 0x4e,
+    0x3a, 0x07, 0xa9, 0x50, 0x40, 0x59, 0x17, 0x82, 0x9c, 0xbc, 0xf2, 0x91, 0x84, 0xe2, 0x69, 0x79,
+    0xff, 0x41, 0xfe, 0xba, 0x1d, 0xff, 0xba, 0x77, 0xc9, 0xb5, 0xed, 0xc4, 0xca, 0x09, 0x07, 0x7b,
+    0xfa, 0xc2, 0x97, 0x6d, 0x78, 0x29, 0x4b, 0xc8, 0x6c, 0x81, 0x54, 0x23, 0x20, 0xe0, 0x7a, 0x47,
+    0xce, 0xda, 0xd5, 0x4b, 0x17, 0xb2, 0x5f, 0x11, 0xd2, 0xe5, 0x4e, 0x72, 0x96, 0x3c, 0xeb, 0xb9,
+    0xa6, 0x9e, 0xde, 0xbb, 0x9f, 0x1e, 0x87, 0x7b, 0x96, 0xa9, 0x6b, 0x76, 0x35, 0xa5, 0x22, 0x41,
+    0xb0, 0x53, 0x5a, 0x08, 0x45, 0xc2, 0x55, 0xab, 0xa9, 0x88, 0x29, 0xeb, 0x82, 0xc0, 0xa1, 0xe9,
+    0x76, 0xa4, 0x69, 0x8f, 0x0b, 0x3f, 0xb3, 0xa6, 0xa2, 0x90, 0x20, 0x7f, 0x27, 0x17, 0x80, 0x86,
+    0x33, 0x2b, 0x98, 0x8c, 0x73, 0x5d, 0x51, 0x08, 0xef, 0x6f, 0xc8, 0x1f, 0xe9, 0xeb, 0x43, 0x7f,
+    0xa8, 0x19, 0x0e, 0xb0, 0x3d, 0xec, 0xeb, 0x03, 0xac, 0x3c, 0x9b, 0x9b, 0xd3, 0x42, 0x80, 0x8d,
+    0xbf, 0xf4, 0x8c, 0xfd, 0x24, 0xe9, 0xe0, 0x54, 0x6f, 0xb3, 0xb7, 0xe5, 0x9c, 0x1b, 0xc5, 0xd0,
+    0xe1, 0x90, 0x24, 0xf2, 0x43, 0x18, 0x1e, 0xd0, 0x6a, 0xec, 0xaa, 0x6c, 0x14, 0x8e, 0x29, 0x49,
+    0x58, 0x85, 0x39, 0x65, 0x00, 0x37, 0x05, 0x2b, 0x88, 0x35, 0xc7, 0x0e, 0x96, 0xc0, 0x42, 0xeb,
+    0x47, 0x6b, 0x68, 0xec, 0x55, 0x18, 0x98, 0xe9, 0xb8, 0xd1, 0xc3, 0x79, 0xb3, 0xdd, 0x83, 0x9f,
+    0xd1, 0x4e, 0x0f, 0x67, 0x5e, 0x01, 0x64, 0xd3, 0x56, 0x14, 0x9c, 0xe7, 0xe2, 0x4e, 0xed, 0x11,
+    0x5c, 0x77, 0x32, 0x5d, 0x4e, 0x02, 0x02, 0xa5, 0x43, 0x85, 0xa8, 0x13, 0xcb, 0x47, 0x27, 0xf6,
+    0x22, 0x01, 0x55, 0xee, 0x93, 0xb1, 0x0a, 0x40, 0x4c, 0x7e, 0xcc, 0x31, 0x27, 0xff, 0xbe, 0xf7,
+    0x03, 0x81, 0x37, 0x86, 0x54, 0x12, 0xd0, 0x5c, 0x72, 0x01, 0x7e, 0x79, 0xdd, 0xfe, 0x24, 0xa5,
+    0xdc, 0x8f, 0x79, 0xd1, 0x79, 0xb7, 0x77, 0xce, 0x57, 0xe1, 0x1c, 0xe4, 0x04, 0x44, 0x11, 0xc8,
+    0xea, 0x07, 0xe0, 0x24, 0xbc, 0x86, 0x77, 0xc3, 0xda, 0xc0, 0x70, 0x5a, 0x8f, 0x21, 0x86, 0x67,
+    0xfa, 0xc0, 0x48, 0x9a, 0xaa, 0x16, 0x2b, 0x4b, 0x46, 0x87, 0x90, 0x1a, 0xb9, 0xeb, 0x10, 0x2a,
+    0x7f, 0xcd, 0x18, 0xda, 0xd0, 0xb7, 0xb7, 0xe9, 0x44, 0x35, 0x5d, 0xd8, 0xcd, 0x60, 0x28, 0x5a,
+    0x94, 0x0d, 0x37, 0xad, 0x24, 0x43, 0x38, 0x98, 0x2b, 0x1b, 0xf0, 0x3f, 0x14, 0x0d, 0x90, 0xf1,
+    0xa6, 0x8a, 0xb0, 0x5d, 0xcd, 0x47, 0xab, 0xad, 0x16, 0xdb, 0x23, 0x58, 0xd5, 0xdf, 0x7d, 0xef,
+    0x4b, 0xd6, 0x70, 0x91, 0x5f, 0x2a, 0x29, 0x74, 0xf5, 0xa2, 0x8c, 0x25, 0x4d, 0x2d, 0x09, 0x8d,
+    0x3c, 0x57, 0xf7, 0xd1, 0x24, 0xea, 0x0f, 0x43, 0x70, 0x8d, 0xbc, 0x3b, 0x32, 0x58, 0x14, 0x01,
+    0x58, 0x24, 0xe4, 0xc4, 0x72, 0x59, 0xde, 0x7b, 0xc1, 0xc3, 0x30, 0xec, 0x17, 0xd6, 0xf8, 0x85,
+    0xd8, 0x42, 0x50, 0x1a, 0x77, 0xf7, 0x1d, 0xf0, 0x41, 0xd9, 0xfc, 0x3a, 0x0a, 0x4c, 0x90, 0xc4,
+    0x11, 0x67, 0x76, 0x5c, 0xb0, 0x46, 0xea, 0x07, 0x72, 0x5f, 0x19, 0xe6, 0x5a, 0xfe, 0x6f, 0x2c,
+    0xf9, 0xbf, 0x13, 0xc6, 0x0b, 0x07, 0x17, 0x89, 0xf4, 0x17, 0xd9, 0x8f, 0xd6, 0x3b, 0xe9, 0xa2,
+    0x9f, 0xce, 0x90, 0x09, 0xd8, 0xbb, 0xd7, 0x38, 0xda, 0xa3, 0xa0, 0x68, 0xab, 0xce, 0x0b, 0x63,
+    0x5a, 0xd6, 0x16, 0x86, 0x94, 0x56, 0x24, 0x69, 0x35, 0x01, 0x43, 0x35, 0xe7, 0xe2, 0xc9, 0x8a,
+    0xf9, 0x2d, 0xfc, 0xca, 0x3b, 0xc3, 0xb5, 0xf7, 0x76, 0xd7, 0x71, 0x51, 0x1e, 0x17, 0xe4, 0x2d,
+    0x58, 0x57, 0xad, 0xd3, 0x32, 0xae, 0x0f, 0xe1, 0x9d, 0x64, 0x90, 0xef, 0xc2, 0x3a, 0xc7, 0x0a,
+    0x12, 0xc7, 0xa8, 0x47, 0xe2, 0x5a, 0x57, 0x6f, 0xe0, 0x93, 0x0f, 0x22, 0x95, 0xc2, 0x3e, 0x7e,
+    0x2b, 0xaa, 0xe0, 0x53, 0x59, 0x25, 0x7e, 0xb4, 0x9a, 0xa4, 0x58, 0xeb, 0x55, 0x63, 0xb4, 0xe7,
+    0xcd, 0x6c, 0xdc, 0xc9, 0x95, 0xe0, 0x4a, 0xc9, 0x75, 0x8d, 0x43, 0xce, 0x53, 0x48, 0x64, 0x50,
+    0x48, 0x0b, 0x29, 0x34, 0xb8, 0xf7, 0x72, 0x70, 0xd9, 0x0c, 0x68, 0x6d, 0xd4, 0xb1, 0xd0, 0x45,
+    0x17, 0xc3, 0x11, 0xad, 0x74, 0xaf, 0x13, 0xe0, 0xde, 0x99, 0x41, 0x05, 0xad, 0xae, 0x44, 0x97,
+    0x5e, 0xf3, 0x88, 0xb7, 0x90, 0xea, 0x6e, 0x16, 0x32, 0xdd, 0xed, 0x20, 0x92, 0x77, 0x0a, 0x0c,
+    0x02, 0xab, 0x93, 0x3b, 0xa3, 0x4b, 0x18, 0xac, 0x3a, 0x0a, 0xd2, 0x40, 0x41, 0x40, 0xdf, 0xe7,
+    0xb5, 0xcb, 0x0d, 0x93, 0x9b, 0x6c, 0x4f, 0x99, 0xbc, 0x73, 0xda, 0xf0, 0x58, 0x7f, 0xca, 0x84,
+    0x5b, 0x1e, 0x1c, 0xcc, 0x71, 0xe7, 0x60, 0x8e, 0x9b, 0x8e, 0xaf, 0xd7, 0xbc, 0x22, 0xf8, 0xec,
+    0x6b, 0x8d, 0x58, 0x7b, 0x32, 0x53, 0x28, 0x54, 0x11, 0x08, 0x5f, 0xfa, 0x42, 0xc6, 0x05, 0x02,
+    0xfa, 0xbf, 0x29, 0xd0, 0x02, 0x8e, 0x22, 0x7b, 0x18, 0x0e, 0xe5, 0x04, 0xbc, 0x9c, 0xe5, 0x42,
+    0xe8, 0x13, 0x4d, 0x53, 0x47, 0xcb, 0xa5, 0xb7, 0x32, 0xd6, 0x10, 0x55, 0xea, 0x4d, 0x3a, 0x22,
+    0x57, 0x84, 0x1a, 0x0f, 0x6c, 0x56, 0x76, 0xdd, 0xe9, 0xf9, 0xd8, 0xe9, 0x3f, 0xd1, 0xb3, 0x07,
+    0x8e, 0x58, 0x80, 0x51, 0x0b, 0xba, 0xbc, 0xf0, 0x85, 0xea, 0xa5, 0x9b, 0x48, 0x6b, 0xbd, 0x91,
+    0x93, 0x30, 0xf7, 0xa5, 0x4c, 0xdc, 0x85, 0xd5, 0x43, 0x5b, 0x3d, 0x08, 0x31, 0x6d, 0x41, 0x83,
+    0x8e, 0xb1, 0xdd, 0x5a, 0xb3, 0xf4, 0xf0, 0xdc, 0xcd, 0x92, 0xa6, 0x2b, 0xa5, 0xc8, 0x5e, 0xd4,
+    0x64, 0x5c, 0x6a, 0x85, 0xa7, 0x29, 0x4b, 0x52, 0x25, 0xfd, 0x43, 0xae, 0x28, 0x14, 0xa6, 0x2c,
+    0x2b, 0x0a, 0x71, 0xf0, 0x66, 0x01, 0x44, 0x67, 0x01, 0x17, 0xe9, 0x28, 0xba, 0xc4, 0xcf, 0x18,
+    0x23, 0x84, 0xb1, 0x8b, 0xe0, 0xbb, 0x19, 0xb8, 0x11, 0x17, 0x5d, 0xf6, 0x6b, 0xd2, 0x8c, 0x70,
+    0x69, 0x8e, 0x50, 0x5b, 0x0e, 0x52, 0x53, 0x02, 0xeb, 0x51, 0xe1, 0x70, 0x54, 0xdd, 0x24, 0x09,
+    0xa9, 0xeb, 0x5b, 0x14, 0x07, 0xb5, 0x5b, 0xc5, 0x11, 0x7a, 0x7c, 0x9c, 0x28, 0x8e, 0x16, 0xb5,
+    0x1e, 0xc1, 0xce, 0xaa, 0x78, 0x27, 0xcd, 0xf7, 0x53, 0xdc, 0x38, 0x4a, 0x53, 0xfc, 0x82, 0xab,
+    0x02, 0xc2, 0xe0, 0x16, 0xc5, 0x5b, 0x08, 0x96, 0x1e, 0x4f, 0x12, 0x84, 0x6e, 0x57, 0xdc, 0x80,
+    0xc7, 0xed, 0x44, 0x9a, 0xef, 0xe8, 0x71, 0xb3, 0xc9, 0xef, 0x47, 0x5e, 0x15, 0xcb, 0x47, 0xc8,
+    0x61, 0x2d, 0x26, 0x93, 0xb5, 0x39, 0x8e, 0x49, 0x6e, 0x62, 0x4d, 0x07, 0x47, 0x96, 0x5d, 0x26,
+    0x34, 0x15, 0x59, 0x69, 0x6a, 0xcf, 0xfd, 0x27, 0x25, 0x25, 0x9c, 0x19, 0xbb, 0x08, 0xf4, 0x04,
+    0x38, 0x96, 0x55, 0x7a, 0x5c, 0x39, 0x6e, 0x1e, 0x27, 0xb4, 0x68, 0xff, 0x7e, 0x27, 0x09, 0xdc,
+    0x7f, 0xf8, 0x5b, 0x49, 0x7e, 0xfc, 0x04, 0xb6, 0x3e, 0x92, 0x4f, 0xff, 0xb5, 0x01, 0x23, 0x60,
+    0x4e, 0xfc, 0x0c, 0x5d, 0x19, 0x06, 0x64, 0xc1, 0xb0, 0x2e, 0x21, 0x3a, 0xec, 0xa9, 0x49, 0xe4,
+    0xc1, 0xd9, 0x65, 0x4d, 0x88, 0x81, 0x15, 0x2f, 0x77, 0xce, 0xfe, 0xc7, 0x22, 0x66, 0x14, 0x29,
+    0xa1, 0x3a, 0x9b, 0xf0, 0x53, 0x73, 0x8e, 0x3b, 0xe1, 0xe7, 0xe5, 0xed, 0x20, 0x7e, 0x40, 0x72,
+    0xa5, 0x40, 0x60, 0xed, 0xa6, 0x47, 0x14, 0xc4, 0x10, 0x39, 0x54, 0xa5, 0xca, 0x8a, 0xe6, 0x8b,
+    0x33, 0x62, 0xaf, 0x66, 0x51, 0x57, 0x52, 0xa6, 0x53, 0xf5, 0x05, 0xe7, 0x8d, 0x1a, 0xf4, 0x69,
+    0x35, 0x6b, 0x37, 0x66, 0x2a, 0x63, 0x7a, 0x3f, 0xad, 0x1f, 0x31, 0x74, 0x7c, 0x37, 0x0c, 0xd2,
+    0xe6, 0x53, 0xac, 0x26, 0x39, 0x34, 0x1e, 0xae, 0x42, 0x3e, 0x94, 0x50, 0xa3, 0x7a, 0x4e, 0x6b,
+    0xe5, 0x8d, 0xf3, 0xd8, 0x65, 0x14, 0xfe, 0x4a, 0x33, 0x3e, 0x53, 0x94, 0x95, 0x66, 0xaa, 0xef,
+    0x5e, 0xc8, 0x95, 0x9d, 0xfc, 0xdd, 0x45, 0x82, 0x95, 0x42, 0x93, 0xd0, 0xef, 0x0c, 0xcb, 0x4a,
+    0x41, 0x0a, 0x8c, 0x61, 0x48, 0xf7, 0x66, 0xe0, 0xc9, 0xd4, 0x4f, 0xce, 0xec, 0x2f, 0x94, 0x27,
+    0xa7, 0x0f, 0x21, 0xc5, 0x92, 0xc1, 0xfd, 0xc8, 0xb3, 0x5e, 0x3b, 0xd6, 0x9d, 0x1c, 0x2d, 0x41,
+    0x34, 0xca, 0x68, 0x55, 0x73, 0x3f, 0x39, 0xd1, 0x3c, 0x5d, 0x3c, 0xa4, 0xbe, 0x06, 0x87, 0xf2,
+    0xa4, 0x65, 0xf4, 0x39, 0x9c, 0xa6, 0xfb, 0x5e, 0xf1, 0xf1, 0x76, 0x1b, 0xd5, 0xcd, 0x32, 0xc1,
+    0x94, 0xf8, 0x9b, 0x7c, 0x11, 0xd4, 0x3d, 0x0c, 0x9f, 0xd4, 0x53, 0x9d, 0x79, 0x3b, 0xd0, 0x61,
+    0xc7, 0x63, 0x3f, 0x73, 0x1f, 0x04, 0xc0, 0x31, 0x84, 0x6e, 0xc3, 0xc9, 0x1c, 0xd3, 0x63, 0xa5,
+    0xdc, 0x2b, 0x27, 0x59, 0xbb, 0x69, 0xd5, 0x6f, 0xaf, 0x8a, 0x09, 0x32, 0x63, 0x7c, 0x14, 0x71,
+    0x83, 0x39, 0x0c, 0x54, 0xd5, 0x39, 0x24, 0xf4, 0x22, 0xb5, 0x35, 0xdf, 0x82, 0xfd, 0x12, 0xba,
+    0x6f, 0x6e, 0x6f, 0x2a, 0x1e, 0xc5, 0x04, 0x0a, 0xf5, 0x55, 0xfd, 0x55, 0xfc, 0x7c, 0xfa, 0xe4,
+    0xc2, 0xdb, 0x09, 0x24, 0xb7, 0x66, 0xd9, 0x0e, 0x42, 0x76, 0x55, 0x7a, 0x0a, 0xd0, 0xbe, 0x3e,
+    0xb0, 0x5a, 0x6e, 0x00, 0x89, 0xdc, 0x5d, 0x65, 0x89, 0x92, 0x13, 0x49, 0x9e, 0x49, 0xea, 0xfd,
+    0xd5, 0xb3, 0x3a, 0xf6, 0x03, 0xbc, 0xd8, 0x02, 0x15, 0x06, 0x29, 0xdd, 0xad, 0xbe, 0x89, 0x30,
+    0xcf, 0x0b, 0x3e, 0x76, 0x8c, 0x8d, 0x51, 0xfd, 0x76, 0x1f, 0xec, 0x06, 0x46, 0x35, 0xb5, 0xa6,
+    0x24, 0xf2, 0xb2, 0x5f, 0xc3, 0xbc, 0xa9, 0xfd, 0x18, 0xcf, 0x20, 0x88, 0x03, 0x28, 0xb0, 0xdc,
+    0x71, 0xd9, 0x5b, 0x2c, 0x8d, 0x4b, 0xc9, 0xcc, 0x08, 0xec, 0x6f, 0x00, 0xdd, 0xfc, 0x02, 0x19,
+    0xbd, 0xb7, 0xb3, 0x1b, 0x5e, 0x38, 0x81, 0x59, 0xe9, 0xda, 0x0b, 0x70, 0x54, 0xb6, 0xb4, 0x94,
+    0x56, 0x63, 0xe1, 0x5a, 0xaf, 0xcf, 0xa3, 0xd1, 0x84, 0x7d, 0x3a, 0x39, 0x2d, 0xc4, 0x6e, 0x40,
+    0x3c, 0x38, 0x00, 0x31, 0x9c, 0xca, 0xbb, 0xd6, 0xb9, 0xeb, 0x78, 0x4a, 0xaa, 0xc4, 0x50, 0xe7,
+    0x1d, 0x0e, 0x87, 0xf6, 0xf1, 0x54, 0x38, 0x7a, 0x52, 0x34, 0x26, 0xf5, 0x5c, 0x6f, 0x94, 0xa7,
+    0x34, 0xea, 0xb0, 0xf0, 0x9d, 0xc4, 0x35, 0x1a, 0xa8, 0xc7, 0xc3, 0xde, 0x3d, 0xcc, 0x18, 0xe4,
+    0xce, 0x68, 0xae, 0xf4, 0xd5, 0xde, 0x8e, 0x7f, 0x99, 0x3f, 0x45, 0x47, 0x0b, 0xa9, 0x93, 0xb0,
+    0x66, 0xdb, 0x74, 0x3f, 0x68, 0x1a, 0x0c, 0x57, 0xe5, 0x89, 0x99, 0x1c, 0x97, 0xfb, 0x1c, 0xc7,
+    0xd6, 0x99, 0xf8, 0xfe, 0x1b, 0xe9, 0x8c, 0x8b, 0x14, 0xcd, 0xd3, 0x9c, 0xfd, 0xca, 0xe2, 0xce,
+    0x5b, 0x5f, 0xcc, 0x38, 0x66, 0x0b, 0xb3, 0xaf, 0x6b, 0x06, 0x2b, 0xdc, 0x38, 0x4b, 0xdc, 0xd9,
+    0x5e, 0x31, 0x8d, 0x36, 0x5c, 0xe3, 0x44, 0x94, 0xf0, 0x1b, 0x10, 0xd8, 0x31, 0x48, 0x7d, 0x70,
+    0xcd, 0x4b, 0xad, 0x08, 0x3d, 0xa4, 0x9e, 0xe5, 0xed, 0xd7, 0x8d, 0x5c, 0x6e, 0x31, 0x9b, 0xd9,
+    0xb5, 0xc9, 0xcb, 0x19, 0xae, 0xf9, 0xa4, 0x96, 0x66, 0xf4, 0x95, 0xa4, 0x46, 0x15, 0xec, 0x53,
+    0xae, 0x32, 0x0b, 0xe9, 0x92, 0xef, 0x4b, 0x7c, 0x7c, 0xb4, 0xe3, 0x80, 0x56, 0x07, 0xaa, 0xd9,
+    0x1b, 0x7a, 0x39, 0x61, 0x53, 0xac, 0x77, 0x60, 0x5c, 0x4b, 0xc6, 0x60, 0x7f, 0xf8, 0xb4, 0x48,
+    0x65, 0x7b, 0xea, 0x1c, 0x3e, 0x04, 0xae, 0xea, 0xb9, 0xbb, 0xea, 0x9c, 0x09, 0xf3, 0x09, 0x35,
+    0xf7, 0xac, 0xeb, 0x13, 0xbb, 0xcc, 0x0e, 0x2a, 0x90, 0xa9, 0xd3, 0x46, 0x3e, 0x5d, 0x9e, 0x18,
+    0x67, 0xfe, 0x0b, 0x25, 0x97, 0x29, 0x17, 0x1f, 0x5a, 0xd3, 0x8f, 0x0e, 0x65, 0xc3, 0xd5, 0x37,
+    0xcd, 0x82, 0x5d, 0x03, 0xe5, 0xdb, 0x46, 0xbb, 0xba, 0x8a, 0x7d, 0xfa, 0x9a, 0x53, 0x13, 0xcf,
+    0xb4, 0xc5, 0x0d, 0xf3, 0xdf, 0xd6, 0x42, 0xaf, 0xfd, 0x57, 0x9f, 0x76, 0xc3, 0x90, 0x96, 0xc5,
+    0xbf, 0x43, 0x9b, 0x04, 0x15, 0x80, 0x47, 0x5e, 0x57, 0xbe, 0x2c, 0xaa, 0x6d, 0x36, 0xad, 0x33,
+    0xda, 0xa3, 0xe7, 0x49, 0xcd, 0xf7, 0x69, 0x8b, 0xae, 0xbf, 0x7e, 0xd6, 0x70, 0xfc, 0xd1, 0x70,
+    0x9f, 0xac, 0x7c, 0x8b, 0x78, 0x8a, 0xa6, 0x50, 0xdc, 0x40, 0xec, 0x4c, 0xde, 0xd4, 0xee, 0xc7,
+    0x6f, 0x6a, 0xaf, 0x8d, 0xae, 0x6f, 0x79, 0xb5, 0x7f, 0x6b, 0x01, 0x09, 0xb4, 0x02, 0xd2, 0xc9,
+    0x5d, 0xe0, 0x97, 0xff, 0xc3, 0x08, 0xfa, 0x30, 0x3f, 0x81, 0x1e, 0x64, 0x19, 0xbe, 0x79, 0xb0,
+    0x34, 0x03, 0xba, 0xaf, 0x6b, 0x68, 0x5b, 0x40, 0x44, 0xe1, 0x38, 0x27, 0xe9, 0xa8, 0x9f, 0x5c,
+    0x6f, 0x9f, 0x7a, 0x8b, 0xa6, 0x24, 0xc3, 0x4d, 0xce, 0xc7, 0x6f, 0x85, 0xa5, 0x43, 0xb4, 0x9d,
+    0x92, 0x9c, 0xd5, 0x37, 0x77, 0x21, 0x42, 0x24, 0x69, 0x9a, 0xed, 0xd6, 0x66, 0x9a, 0x61, 0x77,
+    0x5a, 0x64, 0x6c, 0x86, 0xd6, 0x4e, 0xc6, 0x80, 0xc3, 0x37, 0x24, 0x87, 0xef, 0x9e, 0xe9, 0x5b,
+    0xad, 0x0b, 0x7c, 0x76, 0x7e, 0x01, 0xcd, 0x41, 0x3b, 0x6c, 0x39, 0x6e, 0x07, 0x29, 0x29, 0xe2,
+    0x70, 0x8b, 0xe4, 0x39, 0x2d, 0x6b, 0x5a, 0xcf, 0xbf, 0xa4, 0x1f, 0x89, 0x97, 0x80, 0xf1, 0x78,
+    0x0f, 0xbf, 0x13, 0xb6, 0x34, 0x92, 0xf0, 0xab, 0x94, 0xf0, 0xfd, 0xee, 0x7f, 0xca, 0xac, 0x79,
+    0xab, 0x3d, 0x2a, 0x00, 0x00,
+};
+
+static const uint8_t WEB_APP_JS[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x3c, 0x6b, 0x77, 0xdb, 0x36,
+    0xb2, 0xdf, 0xf3, 0x2b, 0x50, 0x65, 0x1b, 0x52, 0x37, 0x7a, 0x50, 0xb2, 0xe5, 0xd8, 0x52, 0xe4,
+    0x6c, 0x9c, 0x38, 0x5d, 0xef, 0x36, 0x69, 0x4e, 0x9c, 0xb6, 0xf7, 0x9e, 0xa6, 0xb7, 0x0b, 0x91,
+    0x90, 0xc4, 0x86, 0x22, 0xb9, 0x24, 0x65, 0xd9, 0xed, 0xfa, 0x47, 0xed, 0xd9, 0x9f, 0xd0, 0x3f,
+    0xb6, 0x33, 0x00, 0x48, 0x02, 0x7c, 0x49, 0x72, 0xdc, 0xc7, 0x39, 0xf7, 0xb6, 0xdb, 0x4d, 0x44,
+    0x02, 0x83, 0xc1, 0x60, 0xde, 0x33, 0xa0, 0xc7, 0x12, 0x12, 0x27, 0x11, 0xa3, 0x2b, 0xd7, 0x5f,
+    0x90, 0x29, 0x99, 0x53, 0x2f, 0x66, 0x93, 0x07, 0x1e, 0x3c, 0xb6, 0x69, 0x98, 0xac, 0x23, 0xf6,
+    0xca, 0xa3, 0xf1, 0x52, 0x7f, 0x13, 0x2e, 0x83, 0x24, 0xf8, 0xd2, 0x8d, 0x13, 0x78, 0xfc, 0xdd,
+    0xf7, 0x72, 0xf4, 0x3a, 0x8a, 0x98, 0x9f, 0xbc, 0xc5, 0x57, 0x17, 0xbe, 0xc3, 0xae, 0xe1, 0x5d,
+    0x77, 0xa0, 0xbd, 0x7b, 0x15, 0x78, 0x0e, 0x8b, 0xe0, 0xb9, 0x31, 0x87, 0x41, 0xf1, 0x0f, 0x1b,
+    0x36, 0x33, 0xc4, 0x80, 0x39, 0x7f, 0xa3, 0x40, 0x7c, 0x30, 0x5f, 0xfb, 0x76, 0xe2, 0x06, 0x3e,
+    0x89, 0x97, 0xc1, 0xe6, 0x7d, 0x40, 0xe3, 0xc4, 0x5c, 0xb1, 0x38, 0xa6, 0x0b, 0xd6, 0x26, 0x3f,
+    0x3f, 0x20, 0xf0, 0x8f, 0x1d, 0xf8, 0x30, 0x3c, 0xc1, 0x57, 0x30, 0xc9, 0x09, 0xec, 0xf5, 0x0a,
+    0xd6, 0xe8, 0x2d, 0x58, 0x72, 0xee, 0x31, 0xfc, 0xeb, 0xd9, 0xcd, 0x85, 0x63, 0x1a, 0x7c, 0x80,
+    0xd1, 0x9e, 0xf0, 0x39, 0xfc, 0x47, 0x2f, 0x61, 0xd7, 0xc9, 0x8b, 0xc0, 0x4f, 0x60, 0x0c, 0xcc,
+    0x94, 0x60, 0xd5, 0x01, 0x36, 0x6c, 0x39, 0x46, 0x6c, 0x7a, 0xd4, 0x01, 0x10, 0x88, 0x42, 0x0a,
+    0x21, 0x66, 0xc9, 0x7b, 0x77, 0xc5, 0x82, 0x75, 0x62, 0x9a, 0x6d, 0x32, 0x3d, 0x2d, 0xcd, 0x88,
+    0xd8, 0x2a, 0xb8, 0x62, 0xe9, 0xa4, 0x0e, 0x39, 0xb0, 0x2c, 0x0b, 0xe6, 0xde, 0x2a, 0x5b, 0x4a,
+    0x82, 0xc5, 0xc2, 0x63, 0x97, 0x9c, 0xea, 0xa6, 0xbe, 0x1d, 0x77, 0xb5, 0x68, 0xda, 0x8c, 0x38,
+    0xa9, 0x14, 0x17, 0x31, 0x65, 0x96, 0xf8, 0xdb, 0xa7, 0x9c, 0x25, 0x7e, 0xb6, 0x03, 0xe5, 0xb4,
+    0x3f, 0xcb, 0x7e, 0x00, 0xc9, 0xf1, 0xa5, 0x3b, 0x27, 0x66, 0xf6, 0x2c, 0x45, 0x8d, 0xbf, 0x58,
+    0x2d, 0x7a, 0x71, 0x64, 0xe3, 0xe1, 0xf5, 0xc5, 0x80, 0x67, 0x06, 0x79, 0x4c, 0x5e, 0xd2, 0x84,
+    0xf5, 0xfc, 0x60, 0x63, 0x4a, 0xe0, 0xf8, 0x0f, 0x20, 0xd4, 0x73, 0x7d, 0x9f, 0x45, 0x7f, 0x79,
+    0xff, 0xfa, 0x4b, 0x9c, 0xf0, 0xe8, 0xe1, 0xc9, 0xd0, 0x3a, 0x99, 0x90, 0x97, 0x0c, 0x48, 0x0e,
+    0x0c, 0x20, 0x76, 0x6e, 0x88, 0x19, 0xb7, 0x84, 0x01, 0x5f, 0x55, 0xaf, 0x64, 0xe4, 0x40, 0xc5,
+    0x5e, 0x43, 0x1a, 0x89, 0x43, 0xc3, 0x41, 0xe2, 0xc7, 0x9b, 0xc0, 0x61, 0xc5, 0x61, 0x3e, 0xdb,
+    0x5c, 0xe8, 0x84, 0xb4, 0x61, 0xc5, 0x84, 0x49, 0xc2, 0x98, 0x06, 0x4c, 0x37, 0x14, 0x8c, 0xc5,
+    0xf8, 0x9e, 0xeb, 0xe0, 0xa2, 0xb1, 0x8a, 0x9d, 0xf2, 0x96, 0x7a, 0xb8, 0xb0, 0x71, 0x59, 0x7c,
+    0x2d, 0xd0, 0x80, 0x73, 0x0f, 0x3d, 0x6a, 0xb3, 0x17, 0x4b, 0xd7, 0x73, 0x4c, 0x31, 0xa5, 0x83,
+    0x68, 0x6e, 0x21, 0xcc, 0xd1, 0xe8, 0x70, 0x42, 0x2e, 0x7c, 0xd7, 0x76, 0x69, 0x81, 0x30, 0x95,
+    0xdc, 0x96, 0x93, 0x29, 0xdf, 0xad, 0x94, 0xae, 0x8b, 0x7d, 0x58, 0x27, 0x23, 0x36, 0x9c, 0xb7,
+    0x32, 0xff, 0xd1, 0x23, 0x85, 0x25, 0xda, 0x85, 0xd5, 0xf8, 0x8a, 0xd9, 0xd8, 0x8c, 0x1b, 0xa4,
+    0x9a, 0xa8, 0x65, 0x07, 0x7e, 0xc8, 0xd9, 0xaf, 0xdb, 0x0e, 0x19, 0x71, 0x81, 0x10, 0x8f, 0xcb,
+    0x62, 0xf1, 0x42, 0xd1, 0x3a, 0xb9, 0x70, 0xe8, 0xaa, 0xe8, 0x33, 0xf5, 0xf7, 0x1e, 0xb2, 0x30,
+    0xc7, 0xf1, 0xef, 0xf9, 0x32, 0x8a, 0x40, 0x70, 0x1a, 0x28, 0x00, 0xd5, 0x7d, 0x57, 0x1d, 0xd9,
+    0xf1, 0x31, 0xf0, 0x32, 0xe8, 0x0f, 0xc2, 0x47, 0x1b, 0xfa, 0xf9, 0xc6, 0xc9, 0x8d, 0xc7, 0x7a,
+    0x33, 0x6a, 0x7f, 0x5c, 0x44, 0xc1, 0xda, 0xe7, 0x1c, 0xe5, 0xb9, 0x3e, 0xa3, 0x51, 0x77, 0x11,
+    0x51, 0xc7, 0x45, 0xf6, 0x1b, 0x1c, 0x8c, 0x1c, 0xb6, 0xe8, 0x3c, 0x64, 0x96, 0x0d, 0xca, 0xa1,
+    0xf3, 0x90, 0x5a, 0xc7, 0xa8, 0x24, 0x2a, 0x21, 0xd9, 0x81, 0x17, 0x70, 0x95, 0xf9, 0x10, 0x86,
+    0x54, 0xaf, 0x15, 0x44, 0x52, 0xab, 0x0e, 0xc2, 0x6b, 0x12, 0x07, 0x1e, 0xb0, 0x71, 0xb4, 0x98,
+    0x51, 0x73, 0x38, 0x1a, 0x75, 0x86, 0x43, 0xab, 0x03, 0xff, 0xf6, 0x8e, 0xda, 0x35, 0x73, 0xaf,
+    0x2f, 0x97, 0xd4, 0x09, 0x36, 0x38, 0xdd, 0x22, 0x16, 0x19, 0x58, 0x00, 0xa3, 0x34, 0xfb, 0xb0,
+    0x5d, 0x27, 0xac, 0xb5, 0xf4, 0xb9, 0x74, 0x77, 0xa7, 0x4f, 0xbe, 0x9e, 0xfc, 0xcf, 0xea, 0x59,
+    0x4f, 0xb6, 0x91, 0xe3, 0xf8, 0xf8, 0xf8, 0xee, 0xe4, 0x38, 0xd8, 0x81, 0x1c, 0x7e, 0xe0, 0x33,
+    0x43, 0xe1, 0x53, 0x1a, 0xdf, 0xf8, 0x36, 0x29, 0x70, 0xeb, 0x2b, 0xea, 0x17, 0x34, 0xf8, 0x36,
+    0x16, 0xa4, 0x7e, 0x89, 0x01, 0xa5, 0xea, 0x8f, 0xbf, 0xc2, 0x99, 0x88, 0x8d, 0x43, 0x13, 0x0a,
+    0xa2, 0xdf, 0x83, 0xc1, 0xf8, 0x6c, 0x8a, 0x9b, 0x31, 0xd4, 0xb1, 0xa0, 0x5f, 0x2e, 0x13, 0x90,
+    0x35, 0xd4, 0x84, 0x38, 0xed, 0x19, 0x31, 0x82, 0xf9, 0xdc, 0x20, 0x63, 0xf8, 0xd3, 0x97, 0x23,
+    0x93, 0xe8, 0x46, 0x39, 0x28, 0x31, 0x0f, 0xe9, 0x42, 0x37, 0xd4, 0x05, 0x8b, 0xcb, 0x12, 0x7b,
+    0x69, 0x1a, 0x7d, 0x58, 0xe2, 0x59, 0x8c, 0xa0, 0xa6, 0x28, 0xbf, 0x29, 0xdc, 0x76, 0x51, 0xa3,
+    0x22, 0x46, 0xd9, 0xdc, 0xa8, 0xf7, 0x63, 0x1c, 0xf8, 0x66, 0x69, 0x50, 0xc0, 0x77, 0x0e, 0x23,
+    0x11, 0x71, 0x9d, 0xbe, 0x85, 0x1d, 0xe1, 0xd0, 0x67, 0xb8, 0x29, 0xc4, 0x58, 0x65, 0x6b, 0x94,
+    0xc5, 0xc0, 0x2f, 0x6a, 0x9e, 0x0a, 0x2e, 0x1b, 0x0c, 0x8f, 0x07, 0x47, 0xc7, 0x13, 0x02, 0x07,
+    0x40, 0xbe, 0x7a, 0x63, 0x4c, 0x4a, 0xe3, 0xf7, 0x11, 0x44, 0xcb, 0x3a, 0x01, 0x51, 0xc4, 0x3f,
+    0x47, 0x20, 0x8a, 0xed, 0x5a, 0x68, 0x39, 0xf7, 0xcd, 0x81, 0xda, 0xb5, 0x6b, 0xd6, 0x71, 0xa0,
+    0xd5, 0x19, 0x82, 0xb8, 0x0b, 0x06, 0x3f, 0x6a, 0x37, 0xcc, 0xaf, 0x15, 0x4a, 0x15, 0xc2, 0xa1,
+    0x0a, 0xa1, 0x24, 0x98, 0xbb, 0x90, 0xed, 0xd5, 0xab, 0x1d, 0xe9, 0xb6, 0x55, 0x40, 0x77, 0x13,
+    0xd2, 0x3b, 0x90, 0xe9, 0x60, 0x47, 0x32, 0x29, 0xc2, 0x9a, 0xdb, 0x9b, 0x5b, 0xb0, 0x1b, 0xc8,
+    0xe5, 0x4c, 0xe5, 0xa7, 0xdc, 0x9f, 0x34, 0xce, 0xa3, 0x08, 0xf0, 0xa4, 0x1e, 0xb2, 0x6f, 0x12,
+    0x05, 0x1e, 0x58, 0x60, 0xe6, 0x91, 0x2b, 0xe0, 0x0c, 0xd7, 0x03, 0xc0, 0x91, 0xd1, 0xae, 0x17,
+    0x7f, 0x27, 0x90, 0x86, 0x2a, 0x13, 0xff, 0x2a, 0x79, 0xe3, 0x06, 0xe7, 0x2d, 0x8d, 0xe8, 0x0a,
+    0x90, 0xd4, 0x8c, 0x18, 0x70, 0xff, 0x23, 0xfe, 0x76, 0x2a, 0x84, 0x40, 0xfe, 0xb0, 0x4a, 0x2e,
+    0x4f, 0xc4, 0xe2, 0x10, 0xfe, 0xc2, 0x4a, 0x92, 0x0b, 0xde, 0x73, 0xb7, 0xda, 0xf6, 0xc2, 0x8f,
+    0x7c, 0xe1, 0xb6, 0x2e, 0x5c, 0x9f, 0xa5, 0xf0, 0x7a, 0xc1, 0xc7, 0xa2, 0x98, 0x55, 0x92, 0x86,
+    0xaf, 0x40, 0xa3, 0xa2, 0xe3, 0x10, 0x31, 0x78, 0xec, 0x17, 0x29, 0xae, 0x78, 0x6a, 0x18, 0x07,
+    0xbc, 0xa1, 0x2b, 0xc4, 0x3b, 0x5b, 0x72, 0xc9, 0x28, 0x1c, 0x79, 0x8c, 0x4a, 0xd1, 0x34, 0xfe,
+    0xbb, 0xcb, 0x63, 0x85, 0x2e, 0x0e, 0x32, 0x4a, 0xba, 0xc4, 0xdd, 0xd7, 0x9b, 0xc1, 0xcd, 0x65,
+    0x8b, 0x16, 0x77, 0xa6, 0x7a, 0xaf, 0x7c, 0xd0, 0x33, 0x11, 0x71, 0x4c, 0xb3, 0x40, 0xe4, 0x91,
+    0x0f, 0xd3, 0xb8, 0x0e, 0x64, 0xbe, 0x0d, 0x2e, 0xe5, 0xd7, 0xef, 0x2e, 0x5e, 0x04, 0x2b, 0x40,
+    0x1b, 0xf5, 0x44, 0x0e, 0x77, 0x52, 0x47, 0xb0, 0x57, 0x30, 0x82, 0x2c, 0xd6, 0x34, 0x72, 0xa8,
+    0x43, 0xe1, 0x3c, 0x01, 0x50, 0xdd, 0x2c, 0xc5, 0xe7, 0x4a, 0x23, 0xa2, 0xa9, 0x16, 0x13, 0x55,
+    0x39, 0x5e, 0xe2, 0xec, 0xbd, 0x80, 0x3a, 0x9c, 0x6a, 0x71, 0xd1, 0xc3, 0xd2, 0x48, 0xc0, 0x03,
+    0x11, 0x8f, 0xf9, 0x8b, 0x64, 0x49, 0x4e, 0x89, 0xd5, 0xe6, 0x88, 0x7e, 0xe3, 0xb2, 0x0d, 0x8b,
+    0x4c, 0xab, 0xe8, 0x9a, 0x55, 0x69, 0x0e, 0xe1, 0x7b, 0x7a, 0xcc, 0x96, 0x18, 0x9a, 0x2a, 0x76,
+    0xb5, 0xae, 0x5d, 0x15, 0x24, 0x69, 0x14, 0xbd, 0x60, 0x96, 0x9b, 0x8f, 0x94, 0x1d, 0xf0, 0x69,
+    0x71, 0x1f, 0xf9, 0x49, 0x7d, 0xfd, 0xee, 0x4b, 0xe9, 0xb6, 0x7f, 0x35, 0xfb, 0x11, 0x30, 0x81,
+    0xdf, 0x26, 0xce, 0xd8, 0x72, 0x06, 0x92, 0x61, 0x1d, 0x0a, 0x81, 0x0c, 0xf8, 0x20, 0x97, 0x2f,
+    0xdb, 0x2a, 0xc6, 0x9a, 0x62, 0x20, 0x26, 0x43, 0x36, 0xdf, 0xaa, 0x1d, 0x0a, 0x22, 0xa0, 0x7b,
+    0xad, 0x52, 0x04, 0xf9, 0xa9, 0xec, 0xe7, 0x0a, 0x68, 0x91, 0x59, 0x73, 0xf4, 0x75, 0x47, 0x99,
+    0xa8, 0x08, 0xec, 0xff, 0x3f, 0xca, 0x6a, 0x8c, 0xb2, 0x32, 0xb5, 0xae, 0x85, 0x29, 0x45, 0xc6,
+    0x56, 0x94, 0x7f, 0xbd, 0x85, 0x58, 0x87, 0xe0, 0xf4, 0xb0, 0x4b, 0x96, 0x24, 0x70, 0x00, 0x26,
+    0xaa, 0x97, 0x0e, 0xb9, 0xa2, 0xde, 0xba, 0x90, 0xc0, 0x88, 0xc1, 0xee, 0x71, 0x33, 0x58, 0x77,
+    0xae, 0x38, 0x13, 0xb4, 0x89, 0xf1, 0x0d, 0xf5, 0xd4, 0x88, 0x45, 0xcc, 0x6b, 0xcb, 0xf9, 0x85,
+    0x9c, 0x06, 0x5f, 0x47, 0x61, 0x2a, 0x0e, 0x43, 0x68, 0x19, 0x30, 0x09, 0xec, 0xd2, 0xfd, 0x89,
+    0x19, 0x18, 0xec, 0xdd, 0x27, 0xb3, 0xdd, 0x2d, 0x1b, 0xf1, 0x7f, 0x8e, 0x4d, 0x1f, 0xe8, 0x1a,
+    0x1d, 0x5e, 0x92, 0xb7, 0x51, 0xb0, 0x72, 0x63, 0x66, 0x46, 0x18, 0xe1, 0x2b, 0xcc, 0x18, 0x09,
+    0x26, 0x54, 0x70, 0xd3, 0x7d, 0x8c, 0x1c, 0x4a, 0xea, 0x13, 0xc4, 0x82, 0xdb, 0x62, 0xa3, 0x53,
+    0xa1, 0xd0, 0x57, 0x2c, 0x59, 0x06, 0x0e, 0xd8, 0xa6, 0xb7, 0x5f, 0x5d, 0xbe, 0x37, 0x3a, 0xa5,
+    0xf7, 0xd2, 0x3a, 0x8f, 0xc9, 0xcf, 0xc4, 0x90, 0xac, 0xd4, 0x7d, 0x7f, 0x13, 0x32, 0x03, 0xa6,
+    0xd0, 0x30, 0xf4, 0x5c, 0x50, 0x9a, 0xc0, 0xd8, 0x7d, 0x74, 0xfe, 0x0d, 0x08, 0xe4, 0x4b, 0x00,
+    0x66, 0x81, 0x73, 0x33, 0x26, 0x7f, 0xbd, 0xfc, 0xea, 0x0d, 0xb8, 0x68, 0x11, 0xe0, 0xe1, 0xce,
+    0x6f, 0xcc, 0x9f, 0xc9, 0x77, 0xc8, 0x7d, 0xdf, 0x8f, 0x05, 0x53, 0x92, 0xdb, 0xb6, 0x6e, 0x3e,
+    0x54, 0xe5, 0x5c, 0xab, 0x96, 0xeb, 0x54, 0x33, 0xb5, 0x93, 0x35, 0xf5, 0xdc, 0x9f, 0xca, 0xfe,
+    0xc9, 0xfe, 0x5a, 0xa0, 0xda, 0xab, 0xa9, 0x64, 0xd2, 0x24, 0x5a, 0xb3, 0xbb, 0xe6, 0xbb, 0x84,
+    0xfe, 0xd8, 0x22, 0x55, 0xbb, 0xa6, 0xda, 0x54, 0x7c, 0x25, 0xae, 0x3a, 0x8b, 0xec, 0xc8, 0x1e,
+    0x4d, 0xac, 0xf1, 0x49, 0x6c, 0xb1, 0x2f, 0x4b, 0xdc, 0x66, 0x2a, 0x77, 0x1f, 0x0b, 0x5d, 0x66,
+    0x83, 0x2a, 0x85, 0x1c, 0xd3, 0xab, 0x54, 0x1d, 0xc7, 0x8d, 0x5e, 0x7b, 0xad, 0xcb, 0xfd, 0x87,
+    0xa1, 0x1f, 0x6e, 0x65, 0xcc, 0xd9, 0xb0, 0x8a, 0x78, 0xa9, 0xd6, 0xdf, 0xcd, 0xd5, 0x07, 0x9c,
+    0xe6, 0xee, 0x02, 0x1c, 0x1c, 0x1b, 0x89, 0x94, 0xba, 0xb0, 0x9f, 0xea, 0x34, 0x09, 0x38, 0x8d,
+    0xe7, 0x81, 0xce, 0xec, 0x3d, 0x9d, 0x47, 0xc9, 0x0c, 0xa5, 0x6f, 0xca, 0x4e, 0x67, 0x9a, 0xba,
+    0xd8, 0x2e, 0x8c, 0xb3, 0xc8, 0x5d, 0x2c, 0x13, 0x9f, 0xc5, 0x00, 0xbf, 0x27, 0x38, 0x75, 0x9a,
+    0x01, 0xee, 0xe5, 0x6f, 0x27, 0xfb, 0x80, 0xe2, 0x56, 0xbc, 0x60, 0xad, 0xef, 0x06, 0x93, 0x07,
+    0xad, 0xbc, 0xb6, 0x51, 0x46, 0x2e, 0x7d, 0xb7, 0x07, 0x98, 0x46, 0xc4, 0xf6, 0x80, 0x17, 0x53,
+    0x74, 0x96, 0xf1, 0x80, 0xab, 0x10, 0xcb, 0xdf, 0xee, 0x05, 0xaa, 0x11, 0xb9, 0xbd, 0x60, 0xfe,
+    0x03, 0x15, 0x45, 0x72, 0x53, 0x85, 0x9b, 0x7c, 0xb5, 0x3b, 0x90, 0x46, 0xac, 0x76, 0x87, 0x96,
+    0xbb, 0x64, 0x15, 0x48, 0x65, 0x2f, 0x77, 0xb6, 0x1e, 0xaf, 0xc2, 0x4a, 0x7e, 0xcd, 0x5e, 0xee,
+    0x03, 0xa8, 0x99, 0xee, 0xfb, 0x40, 0x0c, 0x19, 0x58, 0x5d, 0xef, 0x7c, 0x3e, 0x87, 0x48, 0xae,
+    0x12, 0x3d, 0x75, 0xc0, 0x0e, 0x00, 0x37, 0x4b, 0x37, 0x61, 0x67, 0xd4, 0xa3, 0xbe, 0x5d, 0x49,
+    0x37, 0xf5, 0xfd, 0x2e, 0x67, 0xc0, 0x53, 0xd5, 0xed, 0x9e, 0xbd, 0x64, 0xf6, 0x47, 0xe6, 0x68,
+    0x27, 0x90, 0x17, 0x19, 0x1a, 0x41, 0xb0, 0xeb, 0x30, 0x88, 0x21, 0x26, 0x78, 0x91, 0x44, 0x5e,
+    0x35, 0x24, 0x75, 0xc4, 0x0e, 0x00, 0x17, 0xd4, 0xf5, 0xeb, 0x81, 0xa5, 0x6f, 0xb7, 0xd9, 0x4b,
+    0xd4, 0x87, 0x81, 0xc7, 0x7a, 0xfc, 0x45, 0xaa, 0xa0, 0x51, 0xf5, 0xa2, 0x2b, 0x93, 0x42, 0x1b,
+    0x83, 0x45, 0x13, 0x33, 0x15, 0x75, 0xdd, 0xef, 0x93, 0xaf, 0x7d, 0x8a, 0x99, 0x39, 0xca, 0xa1,
+    0xac, 0xbd, 0x84, 0x92, 0x90, 0x45, 0xee, 0x2f, 0xff, 0x76, 0xc0, 0x68, 0x8d, 0x49, 0x1f, 0xcc,
+    0x5e, 0xe4, 0xda, 0x31, 0x28, 0x6d, 0xca, 0xc0, 0x06, 0xae, 0x82, 0xc8, 0xa5, 0x1d, 0x08, 0xb9,
+    0xc9, 0x0d, 0xf9, 0xd6, 0x7d, 0xe5, 0x12, 0x87, 0x11, 0x3e, 0x37, 0x74, 0x29, 0x42, 0xfb, 0x07,
+    0x1c, 0x11, 0xf3, 0xc8, 0xf9, 0xe5, 0xdb, 0x83, 0x21, 0x28, 0xe4, 0x39, 0xe8, 0x64, 0x9b, 0x12,
+    0x06, 0x96, 0x99, 0x2d, 0xd6, 0xbe, 0x13, 0x10, 0x70, 0x9a, 0xfd, 0xa0, 0xd2, 0x4c, 0x24, 0x20,
+    0xe3, 0x77, 0x34, 0x12, 0x12, 0xc9, 0x67, 0xf3, 0x20, 0x5a, 0xd1, 0x64, 0xca, 0xcd, 0x6c, 0xc9,
+    0x5e, 0xac, 0x3e, 0xc5, 0x50, 0x80, 0x85, 0x0f, 0xbf, 0x41, 0x06, 0x2c, 0xc9, 0xca, 0x6b, 0x9a,
+    0x2c, 0x7b, 0x3c, 0x8d, 0x6a, 0xae, 0x30, 0xfb, 0x15, 0x82, 0x3c, 0x33, 0x46, 0xfa, 0x64, 0x60,
+    0x0d, 0x0f, 0xdb, 0x3b, 0xf0, 0x40, 0x18, 0x83, 0xfc, 0xef, 0x00, 0x9b, 0x8f, 0xab, 0x01, 0x8e,
+    0xe6, 0xf9, 0x5b, 0x77, 0xee, 0x4a, 0x22, 0xae, 0x7a, 0x1b, 0xf8, 0xa1, 0x6e, 0x0c, 0x7d, 0x85,
+    0x55, 0x2f, 0x76, 0xc0, 0x4f, 0xc0, 0xa0, 0x90, 0xff, 0x35, 0x09, 0x12, 0xea, 0xbd, 0x3e, 0x13,
+    0xe9, 0x23, 0xdd, 0x77, 0xb8, 0x02, 0xef, 0x19, 0x57, 0xfa, 0xe2, 0x0c, 0xb0, 0x10, 0x13, 0xf1,
+    0x27, 0x0c, 0x96, 0x4b, 0xc3, 0xe4, 0x57, 0xee, 0x35, 0x73, 0xcc, 0x41, 0xc1, 0x29, 0xc7, 0x99,
+    0x1c, 0xb0, 0x32, 0x35, 0x5d, 0x68, 0xdb, 0xdc, 0x7a, 0xd5, 0xe2, 0x54, 0xd3, 0x47, 0xa2, 0x08,
+    0x91, 0x73, 0x1f, 0xdd, 0xe7, 0x74, 0x5d, 0xf8, 0x4d, 0xe0, 0x8f, 0x2f, 0xdd, 0x19, 0x9c, 0xb4,
+    0x51, 0xc6, 0x6f, 0x1d, 0x33, 0xe7, 0xad, 0x8d, 0x00, 0x4c, 0x81, 0x20, 0x3e, 0xe0, 0xf8, 0xa9,
+    0xe8, 0xb6, 0xc9, 0x7f, 0x01, 0xbe, 0x56, 0xf3, 0x56, 0x67, 0x34, 0x6a, 0x8c, 0x85, 0x9d, 0x33,
+    0x1a, 0xbd, 0x72, 0x3d, 0xaf, 0x14, 0xbb, 0xd0, 0x48, 0xe6, 0xb8, 0x37, 0xae, 0x93, 0x60, 0xc1,
+    0x33, 0x45, 0x0a, 0x90, 0xff, 0xdc, 0x28, 0x67, 0x13, 0xd3, 0xd7, 0xa7, 0xe4, 0x04, 0x4e, 0x2b,
+    0x9f, 0xde, 0x5c, 0xfd, 0x38, 0xb1, 0x78, 0xf1, 0x63, 0x3e, 0xb7, 0xac, 0xf9, 0xbc, 0xf3, 0x90,
+    0x52, 0xcb, 0xa2, 0xb4, 0x98, 0x6f, 0xe7, 0x99, 0x0f, 0x7d, 0x8d, 0x27, 0xfb, 0xaf, 0xc1, 0x2c,
+    0x5c, 0x05, 0xd7, 0xb0, 0x6d, 0xcb, 0xaa, 0x5c, 0x63, 0x4f, 0x88, 0x80, 0x33, 0xc7, 0xda, 0xb2,
+    0x4e, 0x4e, 0xca, 0x58, 0x37, 0xd3, 0x1c, 0x79, 0x04, 0xb4, 0x27, 0x8b, 0x30, 0xd0, 0xe2, 0x4b,
+    0x3a, 0x6e, 0x0c, 0xba, 0xe7, 0x06, 0xd7, 0x9b, 0x79, 0x81, 0xfd, 0x71, 0x5b, 0x65, 0x65, 0x6f,
+    0x66, 0x34, 0xba, 0xdd, 0xfb, 0x43, 0xb1, 0xa9, 0xd8, 0xb1, 0xb7, 0x05, 0xe0, 0x4a, 0xa1, 0x52,
+    0xff, 0x67, 0x1a, 0x18, 0x30, 0x14, 0x69, 0xe0, 0x97, 0x02, 0x07, 0xcc, 0x69, 0xf3, 0x94, 0x52,
+    0xba, 0x4a, 0x21, 0xc5, 0xc4, 0x53, 0xc5, 0x0e, 0x04, 0xd9, 0x2e, 0x05, 0x57, 0x44, 0x06, 0xa9,
+    0xc4, 0x78, 0x29, 0x9f, 0x4c, 0x6a, 0xe7, 0x24, 0xcc, 0x63, 0x70, 0xd0, 0x2b, 0x65, 0xd2, 0xfb,
+    0xf4, 0x51, 0xfd, 0x2c, 0x91, 0x32, 0x4f, 0x27, 0x7c, 0xcb, 0x9b, 0x8a, 0xf2, 0xe0, 0x98, 0xe0,
+    0xf0, 0x49, 0x4d, 0xf8, 0x21, 0xb6, 0x75, 0x47, 0xc3, 0x22, 0x4a, 0x08, 0x15, 0xc1, 0x87, 0x7c,
+    0x51, 0x6f, 0x52, 0xd2, 0xe1, 0x5a, 0xdb, 0x93, 0x9c, 0x55, 0x04, 0x66, 0xa7, 0x9c, 0xd0, 0x58,
+    0x55, 0xe6, 0x73, 0xdf, 0xd3, 0x59, 0x6c, 0x14, 0x15, 0xbb, 0x04, 0x9b, 0x96, 0x03, 0x90, 0x6e,
+    0x25, 0x8d, 0x9e, 0xad, 0xa1, 0xe7, 0x31, 0x9e, 0x86, 0x84, 0xf3, 0xde, 0xb4, 0xc5, 0x2b, 0x7a,
+    0x63, 0x2c, 0xe7, 0x4d, 0xe6, 0x30, 0xb6, 0x1b, 0x83, 0x43, 0x3a, 0xb6, 0x7a, 0xc7, 0x23, 0xb6,
+    0x9a, 0xb4, 0x4e, 0xdf, 0x04, 0x64, 0x09, 0x9c, 0x69, 0xd3, 0x28, 0x64, 0x09, 0x8d, 0x9f, 0xf6,
+    0xc3, 0xd3, 0xdd, 0xf3, 0x2a, 0xd8, 0xfe, 0xb5, 0x4c, 0x56, 0x5e, 0x21, 0xc5, 0x97, 0xa2, 0x0d,
+    0x56, 0xfb, 0x9c, 0x02, 0xb9, 0xe7, 0x75, 0xdd, 0x2f, 0x6e, 0xfc, 0x1c, 0xce, 0xf3, 0x0a, 0x8f,
+    0x67, 0xde, 0xcb, 0x58, 0x43, 0xaf, 0xaf, 0x3c, 0x03, 0x9d, 0x4f, 0xf9, 0x28, 0x5e, 0x6b, 0x2b,
+    0x20, 0xc7, 0x57, 0x7f, 0x8c, 0xfb, 0x9d, 0xad, 0x93, 0x04, 0x53, 0xfa, 0xd8, 0xcc, 0x35, 0x6d,
+    0x09, 0x14, 0xba, 0x09, 0x9d, 0xa1, 0xfd, 0xc8, 0xd6, 0x01, 0x1d, 0xdc, 0x22, 0x81, 0x6f, 0x43,
+    0xe0, 0xfe, 0x71, 0xda, 0xd2, 0xaa, 0x24, 0x1f, 0x0c, 0x1c, 0x29, 0xd1, 0x80, 0x71, 0x1f, 0x8c,
+    0x76, 0xeb, 0xb4, 0x66, 0xb5, 0x4a, 0xa1, 0x12, 0x53, 0xdb, 0xdc, 0x48, 0x99, 0x02, 0x96, 0x0d,
+    0x8a, 0x90, 0x2b, 0xfe, 0x76, 0x2d, 0xda, 0x7d, 0x81, 0xb7, 0xba, 0xd2, 0xad, 0xce, 0x94, 0x15,
+    0xa7, 0x8b, 0xd3, 0x3f, 0xc9, 0x77, 0x94, 0x27, 0xd4, 0xac, 0x3a, 0x34, 0xf2, 0x88, 0x19, 0x59,
+    0xfa, 0xbb, 0xd0, 0x14, 0x28, 0xde, 0xca, 0x2e, 0x07, 0x2f, 0x88, 0x99, 0x2c, 0x58, 0x49, 0xb8,
+    0xe8, 0x8d, 0xf2, 0x8c, 0x3a, 0x81, 0x03, 0x91, 0xa7, 0xc9, 0xb5, 0x17, 0x7b, 0xa0, 0xa9, 0x53,
+    0x70, 0x32, 0xa3, 0x9b, 0x4b, 0xbe, 0x6c, 0x10, 0x3d, 0xf7, 0x3c, 0xd3, 0xe8, 0x29, 0x07, 0xd9,
+    0xce, 0x18, 0x0a, 0xa1, 0x68, 0x2c, 0x05, 0x0f, 0x2a, 0xda, 0xf8, 0x24, 0xdb, 0x14, 0x32, 0x2b,
+    0x38, 0x56, 0x51, 0xf0, 0xa0, 0xa2, 0x69, 0x94, 0xc4, 0xdf, 0xba, 0xc9, 0xd2, 0xac, 0x3e, 0x57,
+    0xb1, 0xf3, 0x76, 0x51, 0xf0, 0xf4, 0x35, 0x79, 0xb3, 0x61, 0x79, 0x41, 0xa9, 0xdf, 0xe5, 0x13,
+    0xbd, 0x04, 0xa8, 0xd2, 0x5a, 0x38, 0xb8, 0xfc, 0x1d, 0xe6, 0x0a, 0x35, 0x0d, 0x8d, 0xee, 0x08,
+    0x9a, 0x53, 0xa1, 0x0c, 0xd3, 0x6d, 0x38, 0x2a, 0xe2, 0x06, 0xe8, 0xd1, 0x1f, 0x0c, 0x40, 0x11,
+    0xc7, 0xc1, 0x9b, 0xf5, 0x4c, 0x64, 0x9c, 0xcc, 0xc3, 0xb6, 0x3a, 0x23, 0x2d, 0x2b, 0x4e, 0xc9,
+    0xe0, 0x48, 0xdd, 0x0e, 0xae, 0x10, 0x17, 0x66, 0x1e, 0x77, 0x06, 0x56, 0xfb, 0x31, 0xf8, 0x5f,
+    0x8f, 0xd5, 0xa7, 0xa3, 0xce, 0x93, 0xf2, 0x43, 0xab, 0x73, 0x08, 0x0f, 0x89, 0xfe, 0x70, 0x30,
+    0xe8, 0x0c, 0x0e, 0xe0, 0xf1, 0xb8, 0xf0, 0xf8, 0xb0, 0x03, 0x6b, 0xeb, 0x27, 0xa2, 0x21, 0x76,
+    0x82, 0x6e, 0xac, 0x03, 0x51, 0x13, 0x8d, 0x9e, 0x27, 0x26, 0xe2, 0xc9, 0xcd, 0x45, 0x17, 0xcc,
+    0x44, 0xcc, 0x45, 0xa6, 0x08, 0xf0, 0x49, 0x67, 0x70, 0x52, 0x4a, 0xab, 0x92, 0x38, 0xe5, 0xe8,
+    0x1d, 0xad, 0x49, 0x7a, 0x2c, 0x77, 0x31, 0x26, 0xbc, 0x6e, 0x1b, 0xa7, 0x65, 0xe9, 0x9a, 0x3a,
+    0xb4, 0x26, 0x32, 0xed, 0x92, 0xdd, 0x11, 0x30, 0xb6, 0x9b, 0x1d, 0x31, 0x7a, 0x41, 0x3d, 0x0f,
+    0x44, 0xa5, 0xc9, 0xac, 0x70, 0x80, 0x5f, 0x88, 0x71, 0x25, 0xc3, 0x22, 0x56, 0x6b, 0xb4, 0x2b,
+    0xc5, 0x3e, 0x61, 0xf5, 0x9d, 0x5c, 0x7e, 0x07, 0x8b, 0x83, 0x82, 0xd6, 0xa5, 0x9e, 0xbb, 0xf0,
+    0xc7, 0x36, 0xa0, 0x06, 0x3a, 0x22, 0x33, 0x39, 0xdc, 0x01, 0xc0, 0x08, 0x12, 0x09, 0x56, 0x29,
+    0x79, 0x3a, 0xc9, 0x50, 0x8f, 0xee, 0x67, 0x9e, 0xe4, 0x2e, 0xe3, 0x20, 0x4a, 0x4c, 0x13, 0x82,
+    0xdb, 0x19, 0x6f, 0xc3, 0x9c, 0x71, 0x3d, 0xdd, 0x03, 0x57, 0x91, 0x7a, 0x0c, 0xcf, 0x87, 0x46,
+    0xcc, 0xa4, 0x42, 0x79, 0x2b, 0x84, 0x56, 0xf7, 0x2f, 0x00, 0x4d, 0xb6, 0xd9, 0x3d, 0xb9, 0x5e,
+    0xaa, 0xa5, 0xf8, 0xcf, 0x3a, 0xd3, 0x87, 0x56, 0xf8, 0x6f, 0x67, 0x7a, 0x28, 0xc8, 0x27, 0xf4,
+    0xf0, 0x4d, 0x39, 0x10, 0x54, 0xba, 0xa6, 0x97, 0xeb, 0xd5, 0xec, 0xeb, 0x88, 0x2f, 0xde, 0xe7,
+    0x3f, 0xf6, 0xe2, 0x3c, 0x24, 0xe3, 0xf6, 0x86, 0x89, 0xdc, 0x96, 0x3d, 0xba, 0x9a, 0x66, 0x0d,
+    0x11, 0x1c, 0xb7, 0x3a, 0x4b, 0xe6, 0xb8, 0x57, 0x29, 0x03, 0x48, 0x7f, 0x77, 0x3c, 0xf7, 0xd8,
+    0xf5, 0x84, 0x9f, 0x7e, 0xd7, 0x4d, 0xd8, 0x2a, 0x4e, 0x79, 0xe0, 0xc7, 0x75, 0x9c, 0xb8, 0xf3,
+    0x9b, 0xae, 0x2d, 0x54, 0xf0, 0x38, 0x0e, 0xa9, 0xcd, 0xba, 0x33, 0x96, 0x6c, 0x18, 0xf3, 0x27,
+    0x21, 0xe8, 0x52, 0x90, 0xec, 0xf1, 0x71, 0x78, 0x4d, 0x46, 0xe1, 0xf5, 0x44, 0x34, 0x1b, 0x75,
+    0x67, 0x01, 0x18, 0xca, 0xd5, 0xb8, 0xdc, 0x70, 0x94, 0xf5, 0x35, 0x41, 0x1c, 0x57, 0x6b, 0xb2,
+    0x8d, 0xa7, 0x58, 0x14, 0x8d, 0x23, 0x7b, 0xda, 0xe2, 0x11, 0x65, 0x4a, 0x44, 0xee, 0x11, 0x48,
+    0xb3, 0x38, 0x6d, 0x79, 0xf4, 0xa7, 0x9b, 0x16, 0xa1, 0x5e, 0x32, 0x6d, 0x29, 0x7e, 0xc2, 0x15,
+    0x18, 0x33, 0xd1, 0x23, 0x20, 0x9c, 0x84, 0x9c, 0x42, 0xa9, 0xa3, 0x00, 0x63, 0xb9, 0x1d, 0x9d,
+    0xb6, 0x92, 0xa5, 0x1b, 0x4b, 0xaf, 0xff, 0xca, 0x8d, 0xdd, 0x99, 0x8b, 0x89, 0xc4, 0xe9, 0x07,
+    0x63, 0xe9, 0x3a, 0x0e, 0xf3, 0x3f, 0xc0, 0x62, 0x92, 0x46, 0x3c, 0x3c, 0x1c, 0x1f, 0x1d, 0xc2,
+    0x06, 0x97, 0x0c, 0x53, 0xc7, 0xe3, 0x43, 0xd8, 0xf0, 0x24, 0xe0, 0xfd, 0x12, 0xdd, 0xb9, 0x9b,
+    0x8c, 0x6d, 0x30, 0x62, 0x51, 0xba, 0x7b, 0x0c, 0xa1, 0xc0, 0xd7, 0xc7, 0xe1, 0x2b, 0x1a, 0x2d,
+    0x5c, 0xbf, 0xcb, 0xf3, 0xcd, 0x63, 0xec, 0x2f, 0x9b, 0x20, 0x9d, 0xbb, 0xf1, 0x12, 0xf4, 0xe1,
+    0xc7, 0xb1, 0x35, 0x81, 0xf3, 0x06, 0x96, 0x1f, 0x87, 0x81, 0xcb, 0x89, 0x9d, 0x87, 0x64, 0xe3,
+    0x87, 0x83, 0xc1, 0xa0, 0x89, 0x44, 0xca, 0x11, 0x22, 0xc8, 0xf1, 0x60, 0x82, 0x28, 0xcc, 0xbd,
+    0x60, 0x33, 0x16, 0xf8, 0x4f, 0x56, 0xb0, 0xb0, 0xc0, 0xdc, 0xda, 0x11, 0x90, 0x54, 0x06, 0x10,
+    0xf0, 0x95, 0xdd, 0x4f, 0x9e, 0xe8, 0xeb, 0xf2, 0xd3, 0x1f, 0xfb, 0xc1, 0x26, 0xa2, 0x61, 0x69,
+    0x41, 0xae, 0x40, 0xb2, 0x87, 0xcc, 0xf3, 0xdc, 0x30, 0x76, 0x63, 0x5c, 0x1b, 0x3d, 0xac, 0x82,
+    0xd5, 0x2c, 0xb0, 0x2e, 0x79, 0x0a, 0xa0, 0xfd, 0x0a, 0xad, 0xd4, 0x3a, 0xe5, 0x0e, 0x9a, 0x94,
+    0x41, 0x18, 0xf9, 0xb7, 0xb3, 0xf6, 0xd3, 0x3e, 0x0e, 0x3e, 0x7d, 0xda, 0x07, 0xdc, 0xf7, 0xd9,
+    0xd8, 0x68, 0x34, 0xd2, 0x36, 0xf6, 0xe4, 0x1e, 0xf6, 0xa5, 0x33, 0xd8, 0x16, 0x94, 0x76, 0x46,
+    0x58, 0x93, 0xca, 0x05, 0x0d, 0xc7, 0xa3, 0x12, 0xeb, 0x48, 0xd6, 0xf2, 0xd8, 0x5c, 0x72, 0x56,
+    0xc3, 0x19, 0x4b, 0x87, 0x7b, 0x1f, 0x29, 0x91, 0x88, 0xa4, 0x02, 0x0e, 0xeb, 0xf3, 0xfe, 0x48,
+    0x95, 0x45, 0xeb, 0xdb, 0x3c, 0xb5, 0x9c, 0xc1, 0x24, 0x65, 0x2b, 0xcb, 0x92, 0x12, 0x32, 0xc6,
+    0xc8, 0xba, 0x20, 0x2d, 0xb8, 0xc1, 0x82, 0x34, 0x68, 0x3c, 0x08, 0x47, 0xc5, 0x7f, 0x6f, 0x84,
+    0x00, 0x1e, 0x59, 0xc8, 0xd4, 0xdf, 0xb0, 0xa8, 0xca, 0x2b, 0x6f, 0xde, 0xbc, 0x13, 0x6c, 0xfc,
+    0xcc, 0x8d, 0xf8, 0x55, 0x08, 0x50, 0x48, 0xc3, 0xfc, 0x8a, 0x04, 0xe0, 0x9d, 0xa6, 0xc3, 0x21,
+    0x2f, 0x82, 0xc7, 0x10, 0x18, 0x2e, 0xe8, 0x5d, 0x08, 0x02, 0x5e, 0x7c, 0xc2, 0x7e, 0x3d, 0x72,
+    0x20, 0x31, 0x40, 0xe9, 0xf3, 0xcc, 0xd7, 0xc1, 0x41, 0x46, 0x8e, 0x39, 0xa8, 0x99, 0x7b, 0x26,
+    0xc7, 0xb9, 0xe7, 0x82, 0xd6, 0xdb, 0x85, 0x06, 0x5c, 0x12, 0x4b, 0xf2, 0xa8, 0x86, 0x73, 0x55,
+    0x8e, 0xd3, 0x27, 0x07, 0x73, 0xc2, 0xed, 0x68, 0x8e, 0xe5, 0x72, 0xe1, 0x54, 0x23, 0x0b, 0x19,
+    0x85, 0x3b, 0xd7, 0xa9, 0x8f, 0xc3, 0x43, 0x99, 0xb9, 0xeb, 0x3b, 0xfc, 0x16, 0x98, 0x19, 0xa2,
+    0xf7, 0x12, 0xe6, 0x91, 0xb9, 0x9f, 0x37, 0x44, 0xa2, 0x17, 0x89, 0x13, 0x4f, 0x0b, 0xae, 0xa3,
+    0xd2, 0xad, 0x08, 0xaf, 0xeb, 0x9a, 0xb0, 0x36, 0xb0, 0x44, 0xb0, 0xe9, 0x05, 0x21, 0xf3, 0xcd,
+    0x42, 0x57, 0xe7, 0xfd, 0x38, 0x31, 0x1c, 0xd3, 0x0e, 0x31, 0x7e, 0x98, 0x79, 0xd4, 0xff, 0x58,
+    0xdd, 0xfd, 0xa7, 0xa2, 0x8a, 0xdb, 0x55, 0x33, 0x62, 0xfc, 0x01, 0x79, 0x4a, 0x2c, 0xf2, 0xcf,
+    0x7f, 0x12, 0xf1, 0xe3, 0x54, 0xa5, 0x91, 0xf0, 0x9c, 0xdb, 0x9a, 0xf7, 0x59, 0x75, 0x8b, 0x8e,
+    0x4f, 0x55, 0xbb, 0xff, 0xa5, 0x53, 0x98, 0x83, 0xfa, 0x8e, 0x0f, 0xf9, 0x5e, 0x1d, 0x73, 0xc5,
+    0x91, 0xda, 0xea, 0xdc, 0x0b, 0xdc, 0x0b, 0x17, 0x11, 0x9a, 0x3b, 0xbf, 0x04, 0xe4, 0x8b, 0xbc,
+    0x69, 0x4a, 0xb6, 0x59, 0x01, 0xb5, 0xce, 0xbd, 0xed, 0x13, 0xd5, 0x76, 0x5f, 0x19, 0x13, 0xd1,
+    0xcd, 0x2e, 0x13, 0xdf, 0xd1, 0x8d, 0x3e, 0x8f, 0x67, 0x46, 0x58, 0xb4, 0xcb, 0xdc, 0x17, 0x62,
+    0x68, 0xd6, 0x3f, 0x57, 0xd7, 0x0e, 0x7c, 0xef, 0xde, 0xaf, 0x58, 0x4f, 0xd0, 0xa6, 0x58, 0x9f,
+    0xa8, 0x77, 0x3c, 0x64, 0xfe, 0x12, 0xe9, 0x52, 0x98, 0x94, 0x0f, 0x4a, 0x29, 0x21, 0x69, 0x50,
+    0x18, 0x27, 0x99, 0xef, 0x31, 0x19, 0x08, 0x2f, 0xa6, 0x9f, 0x77, 0x24, 0x2b, 0xbc, 0x37, 0x79,
+    0xd0, 0x5c, 0x7c, 0x8a, 0xd8, 0x15, 0x6f, 0xd5, 0xc3, 0xe4, 0x33, 0x9d, 0x79, 0xbc, 0x00, 0x29,
+    0x21, 0x8b, 0x78, 0x6f, 0x0b, 0x00, 0x1f, 0x70, 0x6a, 0x02, 0x50, 0x6a, 0x56, 0xee, 0x92, 0xb4,
+    0x8e, 0x22, 0xce, 0xad, 0x3e, 0x39, 0xa2, 0x0a, 0x21, 0xe2, 0xa9, 0xf7, 0xdf, 0x2a, 0x2d, 0xd6,
+    0x8a, 0x28, 0x15, 0x5b, 0xa1, 0xcb, 0x23, 0xc4, 0xfa, 0x2a, 0x6c, 0xdc, 0xc2, 0x2e, 0xb0, 0x9f,
+    0x56, 0x6f, 0xa6, 0x79, 0xb9, 0xc7, 0xa5, 0xe5, 0xb4, 0xc4, 0x97, 0x5c, 0x70, 0x37, 0x09, 0xde,
+    0x9a, 0xbb, 0xaa, 0xbb, 0xa0, 0xab, 0x2e, 0xaf, 0xbb, 0x20, 0x65, 0x35, 0x4f, 0x1b, 0xda, 0x28,
+    0xb3, 0x96, 0x21, 0xda, 0x5b, 0x46, 0x6c, 0xfe, 0x6b, 0x09, 0x57, 0x1e, 0x54, 0x3a, 0xde, 0x34,
+    0xbd, 0x15, 0x45, 0x7b, 0x29, 0xe6, 0x5a, 0x8e, 0x2b, 0x43, 0x15, 0xdb, 0xa8, 0x7a, 0x34, 0x04,
+    0x53, 0xe1, 0x88, 0x9e, 0x4c, 0x9a, 0xe1, 0xca, 0x7d, 0x0d, 0xb3, 0x5d, 0x35, 0x41, 0xd0, 0x31,
+    0x9f, 0x50, 0x71, 0x0b, 0x44, 0xf1, 0x50, 0x8a, 0x05, 0x91, 0xcf, 0x6c, 0x6c, 0xac, 0x8a, 0x56,
+    0x60, 0x6a, 0xa5, 0xf5, 0xe7, 0x32, 0x98, 0x3a, 0x2f, 0xcf, 0x30, 0xd5, 0xa6, 0xaa, 0xfe, 0xbd,
+    0xd2, 0x45, 0x62, 0xe1, 0x2e, 0xa7, 0xef, 0xef, 0xde, 0x8d, 0x86, 0x5b, 0x1a, 0x13, 0xd1, 0xe1,
+    0x2c, 0xce, 0x7a, 0x5c, 0xc8, 0xee, 0x7e, 0x72, 0x93, 0x1a, 0x6f, 0xed, 0x67, 0x82, 0x8e, 0x7a,
+    0x73, 0x5a, 0x39, 0x27, 0x5a, 0x7c, 0x93, 0x15, 0x79, 0x3e, 0xad, 0xa3, 0x4d, 0xae, 0xae, 0xb7,
+    0xb4, 0xf5, 0xfb, 0x5c, 0x91, 0xbd, 0x63, 0x5e, 0xf0, 0x23, 0xe6, 0xa1, 0x12, 0x97, 0x01, 0xa3,
+    0xc2, 0xb9, 0xc1, 0x04, 0x53, 0x68, 0xf8, 0x80, 0x0c, 0x86, 0x64, 0xc9, 0x53, 0x90, 0x0f, 0x0a,
+    0xcd, 0xe1, 0x2f, 0xb0, 0xd6, 0x58, 0xb8, 0x34, 0xe0, 0xf3, 0x0b, 0x4d, 0xd8, 0x16, 0xcc, 0xad,
+    0x42, 0x9a, 0xf5, 0xc5, 0x6c, 0x11, 0x3e, 0x07, 0x8f, 0x07, 0xd4, 0xc0, 0x5f, 0x82, 0x75, 0xbe,
+    0x21, 0x29, 0x9a, 0xab, 0x10, 0x9b, 0x18, 0x44, 0x02, 0x74, 0x88, 0x25, 0x8f, 0xb7, 0xaf, 0x79,
+    0xb5, 0xe3, 0xf9, 0x6b, 0x29, 0x24, 0x4b, 0xfe, 0xfa, 0x73, 0x7c, 0x0b, 0x0e, 0xc9, 0x60, 0xa8,
+    0xce, 0xc6, 0xa9, 0x97, 0x22, 0x19, 0x2a, 0x97, 0x78, 0xed, 0xfa, 0xeb, 0x84, 0xc1, 0x22, 0xed,
+    0x5e, 0xc8, 0x1b, 0x30, 0xa2, 0xc4, 0x1c, 0x76, 0xf0, 0xb6, 0x9e, 0xb6, 0x6c, 0x5c, 0x9a, 0x78,
+    0xc9, 0xe0, 0x8d, 0xd3, 0x30, 0xb1, 0xa9, 0x8f, 0x02, 0x0e, 0x8a, 0x13, 0x05, 0xf4, 0x99, 0xe2,
+    0xdf, 0x66, 0xe7, 0x22, 0x6e, 0xb0, 0x1d, 0x1c, 0x1c, 0x4d, 0x1e, 0xf9, 0xb3, 0x38, 0x9c, 0xa0,
+    0x40, 0xc9, 0xd5, 0x97, 0xe5, 0xe5, 0x50, 0xcc, 0xc6, 0x38, 0x64, 0x95, 0xfd, 0x2d, 0x16, 0xfa,
+    0x05, 0xe7, 0x6a, 0x81, 0x7d, 0x31, 0xfa, 0x06, 0x7a, 0x83, 0x59, 0xe5, 0xe1, 0x37, 0x46, 0x15,
+    0x03, 0x11, 0xc6, 0xc2, 0x64, 0x4e, 0x66, 0x1e, 0x50, 0xf3, 0x50, 0xdf, 0x40, 0xad, 0x10, 0xb3,
+    0xe4, 0x02, 0xad, 0xf0, 0x15, 0xf5, 0x4c, 0xe5, 0x60, 0x3b, 0xd8, 0x21, 0x80, 0x36, 0x52, 0x3b,
+    0xec, 0x49, 0xc6, 0x34, 0x5f, 0x42, 0xbc, 0x8c, 0x8c, 0x75, 0x16, 0x24, 0xd8, 0x29, 0x93, 0x56,
+    0x3a, 0x75, 0x46, 0x41, 0x06, 0x86, 0x01, 0x38, 0xb6, 0xc0, 0x28, 0xeb, 0x98, 0x45, 0xc2, 0xab,
+    0x26, 0x3c, 0x0f, 0x79, 0x99, 0x04, 0x11, 0x5d, 0x30, 0xa4, 0xea, 0x45, 0xc2, 0x40, 0xed, 0x24,
+    0x8b, 0x1f, 0x66, 0x41, 0xf2, 0x43, 0x3a, 0x4e, 0xbd, 0x3c, 0x90, 0x3e, 0x2b, 0xb7, 0xfd, 0x7b,
+    0x88, 0x54, 0x83, 0x3f, 0x35, 0x13, 0xb8, 0xa8, 0x12, 0x88, 0x53, 0x32, 0x95, 0xbf, 0x4c, 0x92,
+    0x30, 0x1e, 0xf7, 0xfb, 0x49, 0x6f, 0xc5, 0x78, 0xdf, 0x45, 0xba, 0x54, 0x61, 0x7c, 0xa1, 0x3c,
+    0xfe, 0x61, 0x3d, 0x7c, 0x62, 0x1d, 0x93, 0x3f, 0x57, 0xcf, 0xd8, 0x86, 0x8d, 0x4c, 0xf8, 0x56,
+    0xd5, 0xca, 0x31, 0x37, 0x61, 0xec, 0x06, 0xe9, 0xc2, 0x0f, 0xd7, 0xc9, 0x73, 0x10, 0xdd, 0x2d,
+    0x35, 0xf7, 0x8a, 0xeb, 0x20, 0x77, 0x46, 0xaf, 0x50, 0xca, 0xbf, 0x33, 0x7a, 0xca, 0x36, 0x51,
+    0x2f, 0x69, 0x3d, 0xcf, 0x45, 0xf6, 0x41, 0x5d, 0xa2, 0x30, 0x4f, 0xd3, 0x9a, 0x5f, 0xcb, 0x61,
+    0x7c, 0xed, 0xb4, 0xcd, 0xae, 0x07, 0x02, 0xb7, 0x32, 0x15, 0x6e, 0xfa, 0x2c, 0x67, 0x27, 0xd5,
+    0xa0, 0x29, 0x6b, 0xa4, 0x7f, 0x4d, 0x2f, 0x46, 0x98, 0xfd, 0xff, 0xfd, 0x73, 0x1f, 0x84, 0xd4,
+    0xc8, 0x8a, 0x5a, 0x0a, 0x03, 0xc7, 0x75, 0x0c, 0xdc, 0xc9, 0xe0, 0x28, 0xb5, 0xb0, 0x6c, 0x77,
+    0x13, 0x75, 0xdf, 0xcc, 0x71, 0x93, 0xfb, 0x12, 0x1b, 0xd4, 0x96, 0x69, 0x8a, 0x7e, 0x6f, 0x62,
+    0x29, 0x9b, 0xdf, 0x0e, 0x61, 0x77, 0x66, 0xb9, 0x0f, 0x46, 0xd9, 0x67, 0x2f, 0x73, 0x18, 0x2b,
+    0x0b, 0x8e, 0xfb, 0x4c, 0x03, 0xa7, 0xfd, 0x1c, 0xef, 0xd3, 0xa2, 0x5b, 0x8a, 0x57, 0x21, 0x4c,
+    0xe3, 0x23, 0xbb, 0x41, 0x57, 0x0d, 0xce, 0x32, 0x3d, 0x2b, 0x53, 0xf3, 0x9a, 0x58, 0x0f, 0x46,
+    0x88, 0x72, 0xdd, 0xb9, 0x08, 0xd9, 0x74, 0x1e, 0x06, 0x0c, 0xe0, 0xbf, 0xc2, 0xc1, 0xa7, 0x1a,
+    0xf5, 0x0b, 0x16, 0x27, 0xee, 0x2f, 0xff, 0x46, 0xbf, 0x0c, 0x38, 0xd1, 0x61, 0xb1, 0x68, 0x43,
+    0x44, 0x85, 0x5a, 0xfc, 0xcc, 0xc4, 0x5b, 0x70, 0x96, 0x21, 0x12, 0x01, 0x34, 0x2f, 0x9c, 0x0e,
+    0x5e, 0xe1, 0x28, 0xe4, 0x33, 0xfc, 0xb0, 0x41, 0x34, 0xe4, 0x3c, 0x35, 0x8d, 0xe1, 0x87, 0xbd,
+    0x04, 0xdc, 0x28, 0x81, 0x79, 0x08, 0xc0, 0x37, 0x41, 0xe4, 0xe0, 0x4d, 0x4e, 0x92, 0xbf, 0x22,
+    0x06, 0x6a, 0x3d, 0x63, 0x52, 0xfd, 0x79, 0x07, 0xbc, 0x51, 0x2e, 0x1d, 0x13, 0xae, 0x5f, 0xea,
+    0xfe, 0xd1, 0x21, 0x66, 0x4b, 0x55, 0x43, 0x1d, 0x8d, 0x46, 0x1c, 0x6a, 0x31, 0x67, 0xa1, 0xf4,
+    0x03, 0x3a, 0x85, 0x4b, 0x8b, 0xd4, 0x59, 0x34, 0xaa, 0x85, 0x4d, 0x36, 0xf5, 0x0c, 0x87, 0x1a,
+    0x5a, 0x75, 0x18, 0x60, 0xf8, 0xcc, 0x4e, 0x98, 0xa3, 0x7d, 0x44, 0x03, 0xc7, 0x55, 0x68, 0x7c,
+    0x6b, 0x38, 0xe4, 0x2e, 0xb1, 0xd3, 0x8b, 0x63, 0xd7, 0xe1, 0x71, 0x2a, 0x3e, 0x1d, 0x1c, 0xca,
+    0xa7, 0x6e, 0x38, 0x29, 0xc0, 0xa8, 0xbd, 0x9c, 0x2e, 0xef, 0x8b, 0xf3, 0x02, 0x8e, 0x51, 0x33,
+    0x8b, 0xa7, 0xf1, 0x5e, 0xa4, 0xa4, 0x29, 0x4c, 0x3b, 0xa8, 0x9b, 0xa6, 0x7e, 0x80, 0x63, 0x3e,
+    0xcf, 0xee, 0xb3, 0x97, 0xbf, 0x84, 0x51, 0xb3, 0xc9, 0x91, 0x3d, 0xe3, 0x39, 0xd0, 0x00, 0xe9,
+    0x42, 0x9d, 0xc0, 0xd8, 0x79, 0x4f, 0x12, 0xb5, 0x7d, 0xf7, 0x94, 0x4f, 0xdb, 0x61, 0x4f, 0xf3,
+    0xf9, 0x88, 0xb3, 0x88, 0xe6, 0xd1, 0x9e, 0xc7, 0x88, 0x28, 0xb0, 0xd9, 0x0a, 0xd4, 0x28, 0x3a,
+    0xb0, 0xd8, 0xfb, 0x0f, 0xbe, 0xf2, 0x6a, 0x86, 0x17, 0xa7, 0x84, 0x60, 0x99, 0xcc, 0xcb, 0x7b,
+    0x81, 0x03, 0xe2, 0x81, 0xef, 0xc2, 0xbb, 0x84, 0x95, 0x76, 0xdd, 0x76, 0x55, 0x8d, 0x5c, 0x61,
+    0xbc, 0xc6, 0x3a, 0x79, 0xf9, 0xba, 0x3b, 0x4c, 0xec, 0x8b, 0x6e, 0x35, 0xa3, 0xbe, 0xb9, 0x55,
+    0xff, 0x40, 0x85, 0x7e, 0x99, 0x88, 0x2b, 0x9a, 0xba, 0x8b, 0x28, 0x08, 0xe3, 0x0d, 0x4b, 0x40,
+    0x94, 0x3e, 0xde, 0x09, 0x33, 0x5f, 0xce, 0x2d, 0x77, 0x83, 0xc1, 0x9b, 0x78, 0xeb, 0xa7, 0x33,
+    0x76, 0xea, 0xf2, 0xda, 0xe4, 0x38, 0xa2, 0x42, 0x2d, 0x36, 0xa5, 0xe0, 0x42, 0xf7, 0xd6, 0xe6,
+    0xd5, 0x50, 0x74, 0x17, 0x0c, 0x90, 0x5e, 0x14, 0x8a, 0x7b, 0x3b, 0x15, 0xd4, 0xab, 0xca, 0xde,
+    0xb5, 0x85, 0x25, 0x5e, 0x50, 0x72, 0xdc, 0x88, 0xf1, 0xf3, 0x19, 0x03, 0x5a, 0xeb, 0x95, 0xcf,
+    0xcb, 0x4d, 0xc7, 0xc5, 0x7a, 0x12, 0xdf, 0x74, 0x5a, 0x2d, 0xf7, 0xeb, 0x2a, 0xe5, 0x22, 0x13,
+    0x72, 0x26, 0x55, 0x9b, 0xdf, 0x13, 0xbf, 0x4b, 0x17, 0x18, 0x21, 0x68, 0xaa, 0x8f, 0x0a, 0xb0,
+    0xd8, 0x98, 0x56, 0x19, 0x86, 0xe1, 0x35, 0x39, 0xd6, 0x8b, 0x0c, 0x8a, 0x3e, 0x19, 0x1c, 0x1c,
+    0xa1, 0xd0, 0x8e, 0xda, 0x69, 0x19, 0xa1, 0xb2, 0xde, 0x2c, 0x46, 0x1d, 0x28, 0x55, 0x18, 0x54,
+    0x2f, 0x85, 0x6a, 0x83, 0x28, 0xcd, 0x96, 0xea, 0x09, 0xcf, 0x5f, 0xbc, 0xbf, 0xf8, 0xe6, 0x79,
+    0x1a, 0x83, 0x94, 0xf6, 0x51, 0xdf, 0xe3, 0xf6, 0x77, 0x4e, 0x73, 0xd7, 0xc1, 0xda, 0xf1, 0xdc,
+    0x7d, 0x17, 0x6c, 0xfe, 0xf4, 0x33, 0x5e, 0x5e, 0x74, 0xd8, 0xf5, 0x6d, 0x6b, 0xd7, 0xca, 0x3b,
+    0x9e, 0x03, 0xc7, 0x2b, 0xa5, 0x06, 0xff, 0x3e, 0xc9, 0xe0, 0xb0, 0x96, 0x1e, 0xf2, 0x8b, 0x21,
+    0x07, 0xcd, 0xf4, 0xc8, 0xea, 0xef, 0x3a, 0x05, 0x8e, 0xd3, 0x02, 0x23, 0x96, 0x40, 0xc7, 0xbc,
+    0x0e, 0xda, 0x3a, 0x2d, 0xed, 0x58, 0x3f, 0x36, 0x51, 0x77, 0xce, 0xeb, 0xcc, 0x10, 0x87, 0x61,
+    0xd5, 0x46, 0xd0, 0x99, 0x59, 0xf8, 0xaf, 0x56, 0xb4, 0x39, 0x11, 0x7d, 0x8c, 0x48, 0x0b, 0xb4,
+    0x44, 0xb7, 0x92, 0xb0, 0xa5, 0x55, 0xfe, 0xf4, 0xb3, 0xc2, 0x48, 0xb7, 0x65, 0x24, 0x8a, 0x05,
+    0x2c, 0x54, 0x4e, 0xe7, 0xe0, 0x89, 0xbe, 0x0a, 0xa2, 0x95, 0x99, 0x53, 0xba, 0x63, 0xa4, 0x2b,
+    0xe5, 0xfe, 0xb0, 0xd1, 0x5f, 0x74, 0x5a, 0x1f, 0x3e, 0x18, 0xad, 0xf6, 0xad, 0xd1, 0x6e, 0x3d,
+    0xa8, 0x33, 0xfe, 0x55, 0xd5, 0xae, 0x61, 0x05, 0xe1, 0x87, 0xc3, 0x43, 0xc5, 0x22, 0xd6, 0xd0,
+    0x5d, 0x1d, 0x94, 0xf3, 0xa1, 0x28, 0x12, 0x16, 0x4e, 0xe1, 0xe8, 0x4e, 0x55, 0x2f, 0xd8, 0xba,
+    0x52, 0xf3, 0xda, 0x4e, 0x2f, 0x91, 0xd5, 0x52, 0x54, 0xf1, 0x6f, 0x4c, 0x34, 0x4e, 0x8b, 0xe3,
+    0x51, 0x23, 0xcd, 0xf2, 0x31, 0x6a, 0xc5, 0x70, 0x34, 0x2a, 0x89, 0xee, 0xd1, 0xbd, 0x14, 0x0a,
+    0xb5, 0x4d, 0x89, 0xba, 0xa0, 0xfe, 0x28, 0x95, 0x67, 0x26, 0xf9, 0xac, 0x41, 0xa0, 0x79, 0x35,
+    0x33, 0x13, 0xda, 0xe1, 0xa7, 0x09, 0xad, 0xca, 0x3c, 0xc3, 0x5a, 0xa1, 0x6d, 0x50, 0xe2, 0x65,
+    0x76, 0x28, 0xda, 0x21, 0xc9, 0x89, 0xdb, 0xa8, 0x26, 0x1b, 0x0e, 0x64, 0x6f, 0xcf, 0x21, 0x07,
+    0x2e, 0x58, 0x0f, 0x4d, 0x15, 0xf9, 0x2e, 0xa7, 0xc8, 0xf7, 0x68, 0xaa, 0xca, 0xeb, 0x36, 0xf5,
+    0x37, 0x54, 0xa8, 0x9f, 0x0a, 0x95, 0x58, 0xb1, 0x1b, 0x0e, 0x99, 0x07, 0x0a, 0xd9, 0xf1, 0x5c,
+    0x02, 0xf3, 0xaa, 0xc7, 0x83, 0x3e, 0xfc, 0xb4, 0x85, 0x96, 0xb6, 0x25, 0x6e, 0x42, 0x4f, 0x5b,
+    0x99, 0x0a, 0x6a, 0x91, 0x15, 0xbd, 0x16, 0xc6, 0x7c, 0xda, 0x3a, 0x18, 0xb6, 0x08, 0x67, 0xf9,
+    0xa5, 0xc8, 0xa4, 0xb7, 0x2e, 0x2f, 0x2f, 0x5e, 0xd6, 0xf3, 0x7b, 0xce, 0xf2, 0x65, 0x4d, 0x38,
+    0x54, 0x15, 0xf7, 0x71, 0x45, 0xb1, 0x9c, 0x1f, 0xee, 0xc0, 0xea, 0xc0, 0xff, 0x0e, 0xf0, 0x6c,
+    0x8f, 0x77, 0xd1, 0xda, 0x07, 0x45, 0x06, 0x78, 0xd2, 0xac, 0x6f, 0xe1, 0x14, 0x83, 0x75, 0x82,
+    0x75, 0x79, 0xc1, 0x94, 0x75, 0xf4, 0x53, 0x4e, 0x26, 0x0c, 0x62, 0x97, 0x33, 0x52, 0xc4, 0x3c,
+    0x8a, 0x4a, 0x78, 0x52, 0xb3, 0xb9, 0x1a, 0x58, 0x15, 0xe7, 0x81, 0x31, 0x60, 0xf9, 0x3c, 0xd2,
+    0x88, 0xaa, 0x40, 0xf2, 0x37, 0x6b, 0x76, 0x45, 0x89, 0xbc, 0x08, 0xcb, 0x7e, 0xf9, 0x17, 0xd5,
+    0x4e, 0xe8, 0xe8, 0xa0, 0xf1, 0x38, 0x94, 0x23, 0xc9, 0x2c, 0xd2, 0xe7, 0xda, 0x31, 0x1c, 0x48,
+    0x97, 0xe2, 0x0f, 0x7d, 0x1e, 0x95, 0x4a, 0x5b, 0x89, 0xa7, 0x8d, 0x32, 0x55, 0x8d, 0x0e, 0x76,
+    0xb3, 0xb5, 0x81, 0xb8, 0x6e, 0x82, 0xdb, 0x7f, 0x1d, 0xc4, 0x40, 0xc0, 0xa8, 0x0f, 0x3e, 0xae,
+    0x07, 0x12, 0xba, 0x95, 0x6a, 0xa5, 0xe3, 0xa7, 0x33, 0xd8, 0xf3, 0x3a, 0x61, 0x13, 0xd1, 0xbb,
+    0x86, 0xed, 0x18, 0x49, 0x10, 0x8e, 0x47, 0x40, 0x4f, 0x00, 0xec, 0xc7, 0x98, 0x74, 0x1f, 0xf3,
+    0xbf, 0x01, 0x9b, 0xb0, 0xff, 0x31, 0xbb, 0xf0, 0xa6, 0xad, 0x12, 0x54, 0xe9, 0xe9, 0x10, 0x7f,
+    0x57, 0x9a, 0xb0, 0x1a, 0xf4, 0xf5, 0x09, 0x77, 0x11, 0x78, 0xfe, 0xd9, 0x3a, 0x1a, 0x4d, 0xea,
+    0xad, 0x5a, 0x8d, 0xa2, 0xae, 0xa5, 0x9f, 0xc8, 0x0e, 0x57, 0x1b, 0xbd, 0x76, 0x33, 0x7d, 0x0a,
+    0x86, 0xed, 0xb8, 0x42, 0xa3, 0xdf, 0x6b, 0x2b, 0xd0, 0x93, 0x2d, 0x26, 0x6d, 0x54, 0x69, 0xd3,
+    0xbe, 0x10, 0x9f, 0x02, 0xd8, 0x42, 0xb1, 0x22, 0x59, 0x96, 0xae, 0xc3, 0x2a, 0x7c, 0xa7, 0x3b,
+    0x50, 0xc4, 0xaa, 0x31, 0xf5, 0x8a, 0x95, 0x1b, 0x35, 0x99, 0x7b, 0xcd, 0x39, 0x55, 0x42, 0xa4,
+    0xfd, 0x69, 0xd3, 0x3a, 0x7d, 0x81, 0xf7, 0x91, 0xbd, 0x46, 0xa7, 0xa8, 0xc2, 0xc6, 0xf3, 0x47,
+    0x7f, 0xaf, 0x6e, 0x07, 0xaa, 0x6f, 0xe2, 0xdb, 0xf1, 0xde, 0x87, 0xfe, 0x79, 0xbc, 0xdd, 0x83,
+    0xcf, 0x2d, 0x41, 0xa4, 0xc8, 0x2c, 0x54, 0xc6, 0x91, 0xca, 0x97, 0xb5, 0xb0, 0x31, 0x4c, 0x04,
+    0x94, 0x6a, 0x18, 0x59, 0xce, 0x57, 0x65, 0x9c, 0xc0, 0xb9, 0xa0, 0x43, 0xd0, 0x46, 0x6e, 0xad,
+    0x8f, 0xa7, 0x2e, 0x11, 0xbf, 0xbe, 0xc3, 0xbb, 0x73, 0xee, 0x96, 0x0f, 0xad, 0x85, 0x83, 0x93,
+    0x5f, 0xa6, 0x1e, 0x0e, 0x42, 0x13, 0x4e, 0x8e, 0xa1, 0x17, 0xd5, 0x35, 0x4e, 0xd6, 0xba, 0x84,
+    0x3e, 0x09, 0x73, 0x99, 0x0d, 0x2e, 0xa7, 0x33, 0x80, 0xf7, 0x55, 0x6d, 0x52, 0xf8, 0xdc, 0x54,
+    0xcc, 0x3f, 0x6c, 0xd4, 0xd0, 0xb2, 0xb1, 0x41, 0x37, 0xa5, 0x32, 0xd7, 0x9f, 0x7e, 0x76, 0x29,
+    0x8e, 0xb7, 0x40, 0x40, 0x13, 0x90, 0x42, 0x50, 0xca, 0x04, 0xf2, 0xd0, 0xd4, 0xea, 0xea, 0x85,
+    0xbf, 0x88, 0x58, 0x4c, 0xf1, 0x5a, 0xb8, 0x1f, 0xac, 0x66, 0x11, 0x93, 0x77, 0xc6, 0x81, 0x25,
+    0x8c, 0xf6, 0x24, 0xcd, 0x23, 0xc8, 0xfc, 0xc1, 0x1e, 0xe9, 0x18, 0xa0, 0xc1, 0xef, 0xff, 0x91,
+    0x16, 0xd8, 0xee, 0x98, 0xff, 0x7f, 0x87, 0xa4, 0x4e, 0xc5, 0x58, 0x90, 0xaf, 0xa6, 0x1e, 0x2e,
+    0xbf, 0xb5, 0xda, 0x90, 0x2d, 0x92, 0xb7, 0x76, 0xd6, 0xb6, 0xcd, 0xe2, 0xb8, 0xbd, 0xeb, 0xad,
+    0xd4, 0xc2, 0xa1, 0x16, 0xae, 0x1c, 0x6c, 0x9b, 0xaa, 0x9e, 0x66, 0xc5, 0x54, 0xe5, 0x34, 0xdf,
+    0x81, 0xbb, 0x2d, 0x1a, 0x35, 0xd3, 0x84, 0xee, 0x07, 0xa3, 0xf2, 0x8b, 0x32, 0x69, 0xf1, 0x46,
+    0xcf, 0xba, 0x6d, 0xb9, 0x74, 0x9b, 0x2f, 0xe4, 0x88, 0x26, 0x46, 0x5e, 0x98, 0xa9, 0xfb, 0xe2,
+    0x4c, 0xf5, 0x67, 0x40, 0x9b, 0xbe, 0x55, 0x93, 0x32, 0x5d, 0xfd, 0xc7, 0xdc, 0x54, 0xb1, 0xd2,
+    0x04, 0x79, 0x37, 0xd9, 0x4a, 0x63, 0x00, 0x45, 0xaa, 0xef, 0x2a, 0x64, 0xa9, 0xa3, 0x55, 0x04,
+    0xd5, 0x2c, 0x6d, 0xe7, 0x1e, 0xc1, 0xc8, 0x01, 0x44, 0x8d, 0x84, 0x6b, 0x50, 0xba, 0x84, 0xe1,
+    0xfd, 0x2f, 0x88, 0x3d, 0x6c, 0x37, 0xf8, 0x24, 0x71, 0x13, 0xe4, 0xf9, 0xdd, 0x25, 0x8e, 0x53,
+    0x62, 0x4c, 0x14, 0x1b, 0xf1, 0x9b, 0xca, 0x5f, 0x41, 0x12, 0xb2, 0xaf, 0x52, 0xed, 0xc7, 0xfb,
+    0xea, 0xfb, 0x34, 0x53, 0xfe, 0x69, 0x92, 0x51, 0xfd, 0x95, 0xb4, 0x1d, 0x85, 0x23, 0x9f, 0xdc,
+    0x24, 0x1f, 0xe5, 0xcc, 0x4d, 0x85, 0xa1, 0xae, 0xe9, 0x8a, 0x12, 0xea, 0xbe, 0xa4, 0x38, 0x76,
+    0x6b, 0x90, 0xaa, 0xe6, 0x47, 0x81, 0xce, 0x1f, 0x8a, 0x1f, 0x7f, 0x1b, 0x9e, 0x6b, 0x6c, 0x91,
+    0xfa, 0xed, 0x38, 0xae, 0xd8, 0x2b, 0xb5, 0x07, 0xbf, 0xa5, 0x53, 0x35, 0x6e, 0xeb, 0xf7, 0xc9,
+    0x0b, 0xe1, 0x2b, 0xda, 0xda, 0xd7, 0xca, 0x60, 0xbc, 0x8b, 0xdf, 0xf3, 0x0b, 0x1e, 0xe8, 0x1f,
+    0x13, 0x13, 0x15, 0xe2, 0x7c, 0x2f, 0x85, 0x36, 0x30, 0xbd, 0x5f, 0xac, 0x8a, 0x34, 0xb8, 0xe2,
+    0xf3, 0x9c, 0xf3, 0x99, 0xa8, 0x88, 0xd9, 0xf8, 0x59, 0xd9, 0x51, 0xfa, 0xb9, 0x9a, 0x18, 0xcb,
+    0xbe, 0xb6, 0xb7, 0xbe, 0xe1, 0x5f, 0xb5, 0xc1, 0x4a, 0x73, 0x5b, 0x6b, 0x05, 0xca, 0x51, 0xe0,
+    0xdf, 0x71, 0xc4, 0x4e, 0xa0, 0xff, 0x00, 0x27, 0x58, 0x3b, 0xce, 0x6e, 0x65, 0x00, 0x00,
+};
+
+static const uint8_t WEB_INDEX_HTML[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xdd, 0x5b, 0xfd, 0x72, 0xdb, 0xb8,
+    0x11, 0xff, 0x3f, 0x4f, 0x81, 0x63, 0xa6, 0xb1, 0x3c, 0x67, 0xda, 0x24, 0xf5, 0x61, 0x7d, 0x58,
+    0xba, 0xf3, 0x67, 0xce, 0x6d, 0x2e, 0x71, 0xad, 0xc4, 0xd7, 0x9b, 0x4e, 0xe7, 0x06, 0x22, 0x21,
+    0x09, 0x09, 0x45, 0xb0, 0x20, 0xf4, 0xe1, 0xfc, 0xd5, 0x57, 0xe8, 0x4c, 0x5f, 0xa4, 0xcf, 0x70,
+    0x6f, 0xd2, 0x27, 0xe9, 0x2e, 0x48, 0xca, 0x94, 0x4c, 0x51, 0x1f, 0x71, 0x3c, 0x69, 0x15, 0x3b,
+    0x16, 0x49, 0x60, 0xb1, 0xbb, 0xbf, 0xc5, 0xee, 0x02, 0x58, 0x9e, 0x7c, 0x77, 0xf1, 0xee, 0xfc,
+    0xfd, 0xaf, 0x37, 0x97, 0x64, 0xa8, 0x46, 0x7e, 0xe7, 0xc5, 0x09, 0xfe, 0x21, 0x3e, 0x0d, 0x06,
+    0x6d, 0x83, 0x45, 0x06, 0xde, 0x60, 0xd4, 0xeb, 0xbc, 0x20, 0xf0, 0x39, 0x19, 0x31, 0x45, 0x89,
+    0x3b, 0xa4, 0x32, 0x62, 0xaa, 0x6d, 0x7c, 0x78, 0x7f, 0x65, 0xd6, 0x8d, 0xec, 0xa3, 0x80, 0x8e,
+    0x58, 0xdb, 0x98, 0x70, 0x36, 0x0d, 0x85, 0x54, 0x06, 0x71, 0x45, 0xa0, 0x58, 0x00, 0x4d, 0xa7,
+    0xdc, 0x53, 0xc3, 0xb6, 0xc7, 0x26, 0xdc, 0x65, 0xa6, 0xbe, 0x38, 0x20, 0x3c, 0xe0, 0x8a, 0x53,
+    0xdf, 0x8c, 0x5c, 0xea, 0xb3, 0xb6, 0x7d, 0x68, 0xa5, 0xa4, 0x14, 0x57, 0x3e, 0xeb, 0x5c, 0x76,
+    0x6f, 0xca, 0x8e, 0x79, 0x7e, 0xfa, 0x33, 0xb9, 0xa0, 0xd1, 0xb0, 0x27, 0xa8, 0xf4, 0x4e, 0x8e,
+    0xe2, 0x47, 0x71, 0x33, 0x9f, 0x07, 0x9f, 0x88, 0x64, 0x7e, 0xdb, 0x88, 0xd4, 0xbd, 0xcf, 0xa2,
+    0x21, 0x63, 0x30, 0xe4, 0x50, 0xb2, 0x7e, 0xdb, 0x38, 0xa2, 0x61, 0x78, 0xe8, 0x46, 0xd1, 0x0f,
+    0x93, 0x76, 0xb5, 0x6e, 0xf7, 0x6c, 0xea, 0x55, 0xbd, 0xe3, 0xba, 0x8b, 0xe2, 0x1c, 0xc5, 0xf2,
+    0x9c, 0xf4, 0x84, 0x77, 0x9f, 0x50, 0xf2, 0xf8, 0x84, 0xb8, 0x3e, 0x8d, 0xa2, 0xb6, 0x81, 0x1c,
+    0x53, 0x1e, 0x30, 0x99, 0x30, 0xb3, 0xfc, 0x3c, 0xe2, 0x8a, 0x99, 0x48, 0x61, 0xa1, 0xc5, 0x72,
+    0xab, 0xb8, 0x81, 0xa9, 0xb9, 0x35, 0x3a, 0xaf, 0x5e, 0xda, 0x4e, 0xdd, 0xa9, 0x1c, 0xb7, 0x48,
+    0xae, 0x4c, 0xd0, 0x6f, 0x2d, 0x25, 0xd7, 0x17, 0xee, 0x27, 0x83, 0x70, 0x2f, 0xbd, 0x73, 0xae,
+    0x6f, 0xc4, 0xa4, 0xcb, 0xe5, 0x5a, 0x8b, 0x98, 0x66, 0x53, 0xff, 0xc0, 0x97, 0xcd, 0x48, 0xf6,
+    0x84, 0x5a, 0x92, 0x60, 0xde, 0x10, 0x87, 0x81, 0xc7, 0x6f, 0x40, 0xc1, 0x17, 0x3c, 0x0a, 0x7d,
+    0x7a, 0x6f, 0x10, 0xad, 0xe3, 0xb6, 0xe1, 0xc5, 0xd7, 0xcd, 0x40, 0x04, 0xac, 0x45, 0x7d, 0x3e,
+    0x08, 0x4c, 0xd0, 0xc8, 0x28, 0x6a, 0xba, 0x80, 0x33, 0x93, 0xad, 0x01, 0x0d, 0x9b, 0xf5, 0x70,
+    0xd6, 0xca, 0x21, 0xad, 0xc9, 0xd3, 0x2c, 0xf1, 0x14, 0xad, 0x97, 0x06, 0x51, 0x54, 0x0e, 0xd0,
+    0xa6, 0x7e, 0xeb, 0x81, 0xe9, 0xc1, 0x03, 0x8d, 0x6b, 0x20, 0x44, 0xc8, 0x10, 0x8b, 0x94, 0x75,
+    0xe8, 0x67, 0x22, 0xec, 0x2b, 0xa8, 0xe3, 0xe7, 0xd5, 0xcb, 0x46, 0xa3, 0xe1, 0xb4, 0xc8, 0x7b,
+    0xe6, 0xb3, 0x81, 0xa4, 0x23, 0x72, 0x26, 0x54, 0x3e, 0x2b, 0x47, 0x74, 0x05, 0x8f, 0xbd, 0xb1,
+    0x52, 0x22, 0x20, 0x22, 0x70, 0x7d, 0xee, 0x7e, 0x82, 0x69, 0xe0, 0x71, 0x75, 0x16, 0x73, 0x5c,
+    0xda, 0x5f, 0xe0, 0x05, 0x9f, 0x98, 0x3d, 0x15, 0x00, 0xff, 0x08, 0x75, 0xdb, 0x38, 0xa7, 0xa3,
+    0x1e, 0xa7, 0x92, 0x8c, 0xa3, 0x31, 0x95, 0x5c, 0x20, 0x40, 0xc0, 0x4e, 0xbd, 0x75, 0x72, 0x14,
+    0x13, 0xcd, 0x51, 0xf8, 0x63, 0xb0, 0x96, 0x71, 0xb8, 0x0e, 0xc2, 0xb1, 0x3a, 0x95, 0x8c, 0x3e,
+    0x42, 0xa1, 0xef, 0xb3, 0xd9, 0x2e, 0x28, 0x70, 0xa4, 0x48, 0xd4, 0x7d, 0x08, 0xb4, 0x14, 0x9b,
+    0x29, 0x23, 0x1d, 0xea, 0x43, 0xc4, 0x24, 0x4e, 0x62, 0x3d, 0xe4, 0x82, 0xa8, 0x3c, 0xbe, 0x03,
+    0xc3, 0xba, 0x6c, 0x28, 0x7c, 0xb0, 0xa0, 0xb6, 0xf1, 0xe3, 0x38, 0x69, 0xfe, 0x5b, 0xbe, 0x31,
+    0xe5, 0x6a, 0x33, 0xa2, 0x13, 0x96, 0xaf, 0x4d, 0x7c, 0xa2, 0xb5, 0xd9, 0x79, 0x0d, 0xda, 0xf3,
+    0xa8, 0xdc, 0x4a, 0x6b, 0x4b, 0xb7, 0x92, 0xcb, 0xdc, 0x49, 0x3c, 0x90, 0xdc, 0x2b, 0x98, 0xbd,
+    0x2e, 0x0c, 0x9e, 0x37, 0x35, 0x86, 0x4e, 0x3a, 0x95, 0x1b, 0x2d, 0x72, 0xc7, 0x23, 0x70, 0x78,
+    0x2c, 0x80, 0x2f, 0x13, 0x01, 0x4e, 0xc5, 0x59, 0x81, 0x61, 0xea, 0x37, 0x14, 0xe0, 0x37, 0x32,
+    0xf3, 0xdc, 0xcb, 0x22, 0x32, 0xa3, 0x81, 0xc6, 0x22, 0x6e, 0x0f, 0x80, 0x4b, 0x17, 0xbc, 0x99,
+    0x4b, 0x43, 0x35, 0x96, 0xcc, 0x20, 0xd4, 0x87, 0x39, 0xd2, 0x8d, 0x9f, 0x6d, 0x67, 0x4b, 0xa9,
+    0x9e, 0x55, 0x60, 0x0e, 0xa4, 0x18, 0x87, 0x6b, 0xe0, 0x7a, 0x68, 0x4e, 0xb0, 0x4b, 0x28, 0xf9,
+    0x88, 0x4a, 0x70, 0x03, 0x73, 0x18, 0x95, 0x18, 0x0c, 0x7c, 0x16, 0xb3, 0x02, 0x38, 0xae, 0x9e,
+    0x90, 0x27, 0x51, 0x48, 0x83, 0x8c, 0x4c, 0x67, 0x08, 0x30, 0x4c, 0x8b, 0x5a, 0xb5, 0xd2, 0x22,
+    0xd7, 0x01, 0x77, 0x71, 0xbe, 0xc4, 0x74, 0x4e, 0x8e, 0xb0, 0xed, 0x0a, 0xc6, 0x56, 0xda, 0x42,
+    0x01, 0xdb, 0xd1, 0xd8, 0x75, 0x59, 0x14, 0x65, 0xd8, 0x4e, 0x34, 0x79, 0x33, 0x14, 0x4a, 0x20,
+    0xdb, 0x09, 0xa0, 0xf5, 0x16, 0x39, 0xd7, 0x4f, 0x80, 0x97, 0x2b, 0x78, 0xb4, 0xed, 0x68, 0xf1,
+    0x04, 0xea, 0xc3, 0xf5, 0xf0, 0xbd, 0x56, 0x0c, 0x4a, 0xb9, 0xac, 0xac, 0x78, 0x04, 0x76, 0x85,
+    0xad, 0x60, 0xec, 0x95, 0x1a, 0xc3, 0x4f, 0x32, 0xd1, 0x7b, 0xd4, 0xfd, 0x84, 0x70, 0x05, 0x5e,
+    0x53, 0x0e, 0x7a, 0xb4, 0xe4, 0x54, 0xab, 0x07, 0xe9, 0xaf, 0x75, 0x68, 0x1d, 0xef, 0xb7, 0x7a,
+    0x42, 0xc2, 0x5c, 0x6c, 0xda, 0xe1, 0x8c, 0x44, 0xc2, 0xe7, 0x1e, 0x79, 0x68, 0xe7, 0x58, 0x07,
+    0xf0, 0xef, 0xb0, 0xbc, 0xdf, 0x72, 0x85, 0x2f, 0x64, 0xf3, 0x65, 0xbd, 0x5e, 0x6f, 0x8d, 0x78,
+    0x10, 0x07, 0xe0, 0x26, 0x1d, 0x2b, 0xd1, 0x0a, 0xa9, 0xe7, 0xf1, 0x60, 0xd0, 0xb4, 0x1d, 0x20,
+    0x60, 0xd7, 0xd0, 0x67, 0x14, 0xf2, 0x95, 0xf8, 0xb9, 0x53, 0x57, 0xf1, 0x09, 0x95, 0x47, 0x1e,
+    0x8b, 0x68, 0xfc, 0x95, 0x68, 0xe1, 0x49, 0x48, 0x25, 0x85, 0xec, 0x81, 0xc4, 0x7a, 0xa6, 0x1a,
+    0xe9, 0x7a, 0x1d, 0xe6, 0x4b, 0x97, 0x07, 0x44, 0x4b, 0xbe, 0xa3, 0x6a, 0x69, 0xb0, 0x5a, 0xb1,
+    0x57, 0x34, 0xf8, 0xca, 0xfa, 0xb4, 0x0e, 0x1c, 0xcb, 0x4a, 0x5a, 0x3d, 0x93, 0x3e, 0x27, 0xe0,
+    0xca, 0xb9, 0x4f, 0x3d, 0x21, 0x49, 0xe9, 0xf5, 0xcd, 0xf5, 0x3b, 0x62, 0x3b, 0xa9, 0xbd, 0xda,
+    0x35, 0xb0, 0x57, 0x10, 0x9a, 0xbc, 0xbb, 0xba, 0xda, 0xc5, 0x47, 0xee, 0xe6, 0xf9, 0x00, 0x47,
+    0xbb, 0x45, 0x4e, 0x3f, 0x8e, 0x23, 0xc5, 0x22, 0xe2, 0x31, 0x72, 0x3d, 0xa2, 0x03, 0x16, 0xc4,
+    0xbe, 0xaf, 0xd0, 0xe9, 0xa0, 0xd7, 0x93, 0xc2, 0x2f, 0x76, 0x3c, 0x3e, 0xed, 0x31, 0x1f, 0x87,
+    0x39, 0x76, 0x40, 0xba, 0x33, 0xc9, 0x7d, 0x1f, 0xa6, 0x61, 0x7c, 0x37, 0xbf, 0x47, 0xd6, 0xbd,
+    0x02, 0x52, 0x98, 0x26, 0xad, 0x71, 0xaf, 0x8f, 0x82, 0x9f, 0x84, 0x3c, 0x97, 0x25, 0xd1, 0x4f,
+    0xf2, 0xc1, 0x50, 0x05, 0xda, 0x5d, 0x00, 0xa8, 0x6d, 0xc3, 0x74, 0xe0, 0x0b, 0x9d, 0xb5, 0x0d,
+    0xf8, 0x3b, 0xa1, 0xfe, 0x18, 0x9a, 0x5b, 0xda, 0xf4, 0x86, 0xd8, 0xa9, 0x6d, 0x8c, 0x43, 0x8f,
+    0x2a, 0xd6, 0x65, 0x4a, 0x01, 0xe0, 0xa5, 0xbd, 0x87, 0xfe, 0x7b, 0x07, 0x44, 0x0d, 0x79, 0x74,
+    0xa8, 0x3b, 0xad, 0x77, 0x8d, 0x8b, 0x22, 0xe8, 0x4e, 0xcb, 0x1c, 0xdd, 0x51, 0xdf, 0xe8, 0x58,
+    0xc5, 0xee, 0x31, 0xdf, 0xf5, 0xe7, 0x00, 0xfe, 0x45, 0xe8, 0xd8, 0xce, 0xf1, 0x71, 0xad, 0x0c,
+    0xde, 0x12, 0x3b, 0x51, 0xb0, 0x84, 0xe7, 0x84, 0xc8, 0x4d, 0x06, 0xdd, 0x0d, 0xa0, 0xb4, 0xf7,
+    0x53, 0xc1, 0x93, 0xd2, 0xfb, 0x96, 0xc0, 0x01, 0xd7, 0x00, 0xcb, 0x8c, 0x2e, 0x45, 0xdf, 0xeb,
+    0x72, 0x11, 0x3c, 0x27, 0x3a, 0x91, 0x1e, 0x55, 0xc1, 0xa8, 0xbb, 0xe1, 0xf3, 0xd0, 0xff, 0xa9,
+    0x10, 0x7a, 0xa0, 0xf8, 0x4d, 0x61, 0xa4, 0x97, 0x82, 0xe7, 0x90, 0xb6, 0x7b, 0xd4, 0x23, 0x7f,
+    0xbc, 0xb9, 0x7c, 0x4d, 0x4a, 0x23, 0x16, 0x80, 0x9f, 0x6f, 0x93, 0x11, 0xfb, 0x28, 0xe4, 0xfe,
+    0x73, 0xa2, 0xf6, 0xf7, 0x31, 0x30, 0xa2, 0xee, 0x13, 0xc8, 0x6c, 0x2b, 0x81, 0xac, 0x56, 0x9e,
+    0x63, 0x66, 0x3b, 0x05, 0xa0, 0x25, 0xdd, 0x9f, 0x0a, 0xb1, 0x84, 0x9c, 0x86, 0xcb, 0x76, 0xbe,
+    0x15, 0xbc, 0x2c, 0x08, 0x48, 0xb7, 0x0c, 0xd2, 0x81, 0xf1, 0xfa, 0x39, 0x15, 0xc1, 0xba, 0xd3,
+    0x55, 0x71, 0xce, 0x02, 0xcb, 0x4f, 0xd6, 0xe5, 0x9f, 0x59, 0x81, 0xfe, 0xe6, 0x6d, 0x40, 0x83,
+    0x21, 0xee, 0xab, 0x5c, 0x07, 0xaa, 0x94, 0x51, 0x65, 0xa1, 0x2e, 0x45, 0x88, 0xb6, 0xfd, 0x30,
+    0xb7, 0x3a, 0x8d, 0xda, 0xac, 0x51, 0x3b, 0x39, 0x8a, 0xef, 0x6f, 0xdc, 0xd1, 0x06, 0x5d, 0xd7,
+    0xac, 0x99, 0xed, 0x58, 0x5b, 0x77, 0x75, 0xa0, 0xeb, 0x71, 0x6d, 0x66, 0x57, 0x2a, 0x5b, 0x77,
+    0x2d, 0x1b, 0x1d, 0xa7, 0x02, 0xa3, 0x1e, 0x6f, 0xcf, 0x70, 0x25, 0xee, 0x0a, 0xbf, 0x5b, 0x77,
+    0xad, 0x1a, 0x9d, 0xb2, 0xa3, 0xbb, 0x92, 0xd2, 0x9f, 0xef, 0x5e, 0x9f, 0xee, 0x6f, 0x4d, 0xa1,
+    0x66, 0x74, 0x2a, 0x16, 0x50, 0xd8, 0x41, 0xd1, 0xc7, 0xd0, 0xb5, 0x6e, 0xcd, 0xca, 0x3b, 0x28,
+    0xba, 0x0e, 0x4b, 0x41, 0x6d, 0x59, 0xcc, 0xeb, 0xd4, 0x40, 0x76, 0xa0, 0x43, 0x4a, 0x3b, 0xf1,
+    0xdf, 0x30, 0x3a, 0x75, 0xe0, 0xbf, 0x66, 0x01, 0x81, 0xee, 0x4e, 0x14, 0xc0, 0x49, 0x74, 0x6c,
+    0xcb, 0xa9, 0xcc, 0x8e, 0x6b, 0x75, 0x52, 0xfa, 0xcb, 0x4e, 0x24, 0xd0, 0xe6, 0x1c, 0xd0, 0xc5,
+    0xb1, 0x03, 0x6c, 0xfc, 0x74, 0xb1, 0x03, 0x05, 0x27, 0xa1, 0x80, 0x9c, 0x80, 0x24, 0xbb, 0xb1,
+    0x51, 0xd6, 0xa6, 0xaf, 0x6d, 0x1f, 0xf8, 0xf8, 0xb0, 0x9e, 0x08, 0xb8, 0x24, 0x0d, 0xc3, 0xf3,
+    0xa4, 0x5a, 0x0d, 0xcb, 0x81, 0x44, 0xff, 0xa6, 0x0b, 0xd9, 0xb6, 0x3f, 0x5f, 0x23, 0x3f, 0x63,
+    0x44, 0xd7, 0x23, 0x5e, 0x85, 0x69, 0x46, 0x6c, 0x27, 0xc1, 0xa1, 0x6c, 0xcd, 0x83, 0x83, 0x53,
+    0x18, 0xd1, 0xd3, 0xfe, 0xbb, 0x38, 0xb7, 0x35, 0xa1, 0x3d, 0x25, 0xad, 0x43, 0x85, 0xf3, 0x05,
+    0xa1, 0xfd, 0xc9, 0xd6, 0x47, 0x88, 0x97, 0x0d, 0x78, 0x5d, 0xf6, 0xc1, 0x3e, 0x44, 0x44, 0xee,
+    0xc9, 0x19, 0xf5, 0x69, 0xe0, 0xb2, 0xa7, 0x5e, 0x21, 0xd9, 0x16, 0x98, 0x7c, 0x3a, 0x0e, 0xb9,
+    0x8c, 0x42, 0xe6, 0x72, 0xea, 0x6f, 0x1c, 0x96, 0x92, 0xf6, 0x97, 0x7d, 0xec, 0x5f, 0x84, 0x5e,
+    0xb6, 0xdd, 0x93, 0x84, 0x27, 0xdc, 0x03, 0x88, 0xb9, 0xde, 0x25, 0x46, 0xbd, 0x65, 0x03, 0xc8,
+    0xe5, 0x26, 0x62, 0x97, 0x20, 0x75, 0x89, 0x87, 0x0c, 0x14, 0x17, 0xad, 0xaf, 0x25, 0x8f, 0x58,
+    0xb4, 0x4b, 0xb4, 0x7a, 0x2f, 0x02, 0x41, 0x6e, 0xc5, 0x47, 0xb1, 0x4b, 0xbc, 0xd2, 0x9d, 0xef,
+    0x98, 0xf4, 0xd8, 0x2e, 0x21, 0x4b, 0xf7, 0x3e, 0xfd, 0x3c, 0xf6, 0x77, 0x89, 0x56, 0x5d, 0x16,
+    0x72, 0xfa, 0x2d, 0x79, 0x35, 0xf8, 0xb4, 0xd2, 0xb9, 0x81, 0x90, 0x9c, 0xe1, 0x37, 0x11, 0x6d,
+    0x6c, 0xc0, 0xd3, 0x21, 0x57, 0x2c, 0xe9, 0x5f, 0x60, 0xbf, 0xd9, 0x66, 0x4f, 0x62, 0xbe, 0xa7,
+    0x63, 0x25, 0x46, 0x60, 0x82, 0xee, 0x4e, 0xe6, 0xdb, 0x15, 0x3e, 0xa3, 0xde, 0x4e, 0xd6, 0xfb,
+    0x76, 0xdc, 0xf3, 0x77, 0xe9, 0x0a, 0x46, 0xfb, 0xae, 0xcf, 0x5d, 0x1e, 0xd0, 0x5d, 0x4c, 0xf6,
+    0x27, 0x31, 0xc0, 0x2d, 0xf8, 0xaf, 0x67, 0x37, 0xd1, 0x94, 0x2b, 0x77, 0xb8, 0x7e, 0x4f, 0x7c,
+    0xbe, 0x33, 0xa4, 0x37, 0x12, 0xf5, 0x26, 0x22, 0x79, 0x73, 0x79, 0x51, 0x6c, 0x2f, 0xfa, 0xd9,
+    0xe2, 0x48, 0x9b, 0x46, 0x40, 0x77, 0xc8, 0xdc, 0x4f, 0x3d, 0x31, 0xcb, 0x6c, 0xea, 0x16, 0x65,
+    0xf0, 0xf8, 0x3c, 0x5d, 0xff, 0xe8, 0xae, 0xcc, 0xdb, 0x36, 0xb0, 0xc5, 0xdb, 0x98, 0x46, 0xa7,
+    0x38, 0x8a, 0xad, 0x10, 0xf7, 0x6b, 0xa8, 0x1a, 0x67, 0x29, 0x9e, 0x72, 0x5c, 0xce, 0x42, 0x11,
+    0x71, 0x5c, 0xf5, 0x90, 0xb9, 0xf5, 0xd3, 0x67, 0x52, 0x3c, 0xc3, 0xb1, 0xc7, 0x92, 0x9d, 0x2b,
+    0xe9, 0x1b, 0x24, 0xd1, 0xec, 0x6a, 0x1c, 0xb2, 0xcd, 0xff, 0xff, 0xe0, 0xa8, 0x3b, 0x35, 0x48,
+    0x2d, 0x5e, 0xd3, 0x00, 0xbc, 0x19, 0xa7, 0xcf, 0x0f, 0xc6, 0x00, 0xf8, 0xdc, 0x10, 0x88, 0xb4,
+    0xe9, 0xb7, 0x0e, 0xc2, 0xc3, 0x51, 0x58, 0x7a, 0x3a, 0x30, 0xa2, 0x72, 0xc0, 0x03, 0x18, 0x39,
+    0x6c, 0x12, 0xc7, 0x2a, 0x38, 0x3f, 0xcd, 0x3f, 0x6d, 0x9a, 0x52, 0x19, 0x80, 0x06, 0x8c, 0xc5,
+    0xb3, 0xce, 0x44, 0x2f, 0xd1, 0xfc, 0xb4, 0xc9, 0x6e, 0x58, 0x80, 0x64, 0x7c, 0xc2, 0x89, 0xfb,
+    0xa8, 0x7d, 0x3e, 0x98, 0xef, 0xd6, 0x3d, 0xd7, 0x5e, 0xbe, 0xde, 0xd5, 0xc0, 0x5c, 0x35, 0x52,
+    0x10, 0x58, 0xe2, 0xe5, 0x05, 0x8f, 0x14, 0x1b, 0xd1, 0x4d, 0x8e, 0x32, 0xa9, 0x1a, 0x47, 0x66,
+    0x8f, 0xae, 0x34, 0xdb, 0xc7, 0x8d, 0xf1, 0x74, 0xba, 0x08, 0xff, 0x4c, 0x8f, 0x4c, 0x92, 0x3f,
+    0x64, 0x34, 0xbc, 0xd3, 0x97, 0x9d, 0xdc, 0xaa, 0x86, 0x55, 0x24, 0xb4, 0x51, 0xa4, 0x67, 0x7b,
+    0xb8, 0x21, 0xfa, 0x13, 0x10, 0x22, 0x6f, 0x78, 0x4f, 0x32, 0x52, 0xfa, 0xd3, 0xd9, 0x7e, 0x01,
+    0xa9, 0xa2, 0x47, 0x4f, 0x25, 0x56, 0x18, 0x49, 0x3a, 0xfa, 0x52, 0xb9, 0xb4, 0x15, 0xdd, 0x74,
+    0x6f, 0x4f, 0x7f, 0xfe, 0x76, 0x04, 0x8b, 0xbc, 0x2f, 0x97, 0xca, 0x6e, 0x91, 0xee, 0x05, 0x39,
+    0xcf, 0xaf, 0x8c, 0x59, 0xc9, 0xb5, 0x87, 0xe6, 0x98, 0xf1, 0xa7, 0x09, 0x3b, 0x67, 0x54, 0x9e,
+    0x3f, 0xdc, 0xcb, 0x2b, 0x61, 0x29, 0x10, 0x72, 0xc5, 0x20, 0x7d, 0xee, 0xfb, 0x19, 0xfa, 0x57,
+    0x78, 0xd9, 0x59, 0xc7, 0xeb, 0xd6, 0xb8, 0x6c, 0x75, 0x94, 0xff, 0x44, 0xfe, 0xeb, 0xf1, 0x21,
+    0xbf, 0x2f, 0xa8, 0xd7, 0xd5, 0x16, 0xf1, 0x70, 0x56, 0x5e, 0x03, 0xbb, 0x3b, 0x75, 0x15, 0x6e,
+    0xd4, 0x7e, 0x06, 0x07, 0x16, 0x7b, 0x90, 0xa7, 0xf7, 0x5c, 0xa9, 0x4c, 0x58, 0xab, 0x01, 0xc0,
+    0xfa, 0xe3, 0x51, 0xd0, 0x24, 0x36, 0x39, 0x22, 0xa6, 0xdd, 0x2a, 0x2e, 0xce, 0x38, 0xc6, 0x38,
+    0xe9, 0x33, 0xc9, 0xf5, 0x7a, 0x0f, 0x4f, 0xf3, 0xa3, 0x02, 0xa7, 0xa6, 0x53, 0x3c, 0x5d, 0xcf,
+    0xf2, 0x9e, 0xf6, 0xa2, 0xfc, 0x0a, 0x9b, 0xb4, 0x9c, 0x06, 0x2f, 0xcc, 0xa9, 0x84, 0x2b, 0xfc,
+    0xaf, 0x95, 0xa8, 0xbb, 0x27, 0x40, 0xf2, 0x51, 0xd3, 0xae, 0x16, 0x28, 0x3c, 0x4c, 0xe9, 0x66,
+    0x4e, 0x8e, 0xfb, 0x60, 0x99, 0x66, 0xc4, 0x3f, 0xb3, 0xa6, 0x75, 0x58, 0xaf, 0xb2, 0x11, 0x74,
+    0x06, 0xb3, 0x1f, 0xd0, 0x00, 0x1c, 0x32, 0xa8, 0x20, 0x64, 0x8a, 0x46, 0x87, 0x87, 0x87, 0x27,
+    0x47, 0xe1, 0xf6, 0x55, 0x43, 0x21, 0xd6, 0x37, 0xdc, 0x71, 0x36, 0xcd, 0x14, 0x4f, 0xe9, 0x7b,
+    0xe6, 0x24, 0xbe, 0xb9, 0xa6, 0xfc, 0x24, 0x6e, 0x75, 0x3d, 0x1a, 0x24, 0x15, 0x28, 0x49, 0xe5,
+    0x49, 0x5c, 0xf4, 0x12, 0x4a, 0x36, 0xe1, 0x74, 0x03, 0xe7, 0x1f, 0x53, 0x29, 0x88, 0x14, 0x39,
+    0xc6, 0x98, 0xf4, 0x09, 0xe8, 0x24, 0x71, 0x96, 0x30, 0xd8, 0xe2, 0x99, 0x3f, 0xde, 0xc9, 0xd4,
+    0x6f, 0x34, 0x6a, 0xb5, 0x0a, 0x58, 0x24, 0xd6, 0x3d, 0x71, 0x21, 0x8b, 0xab, 0x0b, 0x56, 0x30,
+    0xc8, 0x83, 0xbe, 0x58, 0xe7, 0x08, 0xb2, 0x19, 0x0a, 0x96, 0x3c, 0x19, 0x19, 0x3d, 0xbd, 0xc5,
+    0xeb, 0xc2, 0x44, 0xe5, 0x71, 0x31, 0x4c, 0xdc, 0xf3, 0x96, 0x4e, 0x8d, 0x25, 0xd3, 0xa8, 0x56,
+    0xab, 0x0b, 0xa6, 0x71, 0xac, 0x2d, 0x63, 0x73, 0xe2, 0xf3, 0x45, 0xf9, 0x18, 0x55, 0x92, 0x65,
+    0xf3, 0x3c, 0xb9, 0xb5, 0x96, 0xd8, 0x3a, 0x6f, 0x56, 0x8c, 0x58, 0xc0, 0x66, 0x6a, 0x11, 0x31,
+    0xbc, 0x33, 0x47, 0xac, 0x0b, 0xe9, 0x0e, 0xc7, 0x32, 0x35, 0x92, 0x14, 0x01, 0xad, 0x29, 0x08,
+    0xd9, 0x2c, 0x6e, 0x65, 0x4c, 0x6d, 0x5e, 0xeb, 0xa1, 0x2b, 0x39, 0xb4, 0x37, 0xd4, 0xae, 0x1e,
+    0x0b, 0x17, 0x78, 0xff, 0xde, 0x4c, 0x8a, 0x52, 0x97, 0x6b, 0xe5, 0x92, 0xca, 0x0d, 0xdd, 0xde,
+    0x6a, 0x6d, 0x60, 0xb0, 0x73, 0xf1, 0x3c, 0x31, 0x0d, 0xd0, 0x53, 0xc6, 0x22, 0xea, 0x69, 0xf6,
+    0x06, 0x26, 0xca, 0x5f, 0xdd, 0xb1, 0x94, 0x30, 0x86, 0xbe, 0x7d, 0x1d, 0x78, 0x6c, 0xf6, 0xb7,
+    0x43, 0xb4, 0x9c, 0xfd, 0x39, 0x87, 0x69, 0xb1, 0x48, 0x0d, 0x6b, 0x45, 0x2a, 0xc0, 0x43, 0xa6,
+    0x3c, 0xc5, 0x87, 0x98, 0x05, 0xd1, 0x66, 0x20, 0xa9, 0x87, 0xda, 0x2a, 0xd9, 0xe5, 0xaa, 0xc7,
+    0x06, 0x07, 0x2f, 0x99, 0xd5, 0xef, 0x5b, 0xd6, 0xc1, 0x4b, 0x4a, 0x5d, 0xd7, 0xb2, 0xe6, 0xa5,
+    0x28, 0x96, 0x65, 0xa5, 0xa5, 0x2b, 0x5a, 0xd8, 0x44, 0x78, 0xec, 0x3d, 0x8e, 0x70, 0x80, 0x16,
+    0x70, 0x13, 0x41, 0xcb, 0x50, 0x70, 0x2d, 0xf6, 0x82, 0xf7, 0x01, 0x13, 0xd3, 0xd7, 0x53, 0x86,
+    0x15, 0x07, 0xcd, 0x9a, 0x85, 0x0a, 0x88, 0xdd, 0xa9, 0x03, 0xab, 0xc0, 0x0b, 0x16, 0xb9, 0xe8,
+    0x99, 0x36, 0x99, 0x5d, 0xcb, 0xca, 0x99, 0x72, 0xf0, 0x67, 0xd3, 0x43, 0x2c, 0xe4, 0x2c, 0xed,
+    0x1d, 0x69, 0xe5, 0xfc, 0x10, 0xfb, 0xdb, 0xf6, 0xde, 0xf7, 0x2c, 0x70, 0x85, 0xc7, 0x3e, 0xdc,
+    0x5e, 0x9f, 0x8b, 0x51, 0x08, 0x6c, 0x83, 0x9c, 0x89, 0xd2, 0xae, 0x74, 0x93, 0xfd, 0xef, 0xf7,
+    0x5e, 0xe9, 0x9a, 0xe2, 0xdc, 0xa6, 0xeb, 0x35, 0x7d, 0xb0, 0x17, 0xd7, 0x93, 0xee, 0x7d, 0x99,
+    0xce, 0x2d, 0xab, 0x0f, 0x5a, 0xc7, 0xbf, 0x8d, 0x06, 0xa5, 0x5f, 0x53, 0xe7, 0xa7, 0x3d, 0xc9,
+    0x25, 0x56, 0x15, 0xde, 0x30, 0xf0, 0xb4, 0xb8, 0x6f, 0xb3, 0xa9, 0xc2, 0x17, 0xe7, 0x81, 0xeb,
+    0x8b, 0x88, 0x65, 0xcb, 0xde, 0xf0, 0x3a, 0x8e, 0x07, 0x38, 0x07, 0xcf, 0x99, 0x94, 0xeb, 0xd0,
+    0xdc, 0x21, 0x31, 0x99, 0x47, 0x1e, 0x88, 0xbf, 0x10, 0x80, 0xef, 0x33, 0x89, 0xc9, 0xcc, 0x1c,
+    0xc6, 0x72, 0x92, 0x72, 0x15, 0x33, 0x13, 0x22, 0x26, 0x4c, 0xf6, 0x7d, 0x31, 0x35, 0xef, 0x9b,
+    0x44, 0x57, 0x4e, 0x91, 0x74, 0x02, 0xca, 0xb8, 0xdd, 0x16, 0xe1, 0x94, 0xe8, 0x78, 0x4a, 0xb0,
+    0x92, 0xd5, 0xd4, 0xd5, 0xb0, 0x4d, 0x92, 0x4c, 0xee, 0x87, 0x90, 0xba, 0x4b, 0x24, 0xdd, 0x28,
+    0xd1, 0x2a, 0x8c, 0xfb, 0x9b, 0x96, 0x25, 0xce, 0xdd, 0xc7, 0xea, 0x44, 0x0b, 0x0d, 0x9d, 0x7e,
+    0x79, 0x9e, 0xf5, 0x9d, 0x69, 0x92, 0xff, 0xfc, 0xeb, 0x1f, 0xf0, 0xa3, 0x93, 0xec, 0x26, 0xb9,
+    0x65, 0x1e, 0x8b, 0xc8, 0x2f, 0xfc, 0x8a, 0x27, 0xf7, 0x9f, 0xff, 0x87, 0x98, 0x66, 0xe7, 0xa9,
+    0xb3, 0xc1, 0x4d, 0x4b, 0xa5, 0x97, 0xa3, 0x02, 0x44, 0x46, 0x97, 0x99, 0x3d, 0xa6, 0xa6, 0x8c,
+    0x05, 0xcb, 0x19, 0x1f, 0xc6, 0x0a, 0xbb, 0x20, 0xb1, 0x4e, 0x32, 0xd0, 0x5a, 0x2b, 0xa3, 0xd5,
+    0x17, 0xc5, 0x79, 0xc0, 0x94, 0xf7, 0x79, 0x9c, 0x62, 0x9f, 0x51, 0x0f, 0x0f, 0xde, 0x12, 0xbe,
+    0x17, 0x52, 0x00, 0xcc, 0x0e, 0x53, 0xc7, 0x55, 0x41, 0xc7, 0xe5, 0xa0, 0xe3, 0x5a, 0x70, 0x37,
+    0x3a, 0xdf, 0x5f, 0x76, 0x28, 0x3e, 0x53, 0x20, 0xa3, 0x89, 0x32, 0xe9, 0xa2, 0xc4, 0x45, 0x77,
+    0x37, 0xaf, 0x80, 0x8c, 0xeb, 0x44, 0xed, 0x6a, 0x51, 0x35, 0xe9, 0x72, 0x2d, 0x69, 0xbf, 0x5f,
+    0xc5, 0x4c, 0xc5, 0xe8, 0xdc, 0x41, 0xde, 0xd5, 0xe7, 0xee, 0x7c, 0x8e, 0xe5, 0xa7, 0x16, 0xab,
+    0xce, 0xc0, 0xd0, 0x1c, 0xb5, 0x65, 0x63, 0xae, 0x2e, 0xb5, 0xd2, 0x06, 0x7a, 0x6b, 0xc4, 0xa3,
+    0xd1, 0x23, 0xb3, 0x58, 0x70, 0x34, 0xa8, 0xb8, 0xb7, 0x00, 0x93, 0x90, 0x9f, 0x90, 0xc0, 0xf2,
+    0xdc, 0x4c, 0xb2, 0xf2, 0xc2, 0x65, 0x50, 0x5e, 0x56, 0x9e, 0x71, 0x22, 0x8f, 0x7c, 0x48, 0xcc,
+    0xe0, 0x1a, 0x4f, 0x92, 0x2f, 0xe3, 0x95, 0x90, 0xa3, 0xb1, 0x8f, 0xef, 0x04, 0xc4, 0x25, 0xb2,
+    0xf4, 0xf7, 0x7f, 0x03, 0x6e, 0x12, 0x29, 0xae, 0x16, 0x73, 0x45, 0xd1, 0xaa, 0x95, 0x2d, 0x59,
+    0x2d, 0x17, 0x94, 0xac, 0xce, 0x5b, 0xd9, 0xfb, 0x4b, 0xd6, 0xa2, 0x8d, 0x78, 0x5e, 0xab, 0xba,
+    0xcd, 0xca, 0x25, 0xce, 0x3f, 0x16, 0x42, 0x59, 0x23, 0x27, 0x94, 0x2d, 0xad, 0x8d, 0xd0, 0x5e,
+    0x73, 0x8c, 0x11, 0x5d, 0x5d, 0xa5, 0x0c, 0x6e, 0xee, 0xf7, 0x7f, 0x9e, 0x5e, 0x5c, 0xdf, 0x92,
+    0x5b, 0xdc, 0xd5, 0x0f, 0x0b, 0xb2, 0xbd, 0x55, 0xab, 0x33, 0x2d, 0xcf, 0xd2, 0x64, 0xcd, 0x99,
+    0xec, 0xeb, 0xf7, 0x3e, 0xe3, 0x04, 0x76, 0xda, 0x8d, 0x38, 0x38, 0x9d, 0xec, 0x0b, 0x12, 0x0b,
+    0x2f, 0x3e, 0xbc, 0x15, 0x23, 0xdc, 0x72, 0x89, 0x4d, 0x96, 0x94, 0xba, 0xdd, 0xeb, 0x8b, 0x7d,
+    0x7d, 0x36, 0xee, 0xb3, 0x60, 0xa0, 0x86, 0x6d, 0xa3, 0xec, 0x14, 0x97, 0xfd, 0x3e, 0x54, 0x24,
+    0x23, 0xd3, 0x4d, 0x3b, 0x53, 0x46, 0x6c, 0x57, 0xb2, 0xd8, 0x34, 0xe6, 0xb3, 0x7d, 0xc9, 0x08,
+    0x6c, 0xeb, 0x00, 0x7e, 0xca, 0x38, 0x29, 0xeb, 0x9b, 0x98, 0x40, 0x79, 0xd9, 0x04, 0x30, 0xe7,
+    0x9d, 0x63, 0x8a, 0xff, 0x1e, 0x61, 0x2a, 0xc6, 0x0a, 0x33, 0xa2, 0xb5, 0x1b, 0x25, 0x59, 0x64,
+    0xf0, 0xb8, 0x00, 0xcf, 0x8b, 0x9a, 0x92, 0xf9, 0x78, 0x5a, 0xcb, 0x5a, 0x2b, 0x04, 0x5c, 0xb7,
+    0xde, 0x5a, 0x80, 0xe3, 0x86, 0x62, 0xb4, 0x8c, 0xe1, 0x08, 0xe1, 0x3b, 0x4c, 0x7a, 0x6f, 0x09,
+    0x92, 0xa4, 0x20, 0x95, 0xc1, 0xbc, 0x5a, 0x40, 0xa2, 0x56, 0x5e, 0x8b, 0x44, 0x06, 0x8d, 0x84,
+    0x43, 0xcb, 0xfa, 0xc3, 0x02, 0x02, 0x65, 0xcc, 0x16, 0xff, 0x17, 0xa0, 0xc8, 0x4d, 0xc1, 0xe3,
+    0x9d, 0x74, 0xd4, 0x61, 0x69, 0x2f, 0x51, 0x66, 0xb2, 0x37, 0xbf, 0x3f, 0x7f, 0x71, 0xe9, 0x67,
+    0x11, 0x81, 0xfa, 0xe4, 0x91, 0x70, 0xc7, 0xbe, 0x82, 0x45, 0xd4, 0x26, 0x3a, 0x7b, 0x84, 0x39,
+    0xed, 0x61, 0x8d, 0x9c, 0x62, 0xad, 0x38, 0x85, 0xc3, 0x0c, 0x18, 0x53, 0xa4, 0x2a, 0x68, 0x13,
+    0x88, 0x07, 0x51, 0x1f, 0x9c, 0x60, 0x53, 0x7f, 0x03, 0xdb, 0x60, 0xbf, 0x96, 0x4c, 0x78, 0xb2,
+    0x9f, 0x55, 0x67, 0x26, 0x8d, 0x8e, 0xbf, 0x67, 0xd6, 0xc4, 0x2b, 0x73, 0x69, 0x3b, 0x13, 0x1c,
+    0xb1, 0xea, 0xbe, 0x92, 0x38, 0x16, 0xac, 0x0e, 0xaa, 0x55, 0x5b, 0x1b, 0xa4, 0xd0, 0x5b, 0x2d,
+    0x77, 0x57, 0x27, 0x71, 0xc0, 0xc3, 0x2f, 0x0f, 0x41, 0xa9, 0xf4, 0xb0, 0xe6, 0xd0, 0x53, 0x40,
+    0xcb, 0x93, 0x99, 0x05, 0x49, 0x64, 0xc2, 0x17, 0xc4, 0xf0, 0x58, 0x33, 0x3d, 0x10, 0x80, 0xc4,
+    0xe1, 0xa9, 0xf2, 0xf2, 0xfc, 0x37, 0xa2, 0x96, 0x43, 0xd5, 0x3c, 0xa0, 0x2a, 0xa1, 0x4b, 0xab,
+    0x13, 0x31, 0xe3, 0xab, 0xce, 0x42, 0xcb, 0xc8, 0x95, 0x3c, 0x54, 0xc9, 0x3b, 0x49, 0xf8, 0x86,
+    0xe5, 0x47, 0x7c, 0xc1, 0xd2, 0xae, 0x95, 0xed, 0x9a, 0x4b, 0xab, 0x76, 0xaf, 0x57, 0xd3, 0x7b,
+    0x0b, 0xba, 0x15, 0xbe, 0x69, 0x19, 0xbf, 0x62, 0x09, 0xa1, 0x5f, 0xbf, 0x59, 0xfa, 0x5f, 0x22,
+    0x9f, 0x41, 0x32, 0x6a, 0x3a, 0x00, 0x00,
+};
+
+static const WebAsset WEB_ASSETS[] = {
+    { "/app.css", "text/css", WEB_APP_CSS, 2341, "\"581b1ad5d78c\"", true },
+    { "/app.js", "application/javascript", WEB_APP_JS, 5855, "\"16316ca51bb6\"", true },
+    { "/", "text/html", WEB_INDEX_HTML, 3255, "\"5a51bf4ec404\"", false },
+};
+
+static const size_t WEB_ASSET_COUNT = sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]);
+
+#endif // WEB_ASSETS_H
@@ -0,0 +1,73 @@
+#include "web_response.h"
+
+void buildCacheValidators(size_t size, time_t modified, CacheValidators& out) {
+    snprintf(out.etag, sizeof(out.etag), "\"%x-%lx\"", (unsigned)size, (unsigned long)modified);
+    struct tm gmt;
+    gmtime_r(&modified, &gmt);
+    strftime(out.lastModified, sizeof(out.lastModified), "%a, %d %b %Y %H:%M:%S GMT", &gmt);
+}
+
+bool isNotModified(const CacheValidators& validators, const String* ifNoneMatch, const String* ifModifiedSince) {
+    if (ifNoneMatch) return *ifNoneMatch == validators.etag;
+    return ifModifiedSince && *ifModifiedSince == validators.lastModified;
+}
+
+RangeResult parseRange(const String& header, size_t size, size_t& start, size_t& end) {
+    start = 0;
+    end = size > 0 ? size - 1 : 0;
+
+    int dash = header.indexOf('-');
+    if (!header.startsWith("bytes=") || dash <= 0 || header.indexOf(',') >= 0) {
+        return RANGE_FULL;
+    }
+    if (size == 0) return RANGE_INVALID;
+
+    String first = header.substring(6, dash);
+    String last = header.substring(dash + 1);
+    first.trim();
+    last.trim();
+
+    if (first.isEmpty()) {
+        long suffix = last.toInt();
+        if (suffix <= 0) return RANGE_INVALID;
+        start = ((size_t)suffix >= size) ? 0 : size - suffix;
+        return RANGE_PARTIAL;
+    }
+
+    long from = first.toInt();
+    if (from < 0 || (size_t)from >= size) return RANGE_INVALID;
+    start = from;
+    if (!last.isEmpty()) {
+        long to = last.toInt();
+        if (to < from) return RANGE_INVALID;
+        end = min((size_t)to, size - 1);
+    }
+    return RANGE_PARTIAL;
+}
+
+ChunkedJsonWriter::ChunkedJsonWriter(JsonChunkSink& sink) : sink(sink), sent(false) {
+    buffer.reserve(JSON_LIST_CHUNK + 96);
+}
+
+void ChunkedJsonWriter::begin(const String& totalCount) {
+    sink.beginResponse(totalCount);
+    buffer = "[";
+}
+
+void ChunkedJsonWriter::add(const String& item) {
+    if (buffer.length() > 1 || sent) buffer += ",";
+    buffer += item;
+    if (buffer.length() >= JSON_LIST_CHUNK) flush();
+}
+
+void ChunkedJsonWriter::end() {
+    buffer += "]";
+    flush();
+    sink.sendChunk("");  // Parte final de longitud cero
+}
+
+void ChunkedJsonWriter::flush() {
+    sink.sendChunk(buffer);
+    buffer = "";
+    sent = true;
+}
@@ -0,0 +1,67 @@
+#ifndef WEB_RESPONSE_H
+#define WEB_RESPONSE_H
+
+#include <Arduino.h>
+#include "config.h"
+
+/*
+ * Piezas de las respuestas HTTP que no dependen de WebServer: validadores de
+ * caché (ETag, Last-Modified), el encabezado Range y el JSON por chunks de
+ * los listados. web_server.cpp las conecta con WebServer; al no depender de
+ * él se prueban en el host (tests/test_web_response.cpp).
+ */
+
+// ETag = tamaño + fecha de modificación; Last-Modified en formato HTTP
+struct CacheValidators {
+    char etag[32];
+    char lastModified[40];
+};
+
+void buildCacheValidators(size_t size, time_t modified, CacheValidators& out);
+
+// If-None-Match manda sobre If-Modified-Since, que se compara textualmente:
+// los clientes devuelven el mismo Last-Modified que enviamos.
+// nullptr = encabezado ausente.
+bool isNotModified(const CacheValidators& validators, const String* ifNoneMatch, const String* ifModifiedSince);
+
+enum RangeResult {
+    RANGE_FULL,       // Sin Range (o con uno que no se entiende): 200 completo
+    RANGE_PARTIAL,    // 206 con [start, end]
+    RANGE_INVALID     // 416 con Content-Range: bytes */size
+};
+
+// Range de un solo intervalo: "bytes=a-b", "bytes=a-" o "bytes=-n".
+// start y end quedan inclusivos; con RANGE_FULL cubren el archivo completo.
+RangeResult parseRange(const String& header, size_t size, size_t& start, size_t& end);
+
+// Destino de ChunkedJsonWriter: en el firmware, WebServer con
+// Transfer-Encoding: chunked
+class JsonChunkSink {
+public:
+    virtual ~JsonChunkSink() {}
+    // Encabezados y estado 200; totalCount vacío = sin X-Total-Count
+    virtual void beginResponse(const String& totalCount) = 0;
+    // Una parte del cuerpo; "" es la parte final de longitud cero
+    virtual void sendChunk(const String& data) = 0;
+};
+
+// Arma la respuesta JSON en un buffer fijo y lo envía como una parte cada vez
+// que supera JSON_LIST_CHUNK: el primer byte sale enseguida y la memoria no
+// depende de la cantidad de fotos
+class ChunkedJsonWriter {
+public:
+    explicit ChunkedJsonWriter(JsonChunkSink& sink);
+
+    void begin(const String& totalCount);
+    void add(const String& item);
+    void end();
+
+private:
+    JsonChunkSink& sink;
+    String buffer;
+    bool sent;
+
+    void flush();
+};
+
+#endif // WEB_RESPONSE_H
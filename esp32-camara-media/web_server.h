@@ -4,6 +4,23 @@
 #include <Arduino.h>
 #include <WebServer.h>
 #include <ArduinoJson.h>
+#include "config.h"
+
+struct WebAsset;
+struct ReplayFrame;
+
+// Perfil de una ruta, expuesto en /bench
+struct RouteProfile {
+    const char* path;
+    HTTPMethod method;
+    uint32_t requests;
+    uint64_t totalUs;
+    uint32_t maxUs;
+    int32_t lastHeapDelta;      // Bytes de heap que la petición dejó ocupados
+    int32_t maxHeapDelta;
+    int32_t lastBlockDelta;     // Bloques de heap que quedaron asignados
+    int32_t maxBlockDelta;
+};
 
 class CameraWebServer {
 public:
@@ -14,21 +31,41 @@ public:
 
 private:
     WebServer server;
+    RouteProfile profiles[WEB_PROFILE_ROUTES];
+    int profileCount;
+
+    // server.on() con medición de tiempo y heap por ruta (WEB_PROFILE_ENABLED)
+    void route(const char* path, HTTPMethod method, WebServer::THandlerFunction handler);
 
     // Handlers de rutas - fotos
-    void handleRoot();
+    void handleWebAsset(const WebAsset& asset);  // Dashboard: index.html, app.css, app.js
     void handleStream();
     void handleCapture();
     void handleSettings();
     void handleGetSettings();
     void handleUpdateSettings();
     void handleStatus();
+    void handleMetrics();
+    void handleBench();
+    void handleSdBench();
     void handleWebCapture();
     void handleListPhotos();
     void handleListFolders();
     void handleViewPhoto();
+    void handleThumbnail();
     void handleDeletePhoto();
 
+    // Handlers de rutas - grabaciones de video
+    void handleRecord();
+    void handleListRecordings();
+    void handleViewRecording();
+    void handleReplay();            // Pre-roll en PSRAM como AVI o MJPEG
+    void sendReplayAvi(const ReplayFrame* frames, int count);
+    void sendReplayMjpeg(const ReplayFrame* frames, int count);
+
+    // Envía un archivo de SD por bloques con ETag, Last-Modified y Range
+    void sendSdFile(File& file, const String& name, const char* contentType);
+
     // Handler ventilador
     void handleFan();
 
@@ -40,9 +77,6 @@ private:
     void handleGetWiFiStatus();
 
     void handleNotFound();
-
-    // Generar HTML del dashboard
-    String generateDashboardHTML();
 };
 
 extern CameraWebServer webServer;
@@ -0,0 +1,98 @@
+// Latencia y asignaciones por ruta del servidor web real (CameraWebServer)
+// atendido por loopback, como loop() en la placa: cada petición se atiende
+// llamando a handleClient() mientras el cliente espera
+
+#include "test.h"
+#include "http_client.h"
+#include "camera_handler.h"
+#include "sd_handler.h"
+#include "sd_writer.h"
+#include "stream_server.h"
+#include "web_server.h"
+
+static void pumpLoop() {
+    webServer.handleClient();
+    camera.poll();
+    sdWriter.poll();
+}
+
+static std::string photoName(int i) {
+    char name[32];
+    snprintf(name, sizeof(name), "2024-03-01_%02d-%02d-00.jpg", i / 60, i % 60);
+    return name;
+}
+
+struct Route {
+    const char* name;
+    std::string target;
+    std::map<std::string, std::string> headers;
+    int expectedStatus;
+};
+
+// Repite la petición y reporta p50/p95 y bloques asignados por petición
+// (incluye los del cliente de prueba, que corre en el mismo proceso)
+static void benchRoute(const Route& route, int iterations) {
+    uint16_t port = hostWebServerPort();
+    std::vector<double> samples;
+    HttpResponse last;
+    HostAllocStats before = hostAllocStats();
+    for (int i = 0; i < iterations; i++) {
+        last = httpRequest(port, "GET", route.target, route.headers, "", pumpLoop);
+        CHECK_EQ(last.status, route.expectedStatus);
+        samples.push_back(last.totalUs);
+    }
+    HostAllocStats after = hostAllocStats();
+    char extra[96];
+    snprintf(extra, sizeof(extra), "%.1f allocs/req  %.0f B/req  body %zu B",
+             (double)(after.allocations - before.allocations) / iterations,
+             (double)(after.bytes - before.bytes) / iterations, last.body.size());
+    benchReport(route.name, benchSummarize(samples), extra);
+}
+
+TEST(endpoints) {
+    TestSd sd;
+    int photos = benchQuick() ? 200 : 2000;
+    std::string jpeg = hostMakeJpeg(800, 600, 60 * 1024, 0x55);
+    for (int i = 0; i < photos; i++) sd.write("/fotos_web/" + photoName(i), jpeg);
+
+    hostCameraConfigure({ 800, 600, 40 * 1024, 20000 });
+    REQUIRE(camera.init());
+    REQUIRE(sdCard.init());
+    sdWriter.begin();
+    webServer.init();
+    streamServer.begin();
+
+    int n = benchIterations(200, 5);
+    std::string photo = "/photo?name=" + photoName(photos / 2);
+    const Route routes[] = {
+        { "GET /status", "/status", {}, 200 },
+        { "GET /metrics", "/metrics", {}, 200 },
+        { "GET /folders", "/folders", {}, 200 },
+        { "GET /photos (todo)", "/photos?folder=fotos_web", {}, 200 },
+        { "GET /photos (50)", "/photos?folder=fotos_web&limit=50&offset=100", {}, 200 },
+        { "GET /photo", photo, {}, 200 },
+        { "GET /photo Range", photo, { { "Range", "bytes=0-4095" } }, 206 },
+        { "GET /capture", "/capture?flash=0", {}, 200 },
+    };
+    for (const Route& route : routes) benchRoute(route, n);
+
+    // Revalidación: la segunda petición lleva el ETag de la primera
+    HttpResponse first = httpRequest(hostWebServerPort(), "GET", photo, {}, "", pumpLoop);
+    REQUIRE(!first.header("etag").empty());
+    benchRoute({ "GET /photo 304", photo, { { "If-None-Match", first.header("etag") } }, 304 }, n);
+
+    // /stream lo sirve su tarea: se mide el fps recibido y que loop() siga
+    // respondiendo mientras tanto
+    HttpStream stream(hostWebServerPort(), "/stream");
+    REQUIRE(stream.connected());
+    int streamMs = benchQuick() ? 1000 : 5000;
+    stream.readFor(streamMs, pumpLoop);
+    size_t frames = 0;
+    for (size_t pos = 0; (pos = stream.data().find("Content-Type: image/jpeg", pos)) != std::string::npos; pos++) {
+        frames++;
+    }
+    CHECK(frames > 0);
+    benchNote("/stream: %zu frames en %d ms (%.1f fps)", frames, streamMs, frames * 1000.0 / streamMs);
+    benchRoute({ "GET /status con stream", "/status", {}, 200 }, n);
+    stream.close();
+}
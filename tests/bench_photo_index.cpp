@@ -0,0 +1,138 @@
+// Índice de fotos con 10000 fotos en una carpeta: reconstrucción, acceso por
+// número, búsqueda por fecha, altas/bajas y paginado, comparados con recorrer
+// el directorio como hacía getPhotoPathByIndex() antes del índice
+
+#include "test.h"
+#include "photo_index.h"
+#include "sd_handler.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+static const int PHOTOS = 10000;
+
+static double nowUs() {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// 400 fotos por día, una cada 3 minutos, desde el 2024-01-01
+static std::string photoName(int i) {
+    int second = (i % 400) * 180;
+    char name[32];
+    snprintf(name, sizeof(name), "2024-01-%02d_%02d-%02d-%02d.jpg", 1 + i / 400, second / 3600,
+             second / 60 % 60, second % 60);
+    return name;
+}
+
+// Lo que costaba cada acceso sin índice: recorrer la carpeta y ordenar los
+// nombres (el firmware viejo además ordenaba en O(n²) y cortaba en
+// MAX_TOTAL_PHOTOS, así que esto es una cota inferior)
+static String dirScanPath(const char* folder, int index) {
+    std::vector<std::string> names;
+    File dir = SD_MMC.open(folder);
+    File file = dir.openNextFile();
+    while (file) {
+        std::string name = file.name();
+        if (!file.isDirectory() && name.size() > 4 && name.compare(name.size() - 4, 4, ".jpg") == 0) {
+            names.push_back(name);
+        }
+        file = dir.openNextFile();
+    }
+    dir.close();
+    std::sort(names.begin(), names.end());
+    if (index < 1 || index > (int)names.size()) return "";
+    return String(folder) + "/" + names[index - 1].c_str();
+}
+
+// Mide op() iterations veces y reporta p50/p95 con las operaciones de SD
+// (aperturas y entradas de directorio) por llamada
+template <typename Op>
+static BenchStats measure(const char* name, int iterations, Op op) {
+    std::vector<double> samples;
+    samples.reserve(iterations);
+    HostSdStats before = hostSdStats();
+    for (int i = 0; i < iterations; i++) {
+        double start = nowUs();
+        op(i);
+        samples.push_back(nowUs() - start);
+    }
+    HostSdStats after = hostSdStats();
+    BenchStats stats = benchSummarize(samples);
+    char extra[96];
+    snprintf(extra, sizeof(extra), "%.1f aperturas  %.0f entradas dir  %.0f B leídos",
+             (double)(after.opens - before.opens) / iterations,
+             (double)(after.dirEntries - before.dirEntries) / iterations,
+             (double)(after.bytesRead - before.bytesRead) / iterations);
+    benchReport(name, stats, extra);
+    return stats;
+}
+
+TEST(tenThousandPhotos) {
+    TestSd sd;
+    for (int i = 0; i < PHOTOS; i++) sd.write("/fotos_web/" + photoName(i), std::string(64, 'x'));
+    REQUIRE(sdCard.init());
+    int folder = photoIndex.findFolder("fotos_web");
+    REQUIRE(folder >= 0);
+    REQUIRE(photoIndex.getPhotoCount(folder) == (uint32_t)PHOTOS);
+
+    // Reconstrucción desde el directorio (índice borrado) y carga de uno válido
+    int rebuilds = benchIterations(10, 2);
+    measure("rebuild", rebuilds, [&](int) {
+        std::remove((sd.root() + "/fotos_web/" SD_INDEX_FILE).c_str());
+        photoIndex.begin();
+    });
+    measure("begin (índice válido, verificado)", rebuilds, [&](int) { photoIndex.begin(); });
+    folder = photoIndex.findFolder("fotos_web");
+    REQUIRE(photoIndex.getPhotoCount(folder) == (uint32_t)PHOTOS);
+
+    int n = benchIterations(2000, 50);
+    uint32_t seed = 12345;
+    auto randomIndex = [&] {
+        seed = seed * 1103515245 + 12345;
+        return (int)((seed >> 8) % PHOTOS);
+    };
+
+    BenchStats indexed = measure("getPhotoPathByIndex", n, [&](int) {
+        int i = randomIndex();
+        CHECK(sdCard.getPhotoPathByIndex(i + 1) == String(("/fotos_web/" + photoName(i)).c_str()));
+    });
+    BenchStats scanned = measure("recorrido de directorio", benchIterations(20, 3), [&](int) {
+        int i = randomIndex();
+        CHECK(dirScanPath("/fotos_web", i + 1) == String(("/fotos_web/" + photoName(i)).c_str()));
+    });
+    benchNote("getPhotoPathByIndex %.0fx más rápido que recorrer el directorio", scanned.p50Us / indexed.p50Us);
+
+    measure("findPrefix (día)", n, [&](int) {
+        int day = 1 + randomIndex() % (PHOTOS / 400);
+        char prefix[16];
+        snprintf(prefix, sizeof(prefix), "2024-01-%02d", day);
+        CHECK_EQ(photoIndex.findPrefix(folder, prefix), (int32_t)((day - 1) * 400));
+    });
+
+    // Altas y bajas en medio de la carpeta (segundo impar: no existe todavía)
+    int updates = benchIterations(500, 20);
+    std::vector<std::string> added;
+    for (int i = 0; i < updates; i++) {
+        std::string name = photoName(randomIndex());
+        name[18] = '1';
+        added.push_back("/fotos_web/" + name);
+    }
+    std::sort(added.begin(), added.end());
+    added.erase(std::unique(added.begin(), added.end()), added.end());
+    int distinct = added.size();
+    measure("add", distinct, [&](int i) { CHECK(photoIndex.add(added[i].c_str(), 4096)); });
+    CHECK_EQ(photoIndex.getPhotoCount(folder), (uint32_t)(PHOTOS + distinct));
+    measure("remove", distinct, [&](int i) { CHECK(photoIndex.remove(added[i].c_str())); });
+    CHECK_EQ(photoIndex.getPhotoCount(folder), (uint32_t)PHOTOS);
+
+    // Paginado de 10 en 10: primera, última y al azar
+    int pages = PHOTOS / 10;
+    measure("listPhotosInFolder (pág. 1)", n, [&](int) {
+        int total = 0;
+        sdCard.listPhotosInFolder("fotos_web", 1, 10, &total);
+        CHECK_EQ(total, pages);
+    });
+    measure("listPhotosInFolder (última)", n, [&](int) { sdCard.listPhotosInFolder("fotos_web", pages, 10); });
+    measure("listPhotosInFolder (al azar)", n,
+            [&](int) { sdCard.listPhotosInFolder("fotos_web", 1 + randomIndex() % pages, 10); });
+}
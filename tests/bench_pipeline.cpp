@@ -0,0 +1,65 @@
+// Simulación de profundidad del pipeline: un consumidor que tarda sendUs en
+// "enviar" cada frame mientras el sensor entrega uno cada readoutUs. Se
+// compila una vez por profundidad (FRAME_PIPELINE_DEPTH y CAMERA_FB_COUNT en
+// tests/CMakeLists.txt); con un solo buffer el pipeline queda deshabilitado y
+// se mide la captura en frío (capturar, enviar, devolver)
+
+#include "test.h"
+#include "frame_pipeline.h"
+#include <thread>
+
+static const uint32_t readoutUs = 20000;  // 50 fps de sensor
+
+// Frames por segundo que logra el consumidor en ms milisegundos
+static double consume(uint32_t sendUs, int ms, uint32_t& lastSeq) {
+    int frames = 0;
+    int64_t start = esp_timer_get_time();
+    int64_t end = start + (int64_t)ms * 1000;
+    while (esp_timer_get_time() < end) {
+        if (framePipeline.isEnabled()) {
+            PipelineFrame* frame = framePipeline.acquireNewer(lastSeq);
+            if (!frame) {
+                delay(1);
+                continue;
+            }
+            lastSeq = frame->seq;
+            std::this_thread::sleep_for(std::chrono::microseconds(sendUs));
+            framePipeline.release(frame);
+        } else {
+            camera_fb_t* fb = esp_camera_fb_get();
+            if (!fb) continue;
+            std::this_thread::sleep_for(std::chrono::microseconds(sendUs));
+            esp_camera_fb_return(fb);
+        }
+        frames++;
+    }
+    return frames * 1e6 / (double)(esp_timer_get_time() - start);
+}
+
+TEST(depthThroughput) {
+    hostCameraConfigure({ 800, 600, 30 * 1024, readoutUs });
+    camera_config_t config = {};
+    config.frame_size = FRAMESIZE_SVGA;
+    config.fb_count = CAMERA_FB_COUNT;
+    config.fb_location = CAMERA_FB_IN_PSRAM;
+    config.grab_mode = CAMERA_GRAB_LATEST;
+    REQUIRE(esp_camera_init(&config) == ESP_OK);
+    bool enabled = framePipeline.begin(CAMERA_FB_COUNT);
+    CHECK_EQ(enabled, CAMERA_FB_COUNT > 1);
+    if (enabled) framePipeline.addConsumer();
+
+    int ms = benchQuick() ? 300 : 3000;
+    uint32_t lastSeq = 0;
+    benchNote("profundidad %d (%d buffers), sensor %.0f fps", framePipeline.getDepth(), CAMERA_FB_COUNT,
+              1e6 / readoutUs);
+    for (uint32_t sendUs : { 5000u, 15000u, 25000u, 40000u }) {
+        double fps = consume(sendUs, ms, lastSeq);
+        // Tope teórico: sin solape readout + envío, con solape el mayor de los dos
+        double serial = 1e6 / (readoutUs + sendUs);
+        double overlapped = 1e6 / max(readoutUs, sendUs);
+        benchNote("  envio %5.1f ms: %5.1f fps (en serie %4.1f, solapado %4.1f)", sendUs / 1000.0, fps, serial,
+                  overlapped);
+        CHECK(fps > 0);
+    }
+    if (enabled) framePipeline.removeConsumer();
+}
@@ -0,0 +1,98 @@
+// Difusión del stream: de 1 a 8 clientes leyendo a la vez, FPS recibido por
+// cliente y capturas por segundo (deben seguir al cliente más rápido, no
+// crecer con la cantidad de clientes). Se compila con MAX_STREAM_CLIENTS=8
+// junto a stream_server y camera_handler, sin servidor web: los sockets se
+// entregan directo a streamServer.addClient()
+
+#include "test.h"
+#include "camera_handler.h"
+#include "stream_server.h"
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+
+static int listener = -1;
+static uint16_t listenerPort = 0;
+
+static void startListener() {
+    listener = socket(AF_INET, SOCK_STREAM, 0);
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    bind(listener, (struct sockaddr*)&addr, sizeof(addr));
+    listen(listener, 16);
+    socklen_t len = sizeof(addr);
+    getsockname(listener, (struct sockaddr*)&addr, &len);
+    listenerPort = ntohs(addr.sin_port);
+}
+
+// Par de sockets por loopback: el extremo del servidor va al stream
+static int connectClient() {
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons(listenerPort);
+    if (connect(fd, (struct sockaddr*)&addr, sizeof(addr)) != 0) return -1;
+    int serverFd = accept(listener, nullptr, nullptr);
+    if (!streamServer.addClient(WiFiClient(serverFd))) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+// Lee durante ms y cuenta las partes multipart recibidas
+static size_t readFrames(int fd, int ms) {
+    std::string data;
+    char buf[65536];
+    int64_t end = esp_timer_get_time() + (int64_t)ms * 1000;
+    while (esp_timer_get_time() < end) {
+        struct pollfd pfd = { fd, POLLIN, 0 };
+        if (poll(&pfd, 1, 5) <= 0) continue;
+        ssize_t n = recv(fd, buf, sizeof(buf), 0);
+        if (n <= 0) break;
+        data.append(buf, n);
+    }
+    size_t frames = 0;
+    for (size_t pos = 0; (pos = data.find("--frame\r\n", pos)) != std::string::npos; pos++) frames++;
+    return frames;
+}
+
+TEST(fanOut) {
+    hostCameraConfigure({ 800, 600, 40 * 1024, 10000 });
+    REQUIRE(camera.init());
+    REQUIRE(streamServer.begin());
+    startListener();
+
+    int ms = benchQuick() ? 500 : 4000;
+    benchNote("sensor 100 fps, JPEG 40 KB, %d ms por medición", ms);
+    for (int n = 1; n <= MAX_STREAM_CLIENTS; n++) {
+        std::vector<int> fds;
+        for (int i = 0; i < n; i++) fds.push_back(connectClient());
+        REQUIRE(waitUntil([&] { return streamServer.getClientCount() == n; }, 2000));
+        delay(200);  // Arranque: el primer frame de cada cliente
+
+        uint32_t capturedBefore = hostCameraFramesTaken();
+        std::vector<size_t> frames(n);
+        std::vector<std::thread> readers;
+        for (int i = 0; i < n; i++) readers.emplace_back([&, i] { frames[i] = readFrames(fds[i], ms); });
+        for (std::thread& t : readers) t.join();
+        uint32_t captured = hostCameraFramesTaken() - capturedBefore;
+
+        size_t minFrames = *std::min_element(frames.begin(), frames.end());
+        size_t total = 0;
+        for (size_t f : frames) total += f;
+        benchNote("%d clientes: %5.1f fps por cliente (min %5.1f), %5.1f capturas/s", n,
+                  total * 1000.0 / ms / n, minFrames * 1000.0 / ms, captured * 1000.0 / ms);
+        CHECK(minFrames > 0);
+
+        for (int fd : fds) close(fd);
+        REQUIRE(waitUntil([] { return streamServer.getClientCount() == 0; }, 3000));
+    }
+}
@@ -0,0 +1,134 @@
+// Costo por frame del envío del stream: asignaciones de heap y llamadas a
+// send()/sendmsg() por frame con el envío actual (cabecera en buffer fijo,
+// sendmsg por bloques de STREAM_SEND_CHUNK) y con el anterior (cabecera en
+// String y send() separados para cabecera, bloques del JPEG y cierre)
+
+#include "test.h"
+#include "camera_handler.h"
+#include "stream_server.h"
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <atomic>
+#include <thread>
+#include <unistd.h>
+
+// Par de sockets TCP por loopback: [0] cliente, [1] servidor
+static void socketPair(int fds[2]) {
+    int listener = socket(AF_INET, SOCK_STREAM, 0);
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    bind(listener, (struct sockaddr*)&addr, sizeof(addr));
+    listen(listener, 1);
+    socklen_t len = sizeof(addr);
+    getsockname(listener, (struct sockaddr*)&addr, &len);
+    fds[0] = socket(AF_INET, SOCK_STREAM, 0);
+    connect(fds[0], (struct sockaddr*)&addr, sizeof(addr));
+    fds[1] = accept(listener, nullptr, nullptr);
+    close(listener);
+}
+
+// Lector sin asignaciones: cuenta los "--frame\r\n" con un buffer fijo
+struct FrameCounter {
+    std::atomic<bool> running{ true };
+    std::atomic<uint32_t> frames{ 0 };
+    std::thread thread;
+
+    explicit FrameCounter(int fd) {
+        thread = std::thread([this, fd] {
+            static const char marker[] = "--frame\r\n";
+            const size_t markerLen = sizeof(marker) - 1;
+            char buf[65536 + sizeof(marker)];
+            size_t carry = 0;
+            while (running) {
+                struct pollfd pfd = { fd, POLLIN, 0 };
+                if (poll(&pfd, 1, 5) <= 0) continue;
+                ssize_t n = recv(fd, buf + carry, 65536, 0);
+                if (n <= 0) break;
+                size_t len = carry + n;
+                for (size_t i = 0; i + markerLen <= len; i++) {
+                    if (memcmp(buf + i, marker, markerLen) == 0) frames++;
+                }
+                carry = min(len, markerLen - 1);
+                memmove(buf, buf + len - carry, carry);
+            }
+        });
+    }
+
+    void stop() {
+        running = false;
+        thread.join();
+    }
+};
+
+static void report(const char* name, uint32_t frames, HostAllocStats before, uint64_t sendsBefore) {
+    HostAllocStats after = hostAllocStats();
+    double n = frames ? frames : 1;
+    benchNote("%-24s %5u frames  %6.2f asignaciones/frame  %7.1f bytes/frame  %6.2f send/frame", name, frames,
+              (after.allocations - before.allocations) / n, (after.bytes - before.bytes) / n,
+              (hostSendCalls() - sendsBefore) / n);
+}
+
+TEST(perFrameCost) {
+    hostCameraConfigure({ 800, 600, 40 * 1024, 10000 });
+    REQUIRE(camera.init());
+    REQUIRE(streamServer.begin());
+    int ms = benchQuick() ? 500 : 5000;
+
+    // Actual: StreamServer con un cliente a 30 fps
+    {
+        int fds[2];
+        socketPair(fds);
+        FrameCounter counter(fds[0]);
+        REQUIRE(streamServer.addClient(WiFiClient(fds[1]), 30));
+        REQUIRE(waitUntil([] { return streamServer.getClientCount() == 1; }, 2000));
+        delay(200);
+
+        uint32_t framesBefore = counter.frames;
+        HostAllocStats allocBefore = hostAllocStats();
+        uint64_t sendsBefore = hostSendCalls();
+        delay(ms);
+        uint32_t frames = counter.frames - framesBefore;
+        report("buffer fijo + sendmsg", frames, allocBefore, sendsBefore);
+        CHECK(frames > 0);
+
+        counter.stop();
+        close(fds[0]);
+        REQUIRE(waitUntil([] { return streamServer.getClientCount() == 0; }, 3000));
+    }
+
+    // Anterior: un frame de la cámara, cabecera String y un send() por
+    // parte (como stream_server.cpp antes del cambio)
+    {
+        int fds[2];
+        socketPair(fds);
+        FrameCounter counter(fds[0]);
+        uint32_t frames = 0;
+        HostAllocStats allocBefore = hostAllocStats();
+        uint64_t sendsBefore = hostSendCalls();
+        int64_t end = esp_timer_get_time() + (int64_t)ms * 1000;
+        while (esp_timer_get_time() < end) {
+            camera_fb_t* fb = esp_camera_fb_get();
+            if (!fb) continue;
+
+            String header = "--frame\r\n";
+            header += "Content-Type: image/jpeg\r\n";
+            header += "Content-Length: " + String(fb->len) + "\r\n\r\n";
+            send(fds[1], header.c_str(), header.length(), 0);
+            for (size_t sent = 0; sent < fb->len; sent += STREAM_SEND_CHUNK) {
+                send(fds[1], fb->buf + sent, min((size_t)STREAM_SEND_CHUNK, fb->len - sent), 0);
+            }
+            send(fds[1], "\r\n", 2, 0);
+            esp_camera_fb_return(fb);
+            frames++;
+            delay(1000 / 30);
+        }
+        report("String + send por parte", frames, allocBefore, sendsBefore);
+        counter.stop();
+        close(fds[0]);
+        close(fds[1]);
+    }
+}
@@ -0,0 +1,67 @@
+// Parser de getUpdates con las respuestas de ejemplo: tiempo por respuesta
+// y por MB, asignaciones de heap (deben ser 0) y memoria fija del parser,
+// con bloques del tamaño que usa la tarea de polling (TELEGRAM_POLL_CHUNK)
+
+#include "test.h"
+#include "telegram_updates.h"
+#include <chrono>
+
+static TelegramUpdateParser parser;
+
+static double nowUs() {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+TEST(parseSamples) {
+    benchNote("memoria del parser: %zu bytes (fija, %d slots de %zu)", sizeof(TelegramUpdateParser),
+              TELEGRAM_UPDATE_SLOTS, sizeof(TelegramUpdate));
+    int iterations = benchIterations(20000, 200);
+
+    for (const char* name : { "empty.json", "single.json", "burst.json", "long_text.json", "unicode.json" }) {
+        std::string json = testData(std::string("telegram/") + name);
+        std::vector<double> samples;
+        samples.reserve(iterations);
+        HostAllocStats before = hostAllocStats();
+        for (int i = 0; i < iterations; i++) {
+            double start = nowUs();
+            parser.begin();
+            bool ok = true;
+            for (size_t pos = 0; ok && pos < json.size(); pos += TELEGRAM_POLL_CHUNK) {
+                ok = parser.feed((const uint8_t*)json.data() + pos,
+                                 std::min((size_t)TELEGRAM_POLL_CHUNK, json.size() - pos));
+            }
+            ok = ok && parser.finish();
+            samples.push_back(nowUs() - start);
+            CHECK(ok);
+        }
+        HostAllocStats after = hostAllocStats();
+
+        BenchStats stats = benchSummarize(samples);
+        char extra[96];
+        snprintf(extra, sizeof(extra), "%6zu B  %7.1f MB/s  %.2f allocs/respuesta", json.size(),
+                 json.size() / stats.p50Us, (double)(after.allocations - before.allocations) / iterations);
+        benchReport(name, stats, extra);
+        CHECK_EQ(after.allocations, before.allocations);
+    }
+
+    // Ráfaga grande: muchos updates en una respuesta, la memoria no crece
+    std::string burst = testData("telegram/burst.json");
+    size_t open = burst.find('[') + 1;
+    size_t close = burst.rfind(']');
+    std::string items = burst.substr(open, close - open);
+    std::string big = burst.substr(0, open) + items;
+    while (big.size() < 256 * 1024) big += "," + items;
+    big += burst.substr(close);
+    HostAllocStats before = hostAllocStats();
+    double start = nowUs();
+    parser.begin();
+    for (size_t pos = 0; pos < big.size(); pos += TELEGRAM_POLL_CHUNK) {
+        parser.feed((const uint8_t*)big.data() + pos, std::min((size_t)TELEGRAM_POLL_CHUNK, big.size() - pos));
+    }
+    CHECK(parser.finish());
+    double elapsed = nowUs() - start;
+    CHECK_EQ(hostAllocStats().allocations, before.allocations);
+    CHECK_EQ(parser.getCount(), TELEGRAM_UPDATE_SLOTS);
+    benchNote("respuesta de %zu KB: %.0f us, %d updates guardados, 0 asignaciones", big.size() / 1024, elapsed,
+              parser.getCount());
+}
@@ -0,0 +1,46 @@
+#!/usr/bin/env python3
+# Genera las respuestas de getUpdates de ejemplo (formato de la Bot API)
+# que usan test_telegram_updates y bench_telegram_updates
+import json, os
+
+def user(uid, name):
+    return {"id": uid, "is_bot": False, "first_name": name, "language_code": "es"}
+
+def msg(mid, uid, name, chat, text, date=1700000000, **extra):
+    m = {"message_id": mid, "from": user(uid, name), "chat": chat, "date": date, "text": text}
+    if text.startswith("/"):
+        m["entities"] = [{"offset": 0, "length": len(text.split()[0]), "type": "bot_command"}]
+    m.update(extra)
+    return m
+
+def private(uid, name):
+    return {"id": uid, "first_name": name, "type": "private"}
+
+group = {"id": -1001234567890, "title": "Casa ñandú", "type": "supergroup"}
+
+def write(name, result, body=None):
+    body = body or {"ok": True, "result": result}
+    with open(os.path.join(os.path.dirname(__file__), name), "w", encoding="utf-8") as f:
+        json.dump(body, f, ensure_ascii=(name != "unicode.json"), separators=(",", ":"))
+
+write("empty.json", [])
+write("single.json", [{"update_id": 800000001, "message": msg(10, 111, "Ana", private(111, "Ana"), "/foto")}])
+write("burst.json", [
+    {"update_id": 800000010, "message": msg(20, 111, "Ana", private(111, "Ana"), "/estado")},
+    {"update_id": 800000011, "edited_message": dict(msg(21, 222, "Luis", group, "/foto 3"), edit_date=1700000100)},
+    {"update_id": 800000012, "message": {"message_id": 22, "from": user(333, "Eva"), "chat": group, "date": 1700000001,
+                                          "photo": [{"file_id": "AgAC" + "x" * 60, "file_unique_id": "AQAD", "file_size": 1234,
+                                                     "width": 90, "height": 67}], "caption": "mira"}},
+    {"update_id": 800000013, "my_chat_member": {"chat": group, "from": user(111, "Ana"), "date": 1700000002,
+                                                 "old_chat_member": {"status": "left"}, "new_chat_member": {"status": "member"}}},
+    {"update_id": 800000014, "message": msg(23, 444, "Zoë", private(444, "Zoë"), "/carpeta 2",
+                                            reply_to_message=msg(19, 111, "Ana", private(444, "Zoë"), "hola"))},
+    {"update_id": 800000015, "message": msg(24, 111, "Ana", private(111, "Ana"), "/grabar 30")},
+])
+long_text = ("Texto largo con acentos áéíóú y emoji \U0001F4F7 " * 80)[:4096]
+write("long_text.json", [{"update_id": 800000020, "message": msg(30, 111, "Ana", private(111, "Ana"), long_text)}])
+write("unicode.json", [{"update_id": 800000030, "message": msg(31, 555, "Мария \U0001F600",
+                                                             private(555, "Мария"),
+                                                             "¿foto? → \"sí\" \\ \U0001F4F8\n")}])
+write("error.json", None, {"ok": False, "error_code": 409,
+                           "description": "Conflict: terminated by other getUpdates request"})
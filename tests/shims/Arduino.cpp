@@ -0,0 +1,319 @@
+#include <Arduino.h>
+#include <chrono>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <unistd.h>
+#include "host.h"
+
+HardwareSerial Serial;
+EspClass ESP;
+
+// ===== String =====
+
+bool String::equalsIgnoreCase(const String& o) const {
+    if (s.size() != o.s.size()) return false;
+    for (size_t i = 0; i < s.size(); i++) {
+        if (tolower((unsigned char)s[i]) != tolower((unsigned char)o.s[i])) return false;
+    }
+    return true;
+}
+
+String String::substring(unsigned int from, unsigned int to) const {
+    if (from > to) std::swap(from, to);
+    if (from >= s.size()) return String();
+    return String(s.substr(from, min((size_t)to, s.size()) - from));
+}
+
+void String::trim() {
+    size_t begin = 0;
+    size_t end = s.size();
+    while (begin < end && isspace((unsigned char)s[begin])) begin++;
+    while (end > begin && isspace((unsigned char)s[end - 1])) end--;
+    s = s.substr(begin, end - begin);
+}
+
+void String::toLowerCase() {
+    for (char& c : s) c = (char)tolower((unsigned char)c);
+}
+
+void String::toUpperCase() {
+    for (char& c : s) c = (char)toupper((unsigned char)c);
+}
+
+void String::replace(char find, char replacement) {
+    for (char& c : s) {
+        if (c == find) c = replacement;
+    }
+}
+
+void String::replace(const String& find, const String& replacement) {
+    if (find.s.empty()) return;
+    size_t pos = 0;
+    while ((pos = s.find(find.s, pos)) != std::string::npos) {
+        s.replace(pos, find.s.size(), replacement.s);
+        pos += replacement.s.size();
+    }
+}
+
+void String::getBytes(unsigned char* buf, unsigned int size, unsigned int index) const {
+    if (!buf || size == 0) return;
+    size_t n = index < s.size() ? min((size_t)size - 1, s.size() - index) : 0;
+    memcpy(buf, s.data() + index, n);
+    buf[n] = 0;
+}
+
+void String::fromUnsigned(unsigned long long value, unsigned char base) {
+    if (base < 2 || base > 36) base = 10;
+    char buf[66];
+    int pos = sizeof(buf) - 1;
+    buf[pos] = 0;
+    do {
+        int digit = (int)(value % base);
+        buf[--pos] = (char)(digit < 10 ? '0' + digit : 'a' + digit - 10);
+        value /= base;
+    } while (value > 0);
+    s = buf + pos;
+}
+
+void String::fromSigned(long long value, unsigned char base) {
+    if (value < 0 && base == 10) {
+        fromUnsigned(0ULL - (unsigned long long)value, base);
+        s.insert(s.begin(), '-');
+    } else {
+        fromUnsigned((unsigned long long)value, base);
+    }
+}
+
+void String::fromDouble(double value, unsigned decimals) {
+    char buf[64];
+    snprintf(buf, sizeof(buf), "%.*f", (int)decimals, value);
+    s = buf;
+}
+
+// ===== Print / Stream =====
+
+size_t Print::write(const uint8_t* buffer, size_t size) {
+    size_t n = 0;
+    while (size--) {
+        if (!write(*buffer++)) break;
+        n++;
+    }
+    return n;
+}
+
+size_t Print::printf(const char* format, ...) {
+    char small[256];
+    va_list args;
+    va_start(args, format);
+    int len = vsnprintf(small, sizeof(small), format, args);
+    va_end(args);
+    if (len < 0) return 0;
+    if ((size_t)len < sizeof(small)) return write((const uint8_t*)small, len);
+
+    std::string big(len + 1, '\0');
+    va_start(args, format);
+    vsnprintf(&big[0], big.size(), format, args);
+    va_end(args);
+    return write((const uint8_t*)big.data(), len);
+}
+
+int Stream::timedRead() {
+    unsigned long start = millis();
+    do {
+        int c = read();
+        if (c >= 0) return c;
+        delay(1);
+    } while (millis() - start < _timeout);
+    return -1;
+}
+
+size_t Stream::readBytes(char* buffer, size_t length) {
+    size_t count = 0;
+    while (count < length) {
+        int c = timedRead();
+        if (c < 0) break;
+        buffer[count++] = (char)c;
+    }
+    return count;
+}
+
+String Stream::readStringUntil(char terminator) {
+    std::string out;
+    int c = timedRead();
+    while (c >= 0 && c != terminator) {
+        out += (char)c;
+        c = timedRead();
+    }
+    return String(out);
+}
+
+String Stream::readString() {
+    std::string out;
+    int c = timedRead();
+    while (c >= 0) {
+        out += (char)c;
+        c = timedRead();
+    }
+    return String(out);
+}
+
+bool Stream::find(const char* target) {
+    size_t len = strlen(target);
+    size_t matched = 0;
+    while (matched < len) {
+        int c = timedRead();
+        if (c < 0) return false;
+        matched = (c == target[matched]) ? matched + 1 : (c == target[0] ? 1 : 0);
+    }
+    return true;
+}
+
+long Stream::parseInt() {
+    int c;
+    do {
+        c = timedRead();
+    } while (c >= 0 && c != '-' && !isdigit(c));
+    bool negative = c == '-';
+    if (negative) c = timedRead();
+    long value = 0;
+    while (c >= 0 && isdigit(c)) {
+        value = value * 10 + (c - '0');
+        if (!isdigit(peek())) break;
+        c = timedRead();
+    }
+    return negative ? -value : value;
+}
+
+static bool serialEnabled() {
+    static bool enabled = getenv("HOST_SERIAL") && strcmp(getenv("HOST_SERIAL"), "0") != 0;
+    return enabled;
+}
+
+static std::mutex serialMutex;
+
+size_t HardwareSerial::write(uint8_t c) {
+    return write(&c, 1);
+}
+
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size) {
+    if (serialEnabled()) {
+        std::lock_guard<std::mutex> lock(serialMutex);
+        fwrite(buffer, 1, size, stdout);
+        fflush(stdout);
+    }
+    return size;
+}
+
+int HardwareSerial::available() { return 0; }
+int HardwareSerial::read() { return -1; }
+int HardwareSerial::peek() { return -1; }
+
+// ===== Tiempo =====
+
+static const std::chrono::steady_clock::time_point bootTime = std::chrono::steady_clock::now();
+
+int64_t esp_timer_get_time() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now() - bootTime).count();
+}
+
+unsigned long millis() {
+    return (unsigned long)(esp_timer_get_time() / 1000);
+}
+
+unsigned long micros() {
+    return (unsigned long)esp_timer_get_time();
+}
+
+void delay(unsigned long ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void delayMicroseconds(unsigned int us) {
+    std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+void yield() {
+    std::this_thread::yield();
+}
+
+static std::mutex clockMutex;
+static bool clockSet = false;
+static time_t clockEpoch = 0;
+static int64_t clockSetUs = 0;
+
+void hostSetTime(time_t epoch) {
+    std::lock_guard<std::mutex> lock(clockMutex);
+    clockSet = true;
+    clockEpoch = epoch;
+    clockSetUs = esp_timer_get_time();
+}
+
+void hostClearTime() {
+    std::lock_guard<std::mutex> lock(clockMutex);
+    clockSet = false;
+}
+
+bool getLocalTime(struct tm* info, uint32_t) {
+    time_t now;
+    {
+        std::lock_guard<std::mutex> lock(clockMutex);
+        if (!clockSet) return false;
+        now = clockEpoch + (time_t)((esp_timer_get_time() - clockSetUs) / 1000000);
+    }
+    gmtime_r(&now, info);
+    return true;
+}
+
+void configTime(long, int, const char*, const char*, const char*) {}
+
+// ===== GPIO =====
+
+static int pinValues[64];
+
+void pinMode(uint8_t, uint8_t) {}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+    if (pin < 64) pinValues[pin] = value;
+}
+
+int digitalRead(uint8_t pin) {
+    return pin < 64 ? pinValues[pin] : 0;
+}
+
+int hostPinValue(uint8_t pin) {
+    return digitalRead(pin);
+}
+
+long random(long max) {
+    return max > 0 ? random(0, max) : 0;
+}
+
+long random(long min, long max) {
+    static std::mt19937 generator(12345);
+    static std::mutex randomMutex;
+    if (max <= min) return min;
+    std::lock_guard<std::mutex> lock(randomMutex);
+    return min + (long)(generator() % (unsigned long)(max - min));
+}
+
+// ===== ESP =====
+
+static uint32_t restarts = 0;
+
+uint32_t EspClass::getFreeHeap() { return 180 * 1024; }
+uint32_t EspClass::getMinFreeHeap() { return 150 * 1024; }
+uint32_t EspClass::getHeapSize() { return 320 * 1024; }
+uint32_t EspClass::getMaxAllocHeap() { return 110 * 1024; }
+uint32_t EspClass::getPsramSize() { return 4 * 1024 * 1024; }
+uint32_t EspClass::getFreePsram() { return (uint32_t)heap_caps_get_free_size(MALLOC_CAP_SPIRAM); }
+uint32_t EspClass::getMaxAllocPsram() { return (uint32_t)heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM); }
+
+void EspClass::restart() {
+    restarts++;
+}
+
+uint32_t hostRestartCount() {
+    return restarts;
+}
@@ -0,0 +1,248 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+/*
+ * Arduino.h para el build del host: String, Print, Stream, Serial, tiempo y
+ * ESP con el comportamiento del core de ESP32 que usa el firmware. Los
+ * módulos se compilan sin cambios contra estas cabeceras (ver "Tests en la PC" en el README)
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <time.h>
+#include <math.h>
+#include <string>
+#include <algorithm>
+#include <functional>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+
+using std::min;
+using std::max;
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define PROGMEM
+#define F(x) (x)
+#define FPSTR(x) (x)
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+template <class T, class L, class H>
+T constrain(T value, L low, H high) {
+    return value < (T)low ? (T)low : (value > (T)high ? (T)high : value);
+}
+
+class String {
+public:
+    String() {}
+    String(const char* c) { if (c) s = c; }
+    String(const std::string& value) : s(value) {}
+    explicit String(char c) : s(1, c) {}
+    String(int value, unsigned char base = 10) { fromSigned(value, base); }
+    String(unsigned value, unsigned char base = 10) { fromUnsigned(value, base); }
+    String(long value, unsigned char base = 10) { fromSigned(value, base); }
+    String(unsigned long value, unsigned char base = 10) { fromUnsigned(value, base); }
+    String(long long value, unsigned char base = 10) { fromSigned(value, base); }
+    String(unsigned long long value, unsigned char base = 10) { fromUnsigned(value, base); }
+    String(float value, unsigned decimals = 2) { fromDouble(value, decimals); }
+    String(double value, unsigned decimals = 2) { fromDouble(value, decimals); }
+
+    const char* c_str() const { return s.c_str(); }
+    unsigned int length() const { return s.size(); }
+    bool isEmpty() const { return s.empty(); }
+    bool reserve(unsigned int size) { s.reserve(size); return true; }
+
+    String& operator+=(const String& o) { s += o.s; return *this; }
+    String& operator+=(const char* o) { if (o) s += o; return *this; }
+    String& operator+=(char o) { s += o; return *this; }
+    String& operator+=(int o) { return *this += String(o); }
+    String& operator+=(unsigned o) { return *this += String(o); }
+    String& operator+=(long o) { return *this += String(o); }
+    String& operator+=(unsigned long o) { return *this += String(o); }
+    bool concat(const String& o) { s += o.s; return true; }
+    bool concat(const char* o) { if (o) s += o; return true; }
+    bool concat(const char* o, unsigned int n) { s.append(o, n); return true; }
+    bool concat(char o) { s += o; return true; }
+    bool concat(int o) { return concat(String(o)); }
+    bool concat(unsigned o) { return concat(String(o)); }
+    bool concat(unsigned long o) { return concat(String(o)); }
+
+    friend String operator+(const String& a, const String& b) { return String(a.s + b.s); }
+    friend String operator+(const String& a, const char* b) { return String(a.s + (b ? b : "")); }
+    friend String operator+(const char* a, const String& b) { return String(std::string(a ? a : "") + b.s); }
+    friend String operator+(const String& a, char b) { return String(a.s + b); }
+    friend String operator+(const String& a, int b) { return a + String(b); }
+    friend String operator+(const String& a, unsigned b) { return a + String(b); }
+    friend String operator+(const String& a, long b) { return a + String(b); }
+    friend String operator+(const String& a, unsigned long b) { return a + String(b); }
+
+    bool operator==(const String& o) const { return s == o.s; }
+    bool operator!=(const String& o) const { return s != o.s; }
+    bool operator==(const char* o) const { return s == (o ? o : ""); }
+    bool operator!=(const char* o) const { return !(*this == o); }
+    bool operator<(const String& o) const { return s < o.s; }
+    bool operator>(const String& o) const { return s > o.s; }
+    bool operator<=(const String& o) const { return s <= o.s; }
+    bool operator>=(const String& o) const { return s >= o.s; }
+    int compareTo(const String& o) const { return s.compare(o.s); }
+    bool equals(const String& o) const { return s == o.s; }
+    bool equalsIgnoreCase(const String& o) const;
+
+    char operator[](unsigned int i) const { return i < s.size() ? s[i] : 0; }
+    char& operator[](unsigned int i) { return s[i]; }
+    char charAt(unsigned int i) const { return (*this)[i]; }
+    void setCharAt(unsigned int i, char c) { if (i < s.size()) s[i] = c; }
+
+    bool startsWith(const String& p) const { return s.compare(0, p.s.size(), p.s) == 0; }
+    bool startsWith(const String& p, unsigned int offset) const {
+        return offset <= s.size() && s.compare(offset, p.s.size(), p.s) == 0;
+    }
+    bool endsWith(const String& p) const {
+        return s.size() >= p.s.size() && s.compare(s.size() - p.s.size(), p.s.size(), p.s) == 0;
+    }
+    int indexOf(char c, unsigned int from = 0) const { return found(s.find(c, from)); }
+    int indexOf(const String& p, unsigned int from = 0) const { return found(s.find(p.s, from)); }
+    int lastIndexOf(char c) const { return found(s.rfind(c)); }
+    int lastIndexOf(char c, unsigned int from) const { return found(s.rfind(c, from)); }
+    int lastIndexOf(const String& p) const { return found(s.rfind(p.s)); }
+
+    String substring(unsigned int from) const { return from < s.size() ? String(s.substr(from)) : String(); }
+    String substring(unsigned int from, unsigned int to) const;
+
+    void trim();
+    void toLowerCase();
+    void toUpperCase();
+    void replace(char find, char replacement);
+    void replace(const String& find, const String& replacement);
+    void remove(unsigned int index) { if (index < s.size()) s.erase(index); }
+    void remove(unsigned int index, unsigned int count) { if (index < s.size()) s.erase(index, count); }
+
+    long toInt() const { return atol(s.c_str()); }
+    float toFloat() const { return (float)atof(s.c_str()); }
+    double toDouble() const { return atof(s.c_str()); }
+    void toCharArray(char* buf, unsigned int size, unsigned int index = 0) const { getBytes((unsigned char*)buf, size, index); }
+    void getBytes(unsigned char* buf, unsigned int size, unsigned int index = 0) const;
+
+    explicit operator bool() const { return true; }
+
+private:
+    std::string s;
+
+    static int found(size_t pos) { return pos == std::string::npos ? -1 : (int)pos; }
+    void fromSigned(long long value, unsigned char base);
+    void fromUnsigned(unsigned long long value, unsigned char base);
+    void fromDouble(double value, unsigned decimals);
+};
+
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size);
+    size_t write(const char* str) { return str ? write((const uint8_t*)str, strlen(str)) : 0; }
+    size_t write(const char* buffer, size_t size) { return write((const uint8_t*)buffer, size); }
+
+    size_t print(const String& s) { return write((const uint8_t*)s.c_str(), s.length()); }
+    size_t print(const char* s) { return write(s); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(int n, int base = 10) { return print(String(n, (unsigned char)base)); }
+    size_t print(unsigned n, int base = 10) { return print(String(n, (unsigned char)base)); }
+    size_t print(long n, int base = 10) { return print(String(n, (unsigned char)base)); }
+    size_t print(unsigned long n, int base = 10) { return print(String(n, (unsigned char)base)); }
+    size_t print(double n, int digits = 2) { return print(String(n, (unsigned)digits)); }
+
+    size_t println() { return print("\r\n"); }
+    template <typename T> size_t println(const T& value) { size_t n = print(value); return n + println(); }
+    template <typename T> size_t println(const T& value, int format) { size_t n = print(value, format); return n + println(); }
+
+    size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+    virtual void flush() {}
+};
+
+class Stream : public Print {
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+
+    void setTimeout(unsigned long timeout) { _timeout = timeout; }
+    unsigned long getTimeout() const { return _timeout; }
+
+    virtual size_t readBytes(char* buffer, size_t length);
+    size_t readBytes(uint8_t* buffer, size_t length) { return readBytes((char*)buffer, length); }
+    String readStringUntil(char terminator);
+    String readString();
+    bool find(const char* target);
+    long parseInt();
+
+protected:
+    unsigned long _timeout = 1000;
+    int timedRead();
+};
+
+// Monitor serie: stdout solo con HOST_SERIAL=1 (los tests quedan limpios)
+class HardwareSerial : public Stream {
+public:
+    void begin(unsigned long) {}
+    void setDebugOutput(bool) {}
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t* buffer, size_t size) override;
+    int available() override;
+    int read() override;
+    int peek() override;
+    operator bool() const { return true; }
+    using Print::write;
+};
+
+extern HardwareSerial Serial;
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+
+long random(long max);
+long random(long min, long max);
+
+bool psramFound();
+void* ps_malloc(size_t size);
+void* ps_calloc(size_t n, size_t size);
+void* ps_realloc(void* ptr, size_t size);
+
+class EspClass {
+public:
+    uint32_t getFreeHeap();
+    uint32_t getMinFreeHeap();
+    uint32_t getHeapSize();
+    uint32_t getMaxAllocHeap();
+    uint32_t getPsramSize();
+    uint32_t getFreePsram();
+    uint32_t getMaxAllocPsram();
+    void restart();
+};
+
+extern EspClass ESP;
+
+bool getLocalTime(struct tm* info, uint32_t ms = 5000);
+void configTime(long gmtOffset, int daylightOffset, const char* server1,
+                const char* server2 = nullptr, const char* server3 = nullptr);
+
+#endif // HOST_ARDUINO_H
@@ -0,0 +1,530 @@
+#ifndef HOST_ARDUINOJSON_H
+#define HOST_ARDUINOJSON_H
+
+// Subconjunto de ArduinoJson 6 que usan el firmware y la shim de Telegram:
+// documentos con
+// objetos y arreglos anidados, asignación de escalares y textos, as<T>(),
+// containsKey, serializeJson a String y deserializeJson desde String.
+// La capacidad de los documentos no se respeta (el árbol crece en el heap).
+
+#include <Arduino.h>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hostjson {
+
+struct Node {
+    enum Type { NUL, BOOL, INT, FLOAT, STRING, ARRAY, OBJECT } type = NUL;
+    bool b = false;
+    long long i = 0;
+    double f = 0;
+    std::string s;
+    std::vector<std::unique_ptr<Node>> items;   // Arreglo
+    std::vector<std::pair<std::string, std::unique_ptr<Node>>> members;  // Objeto
+
+    void clear() {
+        type = NUL;
+        s.clear();
+        items.clear();
+        members.clear();
+    }
+
+    Node* find(const std::string& key) const {
+        for (auto& m : members) {
+            if (m.first == key) return m.second.get();
+        }
+        return nullptr;
+    }
+
+    Node* member(const std::string& key) {
+        if (type != OBJECT) {
+            clear();
+            type = OBJECT;
+        }
+        Node* existing = find(key);
+        if (existing) return existing;
+        members.emplace_back(key, std::unique_ptr<Node>(new Node()));
+        return members.back().second.get();
+    }
+
+    Node* append() {
+        if (type != ARRAY) {
+            clear();
+            type = ARRAY;
+        }
+        items.emplace_back(new Node());
+        return items.back().get();
+    }
+
+    template <typename T>
+    void set(const T& value) {
+        clear();
+        if constexpr (std::is_same<T, bool>::value) {
+            type = BOOL;
+            b = value;
+        } else if constexpr (std::is_integral<T>::value || std::is_enum<T>::value) {
+            type = INT;
+            i = (long long)value;
+        } else if constexpr (std::is_floating_point<T>::value) {
+            type = FLOAT;
+            f = value;
+        } else if constexpr (std::is_same<T, String>::value) {
+            type = STRING;
+            s = value.c_str();
+        } else if constexpr (std::is_same<T, std::string>::value) {
+            type = STRING;
+            s = value;
+        } else {
+            static_assert(std::is_convertible<const T&, const char*>::value, "tipo no soportado");
+            const char* text = value;
+            if (text) {
+                type = STRING;
+                s = text;
+            }
+        }
+    }
+
+    template <typename T>
+    T as() const {
+        if constexpr (std::is_same<T, bool>::value) {
+            return type == BOOL ? b : type == INT ? i != 0 : type == FLOAT ? f != 0 : false;
+        } else if constexpr (std::is_integral<T>::value || std::is_enum<T>::value) {
+            return (T)(type == INT ? i : type == FLOAT ? (long long)f : type == BOOL ? (long long)b : 0);
+        } else if constexpr (std::is_floating_point<T>::value) {
+            return (T)(type == FLOAT ? f : type == INT ? (double)i : 0);
+        } else if constexpr (std::is_same<T, String>::value) {
+            if (type == STRING) return String(s.c_str());
+            if (type == NUL) return String("null");
+            std::string out;
+            write(out);
+            return String(out.c_str());
+        } else {
+            static_assert(std::is_same<T, const char*>::value, "tipo no soportado");
+            return type == STRING ? s.c_str() : nullptr;
+        }
+    }
+
+    static void writeString(std::string& out, const std::string& text) {
+        out += '"';
+        for (char c : text) {
+            switch (c) {
+                case '"': out += "\\\""; break;
+                case '\\': out += "\\\\"; break;
+                case '\n': out += "\\n"; break;
+                case '\r': out += "\\r"; break;
+                case '\t': out += "\\t"; break;
+                default:
+                    if ((uint8_t)c < 0x20) {
+                        char esc[8];
+                        snprintf(esc, sizeof(esc), "\\u%04x", c);
+                        out += esc;
+                    } else {
+                        out += c;
+                    }
+            }
+        }
+        out += '"';
+    }
+
+    void write(std::string& out) const {
+        char num[32];
+        switch (type) {
+            case NUL: out += "null"; break;
+            case BOOL: out += b ? "true" : "false"; break;
+            case INT:
+                snprintf(num, sizeof(num), "%lld", i);
+                out += num;
+                break;
+            case FLOAT:
+                snprintf(num, sizeof(num), "%.9g", f);
+                out += num;
+                break;
+            case STRING: writeString(out, s); break;
+            case ARRAY:
+                out += '[';
+                for (size_t n = 0; n < items.size(); n++) {
+                    if (n) out += ',';
+                    items[n]->write(out);
+                }
+                out += ']';
+                break;
+            case OBJECT:
+                out += '{';
+                for (size_t n = 0; n < members.size(); n++) {
+                    if (n) out += ',';
+                    writeString(out, members[n].first);
+                    out += ':';
+                    members[n].second->write(out);
+                }
+                out += '}';
+                break;
+        }
+    }
+};
+
+class Parser {
+public:
+    Parser(const char* text, size_t len) : p(text), end(text + len) {}
+
+    bool parse(Node& root) {
+        if (!value(root, 0)) return false;
+        space();
+        return p == end;
+    }
+
+private:
+    const char* p;
+    const char* end;
+
+    void space() {
+        while (p < end && (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r')) p++;
+    }
+
+    bool literal(const char* word) {
+        size_t n = strlen(word);
+        if ((size_t)(end - p) < n || strncmp(p, word, n) != 0) return false;
+        p += n;
+        return true;
+    }
+
+    bool string(std::string& out) {
+        if (p >= end || *p != '"') return false;
+        p++;
+        while (p < end && *p != '"') {
+            char c = *p++;
+            if (c != '\\') {
+                out += c;
+                continue;
+            }
+            if (p >= end) return false;
+            char e = *p++;
+            switch (e) {
+                case 'n': out += '\n'; break;
+                case 'r': out += '\r'; break;
+                case 't': out += '\t'; break;
+                case 'b': out += '\b'; break;
+                case 'f': out += '\f'; break;
+                case 'u': {
+                    if (end - p < 4) return false;
+                    unsigned cp = (unsigned)strtoul(std::string(p, 4).c_str(), nullptr, 16);
+                    p += 4;
+                    if (cp < 0x80) {
+                        out += (char)cp;
+                    } else if (cp < 0x800) {
+                        out += (char)(0xC0 | (cp >> 6));
+                        out += (char)(0x80 | (cp & 0x3F));
+                    } else {
+                        out += (char)(0xE0 | (cp >> 12));
+                        out += (char)(0x80 | ((cp >> 6) & 0x3F));
+                        out += (char)(0x80 | (cp & 0x3F));
+                    }
+                    break;
+                }
+                default: out += e;
+            }
+        }
+        if (p >= end) return false;
+        p++;
+        return true;
+    }
+
+    bool value(Node& node, int depth) {
+        if (depth > 10) return false;  // DEFAULT_NESTING_LIMIT de ArduinoJson
+        space();
+        if (p >= end) return false;
+        if (*p == '{') {
+            p++;
+            node.type = Node::OBJECT;
+            space();
+            if (p < end && *p == '}') {
+                p++;
+                return true;
+            }
+            for (;;) {
+                space();
+                std::string key;
+                if (!string(key)) return false;
+                space();
+                if (p >= end || *p++ != ':') return false;
+                if (!value(*node.member(key), depth + 1)) return false;
+                space();
+                if (p >= end) return false;
+                if (*p == ',') {
+                    p++;
+                    continue;
+                }
+                if (*p++ == '}') return true;
+                return false;
+            }
+        }
+        if (*p == '[') {
+            p++;
+            node.type = Node::ARRAY;
+            space();
+            if (p < end && *p == ']') {
+                p++;
+                return true;
+            }
+            for (;;) {
+                if (!value(*node.append(), depth + 1)) return false;
+                space();
+                if (p >= end) return false;
+                if (*p == ',') {
+                    p++;
+                    continue;
+                }
+                if (*p++ == ']') return true;
+                return false;
+            }
+        }
+        if (*p == '"') {
+            node.type = Node::STRING;
+            return string(node.s);
+        }
+        if (literal("true")) {
+            node.set(true);
+            return true;
+        }
+        if (literal("false")) {
+            node.set(false);
+            return true;
+        }
+        if (literal("null")) return true;
+
+        const char* start = p;
+        bool isFloat = false;
+        if (p < end && (*p == '-' || *p == '+')) p++;
+        while (p < end && ((*p >= '0' && *p <= '9') || *p == '.' || *p == 'e' || *p == 'E' || *p == '-' || *p == '+')) {
+            if (*p == '.' || *p == 'e' || *p == 'E') isFloat = true;
+            p++;
+        }
+        if (p == start) return false;
+        std::string number(start, p);
+        if (isFloat) {
+            node.set(strtod(number.c_str(), nullptr));
+        } else {
+            node.set(strtoll(number.c_str(), nullptr, 10));
+        }
+        return true;
+    }
+};
+
+}  // namespace hostjson
+
+class JsonObject;
+class JsonArray;
+
+// doc["clave"]: se crea al asignar, no al leer (containsKey sigue siendo exacto)
+class JsonVariant {
+public:
+    JsonVariant(hostjson::Node* parent, std::string key) : parent(parent), node(nullptr), key(std::move(key)) {}
+    explicit JsonVariant(hostjson::Node* node) : parent(nullptr), node(node) {}
+
+    template <typename T>
+    JsonVariant& operator=(const T& value) {
+        hostjson::Node* target = resolve(true);
+        if (target) target->set(value);
+        return *this;
+    }
+
+    template <typename T>
+    T as() const {
+        hostjson::Node* target = resolve(false);
+        if (!target) {
+            static const hostjson::Node empty;
+            return empty.as<T>();
+        }
+        return target->as<T>();
+    }
+
+    template <typename T, typename = typename std::enable_if<!std::is_same<T, String>::value>::type>
+    operator T() const {
+        return as<T>();
+    }
+    operator String() const { return as<String>(); }
+
+    bool isNull() const {
+        hostjson::Node* target = resolve(false);
+        return !target || target->type == hostjson::Node::NUL;
+    }
+
+    JsonVariant operator[](const char* name) const { return JsonVariant(resolve(true), name); }
+    JsonVariant operator[](const String& name) const { return JsonVariant(resolve(true), name.c_str()); }
+
+    bool operator==(const char* text) const { return as<String>() == text; }
+
+private:
+    hostjson::Node* parent;
+    mutable hostjson::Node* node;
+    std::string key;
+
+    hostjson::Node* resolve(bool create) const {
+        if (node) return node;
+        if (!parent) return nullptr;
+        hostjson::Node* found = parent->type == hostjson::Node::OBJECT ? parent->find(key) : nullptr;
+        if (!found && create) found = parent->member(key);
+        if (found) node = found;
+        return found;
+    }
+};
+
+class JsonObject {
+public:
+    JsonObject() : node(nullptr) {}
+    explicit JsonObject(hostjson::Node* node) : node(node) {}
+
+    JsonVariant operator[](const char* key) { return JsonVariant(node, key); }
+    JsonVariant operator[](const String& key) { return JsonVariant(node, key.c_str()); }
+    bool containsKey(const char* key) const { return node && node->find(key); }
+    JsonObject createNestedObject(const char* key) {
+        hostjson::Node* child = node->member(key);
+        child->clear();
+        child->type = hostjson::Node::OBJECT;
+        return JsonObject(child);
+    }
+    JsonArray createNestedArray(const char* key);
+    bool isNull() const { return !node; }
+
+private:
+    hostjson::Node* node;
+};
+
+class JsonArray {
+public:
+    JsonArray() : node(nullptr) {}
+    explicit JsonArray(hostjson::Node* node) : node(node) {}
+
+    template <typename T>
+    bool add(const T& value) {
+        node->append()->set(value);
+        return true;
+    }
+    JsonObject createNestedObject() {
+        hostjson::Node* child = node->append();
+        child->type = hostjson::Node::OBJECT;
+        return JsonObject(child);
+    }
+    JsonArray createNestedArray() {
+        hostjson::Node* child = node->append();
+        child->type = hostjson::Node::ARRAY;
+        return JsonArray(child);
+    }
+    size_t size() const { return node ? node->items.size() : 0; }
+    JsonVariant operator[](size_t index) const {
+        return JsonVariant(node && index < node->items.size() ? node->items[index].get() : nullptr);
+    }
+    bool isNull() const { return !node; }
+
+private:
+    hostjson::Node* node;
+};
+
+inline JsonArray JsonObject::createNestedArray(const char* key) {
+    hostjson::Node* child = node->member(key);
+    child->clear();
+    child->type = hostjson::Node::ARRAY;
+    return JsonArray(child);
+}
+
+class JsonDocument {
+public:
+    JsonVariant operator[](const char* key) { return JsonVariant(&root, key); }
+    JsonVariant operator[](const String& key) { return JsonVariant(&root, key.c_str()); }
+    bool containsKey(const char* key) const { return root.type == hostjson::Node::OBJECT && root.find(key); }
+    bool containsKey(const String& key) const { return containsKey(key.c_str()); }
+
+    JsonObject createNestedObject(const char* key) { return JsonObject(&root).createNestedObject(key); }
+    JsonArray createNestedArray(const char* key) { return JsonObject(&root).createNestedArray(key); }
+
+    template <typename T>
+    T to() {
+        root.clear();
+        if constexpr (std::is_same<T, JsonArray>::value) {
+            root.type = hostjson::Node::ARRAY;
+            return JsonArray(&root);
+        } else {
+            static_assert(std::is_same<T, JsonObject>::value, "tipo no soportado");
+            root.type = hostjson::Node::OBJECT;
+            return JsonObject(&root);
+        }
+    }
+
+    template <typename T>
+    T as() const {
+        return JsonVariant(const_cast<hostjson::Node*>(&root)).as<T>();
+    }
+
+    void clear() { root.clear(); }
+    bool isNull() const { return root.type == hostjson::Node::NUL; }
+
+    hostjson::Node root;
+};
+
+class DynamicJsonDocument : public JsonDocument {
+public:
+    explicit DynamicJsonDocument(size_t) {}
+};
+
+template <size_t N>
+class StaticJsonDocument : public JsonDocument {};
+
+class DeserializationError {
+public:
+    enum Code { Ok, EmptyInput, InvalidInput };
+
+    DeserializationError(Code code = Ok) : code(code) {}
+    explicit operator bool() const { return code != Ok; }
+    bool operator!() const { return code == Ok; }
+    const char* c_str() const {
+        return code == Ok ? "Ok" : code == EmptyInput ? "EmptyInput" : "InvalidInput";
+    }
+
+private:
+    Code code;
+};
+
+inline DeserializationError deserializeJson(JsonDocument& doc, const char* text, size_t len) {
+    doc.clear();
+    if (!text || len == 0) return DeserializationError::EmptyInput;
+    hostjson::Parser parser(text, len);
+    if (!parser.parse(doc.root)) {
+        doc.clear();
+        return DeserializationError::InvalidInput;
+    }
+    return DeserializationError::Ok;
+}
+
+inline DeserializationError deserializeJson(JsonDocument& doc, const String& text) {
+    return deserializeJson(doc, text.c_str(), text.length());
+}
+
+inline DeserializationError deserializeJson(JsonDocument& doc, const char* text) {
+    return deserializeJson(doc, text, text ? strlen(text) : 0);
+}
+
+inline size_t serializeJson(const JsonDocument& doc, String& output) {
+    std::string out;
+    doc.root.write(out);
+    output = String(out.c_str());
+    return out.size();
+}
+
+inline size_t serializeJson(const JsonDocument& doc, char* buffer, size_t size) {
+    std::string out;
+    doc.root.write(out);
+    if (size == 0) return 0;
+    size_t n = std::min(out.size(), size - 1);
+    memcpy(buffer, out.data(), n);
+    buffer[n] = '\0';
+    return n;
+}
+
+inline size_t measureJson(const JsonDocument& doc) {
+    std::string out;
+    doc.root.write(out);
+    return out.size();
+}
+
+#endif // HOST_ARDUINOJSON_H
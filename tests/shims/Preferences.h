@@ -0,0 +1,47 @@
+#ifndef HOST_PREFERENCES_H
+#define HOST_PREFERENCES_H
+
+// NVS en memoria; con hostPreferencesSetFile() cada cambio se guarda además
+// en un archivo y se carga de ahí (simula un reinicio de la placa)
+
+#include <Arduino.h>
+
+class Preferences {
+public:
+    bool begin(const char* name, bool readOnly = false);
+    void end();
+    bool clear();
+    bool remove(const char* key);
+    bool isKey(const char* key);
+
+    size_t putInt(const char* key, int32_t value);
+    size_t putUInt(const char* key, uint32_t value);
+    size_t putLong(const char* key, int32_t value);
+    size_t putULong(const char* key, uint32_t value);
+    size_t putBool(const char* key, bool value);
+    size_t putUChar(const char* key, uint8_t value);
+    size_t putString(const char* key, const String& value);
+
+    int32_t getInt(const char* key, int32_t defaultValue = 0);
+    uint32_t getUInt(const char* key, uint32_t defaultValue = 0);
+    int32_t getLong(const char* key, int32_t defaultValue = 0);
+    uint32_t getULong(const char* key, uint32_t defaultValue = 0);
+    bool getBool(const char* key, bool defaultValue = false);
+    uint8_t getUChar(const char* key, uint8_t defaultValue = 0);
+    String getString(const char* key, const String& defaultValue = String());
+
+private:
+    std::string space;
+    bool opened = false;
+    bool readOnly = false;
+
+    size_t put(const char* key, const std::string& value, size_t size);
+    bool get(const char* key, std::string& value);
+};
+
+// Borra todos los espacios (equivale a un nvs_flash_erase entre tests)
+void hostPreferencesReset();
+// Archivo de respaldo ("" = solo memoria); carga lo que ya tenga
+void hostPreferencesSetFile(const std::string& path);
+
+#endif // HOST_PREFERENCES_H
@@ -0,0 +1,42 @@
+#ifndef HOST_UNIVERSAL_TELEGRAM_BOT_H
+#define HOST_UNIVERSAL_TELEGRAM_BOT_H
+
+// Solo lo que usa el firmware: getUpdates, sendMessage y sendPhoto por
+// file_id, con peticiones HTTP reales por el cliente recibido
+
+#include <Arduino.h>
+#include <WiFiClientSecure.h>
+
+#define HOST_TELEGRAM_MAX_MESSAGES 8
+
+struct telegramMessage {
+    String text;
+    String chat_id;
+    String from_id;
+    String from_name;
+    String date;
+    String type;
+    int update_id = 0;
+};
+
+class UniversalTelegramBot {
+public:
+    UniversalTelegramBot(const String& token, WiFiClient& client);
+    // Mensajes de texto a partir de offset; retorna cuántos quedaron en messages
+    int getUpdates(long offset);
+    bool sendMessage(const String& chatId, const String& text, const String& parseMode = "");
+    String sendPhoto(const String& chatId, const String& photo, const String& caption = "");
+
+    telegramMessage messages[HOST_TELEGRAM_MAX_MESSAGES];
+    long last_message_received = 0;
+    long longPoll = 0;
+
+private:
+    String token;
+    WiFiClient* client;
+
+    String post(const char* method, const String& body);
+    String request(const String& head, const String& body);
+};
+
+#endif // HOST_UNIVERSAL_TELEGRAM_BOT_H
@@ -0,0 +1,90 @@
+#ifndef HOST_WEBSERVER_H
+#define HOST_WEBSERVER_H
+
+// WebServer de arduino-esp32 2.x sobre un socket real en 127.0.0.1 (puerto
+// efímero: hostWebServerPort()). Una petición por conexión con
+// "Connection: close", como el original; handleClient() no bloquea si no
+// hay conexiones pendientes.
+
+#include <Arduino.h>
+#include <FS.h>
+#include <WiFiClient.h>
+#include <functional>
+#include <vector>
+
+enum HTTPMethod { HTTP_DELETE = 0, HTTP_GET = 1, HTTP_HEAD = 2, HTTP_POST = 3, HTTP_PUT = 4, HTTP_ANY = 255 };
+
+#define CONTENT_LENGTH_UNKNOWN ((size_t)-1)
+#define CONTENT_LENGTH_NOT_SET ((size_t)-2)
+
+class WebServer {
+public:
+    typedef std::function<void(void)> THandlerFunction;
+
+    explicit WebServer(int port = 80);
+    ~WebServer();
+
+    void begin();
+    void close();
+    void handleClient();
+
+    void on(const String& uri, HTTPMethod method, THandlerFunction handler);
+    void on(const String& uri, THandlerFunction handler) { on(uri, HTTP_ANY, handler); }
+    void onNotFound(THandlerFunction handler);
+    void collectHeaders(const char* headerKeys[], size_t count);
+
+    String uri() const { return currentUri; }
+    HTTPMethod method() const { return currentMethod; }
+    WiFiClient& client() { return currentClient; }
+
+    String arg(const String& name) const;
+    bool hasArg(const String& name) const;
+    int args() const { return (int)argList.size(); }
+    String header(const String& name) const;
+    bool hasHeader(const String& name) const;
+
+    void send(int code, const char* contentType = nullptr, const String& content = String());
+    void send(int code, const String& contentType, const String& content) { send(code, contentType.c_str(), content); }
+    void send_P(int code, const char* contentType, const char* content, size_t length);
+    void sendHeader(const String& name, const String& value, bool first = false);
+    void setContentLength(size_t length) { contentLength = length; }
+    void sendContent(const String& content);
+    void sendContent(const char* content, size_t length);
+    size_t streamFile(fs::File& file, const String& contentType);
+
+private:
+    struct Route {
+        String uri;
+        HTTPMethod method;
+        THandlerFunction handler;
+    };
+
+    int port;
+    int listenFd;
+    std::vector<Route> routes;
+    THandlerFunction notFound;
+    std::vector<String> collected;
+
+    WiFiClient currentClient;
+    String currentUri;
+    HTTPMethod currentMethod;
+    std::vector<std::pair<String, String>> argList;
+    std::vector<std::pair<String, String>> headerList;
+    String responseHeaders;
+    size_t contentLength;
+    bool chunked;
+
+    bool readRequest();
+    void parseArgs(const String& data);
+    void writeHeader(int code, const char* contentType, size_t length);
+    void writeRaw(const char* data, size_t length);
+};
+
+// Puerto del último WebServer iniciado
+uint16_t hostWebServerPort();
+// SO_SNDBUF de las conexiones aceptadas desde ahora (0 = el del sistema).
+// lwip en la placa guarda unos pocos KB por socket; el de Linux absorbe
+// respuestas enteras de cientos de KB
+void hostSetWebServerSendBuffer(int bytes);
+
+#endif // HOST_WEBSERVER_H
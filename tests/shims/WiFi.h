@@ -0,0 +1,30 @@
+#ifndef HOST_WIFI_H
+#define HOST_WIFI_H
+
+#include <Arduino.h>
+#include "IPAddress.h"
+#include "WiFiClient.h"
+
+typedef enum { WL_IDLE_STATUS = 0, WL_NO_SSID_AVAIL = 1, WL_CONNECTED = 3, WL_DISCONNECTED = 6 } wl_status_t;
+typedef enum { WIFI_OFF = 0, WIFI_STA = 1, WIFI_AP = 2, WIFI_AP_STA = 3 } wifi_mode_t;
+
+// Siempre conectado a una red ficticia; setSleep() queda registrado para los tests
+class WiFiClass {
+public:
+    wl_status_t status() { return WL_CONNECTED; }
+    IPAddress localIP() { return IPAddress(192, 168, 1, 50); }
+    int8_t RSSI() { return -55; }
+    String SSID() { return "host"; }
+    bool mode(wifi_mode_t) { return true; }
+    void begin(const char*, const char* = nullptr) {}
+    bool disconnect(bool = false) { return true; }
+    bool setSleep(bool enabled) { sleeping = enabled; return true; }
+    bool getSleep() { return sleeping; }
+
+private:
+    bool sleeping = false;
+};
+
+extern WiFiClass WiFi;
+
+#endif // HOST_WIFI_H
@@ -0,0 +1,45 @@
+#ifndef HOST_WIFICLIENT_H
+#define HOST_WIFICLIENT_H
+
+// WiFiClient sobre un socket TCP real. Como en el core de ESP32 las copias
+// comparten el socket (se cierra al soltar la última) y stop() suelta la
+// referencia de esta copia
+
+#include <Arduino.h>
+#include <memory>
+#include "IPAddress.h"
+
+struct HostSocket;
+
+class WiFiClient : public Stream {
+public:
+    WiFiClient();
+    explicit WiFiClient(int fd);
+    virtual ~WiFiClient();
+
+    virtual int connect(const char* host, uint16_t port);
+    virtual int connect(const char* host, uint16_t port, int32_t timeoutMs);
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t* buf, size_t size) override;
+    int available() override;
+    int read() override;
+    virtual int read(uint8_t* buf, size_t size);
+    int peek() override;
+    size_t readBytes(char* buffer, size_t length) override;
+    virtual uint8_t connected();
+    virtual void stop();
+    int fd() const;
+    int setTimeout(uint32_t seconds);
+    int setNoDelay(bool nodelay);
+    int setSocketOption(int option, char* value, size_t len);
+    IPAddress remoteIP() const;
+    operator bool() { return connected(); }
+
+    using Print::write;
+
+protected:
+    std::shared_ptr<HostSocket> sock;
+    int connectTo(const char* host, uint16_t port, int32_t timeoutMs);
+};
+
+#endif // HOST_WIFICLIENT_H
@@ -0,0 +1,19 @@
+#ifndef HOST_WIFICLIENTSECURE_H
+#define HOST_WIFICLIENTSECURE_H
+
+// Sin TLS en el host: api.telegram.org:443 se conecta en claro al servidor
+// de prueba de hostSetTelegramPort()
+
+#include "WiFiClient.h"
+
+class WiFiClientSecure : public WiFiClient {
+public:
+    void setInsecure() {}
+    void setCACert(const char*) {}
+    void setHandshakeTimeout(unsigned long) {}
+    int connect(const char* host, uint16_t port) override;
+    int connect(const char* host, uint16_t port, int32_t timeoutMs) override;
+    int lastError(char* buf, size_t size);
+};
+
+#endif // HOST_WIFICLIENTSECURE_H
@@ -0,0 +1,324 @@
+#include <Arduino.h>
+#include "esp_camera.h"
+#include "esp_jpg_decode.h"
+#include "host.h"
+#include <chrono>
+#include <condition_variable>
+#include <dirent.h>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// ===== JPEG sintético =====
+
+// Escribe el JPEG en buf (hasta capacity bytes) sin reservar memoria: el
+// DMA simulado no debe sumar asignaciones a las del firmware
+static size_t makeJpegInto(uint8_t* buf, size_t capacity, int width, int height, size_t size, uint8_t fill) {
+    static const uint8_t head[] = {
+        0xFF, 0xD8,                                     // SOI
+        0xFF, 0xE0, 0x00, 0x10, 'J', 'F', 'I', 'F', 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00,
+        0xFF, 0xC0, 0x00, 0x11, 0x08, 0, 0, 0, 0,       // SOF0: alto y ancho en 25-28
+        0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11, 0x01,
+        0xFF, 0xDA, 0x00, 0x0C, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3F, 0x00,  // SOS
+    };
+    size_t total = max(size, sizeof(head) + 2);
+    if (total > capacity) return 0;
+    memcpy(buf, head, sizeof(head));
+    buf[25] = (uint8_t)(height >> 8);
+    buf[26] = (uint8_t)(height & 0xFF);
+    buf[27] = (uint8_t)(width >> 8);
+    buf[28] = (uint8_t)(width & 0xFF);
+    if (fill == 0xFF) fill = 0xFE;                  // Sin marcadores dentro de los datos
+    memset(buf + sizeof(head), fill, total - sizeof(head) - 2);
+    buf[total - 2] = 0xFF;                          // EOI
+    buf[total - 1] = 0xD9;
+    return total;
+}
+
+std::string hostMakeJpeg(int width, int height, size_t size, uint8_t fill) {
+    std::string jpeg(max(size, (size_t)64), '\0');
+    jpeg.resize(makeJpegInto((uint8_t*)&jpeg[0], jpeg.size(), width, height, size, fill));
+    return jpeg;
+}
+
+static bool jpegSize(const uint8_t* data, size_t len, int& width, int& height) {
+    for (size_t i = 2; i + 9 <= len; i++) {
+        if (data[i] == 0xFF && data[i + 1] >= 0xC0 && data[i + 1] <= 0xC3) {
+            height = (data[i + 5] << 8) | data[i + 6];
+            width = (data[i + 7] << 8) | data[i + 8];
+            return true;
+        }
+    }
+    return false;
+}
+
+// ===== Sensor y DMA =====
+
+enum BufferState { BUF_FREE, BUF_FILLING, BUF_READY, BUF_OUT };
+
+struct HostCamera {
+    std::mutex mutex;
+    std::condition_variable changed;
+    HostCameraConfig config = { 800, 600, 30 * 1024, 40000, "" };
+    bool running = false;
+    std::vector<camera_fb_t> fbs;
+    std::vector<BufferState> states;
+    std::vector<std::string> files;             // framesDir
+    size_t capacity = 0;
+    int ready = -1;
+    uint32_t captured = 0;
+    uint32_t taken = 0;
+    framesize_t framesize = FRAMESIZE_SVGA;
+    sensor_t sensor;
+};
+
+static HostCamera cam;
+
+static void framesizeDims(framesize_t size, int& width, int& height) {
+    static const int dims[][2] = {
+        { 96, 96 }, { 160, 120 }, { 176, 144 }, { 240, 176 }, { 240, 240 }, { 320, 240 },
+        { 400, 296 }, { 480, 320 }, { 640, 480 }, { 800, 600 }, { 1024, 768 }, { 1280, 720 },
+        { 1280, 1024 }, { 1600, 1200 },
+    };
+    int i = (size >= 0 && size < FRAMESIZE_INVALID) ? size : FRAMESIZE_SVGA;
+    width = dims[i][0];
+    height = dims[i][1];
+}
+
+void hostCameraConfigure(const HostCameraConfig& config) {
+    std::lock_guard<std::mutex> lock(cam.mutex);
+    cam.config = config;
+    cam.files.clear();
+    if (config.framesDir.empty()) return;
+
+    std::vector<std::string> names;
+    DIR* dir = opendir(config.framesDir.c_str());
+    struct dirent* entry;
+    while (dir && (entry = readdir(dir)) != nullptr) {
+        std::string name = entry->d_name;
+        if (name.size() > 4 && name.compare(name.size() - 4, 4, ".jpg") == 0) names.push_back(name);
+    }
+    if (dir) closedir(dir);
+    std::sort(names.begin(), names.end());
+    for (const std::string& name : names) {
+        FILE* f = fopen((config.framesDir + "/" + name).c_str(), "rb");
+        if (!f) continue;
+        std::string data;
+        char buf[4096];
+        size_t n;
+        while ((n = fread(buf, 1, sizeof(buf), f)) > 0) data.append(buf, n);
+        fclose(f);
+        cam.files.push_back(data);
+    }
+}
+
+uint32_t hostCameraFramesCaptured() {
+    std::lock_guard<std::mutex> lock(cam.mutex);
+    return cam.captured;
+}
+
+uint32_t hostCameraFramesTaken() {
+    std::lock_guard<std::mutex> lock(cam.mutex);
+    return cam.taken;
+}
+
+static int setFramesize(sensor_t* s, framesize_t size) {
+    std::lock_guard<std::mutex> lock(cam.mutex);
+    cam.framesize = size;
+    s->status.framesize = size;
+    int width, height;
+    framesizeDims(size, width, height);
+    cam.config.width = width;
+    cam.config.height = height;
+    return 0;
+}
+
+static int setQuality(sensor_t* s, int value) { s->status.quality = value; return 0; }
+static int setBrightness(sensor_t* s, int value) { s->status.brightness = value; return 0; }
+static int setContrast(sensor_t* s, int value) { s->status.contrast = value; return 0; }
+static int setSaturation(sensor_t* s, int value) { s->status.saturation = value; return 0; }
+static int setSpecialEffect(sensor_t* s, int value) { s->status.special_effect = value; return 0; }
+static int setWbMode(sensor_t* s, int value) { s->status.wb_mode = value; return 0; }
+static int setExposureCtrl(sensor_t* s, int value) { s->status.aec = value; return 0; }
+static int setAecValue(sensor_t* s, int value) { s->status.aec_value = value; return 0; }
+static int setGainCtrl(sensor_t* s, int value) { s->status.agc = value; return 0; }
+static int setAgcGain(sensor_t* s, int value) { s->status.agc_gain = value; return 0; }
+static int setFlip(sensor_t*, int) { return 0; }
+
+// Registros de exposición y ganancia estables: el AEC converge enseguida
+static int getReg(sensor_t*, int reg, int mask) {
+    switch (reg) {
+        case 0x145: return 0x01 & mask;
+        case 0x110: return 0x40 & mask;
+        case 0x104: return 0x02 & mask;
+        case 0x100: return 0x10 & mask;
+        default: return 0;
+    }
+}
+
+// Un frame cada readoutUs en el primer buffer libre (el DMA no espera a
+// nadie); con GRAB_LATEST el frame listo anterior vuelve a quedar libre
+static void dmaTask() {
+    uint32_t seq = 0;
+    for (;;) {
+        int index = -1;
+        HostCameraConfig config;
+        size_t fileIndex = 0;
+        bool useFiles = false;
+        {
+            std::unique_lock<std::mutex> lock(cam.mutex);
+            cam.changed.wait(lock, [] {
+                return std::find(cam.states.begin(), cam.states.end(), BUF_FREE) != cam.states.end();
+            });
+            index = (int)(std::find(cam.states.begin(), cam.states.end(), BUF_FREE) - cam.states.begin());
+            cam.states[index] = BUF_FILLING;
+            config = cam.config;
+            useFiles = !cam.files.empty();
+            if (useFiles) fileIndex = seq % cam.files.size();
+        }
+
+        std::this_thread::sleep_for(std::chrono::microseconds(config.readoutUs));
+
+        camera_fb_t& fb = cam.fbs[index];
+        if (useFiles) {
+            // cam.files no cambia mientras corre el DMA (se configura antes)
+            const std::string& file = cam.files[fileIndex];
+            fb.len = min(file.size(), cam.capacity);
+            memcpy(fb.buf, file.data(), fb.len);
+        } else {
+            fb.len = makeJpegInto(fb.buf, cam.capacity, config.width, config.height, config.jpegSize,
+                                  (uint8_t)(seq + 1));
+        }
+        int width = config.width;
+        int height = config.height;
+        jpegSize(fb.buf, fb.len, width, height);
+        fb.width = width;
+        fb.height = height;
+        int64_t now = esp_timer_get_time();
+        fb.timestamp.tv_sec = now / 1000000;
+        fb.timestamp.tv_usec = now % 1000000;
+        seq++;
+
+        std::lock_guard<std::mutex> lock(cam.mutex);
+        if (cam.ready >= 0) cam.states[cam.ready] = BUF_FREE;
+        cam.states[index] = BUF_READY;
+        cam.ready = index;
+        cam.captured++;
+        cam.changed.notify_all();
+    }
+}
+
+esp_err_t esp_camera_init(const camera_config_t* config) {
+    std::lock_guard<std::mutex> lock(cam.mutex);
+    if (cam.running) return ESP_OK;
+
+    int width, height;
+    framesizeDims(config->frame_size, width, height);
+    if (cam.config.framesDir.empty()) {
+        cam.config.width = width;
+        cam.config.height = height;
+    }
+    cam.framesize = config->frame_size;
+
+    cam.capacity = cam.config.jpegSize + 1024;
+    for (const std::string& file : cam.files) cam.capacity = max(cam.capacity, file.size());
+
+    size_t count = max((size_t)1, config->fb_count);
+    cam.fbs.assign(count, camera_fb_t());
+    cam.states.assign(count, BUF_FREE);
+    for (camera_fb_t& fb : cam.fbs) {
+        fb.buf = (uint8_t*)(config->fb_location == CAMERA_FB_IN_PSRAM ? ps_malloc(cam.capacity)
+                                                                      : malloc(cam.capacity));
+        fb.format = PIXFORMAT_JPEG;
+        if (!fb.buf) return ESP_FAIL;
+    }
+
+    memset(&cam.sensor, 0, sizeof(cam.sensor));
+    cam.sensor.id.PID = OV2640_PID;
+    cam.sensor.status.framesize = config->frame_size;
+    cam.sensor.status.quality = config->jpeg_quality;
+    cam.sensor.set_framesize = setFramesize;
+    cam.sensor.set_quality = setQuality;
+    cam.sensor.set_brightness = setBrightness;
+    cam.sensor.set_contrast = setContrast;
+    cam.sensor.set_saturation = setSaturation;
+    cam.sensor.set_special_effect = setSpecialEffect;
+    cam.sensor.set_wb_mode = setWbMode;
+    cam.sensor.set_exposure_ctrl = setExposureCtrl;
+    cam.sensor.set_aec_value = setAecValue;
+    cam.sensor.set_gain_ctrl = setGainCtrl;
+    cam.sensor.set_agc_gain = setAgcGain;
+    cam.sensor.set_vflip = setFlip;
+    cam.sensor.set_hmirror = setFlip;
+    cam.sensor.get_reg = getReg;
+
+    cam.running = true;
+    std::thread(dmaTask).detach();
+    return ESP_OK;
+}
+
+esp_err_t esp_camera_deinit() {
+    return ESP_OK;
+}
+
+camera_fb_t* esp_camera_fb_get() {
+    std::unique_lock<std::mutex> lock(cam.mutex);
+    if (!cam.running) return nullptr;
+    // El driver corta a los pocos segundos sin frames del sensor
+    if (!cam.changed.wait_for(lock, std::chrono::seconds(3), [] { return cam.ready >= 0; })) {
+        return nullptr;
+    }
+    int index = cam.ready;
+    cam.ready = -1;
+    cam.states[index] = BUF_OUT;
+    cam.taken++;
+    return &cam.fbs[index];
+}
+
+void esp_camera_fb_return(camera_fb_t* fb) {
+    std::lock_guard<std::mutex> lock(cam.mutex);
+    for (size_t i = 0; i < cam.fbs.size(); i++) {
+        if (&cam.fbs[i] == fb && cam.states[i] == BUF_OUT) {
+            cam.states[i] = BUF_FREE;
+            cam.changed.notify_all();
+            return;
+        }
+    }
+}
+
+sensor_t* esp_camera_sensor_get() {
+    return cam.running ? &cam.sensor : nullptr;
+}
+
+// ===== Miniaturas =====
+
+esp_err_t esp_jpg_decode(size_t len, jpg_scale_t scale, jpg_reader_cb reader, jpg_writer_cb writer, void* arg) {
+    std::vector<uint8_t> data(len);
+    if (reader(arg, 0, data.data(), len) != len) return ESP_FAIL;
+    int width, height;
+    if (len < 4 || data[0] != 0xFF || data[1] != 0xD8 || !jpegSize(data.data(), len, width, height)) {
+        return ESP_FAIL;
+    }
+
+    uint16_t w = (uint16_t)(width >> scale);
+    uint16_t h = (uint16_t)(height >> scale);
+    if (!writer(arg, 0, 0, w, h, nullptr)) return ESP_FAIL;
+    std::vector<uint8_t> block((size_t)w * 8 * 3, 0x80);
+    for (uint16_t y = 0; y < h; y += 8) {
+        uint16_t rows = min((uint16_t)8, (uint16_t)(h - y));
+        if (!writer(arg, 0, y, w, rows, block.data())) return ESP_FAIL;
+    }
+    writer(arg, w, h, 0, 0, nullptr);
+    return ESP_OK;
+}
+
+bool fmt2jpg(uint8_t* src, size_t srcLen, uint16_t width, uint16_t height, pixformat_t,
+             uint8_t, uint8_t** out, size_t* outLen) {
+    if (!src || srcLen < (size_t)width * height * 3) return false;
+    std::string jpeg = hostMakeJpeg(width, height, max((size_t)256, (size_t)width * height / 8), 0x42);
+    *out = (uint8_t*)malloc(jpeg.size());
+    if (!*out) return false;
+    memcpy(*out, jpeg.data(), jpeg.size());
+    *outLen = jpeg.size();
+    return true;
+}
@@ -0,0 +1,242 @@
+#include <Arduino.h>
+#include "soc/soc_memory_layout.h"
+#include "host.h"
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <sys/socket.h>
+
+// ===== Contadores de memoria =====
+// new/delete se reemplazan aquí; malloc/calloc/realloc/free se envuelven con
+// -Wl,--wrap (solo las llamadas del firmware y de los tests, no las de libc)
+
+extern "C" void* __real_malloc(size_t size);
+extern "C" void* __real_calloc(size_t n, size_t size);
+extern "C" void* __real_realloc(void* ptr, size_t size);
+extern "C" void __real_free(void* ptr);
+
+static std::atomic<uint64_t> allocCount(0);
+static std::atomic<uint64_t> allocBytes(0);
+
+static void countAllocation(size_t size) {
+    allocCount.fetch_add(1, std::memory_order_relaxed);
+    allocBytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+HostAllocStats hostAllocStats() {
+    HostAllocStats stats;
+    stats.allocations = allocCount.load();
+    stats.bytes = allocBytes.load();
+    return stats;
+}
+
+void* operator new(size_t size) {
+    countAllocation(size);
+    void* ptr = __real_malloc(size ? size : 1);
+    if (!ptr) throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    countAllocation(size);
+    return __real_malloc(size ? size : 1);
+}
+
+void* operator new[](size_t size, const std::nothrow_t& tag) noexcept {
+    return operator new(size, tag);
+}
+
+void operator delete(void* ptr) noexcept { __real_free(ptr); }
+void operator delete[](void* ptr) noexcept { __real_free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { __real_free(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { __real_free(ptr); }
+
+// ===== PSRAM simulada =====
+// Tabla fija (sin reservar memoria para llevar la cuenta)
+
+#define HOST_PSRAM_BLOCKS 4096
+
+struct PsramBlock {
+    void* ptr;
+    size_t size;
+};
+
+static std::mutex psramMutex;
+static PsramBlock psramBlocks[HOST_PSRAM_BLOCKS];
+static size_t psramCapacity = 4 * 1024 * 1024 - 512 * 1024;  // Lo que deja libre el core
+static size_t psramUsed = 0;
+
+void hostSetPsramFree(size_t bytes) {
+    std::lock_guard<std::mutex> lock(psramMutex);
+    psramCapacity = psramUsed + bytes;
+}
+
+static void* psramAlloc(size_t size) {
+    std::lock_guard<std::mutex> lock(psramMutex);
+    if (psramUsed + size > psramCapacity) return nullptr;
+    for (int i = 0; i < HOST_PSRAM_BLOCKS; i++) {
+        if (!psramBlocks[i].ptr) {
+            void* ptr = __real_malloc(size ? size : 1);
+            if (!ptr) return nullptr;
+            psramBlocks[i] = { ptr, size };
+            psramUsed += size;
+            countAllocation(size);
+            return ptr;
+        }
+    }
+    return nullptr;
+}
+
+static int psramFind(const void* ptr) {
+    for (int i = 0; ptr && i < HOST_PSRAM_BLOCKS; i++) {
+        if (psramBlocks[i].ptr == ptr) return i;
+    }
+    return -1;
+}
+
+static bool psramRelease(void* ptr) {
+    std::lock_guard<std::mutex> lock(psramMutex);
+    int i = psramFind(ptr);
+    if (i < 0) return false;
+    psramUsed -= psramBlocks[i].size;
+    psramBlocks[i] = { nullptr, 0 };
+    return true;
+}
+
+bool esp_ptr_external_ram(const void* ptr) {
+    std::lock_guard<std::mutex> lock(psramMutex);
+    int i = psramFind(ptr);
+    if (i >= 0) return true;
+    // También punteros dentro de un bloque (slots del anillo de pre-roll)
+    for (int b = 0; b < HOST_PSRAM_BLOCKS; b++) {
+        const uint8_t* base = (const uint8_t*)psramBlocks[b].ptr;
+        if (base && (const uint8_t*)ptr >= base && (const uint8_t*)ptr < base + psramBlocks[b].size) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool esp_ptr_dma_capable(const void* ptr) {
+    return !esp_ptr_external_ram(ptr);
+}
+
+extern "C" void* __wrap_malloc(size_t size) {
+    countAllocation(size);
+    return __real_malloc(size);
+}
+
+extern "C" void* __wrap_calloc(size_t n, size_t size) {
+    countAllocation(n * size);
+    return __real_calloc(n, size);
+}
+
+extern "C" void* __wrap_realloc(void* ptr, size_t size) {
+    countAllocation(size);
+    std::lock_guard<std::mutex> lock(psramMutex);
+    int i = psramFind(ptr);
+    if (i < 0) return __real_realloc(ptr, size);
+    if (psramUsed - psramBlocks[i].size + size > psramCapacity) return nullptr;
+    void* moved = __real_realloc(ptr, size);
+    if (moved) {
+        psramUsed = psramUsed - psramBlocks[i].size + size;
+        psramBlocks[i] = { moved, size };
+    }
+    return moved;
+}
+
+extern "C" void __wrap_free(void* ptr) {
+    if (!ptr) return;
+    psramRelease(ptr);
+    __real_free(ptr);
+}
+
+void* heap_caps_malloc(size_t size, uint32_t caps) {
+    if (caps & MALLOC_CAP_SPIRAM) return psramAlloc(size);
+    countAllocation(size);
+    return __real_malloc(size);
+}
+
+void* heap_caps_calloc(size_t n, size_t size, uint32_t caps) {
+    void* ptr = heap_caps_malloc(n * size, caps);
+    if (ptr) memset(ptr, 0, n * size);
+    return ptr;
+}
+
+void* heap_caps_realloc(void* ptr, size_t size, uint32_t caps) {
+    if (!ptr) return heap_caps_malloc(size, caps);
+    return __wrap_realloc(ptr, size);
+}
+
+void heap_caps_free(void* ptr) {
+    __wrap_free(ptr);
+}
+
+size_t heap_caps_get_free_size(uint32_t caps) {
+    if (caps & MALLOC_CAP_SPIRAM) {
+        std::lock_guard<std::mutex> lock(psramMutex);
+        return psramCapacity - psramUsed;
+    }
+    return ESP.getFreeHeap();
+}
+
+size_t heap_caps_get_largest_free_block(uint32_t caps) {
+    if (caps & MALLOC_CAP_SPIRAM) return heap_caps_get_free_size(caps);
+    return ESP.getMaxAllocHeap();
+}
+
+size_t heap_caps_get_minimum_free_size(uint32_t caps) {
+    return heap_caps_get_free_size(caps);
+}
+
+void heap_caps_get_info(multi_heap_info_t* info, uint32_t caps) {
+    memset(info, 0, sizeof(*info));
+    info->total_free_bytes = heap_caps_get_free_size(caps);
+    info->largest_free_block = heap_caps_get_largest_free_block(caps);
+    info->minimum_free_bytes = info->total_free_bytes;
+    info->allocated_blocks = (size_t)allocCount.load();
+}
+
+bool psramFound() {
+    return true;
+}
+
+void* ps_malloc(size_t size) {
+    return psramAlloc(size);
+}
+
+void* ps_calloc(size_t n, size_t size) {
+    void* ptr = psramAlloc(n * size);
+    if (ptr) memset(ptr, 0, n * size);
+    return ptr;
+}
+
+void* ps_realloc(void* ptr, size_t size) {
+    if (!ptr) return psramAlloc(size);
+    return __wrap_realloc(ptr, size);
+}
+
+// ===== Llamadas al sistema de los sockets =====
+
+static std::atomic<uint64_t> sendCalls(0);
+
+uint64_t hostSendCalls() {
+    return sendCalls.load();
+}
+
+extern "C" ssize_t __real_send(int fd, const void* buf, size_t len, int flags);
+extern "C" ssize_t __real_sendmsg(int fd, const struct msghdr* msg, int flags);
+
+extern "C" ssize_t __wrap_send(int fd, const void* buf, size_t len, int flags) {
+    sendCalls++;
+    return __real_send(fd, buf, len, flags | MSG_NOSIGNAL);
+}
+
+extern "C" ssize_t __wrap_sendmsg(int fd, const struct msghdr* msg, int flags) {
+    sendCalls++;
+    return __real_sendmsg(fd, msg, flags | MSG_NOSIGNAL);
+}
@@ -0,0 +1,277 @@
+#include "FS.h"
+#include "SD_MMC.h"
+#include "host.h"
+#include <atomic>
+#include <dirent.h>
+#include <ftw.h>
+#include <mutex>
+#include <sys/stat.h>
+#include <unistd.h>
+
+SDMMCFS SD_MMC;
+
+static std::string sdRoot;
+static std::string mountPoint = "/sdcard";
+
+void hostSdSetRoot(const std::string& dir) {
+    sdRoot = dir;
+}
+
+const std::string& hostSdRoot() {
+    return sdRoot;
+}
+
+std::string hostMakeTempDir(const char* tag) {
+    std::string pattern = std::string("/tmp/host_") + tag + "_XXXXXX";
+    char buf[256];
+    snprintf(buf, sizeof(buf), "%s", pattern.c_str());
+    return mkdtemp(buf) ? std::string(buf) : std::string();
+}
+
+static int removeEntry(const char* path, const struct stat*, int, struct FTW*) {
+    return ::remove(path);
+}
+
+void hostRemoveTree(const std::string& dir) {
+    if (!dir.empty()) nftw(dir.c_str(), removeEntry, 16, FTW_DEPTH | FTW_PHYS);
+}
+
+static std::atomic<uint64_t> sdOpens(0);
+static std::atomic<uint64_t> sdDirEntries(0);
+static std::atomic<uint64_t> sdBytesRead(0);
+static std::atomic<uint64_t> sdBytesWritten(0);
+
+HostSdStats hostSdStats() {
+    HostSdStats stats;
+    stats.opens = sdOpens.load();
+    stats.dirEntries = sdDirEntries.load();
+    stats.bytesRead = sdBytesRead.load();
+    stats.bytesWritten = sdBytesWritten.load();
+    return stats;
+}
+
+static std::string hostPath(const char* path) {
+    std::string p = path ? path : "";
+    if (p.empty() || p[0] != '/') p = "/" + p;
+    while (p.size() > 1 && p.back() == '/') p.pop_back();
+    return sdRoot + (p == "/" ? "" : p);
+}
+
+// truncate() del firmware usa la ruta VFS (/sdcard/...): se lleva a la raíz
+extern "C" int __real_truncate(const char* path, off_t length);
+extern "C" int __wrap_truncate(const char* path, off_t length) {
+    std::string p = path;
+    if (p.compare(0, mountPoint.size(), mountPoint) == 0) {
+        return __real_truncate(hostPath(p.substr(mountPoint.size()).c_str()).c_str(), length);
+    }
+    return __real_truncate(path, length);
+}
+
+namespace fs {
+
+struct FileImpl {
+    FILE* file = nullptr;
+    DIR* dir = nullptr;
+    std::string path;           // Ruta en la SD ("/carpeta/foto.jpg")
+    std::string name;           // Último componente
+
+    ~FileImpl() {
+        if (file) fclose(file);
+        if (dir) closedir(dir);
+    }
+};
+
+static std::shared_ptr<FileImpl> openImpl(const std::string& path, const char* mode) {
+    std::string real = hostPath(path.c_str());
+    struct stat st;
+    sdOpens++;
+    auto impl = std::make_shared<FileImpl>();
+    impl->path = path.empty() ? "/" : path;
+    size_t slash = impl->path.find_last_of('/');
+    impl->name = impl->path.substr(slash + 1);
+
+    if (stat(real.c_str(), &st) == 0 && S_ISDIR(st.st_mode)) {
+        impl->dir = opendir(real.c_str());
+        return impl->dir ? impl : nullptr;
+    }
+
+    std::string m = mode ? mode : "r";
+    if (m.find('b') == std::string::npos) m += "b";
+    impl->file = fopen(real.c_str(), m.c_str());
+    return impl->file ? impl : nullptr;
+}
+
+size_t File::write(uint8_t c) {
+    return write(&c, 1);
+}
+
+size_t File::write(const uint8_t* buf, size_t size) {
+    if (!impl || !impl->file) return 0;
+    size_t written = fwrite(buf, 1, size, impl->file);
+    sdBytesWritten += written;
+    return written;
+}
+
+int File::available() {
+    if (!impl || !impl->file) return 0;
+    return (int)(size() - position());
+}
+
+int File::read() {
+    if (!impl || !impl->file) return -1;
+    int c = fgetc(impl->file);
+    return c == EOF ? -1 : c;
+}
+
+int File::peek() {
+    if (!impl || !impl->file) return -1;
+    int c = fgetc(impl->file);
+    if (c == EOF) return -1;
+    ungetc(c, impl->file);
+    return c;
+}
+
+void File::flush() {
+    if (impl && impl->file) fflush(impl->file);
+}
+
+size_t File::read(uint8_t* buf, size_t size) {
+    if (!impl || !impl->file) return 0;
+    size_t count = fread(buf, 1, size, impl->file);
+    sdBytesRead += count;
+    return count;
+}
+
+bool File::seek(uint32_t pos, SeekMode mode) {
+    if (!impl || !impl->file) return false;
+    int whence = mode == SeekSet ? SEEK_SET : (mode == SeekCur ? SEEK_CUR : SEEK_END);
+    return fseek(impl->file, (long)pos, whence) == 0;
+}
+
+size_t File::position() const {
+    if (!impl || !impl->file) return 0;
+    long pos = ftell(impl->file);
+    return pos < 0 ? 0 : (size_t)pos;
+}
+
+size_t File::size() const {
+    if (!impl || !impl->file) return 0;
+    fflush(impl->file);
+    struct stat st;
+    return fstat(fileno(impl->file), &st) == 0 ? (size_t)st.st_size : 0;
+}
+
+void File::close() {
+    if (!impl) return;
+    if (impl->file) {
+        fclose(impl->file);
+        impl->file = nullptr;
+    }
+    if (impl->dir) {
+        closedir(impl->dir);
+        impl->dir = nullptr;
+    }
+    impl.reset();
+}
+
+File::operator bool() const {
+    return impl && (impl->file || impl->dir);
+}
+
+time_t File::getLastWrite() {
+    if (!impl) return 0;
+    struct stat st;
+    if (impl->file) fflush(impl->file);
+    return stat(hostPath(impl->path.c_str()).c_str(), &st) == 0 ? st.st_mtime : 0;
+}
+
+const char* File::path() const {
+    return impl ? impl->path.c_str() : nullptr;
+}
+
+const char* File::name() const {
+    return impl ? impl->name.c_str() : nullptr;
+}
+
+bool File::isDirectory() {
+    return impl && impl->dir;
+}
+
+File File::openNextFile(const char* mode) {
+    if (!impl || !impl->dir) return File();
+    struct dirent* entry;
+    while ((entry = readdir(impl->dir)) != nullptr) {
+        if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) continue;
+        sdDirEntries++;
+        std::string child = (impl->path == "/" ? "" : impl->path) + "/" + entry->d_name;
+        return File(openImpl(child, mode));
+    }
+    return File();
+}
+
+void File::rewindDirectory() {
+    if (impl && impl->dir) rewinddir(impl->dir);
+}
+
+File FS::open(const char* path, const char* mode, bool) {
+    if (sdRoot.empty() || !path) return File();
+    return File(openImpl(path, mode));
+}
+
+bool FS::exists(const char* path) {
+    struct stat st;
+    return !sdRoot.empty() && stat(hostPath(path).c_str(), &st) == 0;
+}
+
+bool FS::remove(const char* path) {
+    return !sdRoot.empty() && unlink(hostPath(path).c_str()) == 0;
+}
+
+bool FS::rename(const char* from, const char* to) {
+    return !sdRoot.empty() && ::rename(hostPath(from).c_str(), hostPath(to).c_str()) == 0;
+}
+
+bool FS::mkdir(const char* path) {
+    return !sdRoot.empty() && ::mkdir(hostPath(path).c_str(), 0755) == 0;
+}
+
+bool FS::rmdir(const char* path) {
+    return !sdRoot.empty() && ::rmdir(hostPath(path).c_str()) == 0;
+}
+
+}  // namespace fs
+
+bool SDMMCFS::begin(const char* mountpoint, bool, bool, int, uint8_t) {
+    mountPoint = mountpoint ? mountpoint : "/sdcard";
+    struct stat st;
+    return !sdRoot.empty() && stat(sdRoot.c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+}
+
+void SDMMCFS::end() {}
+
+sdcard_type_t SDMMCFS::cardType() {
+    return sdRoot.empty() ? CARD_NONE : CARD_SDHC;
+}
+
+uint64_t SDMMCFS::cardSize() {
+    return 16ULL * 1024 * 1024 * 1024;
+}
+
+uint64_t SDMMCFS::totalBytes() {
+    return 15ULL * 1024 * 1024 * 1024;
+}
+
+static uint64_t usedTotal = 0;
+
+static int addSize(const char*, const struct stat* st, int type, struct FTW*) {
+    if (type == FTW_F) usedTotal += (uint64_t)st->st_size;
+    return 0;
+}
+
+uint64_t SDMMCFS::usedBytes() {
+    static std::mutex usedMutex;
+    std::lock_guard<std::mutex> lock(usedMutex);
+    usedTotal = 0;
+    if (!sdRoot.empty()) nftw(sdRoot.c_str(), addSize, 16, FTW_PHYS);
+    return usedTotal;
+}
@@ -0,0 +1,72 @@
+#ifndef HOST_H
+#define HOST_H
+
+/*
+ * Control de las shims desde los tests: carpeta que hace de tarjeta SD,
+ * hora local, cámara simulada, servidor que responde por api.telegram.org
+ * y contadores de memoria y de llamadas al sistema
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <time.h>
+#include <string>
+
+// ===== SD =====
+// Carpeta que hace de raíz de SD_MMC (y de /sdcard para truncate())
+void hostSdSetRoot(const std::string& dir);
+const std::string& hostSdRoot();
+// Carpeta temporal vacía para un test; se borra con hostRemoveTree()
+std::string hostMakeTempDir(const char* tag);
+void hostRemoveTree(const std::string& dir);
+// Operaciones sobre la SD desde el arranque (aperturas, entradas de
+// directorio recorridas y bytes leídos/escritos)
+struct HostSdStats {
+    uint64_t opens;
+    uint64_t dirEntries;
+    uint64_t bytesRead;
+    uint64_t bytesWritten;
+};
+HostSdStats hostSdStats();
+
+// ===== Hora =====
+// getLocalTime() devuelve false hasta que se fija la hora (sin NTP)
+void hostSetTime(time_t epoch);
+void hostClearTime();
+
+// ===== Memoria =====
+// Bloques pedidos con malloc/new/heap_caps_malloc desde el arranque
+struct HostAllocStats {
+    uint64_t allocations;
+    uint64_t bytes;
+};
+HostAllocStats hostAllocStats();
+// PSRAM libre que informan heap_caps_get_free_size/largest_free_block
+void hostSetPsramFree(size_t bytes);
+
+// ===== Sockets =====
+// Llamadas a send()/sendmsg()/write() sobre sockets (build con --wrap)
+uint64_t hostSendCalls();
+// connect() a api.telegram.org:443 va a 127.0.0.1:port (sin TLS)
+void hostSetTelegramPort(uint16_t port);
+
+// ===== Cámara =====
+struct HostCameraConfig {
+    int width;
+    int height;
+    size_t jpegSize;            // Tamaño de los JPEG sintéticos
+    uint32_t readoutUs;         // Lectura del sensor por frame (tiempo de DMA)
+    std::string framesDir;      // Si no está vacío se repiten sus .jpg en orden
+};
+void hostCameraConfigure(const HostCameraConfig& config);
+uint32_t hostCameraFramesCaptured();
+// Frames entregados por esp_camera_fb_get() (capturas que pidió el firmware)
+uint32_t hostCameraFramesTaken();
+// JPEG mínimo válido (SOI, SOF0 con el tamaño, relleno y EOI)
+std::string hostMakeJpeg(int width, int height, size_t size, uint8_t fill);
+
+// ===== GPIO y sistema =====
+int hostPinValue(uint8_t pin);
+uint32_t hostRestartCount();
+
+#endif // HOST_H
@@ -0,0 +1,157 @@
+#include <Preferences.h>
+#include <fstream>
+#include <map>
+#include <mutex>
+
+static std::mutex storeMutex;
+static std::map<std::string, std::map<std::string, std::string>> store;
+static std::string storeFile;
+
+// Una línea por clave: espacio, clave y valor separados por tabuladores
+static std::string escape(const std::string& text) {
+    std::string out;
+    for (char c : text) {
+        if (c == '\\') out += "\\\\";
+        else if (c == '\n') out += "\\n";
+        else if (c == '\t') out += "\\t";
+        else out += c;
+    }
+    return out;
+}
+
+static std::string unescape(const std::string& text) {
+    std::string out;
+    for (size_t i = 0; i < text.size(); i++) {
+        if (text[i] == '\\' && i + 1 < text.size()) {
+            char c = text[++i];
+            out += c == 'n' ? '\n' : c == 't' ? '\t' : c;
+        } else {
+            out += text[i];
+        }
+    }
+    return out;
+}
+
+static void saveStore() {
+    if (storeFile.empty()) return;
+    std::ofstream out(storeFile, std::ios::trunc);
+    for (auto& ns : store) {
+        for (auto& kv : ns.second) {
+            out << escape(ns.first) << '\t' << escape(kv.first) << '\t' << escape(kv.second) << '\n';
+        }
+    }
+}
+
+void hostPreferencesReset() {
+    std::lock_guard<std::mutex> lock(storeMutex);
+    store.clear();
+    saveStore();
+}
+
+void hostPreferencesSetFile(const std::string& path) {
+    std::lock_guard<std::mutex> lock(storeMutex);
+    storeFile = path;
+    store.clear();
+    std::ifstream in(path);
+    std::string line;
+    while (std::getline(in, line)) {
+        size_t a = line.find('\t');
+        size_t b = a == std::string::npos ? a : line.find('\t', a + 1);
+        if (b == std::string::npos) continue;
+        store[unescape(line.substr(0, a))][unescape(line.substr(a + 1, b - a - 1))] = unescape(line.substr(b + 1));
+    }
+}
+
+bool Preferences::begin(const char* name, bool ro) {
+    space = name ? name : "";
+    readOnly = ro;
+    opened = !space.empty();
+    return opened;
+}
+
+void Preferences::end() {
+    opened = false;
+}
+
+bool Preferences::clear() {
+    if (!opened || readOnly) return false;
+    std::lock_guard<std::mutex> lock(storeMutex);
+    store[space].clear();
+    saveStore();
+    return true;
+}
+
+bool Preferences::remove(const char* key) {
+    if (!opened || readOnly) return false;
+    std::lock_guard<std::mutex> lock(storeMutex);
+    bool removed = store[space].erase(key) > 0;
+    saveStore();
+    return removed;
+}
+
+bool Preferences::isKey(const char* key) {
+    std::string value;
+    return get(key, value);
+}
+
+size_t Preferences::put(const char* key, const std::string& value, size_t size) {
+    if (!opened || readOnly || !key) return 0;
+    std::lock_guard<std::mutex> lock(storeMutex);
+    store[space][key] = value;
+    saveStore();
+    return size;
+}
+
+bool Preferences::get(const char* key, std::string& value) {
+    if (!opened || !key) return false;
+    std::lock_guard<std::mutex> lock(storeMutex);
+    auto ns = store.find(space);
+    if (ns == store.end()) return false;
+    auto it = ns->second.find(key);
+    if (it == ns->second.end()) return false;
+    value = it->second;
+    return true;
+}
+
+size_t Preferences::putInt(const char* key, int32_t value) { return put(key, std::to_string(value), 4); }
+size_t Preferences::putUInt(const char* key, uint32_t value) { return put(key, std::to_string(value), 4); }
+size_t Preferences::putLong(const char* key, int32_t value) { return put(key, std::to_string(value), 4); }
+size_t Preferences::putULong(const char* key, uint32_t value) { return put(key, std::to_string(value), 4); }
+size_t Preferences::putBool(const char* key, bool value) { return put(key, value ? "1" : "0", 1); }
+size_t Preferences::putUChar(const char* key, uint8_t value) { return put(key, std::to_string(value), 1); }
+
+size_t Preferences::putString(const char* key, const String& value) {
+    return put(key, value.c_str(), value.length());
+}
+
+int32_t Preferences::getInt(const char* key, int32_t defaultValue) {
+    std::string v;
+    return get(key, v) ? (int32_t)strtol(v.c_str(), nullptr, 10) : defaultValue;
+}
+
+uint32_t Preferences::getUInt(const char* key, uint32_t defaultValue) {
+    std::string v;
+    return get(key, v) ? (uint32_t)strtoul(v.c_str(), nullptr, 10) : defaultValue;
+}
+
+int32_t Preferences::getLong(const char* key, int32_t defaultValue) {
+    return getInt(key, defaultValue);
+}
+
+uint32_t Preferences::getULong(const char* key, uint32_t defaultValue) {
+    return getUInt(key, defaultValue);
+}
+
+bool Preferences::getBool(const char* key, bool defaultValue) {
+    std::string v;
+    return get(key, v) ? v == "1" : defaultValue;
+}
+
+uint8_t Preferences::getUChar(const char* key, uint8_t defaultValue) {
+    return (uint8_t)getUInt(key, defaultValue);
+}
+
+String Preferences::getString(const char* key, const String& defaultValue) {
+    std::string v;
+    return get(key, v) ? String(v.c_str()) : defaultValue;
+}
@@ -0,0 +1,8 @@
+#ifndef HOST_SOC_MEMORY_LAYOUT_H
+#define HOST_SOC_MEMORY_LAYOUT_H
+
+// En el host solo las reservas de PSRAM simulada no admiten DMA
+bool esp_ptr_dma_capable(const void* ptr);
+bool esp_ptr_external_ram(const void* ptr);
+
+#endif // HOST_SOC_MEMORY_LAYOUT_H
@@ -0,0 +1,123 @@
+#include <UniversalTelegramBot.h>
+#include <ArduinoJson.h>
+
+static String jsonEscape(const String& text) {
+    String out;
+    for (unsigned int i = 0; i < text.length(); i++) {
+        char c = text[i];
+        switch (c) {
+            case '"': out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n"; break;
+            case '\r': out += "\\r"; break;
+            case '\t': out += "\\t"; break;
+            default:
+                if ((uint8_t)c < 0x20) {
+                    char esc[8];
+                    snprintf(esc, sizeof(esc), "\\u%04x", c);
+                    out += esc;
+                } else {
+                    out += c;
+                }
+        }
+    }
+    return out;
+}
+
+UniversalTelegramBot::UniversalTelegramBot(const String& token, WiFiClient& client)
+    : token(token), client(&client) {}
+
+String UniversalTelegramBot::post(const char* method, const String& body) {
+    String head = String("POST /bot") + token + "/" + method + " HTTP/1.1\r\n"
+                  "Host: api.telegram.org\r\n"
+                  "Content-Type: application/json\r\n"
+                  "Content-Length: " + String(body.length()) + "\r\n"
+                  "Connection: keep-alive\r\n\r\n";
+    return request(head, body);
+}
+
+String UniversalTelegramBot::request(const String& head, const String& body) {
+    if (!client->connected() && !client->connect("api.telegram.org", 443)) return "";
+    client->print(head + body);
+
+    String status = client->readStringUntil('\n');
+    if (!status.startsWith("HTTP/1.")) {
+        client->stop();
+        return "";
+    }
+    long contentLength = -1;
+    for (;;) {
+        String line = client->readStringUntil('\n');
+        line.trim();
+        if (line.isEmpty()) break;
+        line.toLowerCase();
+        if (line.startsWith("content-length:")) contentLength = line.substring(15).toInt();
+    }
+    if (contentLength < 0) {
+        String rest = client->readString();
+        client->stop();
+        return rest;
+    }
+    String response;
+    response.reserve(contentLength);
+    char buf[512];
+    while ((long)response.length() < contentLength) {
+        size_t want = min((size_t)(contentLength - response.length()), sizeof(buf));
+        size_t n = client->readBytes(buf, want);
+        if (n == 0) {
+            client->stop();
+            break;
+        }
+        response.concat(buf, n);
+    }
+    return response;
+}
+
+bool UniversalTelegramBot::sendMessage(const String& chatId, const String& text, const String& parseMode) {
+    String body = "{\"chat_id\":\"" + jsonEscape(chatId) + "\",\"text\":\"" + jsonEscape(text) + "\"";
+    if (!parseMode.isEmpty()) body += ",\"parse_mode\":\"" + jsonEscape(parseMode) + "\"";
+    body += "}";
+    return post("sendMessage", body).indexOf("\"ok\":true") >= 0;
+}
+
+String UniversalTelegramBot::sendPhoto(const String& chatId, const String& photo, const String& caption) {
+    String body = "{\"chat_id\":\"" + jsonEscape(chatId) + "\",\"photo\":\"" + jsonEscape(photo) + "\"";
+    if (!caption.isEmpty()) body += ",\"caption\":\"" + jsonEscape(caption) + "\"";
+    body += "}";
+    return post("sendPhoto", body);
+}
+
+int UniversalTelegramBot::getUpdates(long offset) {
+    String head = String("GET /bot") + token + "/getUpdates?offset=" + String(offset) +
+                  "&limit=" + String(HOST_TELEGRAM_MAX_MESSAGES) + "&timeout=" + String(longPoll) +
+                  " HTTP/1.1\r\nHost: api.telegram.org\r\nConnection: keep-alive\r\n\r\n";
+    String response = request(head, "");
+
+    DynamicJsonDocument doc(16384);
+    if (response.isEmpty() || deserializeJson(doc, response)) return 0;
+    const hostjson::Node* ok = doc.root.find("ok");
+    const hostjson::Node* result = doc.root.find("result");
+    if (!ok || !ok->b || !result) return 0;
+
+    static const hostjson::Node empty;
+    auto field = [](const hostjson::Node* node, const char* key) {
+        const hostjson::Node* found = node ? node->find(key) : nullptr;
+        return found ? found : &empty;
+    };
+    int count = 0;
+    for (const auto& update : result->items) {
+        if (count == HOST_TELEGRAM_MAX_MESSAGES) break;
+        last_message_received = (long)field(update.get(), "update_id")->i;
+        const hostjson::Node* message = field(update.get(), "message");
+        telegramMessage& m = messages[count++];
+        m = telegramMessage();
+        m.update_id = (int)last_message_received;
+        m.text = field(message, "text")->s.c_str();
+        m.chat_id = String((long long)field(field(message, "chat"), "id")->i);
+        m.from_id = String((long long)field(field(message, "from"), "id")->i);
+        m.from_name = field(field(message, "from"), "first_name")->s.c_str();
+        m.date = String((long long)field(message, "date")->i);
+        m.type = "message";
+    }
+    return count;
+}
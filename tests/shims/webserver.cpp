@@ -0,0 +1,298 @@
+#include <WebServer.h>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+static uint16_t lastPort = 0;
+static int sendBuffer = 0;
+
+uint16_t hostWebServerPort() {
+    return lastPort;
+}
+
+void hostSetWebServerSendBuffer(int bytes) {
+    sendBuffer = bytes;
+}
+
+static const char* statusText(int code) {
+    switch (code) {
+        case 200: return "OK";
+        case 204: return "No Content";
+        case 206: return "Partial Content";
+        case 304: return "Not Modified";
+        case 400: return "Bad Request";
+        case 404: return "Not Found";
+        case 409: return "Conflict";
+        case 416: return "Range Not Satisfiable";
+        case 500: return "Internal Server Error";
+        case 503: return "Service Unavailable";
+        default: return "";
+    }
+}
+
+static String urlDecode(const String& text) {
+    String out;
+    for (unsigned int i = 0; i < text.length(); i++) {
+        char c = text[i];
+        if (c == '+') {
+            out += ' ';
+        } else if (c == '%' && i + 2 < text.length()) {
+            char hex[3] = { text[i + 1], text[i + 2], 0 };
+            out += (char)strtol(hex, nullptr, 16);
+            i += 2;
+        } else {
+            out += c;
+        }
+    }
+    return out;
+}
+
+WebServer::WebServer(int port)
+    : port(port), listenFd(-1), currentMethod(HTTP_GET), contentLength(CONTENT_LENGTH_NOT_SET), chunked(false) {}
+
+WebServer::~WebServer() {
+    close();
+}
+
+void WebServer::begin() {
+    listenFd = socket(AF_INET, SOCK_STREAM, 0);
+    int one = 1;
+    setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = 0;
+    socklen_t len = sizeof(addr);
+    if (bind(listenFd, (struct sockaddr*)&addr, sizeof(addr)) != 0 || listen(listenFd, 32) != 0 ||
+        getsockname(listenFd, (struct sockaddr*)&addr, &len) != 0) {
+        ::close(listenFd);
+        listenFd = -1;
+        return;
+    }
+    fcntl(listenFd, F_SETFL, fcntl(listenFd, F_GETFL) | O_NONBLOCK);
+    lastPort = ntohs(addr.sin_port);
+}
+
+void WebServer::close() {
+    if (listenFd >= 0) ::close(listenFd);
+    listenFd = -1;
+}
+
+void WebServer::on(const String& uri, HTTPMethod method, THandlerFunction handler) {
+    routes.push_back({ uri, method, handler });
+}
+
+void WebServer::onNotFound(THandlerFunction handler) {
+    notFound = handler;
+}
+
+void WebServer::collectHeaders(const char* headerKeys[], size_t count) {
+    collected.clear();
+    for (size_t i = 0; i < count; i++) {
+        String key = headerKeys[i];
+        key.toLowerCase();
+        collected.push_back(key);
+    }
+}
+
+void WebServer::handleClient() {
+    if (listenFd < 0) return;
+    int fd = accept(listenFd, nullptr, nullptr);
+    if (fd < 0) return;
+    if (sendBuffer > 0) setsockopt(fd, SOL_SOCKET, SO_SNDBUF, &sendBuffer, sizeof(sendBuffer));
+
+    currentClient = WiFiClient(fd);
+    currentClient.setTimeout(5);  // HTTP_MAX_DATA_WAIT
+    argList.clear();
+    headerList.clear();
+    responseHeaders = "";
+    contentLength = CONTENT_LENGTH_NOT_SET;
+    chunked = false;
+
+    if (readRequest()) {
+        bool handled = false;
+        for (const Route& route : routes) {
+            if (route.uri == currentUri && (route.method == HTTP_ANY || route.method == currentMethod)) {
+                route.handler();
+                handled = true;
+                break;
+            }
+        }
+        if (!handled) {
+            if (notFound) {
+                notFound();
+            } else {
+                send(404, "text/plain", "Not found");
+            }
+        }
+    }
+    // Como el original: se suelta la copia del servidor. Si el handler se quedó
+    // con otra (stream), el socket sigue abierto
+    currentClient = WiFiClient();
+}
+
+bool WebServer::readRequest() {
+    String requestLine = currentClient.readStringUntil('\n');
+    requestLine.trim();
+    int sp1 = requestLine.indexOf(' ');
+    int sp2 = requestLine.indexOf(' ', sp1 + 1);
+    if (sp1 < 0 || sp2 < 0) return false;
+
+    String methodText = requestLine.substring(0, sp1);
+    String url = requestLine.substring(sp1 + 1, sp2);
+    currentMethod = methodText == "POST" ? HTTP_POST
+                  : methodText == "DELETE" ? HTTP_DELETE
+                  : methodText == "PUT" ? HTTP_PUT
+                  : methodText == "HEAD" ? HTTP_HEAD : HTTP_GET;
+
+    int query = url.indexOf('?');
+    currentUri = query >= 0 ? url.substring(0, query) : url;
+    if (query >= 0) parseArgs(url.substring(query + 1));
+
+    size_t bodyLength = 0;
+    String contentType;
+    for (;;) {
+        String line = currentClient.readStringUntil('\n');
+        line.trim();
+        if (line.isEmpty()) break;
+        int colon = line.indexOf(':');
+        if (colon <= 0) continue;
+        String name = line.substring(0, colon);
+        String value = line.substring(colon + 1);
+        value.trim();
+        String lower = name;
+        lower.toLowerCase();
+        if (lower == "content-length") bodyLength = value.toInt();
+        if (lower == "content-type") contentType = value;
+        for (const String& key : collected) {
+            if (key == lower) headerList.push_back({ lower, value });
+        }
+    }
+
+    if (bodyLength > 0) {
+        String body;
+        body.reserve(bodyLength);
+        char buf[1024];
+        while (body.length() < bodyLength) {
+            size_t n = currentClient.readBytes(buf, min(sizeof(buf), (size_t)(bodyLength - body.length())));
+            if (n == 0) return false;
+            body.concat(buf, n);
+        }
+        if (contentType.startsWith("application/x-www-form-urlencoded")) parseArgs(body);
+        argList.push_back({ "plain", body });
+    }
+    return true;
+}
+
+void WebServer::parseArgs(const String& data) {
+    int pos = 0;
+    while (pos < (int)data.length()) {
+        int amp = data.indexOf('&', pos);
+        if (amp < 0) amp = data.length();
+        String pair = data.substring(pos, amp);
+        int eq = pair.indexOf('=');
+        if (!pair.isEmpty()) {
+            argList.push_back({ urlDecode(eq >= 0 ? pair.substring(0, eq) : pair),
+                                urlDecode(eq >= 0 ? pair.substring(eq + 1) : String()) });
+        }
+        pos = amp + 1;
+    }
+}
+
+String WebServer::arg(const String& name) const {
+    for (auto& a : argList) {
+        if (a.first == name) return a.second;
+    }
+    return "";
+}
+
+bool WebServer::hasArg(const String& name) const {
+    for (auto& a : argList) {
+        if (a.first == name) return true;
+    }
+    return false;
+}
+
+String WebServer::header(const String& name) const {
+    String lower = name;
+    lower.toLowerCase();
+    for (auto& h : headerList) {
+        if (h.first == lower) return h.second;
+    }
+    return "";
+}
+
+bool WebServer::hasHeader(const String& name) const {
+    return header(name).length() > 0;
+}
+
+void WebServer::sendHeader(const String& name, const String& value, bool first) {
+    String line = name + ": " + value + "\r\n";
+    responseHeaders = first ? line + responseHeaders : responseHeaders + line;
+}
+
+void WebServer::writeRaw(const char* data, size_t length) {
+    currentClient.write((const uint8_t*)data, length);
+}
+
+void WebServer::writeHeader(int code, const char* contentType, size_t length) {
+    if (contentLength != CONTENT_LENGTH_NOT_SET) length = contentLength;
+    String head = "HTTP/1.1 " + String(code) + " " + statusText(code) + "\r\n";
+    if (contentType && contentType[0]) head += "Content-Type: " + String(contentType) + "\r\n";
+    if (length == CONTENT_LENGTH_UNKNOWN) {
+        head += "Transfer-Encoding: chunked\r\n";
+        chunked = true;
+    } else {
+        head += "Content-Length: " + String((unsigned long)length) + "\r\n";
+    }
+    head += responseHeaders;
+    head += "Connection: close\r\n\r\n";
+    writeRaw(head.c_str(), head.length());
+    responseHeaders = "";
+    contentLength = CONTENT_LENGTH_NOT_SET;
+}
+
+void WebServer::send(int code, const char* contentType, const String& content) {
+    writeHeader(code, contentType, content.length());
+    if (content.length()) sendContent(content);
+}
+
+void WebServer::send_P(int code, const char* contentType, const char* content, size_t length) {
+    writeHeader(code, contentType, length);
+    sendContent(content, length);
+}
+
+void WebServer::sendContent(const String& content) {
+    sendContent(content.c_str(), content.length());
+}
+
+void WebServer::sendContent(const char* content, size_t length) {
+    if (!chunked) {
+        writeRaw(content, length);
+        return;
+    }
+    char size[16];
+    snprintf(size, sizeof(size), "%zx\r\n", length);
+    writeRaw(size, strlen(size));
+    writeRaw(content, length);
+    writeRaw("\r\n", 2);
+    if (length == 0) chunked = false;
+}
+
+size_t WebServer::streamFile(fs::File& file, const String& contentType) {
+    setContentLength(file.size());
+    send(200, contentType.c_str(), "");
+    uint8_t buf[4096];
+    size_t total = 0;
+    size_t n;
+    while ((n = file.read(buf, sizeof(buf))) > 0) {
+        size_t written = currentClient.write(buf, n);
+        total += written;
+        if (written != n) break;
+    }
+    return total;
+}
@@ -0,0 +1,208 @@
+#include <WiFi.h>
+#include <WiFiClientSecure.h>
+#include "host.h"
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+WiFiClass WiFi;
+
+// Un socket cerrado por el otro extremo no debe terminar el proceso
+static const bool ignoreSigpipe = [] {
+    signal(SIGPIPE, SIG_IGN);
+    return true;
+}();
+
+static uint16_t telegramPort = 0;
+
+void hostSetTelegramPort(uint16_t port) {
+    telegramPort = port;
+}
+
+struct HostSocket {
+    int fd;
+    explicit HostSocket(int fd) : fd(fd) {}
+    ~HostSocket() { if (fd >= 0) close(fd); }
+};
+
+WiFiClient::WiFiClient() {}
+
+WiFiClient::WiFiClient(int fd) : sock(std::make_shared<HostSocket>(fd)) {}
+
+WiFiClient::~WiFiClient() {}
+
+int WiFiClient::connectTo(const char* host, uint16_t port, int32_t timeoutMs) {
+    stop();
+    struct addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+    struct addrinfo* result = nullptr;
+    char service[8];
+    snprintf(service, sizeof(service), "%u", port);
+    if (getaddrinfo(host, service, &hints, &result) != 0 || !result) return 0;
+
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    bool ok = fd >= 0;
+    if (ok) {
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+        int rc = ::connect(fd, result->ai_addr, result->ai_addrlen);
+        if (rc != 0 && errno == EINPROGRESS) {
+            struct pollfd pfd = { fd, POLLOUT, 0 };
+            int err = 0;
+            socklen_t len = sizeof(err);
+            rc = (poll(&pfd, 1, timeoutMs) == 1 && getsockopt(fd, SOL_SOCKET, SO_ERROR, &err, &len) == 0 &&
+                  err == 0) ? 0 : -1;
+        }
+        ok = rc == 0;
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) & ~O_NONBLOCK);
+    }
+    freeaddrinfo(result);
+    if (!ok) {
+        if (fd >= 0) close(fd);
+        return 0;
+    }
+    sock = std::make_shared<HostSocket>(fd);
+    setTimeout((uint32_t)(_timeout / 1000));
+    return 1;
+}
+
+int WiFiClient::connect(const char* host, uint16_t port) {
+    return connectTo(host, port, 3000);
+}
+
+int WiFiClient::connect(const char* host, uint16_t port, int32_t timeoutMs) {
+    return connectTo(host, port, timeoutMs);
+}
+
+size_t WiFiClient::write(uint8_t c) {
+    return write(&c, 1);
+}
+
+size_t WiFiClient::write(const uint8_t* buf, size_t size) {
+    if (!sock) return 0;
+    size_t sent = 0;
+    while (sent < size) {
+        ssize_t n = send(sock->fd, buf + sent, size - sent, 0);
+        if (n <= 0) {
+            if (n < 0 && errno == EINTR) continue;
+            stop();
+            break;
+        }
+        sent += n;
+    }
+    return sent;
+}
+
+int WiFiClient::available() {
+    if (!sock) return 0;
+    int count = 0;
+    return ioctl(sock->fd, FIONREAD, &count) == 0 ? count : 0;
+}
+
+int WiFiClient::read() {
+    uint8_t c;
+    return read(&c, 1) == 1 ? c : -1;
+}
+
+int WiFiClient::read(uint8_t* buf, size_t size) {
+    if (!sock) return -1;
+    ssize_t n = recv(sock->fd, buf, size, MSG_DONTWAIT);
+    if (n > 0) return (int)n;
+    if (n == 0 || (errno != EAGAIN && errno != EWOULDBLOCK)) stop();
+    return n == 0 ? 0 : -1;
+}
+
+int WiFiClient::peek() {
+    if (!sock) return -1;
+    uint8_t c;
+    return recv(sock->fd, &c, 1, MSG_PEEK | MSG_DONTWAIT) == 1 ? c : -1;
+}
+
+// Espera con poll() en vez de leer byte a byte como Stream::readBytes
+size_t WiFiClient::readBytes(char* buffer, size_t length) {
+    size_t count = 0;
+    unsigned long start = millis();
+    while (sock && count < length) {
+        ssize_t n = recv(sock->fd, buffer + count, length - count, MSG_DONTWAIT);
+        if (n > 0) {
+            count += n;
+            continue;
+        }
+        if (n == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) break;
+        long left = (long)_timeout - (long)(millis() - start);
+        if (left <= 0) break;
+        struct pollfd pfd = { sock->fd, POLLIN, 0 };
+        poll(&pfd, 1, (int)left);
+    }
+    return count;
+}
+
+uint8_t WiFiClient::connected() {
+    if (!sock) return 0;
+    uint8_t c;
+    ssize_t n = recv(sock->fd, &c, 1, MSG_PEEK | MSG_DONTWAIT);
+    if (n > 0) return 1;
+    if (n == 0) {
+        stop();
+        return 0;
+    }
+    if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) return 1;
+    stop();
+    return 0;
+}
+
+void WiFiClient::stop() {
+    sock.reset();
+}
+
+int WiFiClient::fd() const {
+    return sock ? sock->fd : -1;
+}
+
+int WiFiClient::setTimeout(uint32_t seconds) {
+    Stream::setTimeout(seconds * 1000);
+    if (!sock) return 0;
+    struct timeval tv = { (time_t)seconds, 0 };
+    setsockopt(sock->fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    setsockopt(sock->fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+    return 0;
+}
+
+int WiFiClient::setNoDelay(bool nodelay) {
+    int flag = nodelay;
+    return sock ? setsockopt(sock->fd, IPPROTO_TCP, TCP_NODELAY, &flag, sizeof(flag)) : -1;
+}
+
+int WiFiClient::setSocketOption(int option, char* value, size_t len) {
+    return sock ? setsockopt(sock->fd, SOL_SOCKET, option, value, len) : -1;
+}
+
+IPAddress WiFiClient::remoteIP() const {
+    return IPAddress(127, 0, 0, 1);
+}
+
+int WiFiClientSecure::connect(const char* host, uint16_t port) {
+    return connect(host, port, 3000);
+}
+
+int WiFiClientSecure::connect(const char* host, uint16_t port, int32_t timeoutMs) {
+    if (strcmp(host, "api.telegram.org") == 0) {
+        if (telegramPort == 0) return 0;
+        return connectTo("127.0.0.1", telegramPort, timeoutMs);
+    }
+    return connectTo(host, port, timeoutMs);
+}
+
+int WiFiClientSecure::lastError(char* buf, size_t size) {
+    if (buf && size) buf[0] = 0;
+    return 0;
+}
@@ -0,0 +1,91 @@
+#include "avi_reader.h"
+#include <string.h>
+
+static uint32_t get32(const std::string& data, size_t pos) {
+    const uint8_t* p = (const uint8_t*)data.data() + pos;
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static bool fourccAt(const std::string& data, size_t pos, const char* id) {
+    return pos + 4 <= data.size() && memcmp(data.data() + pos, id, 4) == 0;
+}
+
+bool readAvi(const std::string& data, AviSummary& summary, std::string& error) {
+    summary = AviSummary();
+    if (data.size() < 12 || !fourccAt(data, 0, "RIFF") || !fourccAt(data, 8, "AVI ")) {
+        error = "sin RIFF AVI";
+        return false;
+    }
+    if (get32(data, 4) + 8 != data.size()) {
+        error = "tamaño RIFF " + std::to_string(get32(data, 4) + 8) + " != archivo " + std::to_string(data.size());
+        return false;
+    }
+
+    size_t moviStart = 0;
+    size_t moviEnd = 0;
+    bool haveHeader = false;
+    bool haveIndex = false;
+    size_t pos = 12;
+    while (pos + 8 <= data.size()) {
+        uint32_t size = get32(data, pos + 4);
+        size_t next = pos + 8 + size + (size & 1);
+        if (next > data.size()) {
+            error = "chunk fuera del archivo en " + std::to_string(pos);
+            return false;
+        }
+        if (fourccAt(data, pos, "LIST") && fourccAt(data, pos + 8, "hdrl")) {
+            if (!fourccAt(data, pos + 12, "avih") || !fourccAt(data, pos + 76, "LIST") ||
+                !fourccAt(data, pos + 88, "strh") || !fourccAt(data, pos + 96, "vids") ||
+                !fourccAt(data, pos + 100, "MJPG") || !fourccAt(data, pos + 152, "strf")) {
+                error = "hdrl mal formado";
+                return false;
+            }
+            summary.microSecPerFrame = get32(data, pos + 20);
+            summary.totalFrames = get32(data, pos + 36);
+            summary.width = get32(data, pos + 52);
+            summary.height = get32(data, pos + 56);
+            summary.rate = get32(data, pos + 120);
+            summary.streamLength = get32(data, pos + 128);
+            haveHeader = true;
+        } else if (fourccAt(data, pos, "LIST") && fourccAt(data, pos + 8, "movi")) {
+            moviStart = pos + 8;
+            moviEnd = pos + 8 + size;
+            for (size_t c = pos + 12; c + 8 <= moviEnd;) {
+                uint32_t chunkSize = get32(data, c + 4);
+                if (fourccAt(data, c, "00dc")) summary.moviChunks++;
+                c += 8 + chunkSize + (chunkSize & 1);
+            }
+        } else if (fourccAt(data, pos, "idx1")) {
+            for (uint32_t e = 0; e + 16 <= size; e += 16) {
+                summary.indexOffsets.push_back(get32(data, pos + 8 + e + 8));
+                summary.indexSizes.push_back(get32(data, pos + 8 + e + 12));
+                if (!fourccAt(data, pos + 8 + e, "00dc") || get32(data, pos + 8 + e + 4) != 0x10) {
+                    error = "entrada de idx1 sin 00dc/keyframe";
+                    return false;
+                }
+            }
+            haveIndex = true;
+        }
+        pos = next;
+    }
+    if (!haveHeader || !moviStart || !haveIndex) {
+        error = "faltan hdrl, movi o idx1";
+        return false;
+    }
+
+    for (size_t i = 0; i < summary.indexOffsets.size(); i++) {
+        size_t chunk = moviStart + summary.indexOffsets[i];
+        if (chunk + 8 + summary.indexSizes[i] > moviEnd || !fourccAt(data, chunk, "00dc") ||
+            get32(data, chunk + 4) != summary.indexSizes[i]) {
+            error = "idx1[" + std::to_string(i) + "] no apunta a su frame";
+            return false;
+        }
+        const uint8_t* jpeg = (const uint8_t*)data.data() + chunk + 8;
+        size_t len = summary.indexSizes[i];
+        if (len < 4 || jpeg[0] != 0xFF || jpeg[1] != 0xD8 || jpeg[len - 2] != 0xFF || jpeg[len - 1] != 0xD9) {
+            error = "frame " + std::to_string(i) + " no es un JPEG completo";
+            return false;
+        }
+    }
+    return true;
+}
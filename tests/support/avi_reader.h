@@ -0,0 +1,26 @@
+#ifndef AVI_READER_H
+#define AVI_READER_H
+
+// Lectura de un AVI MJPEG como lo haría un reproductor: recorre RIFF, hdrl,
+// movi e idx1 y comprueba que cada entrada del índice apunte a un chunk
+// '00dc' del tamaño indicado que contiene un JPEG completo
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+struct AviSummary {
+    uint32_t microSecPerFrame;
+    uint32_t totalFrames;           // avih.dwTotalFrames
+    uint32_t streamLength;          // strh.dwLength
+    uint32_t rate;                  // strh.dwRate (fps)
+    uint32_t width;
+    uint32_t height;
+    uint32_t moviChunks;            // Chunks '00dc' en movi
+    std::vector<uint32_t> indexOffsets;  // idx1, relativos a 'movi'
+    std::vector<uint32_t> indexSizes;
+};
+
+bool readAvi(const std::string& data, AviSummary& summary, std::string& error);
+
+#endif // AVI_READER_H
@@ -0,0 +1,152 @@
+#include "http_client.h"
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+
+static double nowUs() {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static int connectLocal(uint16_t port, int receiveBuffer = 0) {
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    // Antes de connect(): la ventana TCP se negocia con este tamaño
+    if (receiveBuffer > 0) setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &receiveBuffer, sizeof(receiveBuffer));
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons(port);
+    if (connect(fd, (struct sockaddr*)&addr, sizeof(addr)) != 0) {
+        close(fd);
+        return -1;
+    }
+    int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    return fd;
+}
+
+// Espera datos en fd hasta ms; mientras tanto atiende al servidor con pump
+static bool waitReadable(int fd, int ms, void (*pump)()) {
+    double deadline = nowUs() + ms * 1000.0;
+    for (;;) {
+        if (pump) pump();
+        struct pollfd pfd = { fd, POLLIN, 0 };
+        int wait = pump ? 1 : std::max(0, (int)((deadline - nowUs()) / 1000));
+        if (poll(&pfd, 1, wait) > 0) return true;
+        if (nowUs() >= deadline) return false;
+    }
+}
+
+HttpResponse httpRequest(uint16_t port, const std::string& method, const std::string& target,
+                         const std::map<std::string, std::string>& headers, const std::string& body,
+                         void (*pump)(), int timeoutMs) {
+    HttpResponse response;
+    double start = nowUs();
+    int fd = connectLocal(port);
+    if (fd < 0) return response;
+
+    std::string request = method + " " + target + " HTTP/1.1\r\nHost: 127.0.0.1\r\n";
+    for (auto& h : headers) request += h.first + ": " + h.second + "\r\n";
+    if (!body.empty()) request += "Content-Length: " + std::to_string(body.size()) + "\r\n";
+    request += "Connection: close\r\n\r\n" + body;
+    send(fd, request.data(), request.size(), MSG_NOSIGNAL);
+
+    std::string data;
+    char buf[65536];
+    size_t headerEnd = std::string::npos;
+    long contentLength = -1;
+    for (;;) {
+        if (!waitReadable(fd, timeoutMs, pump)) break;
+        ssize_t n = recv(fd, buf, sizeof(buf), 0);
+        if (n <= 0) break;
+        if (data.empty()) response.firstByteUs = nowUs() - start;
+        data.append(buf, n);
+
+        if (headerEnd == std::string::npos) {
+            headerEnd = data.find("\r\n\r\n");
+            if (headerEnd == std::string::npos) continue;
+            std::string head = data.substr(0, headerEnd);
+            response.status = atoi(head.c_str() + 9);
+            size_t pos = head.find("\r\n");
+            while (pos != std::string::npos && pos < head.size()) {
+                size_t next = head.find("\r\n", pos + 2);
+                std::string line = head.substr(pos + 2, next == std::string::npos ? std::string::npos : next - pos - 2);
+                size_t colon = line.find(':');
+                if (colon != std::string::npos) {
+                    std::string name = line.substr(0, colon);
+                    std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+                    size_t v = line.find_first_not_of(' ', colon + 1);
+                    response.headers[name] = v == std::string::npos ? "" : line.substr(v);
+                }
+                pos = next;
+            }
+            response.chunked = response.header("transfer-encoding").find("chunked") != std::string::npos;
+            if (response.headers.count("content-length")) contentLength = atol(response.header("content-length").c_str());
+            if (method == "HEAD" || response.status == 304) contentLength = 0;
+        }
+        std::string rest = data.substr(headerEnd + 4);
+        if (contentLength >= 0 && (long)rest.size() >= contentLength) break;
+        if (response.chunked && rest.find("\r\n0\r\n\r\n") != std::string::npos) break;
+        if (response.chunked && rest.compare(0, 5, "0\r\n\r\n") == 0) break;
+    }
+    close(fd);
+    response.totalUs = nowUs() - start;
+    if (headerEnd == std::string::npos) return response;
+
+    std::string rest = data.substr(headerEnd + 4);
+    if (!response.chunked) {
+        response.body = contentLength >= 0 ? rest.substr(0, contentLength) : rest;
+        return response;
+    }
+    size_t pos = 0;
+    while (pos < rest.size()) {
+        size_t lineEnd = rest.find("\r\n", pos);
+        if (lineEnd == std::string::npos) break;
+        size_t size = strtoul(rest.substr(pos, lineEnd - pos).c_str(), nullptr, 16);
+        if (size == 0) break;
+        response.body += rest.substr(lineEnd + 2, size);
+        pos = lineEnd + 2 + size + 2;
+    }
+    return response;
+}
+
+HttpStream::HttpStream(uint16_t port, const std::string& target, int receiveBuffer) {
+    fd = connectLocal(port, receiveBuffer);
+    if (fd < 0) return;
+    std::string request = "GET " + target + " HTTP/1.1\r\nHost: 127.0.0.1\r\n\r\n";
+    send(fd, request.data(), request.size(), MSG_NOSIGNAL);
+}
+
+HttpStream::~HttpStream() {
+    close();
+}
+
+size_t HttpStream::readFor(int ms, void (*pump)()) {
+    if (fd < 0) return 0;
+    size_t before = received.size();
+    double deadline = nowUs() + ms * 1000.0;
+    char buf[65536];
+    while (nowUs() < deadline) {
+        if (pump) pump();
+        struct pollfd pfd = { fd, POLLIN, 0 };
+        if (poll(&pfd, 1, 1) <= 0) continue;
+        ssize_t n = recv(fd, buf, sizeof(buf), 0);
+        if (n <= 0) {
+            close();
+            break;
+        }
+        received.append(buf, n);
+    }
+    return received.size() - before;
+}
+
+void HttpStream::close() {
+    if (fd >= 0) ::close(fd);
+    fd = -1;
+}
@@ -0,0 +1,50 @@
+#ifndef HTTP_CLIENT_H
+#define HTTP_CLIENT_H
+
+// Cliente HTTP/1.1 mínimo para pedirle rutas al WebServer de las shims por
+// loopback: una petición por conexión, cuerpo por Content-Length, chunked o
+// hasta el cierre
+
+#include <map>
+#include <string>
+
+struct HttpResponse {
+    int status = 0;
+    std::map<std::string, std::string> headers;  // Nombres en minúsculas
+    std::string body;
+    bool chunked = false;
+    double firstByteUs = 0;                      // Hasta la línea de estado
+    double totalUs = 0;                          // Hasta el último byte
+
+    std::string header(const std::string& name) const {
+        auto it = headers.find(name);
+        return it == headers.end() ? "" : it->second;
+    }
+};
+
+// Hace la petición y la atiende llamando a pump() (p. ej. handleClient())
+// mientras espera, como loop() en la placa. Sin pump el servidor debe correr
+// en otro hilo.
+HttpResponse httpRequest(uint16_t port, const std::string& method, const std::string& target,
+                         const std::map<std::string, std::string>& headers = {},
+                         const std::string& body = "", void (*pump)() = nullptr, int timeoutMs = 10000);
+
+// Conexión abierta para respuestas que no terminan (/stream): lee lo que
+// llegue durante ms milisegundos. receiveBuffer > 0 achica el buffer de
+// recepción (cliente lento que deja de leer)
+class HttpStream {
+public:
+    HttpStream(uint16_t port, const std::string& target, int receiveBuffer = 0);
+    ~HttpStream();
+    bool connected() const { return fd >= 0; }
+    // Lee lo disponible hasta ms; retorna bytes nuevos
+    size_t readFor(int ms, void (*pump)() = nullptr);
+    std::string& data() { return received; }
+    void close();
+
+private:
+    int fd;
+    std::string received;
+};
+
+#endif // HTTP_CLIENT_H
@@ -0,0 +1,267 @@
+#include "mock_telegram.h"
+#include <Arduino.h>
+#include "host.h"
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+MockTelegram::MockTelegram()
+    : listenFd(-1), nextConnection(0), longPollMs(200), running(false), fileCounter(0) {}
+
+MockTelegram::~MockTelegram() {
+    stop();
+}
+
+bool MockTelegram::start() {
+    listenFd = socket(AF_INET, SOCK_STREAM, 0);
+    if (listenFd < 0) return false;
+    int one = 1;
+    setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = 0;
+    socklen_t len = sizeof(addr);
+    if (bind(listenFd, (struct sockaddr*)&addr, sizeof(addr)) != 0 || listen(listenFd, 16) != 0 ||
+        getsockname(listenFd, (struct sockaddr*)&addr, &len) != 0) {
+        close(listenFd);
+        listenFd = -1;
+        return false;
+    }
+    running = true;
+    hostSetTelegramPort(ntohs(addr.sin_port));
+    std::thread([this] { acceptLoop(); }).detach();
+    return true;
+}
+
+void MockTelegram::stop() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!running) return;
+    running = false;
+    hostSetTelegramPort(0);
+    shutdown(listenFd, SHUT_RDWR);
+    for (int fd : openFds) shutdown(fd, SHUT_RDWR);
+    changed.notify_all();
+}
+
+void MockTelegram::pushUpdate(const std::string& updateJson) {
+    size_t pos = updateJson.find("\"update_id\":");
+    long long id = pos == std::string::npos ? 0 : atoll(updateJson.c_str() + pos + 12);
+    std::lock_guard<std::mutex> lock(mutex);
+    updates.push_back({ id, updateJson });
+    changed.notify_all();
+}
+
+std::string MockTelegram::textUpdate(long long updateId, long long chatId, const std::string& text) {
+    return "{\"update_id\":" + std::to_string(updateId) + ",\"message\":{\"message_id\":" +
+           std::to_string(updateId) + ",\"from\":{\"id\":" + std::to_string(chatId) +
+           ",\"first_name\":\"Test\"},\"chat\":{\"id\":" + std::to_string(chatId) +
+           ",\"type\":\"private\"},\"date\":1700000000,\"text\":\"" + text + "\"}}";
+}
+
+void MockTelegram::setLongPollMs(int ms) {
+    std::lock_guard<std::mutex> lock(mutex);
+    longPollMs = ms;
+}
+
+void MockTelegram::failNext(const std::string& method, int count) {
+    std::lock_guard<std::mutex> lock(mutex);
+    failures[method] = count;
+}
+
+void MockTelegram::setDelay(const std::string& method, int ms) {
+    std::lock_guard<std::mutex> lock(mutex);
+    delays[method] = ms;
+}
+
+std::vector<MockRequest> MockTelegram::requests() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return log;
+}
+
+size_t MockTelegram::count(const std::string& method) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return std::count_if(log.begin(), log.end(), [&](const MockRequest& r) { return r.method == method; });
+}
+
+bool MockTelegram::waitFor(const std::string& method, size_t wanted, unsigned long timeoutMs) {
+    std::unique_lock<std::mutex> lock(mutex);
+    return changed.wait_for(lock, std::chrono::milliseconds(timeoutMs), [&] {
+        return (size_t)std::count_if(log.begin(), log.end(),
+                                     [&](const MockRequest& r) { return r.method == method; }) >= wanted;
+    });
+}
+
+static std::string formField(const std::string& body, const std::string& name) {
+    std::string key = "name=\"" + name + "\"";
+    size_t pos = body.find(key);
+    if (pos == std::string::npos) return "";
+    pos = body.find("\r\n\r\n", pos);
+    if (pos == std::string::npos) return "";
+    pos += 4;
+    size_t end = body.find("\r\n--", pos);
+    return body.substr(pos, end == std::string::npos ? std::string::npos : end - pos);
+}
+
+static std::string jsonField(const std::string& body, const std::string& name) {
+    std::string key = "\"" + name + "\":\"";
+    size_t pos = body.find(key);
+    if (pos == std::string::npos) return "";
+    pos += key.size();
+    return body.substr(pos, body.find('"', pos) - pos);
+}
+
+std::string MockTelegram::chatOf(const MockRequest& request) {
+    std::string type = request.headers.count("content-type") ? request.headers.at("content-type") : "";
+    if (type.find("multipart") != std::string::npos) return formField(request.body, "chat_id");
+    return jsonField(request.body, "chat_id");
+}
+
+std::string MockTelegram::photoOf(const MockRequest& request) {
+    return formField(request.body, "photo");
+}
+
+void MockTelegram::acceptLoop() {
+    for (;;) {
+        int fd = accept(listenFd, nullptr, nullptr);
+        if (fd < 0) break;
+        int connection;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!running) {
+                close(fd);
+                break;
+            }
+            connection = ++nextConnection;
+            openFds.push_back(fd);
+        }
+        std::thread([this, fd, connection] { serve(fd, connection); }).detach();
+    }
+}
+
+// Lee una petición completa (encabezados + Content-Length) y responde; la
+// conexión sigue abierta para la próxima (keep-alive) hasta que el cliente cierra
+void MockTelegram::serve(int fd, int connection) {
+    std::string pending;
+    char buf[16384];
+    for (;;) {
+        size_t headerEnd;
+        while ((headerEnd = pending.find("\r\n\r\n")) == std::string::npos) {
+            ssize_t n = recv(fd, buf, sizeof(buf), 0);
+            if (n <= 0) goto done;
+            pending.append(buf, n);
+        }
+
+        MockRequest request;
+        request.connection = connection;
+        {
+            std::string head = pending.substr(0, headerEnd);
+            size_t lineEnd = head.find("\r\n");
+            std::string requestLine = head.substr(0, lineEnd);
+            size_t sp1 = requestLine.find(' ');
+            size_t sp2 = requestLine.find(' ', sp1 + 1);
+            request.target = requestLine.substr(sp1 + 1, sp2 - sp1 - 1);
+            size_t slash = request.target.find('/', 1);
+            size_t query = request.target.find('?');
+            request.method = slash == std::string::npos ? "" : request.target.substr(slash + 1, query - slash - 1);
+            size_t pos = lineEnd + 2;
+            while (pos < head.size()) {
+                size_t next = head.find("\r\n", pos);
+                if (next == std::string::npos) next = head.size();
+                std::string line = head.substr(pos, next - pos);
+                size_t colon = line.find(':');
+                if (colon != std::string::npos) {
+                    std::string name = line.substr(0, colon);
+                    std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+                    size_t v = line.find_first_not_of(' ', colon + 1);
+                    request.headers[name] = v == std::string::npos ? "" : line.substr(v);
+                }
+                pos = next + 2;
+            }
+        }
+        size_t length = request.headers.count("content-length") ? atol(request.headers["content-length"].c_str()) : 0;
+        while (pending.size() < headerEnd + 4 + length) {
+            ssize_t n = recv(fd, buf, sizeof(buf), 0);
+            if (n <= 0) goto done;
+            pending.append(buf, n);
+        }
+        request.body = pending.substr(headerEnd + 4, length);
+        request.bytes = headerEnd + 4 + length;
+        request.receivedMs = millis();
+        pending.erase(0, headerEnd + 4 + length);
+
+        std::string body = respond(request);
+        std::string response = "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\nConnection: keep-alive\r\n"
+                               "Content-Length: " + std::to_string(body.size()) + "\r\n\r\n" + body;
+        size_t sent = 0;
+        while (sent < response.size()) {
+            ssize_t n = send(fd, response.data() + sent, response.size() - sent, MSG_NOSIGNAL);
+            if (n <= 0) goto done;
+            sent += n;
+        }
+    }
+done:
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        openFds.erase(std::remove(openFds.begin(), openFds.end(), fd), openFds.end());
+    }
+    close(fd);
+}
+
+std::string MockTelegram::respond(MockRequest& request) {
+    std::unique_lock<std::mutex> lock(mutex);
+    log.push_back(request);
+    changed.notify_all();
+
+    int delayMs = delays.count(request.method) ? delays[request.method] : 0;
+    if (delayMs > 0) {
+        lock.unlock();
+        std::this_thread::sleep_for(std::chrono::milliseconds(delayMs));
+        lock.lock();
+    }
+
+    if (failures[request.method] > 0) {
+        failures[request.method]--;
+        return "{\"ok\":false,\"error_code\":500,\"description\":\"mock\"}";
+    }
+
+    if (request.method == "getUpdates") {
+        size_t pos = request.target.find("offset=");
+        long long offset = pos == std::string::npos ? 0 : atoll(request.target.c_str() + pos + 7);
+        auto ready = [&] {
+            if (!running) return true;
+            for (auto& u : updates) {
+                if (u.first >= offset) return true;
+            }
+            return false;
+        };
+        changed.wait_for(lock, std::chrono::milliseconds(longPollMs), ready);
+        std::string body = "{\"ok\":true,\"result\":[";
+        bool first = true;
+        for (auto& u : updates) {
+            if (u.first < offset) continue;
+            if (!first) body += ",";
+            body += u.second;
+            first = false;
+        }
+        // Lo que el cliente confirmó con offset ya no se entrega
+        while (!updates.empty() && updates.front().first < offset) updates.pop_front();
+        return body + "]}";
+    }
+
+    if (request.method == "sendPhoto") {
+        int id = ++fileCounter;
+        std::string fileId = jsonField(request.body, "photo");
+        if (fileId.empty()) fileId = "FILE" + std::to_string(id);
+        return "{\"ok\":true,\"result\":{\"message_id\":" + std::to_string(id) +
+               ",\"photo\":[{\"file_id\":\"small" + std::to_string(id) + "\",\"width\":90},{\"file_id\":\"" +
+               fileId + "\",\"width\":800}]}}";
+    }
+
+    return "{\"ok\":true,\"result\":{\"message_id\":" + std::to_string(++fileCounter) + "}}";
+}
@@ -0,0 +1,76 @@
+#ifndef MOCK_TELEGRAM_H
+#define MOCK_TELEGRAM_H
+
+/*
+ * Servidor HTTP local que responde como api.telegram.org (sin TLS):
+ * getUpdates con long polling, sendMessage y sendPhoto (multipart o por
+ * file_id). Guarda cada petición para que los tests revisen qué bytes salieron
+ * hacia cada chat y por cuántas conexiones.
+ */
+
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+struct MockRequest {
+    std::string method;                         // "sendPhoto", "getUpdates", ...
+    std::string target;                         // Ruta completa con query
+    std::map<std::string, std::string> headers; // Nombres en minúsculas
+    std::string body;
+    int connection;                             // Número de conexión TCP (desde 1)
+    size_t bytes;                               // Encabezados + cuerpo recibidos
+    unsigned long receivedMs;                   // millis() al terminar de recibir
+};
+
+class MockTelegram {
+public:
+    MockTelegram();
+    ~MockTelegram();
+
+    // Escucha en 127.0.0.1 y redirige api.telegram.org:443 a este puerto
+    bool start();
+    void stop();
+
+    // Update que getUpdates entrega mientras su update_id >= offset
+    void pushUpdate(const std::string& updateJson);
+    static std::string textUpdate(long long updateId, long long chatId, const std::string& text);
+    // Sin updates, getUpdates espera hasta este tiempo (long poll)
+    void setLongPollMs(int ms);
+    // Las próximas count peticiones de method responden {"ok":false}
+    void failNext(const std::string& method, int count);
+    // Demora antes de responder cada petición de method
+    void setDelay(const std::string& method, int ms);
+
+    std::vector<MockRequest> requests();
+    size_t count(const std::string& method);
+    // Espera hasta tener count peticiones de method
+    bool waitFor(const std::string& method, size_t count, unsigned long timeoutMs);
+
+    // chat_id de una petición (JSON o multipart)
+    static std::string chatOf(const MockRequest& request);
+    // Contenido del campo "photo" de un sendPhoto multipart
+    static std::string photoOf(const MockRequest& request);
+
+private:
+    int listenFd;
+    int nextConnection;
+    int longPollMs;
+    bool running;
+    int fileCounter;
+    std::mutex mutex;
+    std::condition_variable changed;
+    std::vector<MockRequest> log;
+    std::deque<std::pair<long long, std::string>> updates;
+    std::map<std::string, int> failures;
+    std::map<std::string, int> delays;
+    std::vector<int> openFds;
+
+    void acceptLoop();
+    void serve(int fd, int connection);
+    std::string respond(MockRequest& request);
+};
+
+#endif // MOCK_TELEGRAM_H
@@ -0,0 +1,145 @@
+#include "test.h"
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <unistd.h>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+struct TestCase {
+    const char* name;
+    TestFunction fn;
+};
+
+static std::vector<TestCase>& registry() {
+    static std::vector<TestCase> tests;
+    return tests;
+}
+
+static int failures = 0;
+static const char* currentTest = "";
+
+TestRegistrar::TestRegistrar(const char* name, TestFunction fn) {
+    registry().push_back({ name, fn });
+}
+
+void testFail(const char* file, int line, const std::string& message) {
+    failures++;
+    fprintf(stderr, "  FALLO %s (%s:%d): %s\n", currentTest, file, line, message.c_str());
+}
+
+std::string testShow(const String& value) { return "\"" + std::string(value.c_str()) + "\""; }
+std::string testShow(const std::string& value) { return "\"" + value + "\""; }
+std::string testShow(const char* value) { return value ? "\"" + std::string(value) + "\"" : "null"; }
+std::string testShow(bool value) { return value ? "true" : "false"; }
+
+bool waitUntil(std::function<bool()> cond, uint32_t timeoutMs) {
+    unsigned long start = millis();
+    while (!cond()) {
+        if (millis() - start >= timeoutMs) return cond();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+TestSd::TestSd() {
+    dir = hostMakeTempDir("sd");
+    hostSdSetRoot(dir);
+}
+
+TestSd::~TestSd() {
+    hostSdSetRoot("");
+    hostRemoveTree(dir);
+}
+
+void TestSd::write(const std::string& path, const std::string& data, time_t mtime) {
+    // Crea las carpetas intermedias
+    std::string full = dir;
+    size_t pos = 1;
+    while ((pos = path.find('/', pos)) != std::string::npos) {
+        mkdir((dir + path.substr(0, pos)).c_str(), 0755);
+        pos++;
+    }
+    std::ofstream out(dir + path, std::ios::binary);
+    out.write(data.data(), data.size());
+    out.close();
+    if (mtime) {
+        struct timeval times[2] = { { mtime, 0 }, { mtime, 0 } };
+        utimes((dir + path).c_str(), times);
+    }
+}
+
+std::string TestSd::read(const std::string& path) const {
+    std::ifstream in(dir + path, std::ios::binary);
+    std::stringstream data;
+    data << in.rdbuf();
+    return data.str();
+}
+
+std::string testData(const std::string& path) {
+    std::ifstream in(std::string(TEST_DATA_DIR) + "/" + path, std::ios::binary);
+    if (!in) testFail(__FILE__, __LINE__, "falta tests/data/" + path);
+    std::stringstream data;
+    data << in.rdbuf();
+    return data.str();
+}
+
+bool benchQuick() {
+    const char* quick = getenv("BENCH_QUICK");
+    return quick && quick[0] == '1';
+}
+
+int benchIterations(int full, int quick) {
+    return benchQuick() ? quick : full;
+}
+
+BenchStats benchSummarize(std::vector<double>& samplesUs) {
+    BenchStats stats = { 0, 0, 0, 0, 0 };
+    if (samplesUs.empty()) return stats;
+    std::sort(samplesUs.begin(), samplesUs.end());
+    double sum = 0;
+    for (double s : samplesUs) sum += s;
+    size_t n = samplesUs.size();
+    stats.minUs = samplesUs[0];
+    stats.p50Us = samplesUs[n / 2];
+    stats.p95Us = samplesUs[std::min(n - 1, n * 95 / 100)];
+    stats.maxUs = samplesUs[n - 1];
+    stats.meanUs = sum / n;
+    return stats;
+}
+
+void benchReport(const char* name, const BenchStats& stats, const std::string& extra) {
+    printf("[bench] %-36s p50 %9.1f us  p95 %9.1f us  max %9.1f us  %s\n", name, stats.p50Us, stats.p95Us,
+           stats.maxUs, extra.c_str());
+    fflush(stdout);
+}
+
+void benchNote(const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    printf("[bench] ");
+    vprintf(format, args);
+    printf("\n");
+    va_end(args);
+    fflush(stdout);
+}
+
+int main(int argc, char** argv) {
+    const char* filter = argc > 1 ? argv[1] : nullptr;
+    int run = 0;
+    for (const TestCase& test : registry()) {
+        if (filter && !strstr(test.name, filter)) continue;
+        currentTest = test.name;
+        int before = failures;
+        auto start = std::chrono::steady_clock::now();
+        test.fn();
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        printf("%s %s (%.0f ms)\n", failures == before ? "OK   " : "FALLO", test.name, ms);
+        fflush(stdout);
+        run++;
+    }
+    printf("%d casos, %d fallos\n", run, failures);
+    fflush(stdout);
+    _exit(failures == 0 && run > 0 ? 0 : 1);
+}
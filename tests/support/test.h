@@ -0,0 +1,99 @@
+#ifndef TEST_H
+#define TEST_H
+
+/*
+ * Mini framework de los tests del host: TEST() registra un caso, CHECK*
+ * cuenta fallos sin abortar el caso y main() (test.cpp) corre todos.
+ * Termina con _exit(): las tareas del firmware siguen vivas en sus hilos y
+ * no deben ver destructores estáticos.
+ */
+
+#include <Arduino.h>
+#include <string>
+#include <vector>
+#include "host.h"
+
+typedef void (*TestFunction)();
+
+struct TestRegistrar {
+    TestRegistrar(const char* name, TestFunction fn);
+};
+
+#define TEST(name)                                               \
+    static void name();                                          \
+    static TestRegistrar name##Registrar(#name, name);           \
+    static void name()
+
+void testFail(const char* file, int line, const std::string& message);
+
+#define CHECK(cond)                                                          \
+    do {                                                                     \
+        if (!(cond)) testFail(__FILE__, __LINE__, "CHECK(" #cond ")");       \
+    } while (0)
+
+#define CHECK_EQ(a, b)                                                                       \
+    do {                                                                                     \
+        auto checkA = (a);                                                                   \
+        auto checkB = (b);                                                                   \
+        if (!(checkA == checkB)) {                                                           \
+            testFail(__FILE__, __LINE__, "CHECK_EQ(" #a ", " #b "): " + testShow(checkA) +   \
+                                             " != " + testShow(checkB));                     \
+        }                                                                                    \
+    } while (0)
+
+// Corta el caso actual (para condiciones que dejan sin sentido el resto)
+#define REQUIRE(cond)                                                        \
+    do {                                                                     \
+        if (!(cond)) {                                                       \
+            testFail(__FILE__, __LINE__, "REQUIRE(" #cond ")");              \
+            return;                                                          \
+        }                                                                    \
+    } while (0)
+
+std::string testShow(const String& value);
+std::string testShow(const std::string& value);
+std::string testShow(const char* value);
+std::string testShow(bool value);
+template <typename T>
+std::string testShow(const T& value) {
+    return std::to_string(value);
+}
+
+// Espera hasta timeoutMs a que cond() sea verdadera
+bool waitUntil(std::function<bool()> cond, uint32_t timeoutMs);
+
+// Tarjeta SD del caso: carpeta temporal que se borra al salir del scope
+class TestSd {
+public:
+    TestSd();
+    ~TestSd();
+    const std::string& root() const { return dir; }
+    // Crea un archivo con contenido dado (ruta de la SD, "/fotos/a.jpg")
+    void write(const std::string& path, const std::string& data, time_t mtime = 0);
+    std::string read(const std::string& path) const;
+
+private:
+    std::string dir;
+};
+
+// Archivo de tests/data (respuestas de ejemplo, etc.)
+std::string testData(const std::string& path);
+
+// ===== Benchmarks =====
+// BENCH_QUICK=1 (ctest) reduce iteraciones: solo verifica que corre
+bool benchQuick();
+int benchIterations(int full, int quick);
+
+struct BenchStats {
+    double minUs;
+    double p50Us;
+    double p95Us;
+    double maxUs;
+    double meanUs;
+};
+BenchStats benchSummarize(std::vector<double>& samplesUs);
+// Una línea por medición: "[bench] nombre  p50 .. p95 .. max .. extra"
+void benchReport(const char* name, const BenchStats& stats, const std::string& extra = "");
+void benchNote(const char* format, ...);
+
+#endif // TEST_H
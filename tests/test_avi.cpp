@@ -0,0 +1,201 @@
+// Formato AVI de VideoRecorder (grabaciones y /replay): cabecera, chunks e
+// índice idx1 leídos como un reproductor, con los helpers públicos y con una
+// grabación real desde el pipeline
+
+#include "test.h"
+#include "avi_reader.h"
+#include "camera_handler.h"
+#include "replay_buffer.h"
+#include "sd_handler.h"
+#include "sleep_manager.h"
+#include "video_recorder.h"
+
+static uint32_t get32(const uint8_t* p) {
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// AVI en memoria con los helpers públicos, como lo arma sendReplayAvi
+static std::string buildAvi(const std::vector<std::string>& frames, const std::vector<int>& indexFrames, int fps) {
+    std::string movi;
+    std::vector<uint32_t> offsets;
+    uint32_t maxFrame = 0;
+    for (const std::string& jpeg : frames) {
+        uint8_t chunk[8];
+        VideoRecorder::buildAviChunk(chunk, "00dc", jpeg.size());
+        offsets.push_back(4 + movi.size());
+        movi.append((const char*)chunk, 8);
+        movi += jpeg;
+        if (jpeg.size() & 1) movi += '\0';
+        maxFrame = std::max<uint32_t>(maxFrame, jpeg.size());
+    }
+    std::string index;
+    for (int f : indexFrames) {
+        AviIndexEntry entry = VideoRecorder::aviIndexEntry(offsets[f], frames[f].size());
+        index.append((const char*)&entry, sizeof(entry));
+    }
+    uint8_t idxHead[8];
+    VideoRecorder::buildAviChunk(idxHead, "idx1", index.size());
+
+    AviInfo info;
+    info.fps = fps;
+    info.width = 640;
+    info.height = 480;
+    info.totalFrames = indexFrames.size();
+    info.maxFrameSize = maxFrame;
+    info.durationMs = indexFrames.size() * 1000 / fps;
+    info.moviSize = 4 + movi.size();
+    info.riffSize = AVI_HEADER_SIZE + movi.size() + 8 + index.size() - 8;
+    uint8_t header[AVI_HEADER_SIZE];
+    VideoRecorder::buildAviHeader(header, info);
+    return std::string((const char*)header, sizeof(header)) + movi + std::string((const char*)idxHead, 8) + index;
+}
+
+TEST(headerLayout) {
+    AviInfo info = { 10, 800, 600, 42, 30000, 4200, 123456, 120000 };
+    uint8_t header[AVI_HEADER_SIZE];
+    VideoRecorder::buildAviHeader(header, info);
+
+    CHECK(memcmp(header, "RIFF", 4) == 0);
+    CHECK_EQ(get32(header + 4), 123456u);
+    CHECK(memcmp(header + 8, "AVI ", 4) == 0);
+    CHECK(memcmp(header + 12, "LIST", 4) == 0);
+    // LIST hdrl termina justo donde empieza LIST movi
+    CHECK_EQ(20 + get32(header + 16), (uint32_t)AVI_MOVI_FOURCC - 8);
+    CHECK_EQ(get32(header + 32), 100000u);            // µs por frame a 10 fps
+    CHECK_EQ(get32(header + 48), 42u);                // dwTotalFrames
+    CHECK_EQ(get32(header + 60), 30008u);             // Buffer sugerido: frame + cabecera de chunk
+    CHECK_EQ(get32(header + 64), 800u);
+    CHECK_EQ(get32(header + 68), 600u);
+    CHECK(memcmp(header + AVI_MOVI_FOURCC - 8, "LIST", 4) == 0);
+    CHECK_EQ(get32(header + AVI_MOVI_FOURCC - 4), 120000u);
+    CHECK(memcmp(header + AVI_MOVI_FOURCC, "movi", 4) == 0);
+}
+
+TEST(chunkAndIndexEntry) {
+    uint8_t chunk[8];
+    VideoRecorder::buildAviChunk(chunk, "00dc", 0x01020304);
+    CHECK(memcmp(chunk, "00dc", 4) == 0);
+    CHECK_EQ(get32(chunk + 4), 0x01020304u);
+
+    AviIndexEntry entry = VideoRecorder::aviIndexEntry(4, 1000);
+    CHECK(memcmp(&entry.ckid, "00dc", 4) == 0);
+    CHECK_EQ(entry.flags, 0x10u);                     // AVIIF_KEYFRAME
+    CHECK_EQ(entry.offset, 4u);
+    CHECK_EQ(entry.size, 1000u);
+    CHECK_EQ(sizeof(AviIndexEntry), (size_t)16);
+}
+
+TEST(completeFileReadsBack) {
+    std::vector<std::string> frames;
+    for (int i = 0; i < 5; i++) frames.push_back(hostMakeJpeg(640, 480, 1000 + i * 333, i));
+    // Frames de tamaño impar llevan relleno; el índice repite el 2 (hueco de tiempo)
+    std::string avi = buildAvi(frames, { 0, 1, 2, 2, 3, 4 }, 10);
+
+    AviSummary summary;
+    std::string error;
+    REQUIRE(readAvi(avi, summary, error));
+    CHECK_EQ(summary.moviChunks, 5u);
+    CHECK_EQ(summary.indexOffsets.size(), (size_t)6);
+    CHECK_EQ(summary.totalFrames, 6u);
+    CHECK_EQ(summary.streamLength, 6u);
+    CHECK_EQ(summary.rate, 10u);
+    CHECK_EQ(summary.indexOffsets[2], summary.indexOffsets[3]);
+    CHECK_EQ(summary.indexOffsets[0], 4u);            // Primer chunk justo después de 'movi'
+}
+
+TEST(readerRejectsBrokenIndex) {
+    std::vector<std::string> frames = { hostMakeJpeg(640, 480, 900, 1), hostMakeJpeg(640, 480, 901, 2) };
+    std::string avi = buildAvi(frames, { 0, 1 }, 5);
+    // Desplazar la última entrada: ya no apunta a un chunk '00dc'
+    avi[avi.size() - 8] += 2;
+    AviSummary summary;
+    std::string error;
+    CHECK(!readAvi(avi, summary, error));
+}
+
+static TestSd* sd = nullptr;
+
+static void initRecorder() {
+    static bool ready = false;
+    if (ready) return;
+    sd = new TestSd();      // Vive todo el proceso (la tarea sigue corriendo)
+    REQUIRE(sdCard.init());
+    // ~6 FPS con JPEG de tamaño impar: a 10 FPS hay huecos en el tiempo y
+    // los chunks llevan relleno
+    hostCameraConfigure({ 800, 600, 30 * 1024 + 1, 150000 });
+    REQUIRE(camera.init());
+    camera.setFrameSize(FRAMESIZE_SVGA);
+    REQUIRE(videoRecorder.begin());
+    ready = true;
+}
+
+static bool record(uint32_t seconds, int fps, RecorderStatus& status) {
+    String error;
+    if (!videoRecorder.start(seconds, fps, error)) return false;
+    return waitUntil([&] { return videoRecorder.takeFinished(status); }, (seconds + 5) * 1000);
+}
+
+TEST(recordingReadsBack) {
+    initRecorder();
+    RecorderStatus status = {};
+    REQUIRE(record(2, 10, status));
+    CHECK(!status.failed);
+    CHECK(status.frames > 0);
+
+    std::string avi = sd->read(std::string("/" RECORDINGS_FOLDER "/") + status.name);
+    CHECK_EQ(avi.size(), (size_t)status.bytes);
+    AviSummary summary;
+    std::string error;
+    if (!readAvi(avi, summary, error)) testFail(__FILE__, __LINE__, error);
+    CHECK_EQ(summary.rate, 10u);
+    CHECK_EQ(summary.microSecPerFrame, 100000u);
+    CHECK_EQ(summary.width, 800u);
+    CHECK_EQ(summary.height, 600u);
+    CHECK_EQ(summary.moviChunks, status.frames);
+    CHECK_EQ((uint32_t)summary.indexOffsets.size(), status.indexFrames);
+    CHECK_EQ(summary.totalFrames, status.indexFrames);
+    CHECK_EQ(summary.streamLength, status.indexFrames);
+    CHECK_EQ(summary.indexOffsets[0], 4u);            // Primer chunk justo después de 'movi'
+}
+
+// Con la cámara más lenta que el fps pedido el índice repite frames: el
+// video dura lo mismo que la grabación
+TEST(gapsRepeatPreviousFrame) {
+    initRecorder();
+    RecorderStatus status = {};
+    REQUIRE(record(2, 10, status));
+    CHECK(status.indexFrames > status.frames);
+    CHECK(status.indexFrames >= 15 && status.indexFrames <= 25);
+
+    std::string avi = sd->read(std::string("/" RECORDINGS_FOLDER "/") + status.name);
+    AviSummary summary;
+    std::string error;
+    REQUIRE(readAvi(avi, summary, error));
+    size_t repeated = 0;
+    for (size_t i = 1; i < summary.indexOffsets.size(); i++) {
+        if (summary.indexOffsets[i] == summary.indexOffsets[i - 1]) repeated++;
+    }
+    CHECK_EQ(repeated, (size_t)(status.indexFrames - status.frames));
+}
+
+// El pre-roll pide frames siempre salvo en modo sleep: ahí la cámara queda
+// inactiva y al despertar el anillo vuelve a llenarse
+TEST(replayPausesWhileSleeping) {
+    initRecorder();
+    REQUIRE(replayBuffer.begin());
+    uint32_t stored = replayBuffer.getStats().stored;
+    REQUIRE(waitUntil([&] { return replayBuffer.getStats().stored > stored + 2; }, 3000));
+
+    sleepManager.enterSleep();
+    delay(REPLAY_SLEEP_CHECK + 500);    // Termina la captura en curso
+    stored = replayBuffer.getStats().stored;
+    uint32_t taken = hostCameraFramesTaken();
+    delay(2000);
+    benchNote("en sleep: %u frames pedidos a la cámara y %u guardados en 2 s", hostCameraFramesTaken() - taken,
+              replayBuffer.getStats().stored - stored);
+    CHECK_EQ(replayBuffer.getStats().stored, stored);
+    CHECK_EQ(hostCameraFramesTaken(), taken);
+
+    sleepManager.exitSleep();
+    CHECK(waitUntil([&] { return replayBuffer.getStats().stored > stored + 2; }, 3000));
+}
@@ -0,0 +1,62 @@
+// Capturas con y sin flash: la de flash no bloquea y entrega el frame por
+// callback desde poll(); las latencias se cuentan sin perder capturas
+// aunque capturen varias tareas a la vez
+
+#include "test.h"
+#include "camera_handler.h"
+#include <thread>
+
+static void initCamera() {
+    static bool ready = false;
+    if (ready) return;
+    hostCameraConfigure({ 800, 600, 8 * 1024, 5000 });
+    ready = camera.init();
+}
+
+TEST(flashCaptureIsAsynchronous) {
+    initCamera();
+    uint32_t before = camera.getLatency(true).count;
+    camera_fb_t* result = nullptr;
+    bool done = false;
+    unsigned long start = millis();
+    REQUIRE(camera.requestCapture(true, [&](camera_fb_t* fb) {
+        result = fb;
+        done = true;
+    }));
+    // requestCapture() retorna sin esperar la exposición
+    CHECK(millis() - start < 20);
+    CHECK(!done);
+    CHECK_EQ(hostPinValue(FLASH_GPIO_NUM), 1);
+
+    REQUIRE(waitUntil([&] { camera.poll(); return done; }, 3000));
+    REQUIRE(result);
+    CHECK(result->len > 0);
+    camera.releaseFrame(result);
+    CHECK_EQ(hostPinValue(FLASH_GPIO_NUM), 0);
+    CHECK_EQ(camera.getLatency(true).count, before + 1);
+    CHECK(camera.getLastAecFrames() > 0);
+}
+
+// Capturas sin flash desde varios hilos (loop, stream, Telegram)
+TEST(concurrentCapturesAreAllCounted) {
+    initCamera();
+    uint32_t before = camera.getLatency(false).count;
+    uint32_t cacheBefore = camera.getCacheHits() + camera.getCacheMisses();
+    const int threads = 8;
+    const int perThread = 20000;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([] {
+            for (int i = 0; i < perThread; i++) {
+                camera_fb_t* fb = camera.capturePhoto(false);
+                if (fb) camera.releaseFrame(fb);
+            }
+        });
+    }
+    for (std::thread& w : workers) w.join();
+
+    CaptureLatency latency = camera.getLatency(false);
+    CHECK_EQ(latency.count, before + threads * perThread);
+    CHECK(latency.maxMs >= latency.lastMs);
+    CHECK_EQ(camera.getCacheHits() + camera.getCacheMisses(), cacheBefore + threads * perThread);
+}
@@ -0,0 +1,94 @@
+// Pipeline de captura: frames compartidos por referencia y frames de
+// transición descartados tras un cambio del sensor
+
+#include "test.h"
+#include "camera_handler.h"
+#include "frame_pipeline.h"
+
+static void initCamera() {
+    static bool ready = false;
+    if (ready) return;
+    hostCameraConfigure({ 800, 600, 8 * 1024, 5000 });
+    ready = camera.init();
+}
+
+static PipelineFrame* waitNewer(uint32_t afterSeq) {
+    PipelineFrame* frame = nullptr;
+    waitUntil([&] { return (frame = framePipeline.acquireNewer(afterSeq)) != nullptr; }, 2000);
+    return frame;
+}
+
+TEST(sharesNewestFrame) {
+    initCamera();
+    REQUIRE(framePipeline.isEnabled());
+    CHECK_EQ(framePipeline.getDepth(), min(FRAME_PIPELINE_DEPTH, CAMERA_FB_COUNT - 1));
+
+    framePipeline.addConsumer();
+    PipelineFrame* a = waitNewer(0);
+    REQUIRE(a);
+    // Un segundo consumidor que pide lo mismo recibe el mismo frame
+    PipelineFrame* b = framePipeline.acquireNewer(a->seq - 1);
+    CHECK(b == a);
+    CHECK_EQ(a->refs, 2);
+    framePipeline.release(b);
+    framePipeline.release(a);
+
+    // Al tomarlo la tarea ya captura el siguiente
+    PipelineFrame* next = waitNewer(a->seq);
+    REQUIRE(next);
+    CHECK(next->seq > a->seq);
+    framePipeline.release(next);
+    framePipeline.removeConsumer();
+}
+
+TEST(frameSizeChangeDropsStaleFrames) {
+    initCamera();
+    REQUIRE(framePipeline.isEnabled());
+    framePipeline.addConsumer();
+
+    camera.setFrameSize(FRAMESIZE_SVGA);
+    PipelineFrame* before = waitNewer(0);
+    REQUIRE(before);
+    uint32_t lastSeq = before->seq;
+    framePipeline.release(before);
+
+    uint32_t capturedBefore = hostCameraFramesCaptured();
+    int64_t changeUs = esp_timer_get_time();
+    camera.setFrameSize(FRAMESIZE_QVGA);
+
+    // Ni el frame anterior ni los que el driver tenía en curso se entregan
+    PipelineFrame* stale = framePipeline.acquireNewer(0);
+    CHECK(stale == nullptr);
+    if (stale) framePipeline.release(stale);
+
+    for (int i = 0; i < 5; i++) {
+        PipelineFrame* frame = waitNewer(lastSeq);
+        REQUIRE(frame);
+        CHECK(frame->timestampUs >= changeUs);
+        CHECK_EQ((int)frame->fb->width, 320);
+        CHECK_EQ((int)frame->fb->height, 240);
+        lastSeq = frame->seq;
+        framePipeline.release(frame);
+    }
+    CHECK(hostCameraFramesCaptured() - capturedBefore >= FRAMESIZE_DISCARD_FRAMES + 5);
+    framePipeline.removeConsumer();
+}
+
+TEST(acquireFreshHonoursSensorChange) {
+    initCamera();
+    int64_t changeUs = esp_timer_get_time();
+    camera.setFrameSize(FRAMESIZE_VGA);
+
+    // Aunque se acepte cualquier antigüedad, nada anterior al cambio
+    PipelineFrame* frame = framePipeline.acquireFresh(0, 2000);
+    REQUIRE(frame);
+    CHECK(frame->timestampUs >= changeUs);
+    CHECK_EQ((int)frame->fb->width, 640);
+    framePipeline.release(frame);
+
+    // Las capturas de /capture y Telegram pasan por el mismo camino
+    camera_fb_t* fb = camera.capturePhoto(false);
+    REQUIRE(fb);
+    CHECK_EQ((int)fb->width, 640);
+    camera.releaseFrame(fb);
+}
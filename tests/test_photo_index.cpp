@@ -0,0 +1,125 @@
+// Índice de fotos en la SD: altas y bajas en medio del archivo (registros
+// desplazados por bloques de SD_INDEX_SHIFT_RECORDS) y reconstrucción
+
+#include "test.h"
+#include "photo_index.h"
+#include <set>
+
+static std::string photoName(int i) {
+    char name[32];
+    snprintf(name, sizeof(name), "2024-01-01_%05d.jpg", i);
+    return name;
+}
+
+// Lo que dice el índice, en orden, comparado con lo esperado
+static void checkFolder(const char* folder, const std::set<std::string>& expected) {
+    int f = photoIndex.findFolder(folder);
+    REQUIRE(f >= 0);
+    CHECK_EQ(photoIndex.getPhotoCount(f), (uint32_t)expected.size());
+
+    PhotoIndexEntry entry;
+    auto it = expected.begin();
+    for (uint32_t i = 0; i < expected.size(); i++, ++it) {
+        REQUIRE(photoIndex.getEntry(f, i, entry));
+        CHECK_EQ(std::string(entry.name), *it);
+        CHECK_EQ(entry.size, (uint32_t)(100 + atoi(entry.name + 11)));
+    }
+    CHECK(!photoIndex.getEntry(f, expected.size(), entry));
+}
+
+static uint32_t headerField(TestSd& sd, const char* folder, size_t offset) {
+    std::string data = sd.read(std::string("/") + folder + "/" SD_INDEX_FILE);
+    uint32_t value = 0;
+    if (data.size() >= offset + 4) memcpy(&value, data.data() + offset, 4);
+    return value;
+}
+
+TEST(rebuildsFromDirectory) {
+    TestSd sd;
+    std::set<std::string> names;
+    for (int i = 0; i < 40; i += 2) {
+        sd.write("/fotos_web/" + photoName(i), std::string(100 + i, 'x'));
+        names.insert(photoName(i));
+    }
+    sd.write("/fotos_web/nota.txt", "no es una foto");
+    photoIndex.begin();
+    checkFolder("fotos_web", names);
+}
+
+TEST(addShiftsRecordsAcrossBlocks) {
+    TestSd sd;
+    std::set<std::string> names;
+    // Más registros que SD_INDEX_SHIFT_RECORDS después del punto de inserción
+    for (int i = 10; i < 10 + SD_INDEX_SHIFT_RECORDS * 3; i += 2) {
+        sd.write("/fotos_web/" + photoName(i), std::string(100 + i, 'x'));
+        names.insert(photoName(i));
+    }
+    photoIndex.begin();
+    uint32_t generation = photoIndex.getGeneration(photoIndex.findFolder("fotos_web"));
+
+    // Al principio, en medio (impares) y al final
+    for (int i : { 1, 3, 11, 25, 41, 200 }) {
+        CHECK(photoIndex.add(("/fotos_web/" + photoName(i)).c_str(), 100 + i));
+        names.insert(photoName(i));
+        checkFolder("fotos_web", names);
+    }
+    CHECK_EQ(photoIndex.getGeneration(photoIndex.findFolder("fotos_web")), generation + 6);
+
+    // Misma foto otra vez: solo cambia el tamaño, no se duplica
+    CHECK(photoIndex.add(("/fotos_web/" + photoName(25)).c_str(), 125));
+    checkFolder("fotos_web", names);
+}
+
+TEST(removeShiftsRecordsBack) {
+    TestSd sd;
+    std::set<std::string> names;
+    for (int i = 0; i < SD_INDEX_SHIFT_RECORDS * 3; i++) {
+        sd.write("/fotos_web/" + photoName(i), std::string(100 + i, 'x'));
+        names.insert(photoName(i));
+    }
+    photoIndex.begin();
+
+    for (int i : { 0, 5, 17, SD_INDEX_SHIFT_RECORDS * 3 - 1 }) {
+        CHECK(photoIndex.remove(("/fotos_web/" + photoName(i)).c_str()));
+        names.erase(photoName(i));
+        checkFolder("fotos_web", names);
+    }
+    CHECK(!photoIndex.remove(("/fotos_web/" + photoName(5)).c_str()));
+    checkFolder("fotos_web", names);
+}
+
+TEST(searchByName) {
+    TestSd sd;
+    for (int i = 0; i < 30; i++) sd.write("/fotos_web/" + photoName(i * 3), std::string(100 + i * 3, 'x'));
+    photoIndex.begin();
+    int f = photoIndex.findFolder("fotos_web");
+    CHECK_EQ(photoIndex.findPrefix(f, "2024-01-01_0004"), 14);          // 00042
+    CHECK_EQ(photoIndex.findPrefix(f, "2025"), -1);
+}
+
+TEST(dirtyIndexIsRebuilt) {
+    TestSd sd;
+    std::set<std::string> names;
+    for (int i = 0; i < 20; i++) {
+        sd.write("/fotos_web/" + photoName(i), std::string(100 + i, 'x'));
+        names.insert(photoName(i));
+    }
+    photoIndex.begin();
+    uint32_t generation = headerField(sd, "fotos_web", 8);
+
+    // Corte de energía a mitad de una actualización: dirty queda en 1 y los
+    // registros a medio mover
+    std::string path = sd.root() + "/fotos_web/" SD_INDEX_FILE;
+    FILE* file = fopen(path.c_str(), "r+b");
+    REQUIRE(file);
+    uint8_t dirty = 1;
+    fseek(file, offsetof(PhotoIndexHeader, dirty), SEEK_SET);
+    fwrite(&dirty, 1, 1, file);
+    fseek(file, sizeof(PhotoIndexHeader), SEEK_SET);
+    fwrite("basura", 1, 6, file);
+    fclose(file);
+
+    photoIndex.begin();
+    checkFolder("fotos_web", names);
+    CHECK(headerField(sd, "fotos_web", 8) > generation);
+}
@@ -0,0 +1,111 @@
+// Stream MJPEG en su propia tarea: handleStream() entrega el socket y
+// retorna, así loop() sigue atendiendo mientras alguien mira el stream
+
+#include "test.h"
+#include "http_client.h"
+#include "camera_handler.h"
+#include "stream_server.h"
+#include "web_server.h"
+#include <atomic>
+#include <thread>
+
+static void pumpLoop() {
+    webServer.handleClient();
+    camera.poll();
+}
+
+static void initServers() {
+    static bool ready = false;
+    if (ready) return;
+    hostCameraConfigure({ 800, 600, 20 * 1024, 10000 });
+    camera.init();
+    webServer.init();
+    streamServer.begin();
+    ready = true;
+}
+
+static size_t countFrames(const std::string& data) {
+    size_t frames = 0;
+    for (size_t pos = 0; (pos = data.find("--frame\r\n", pos)) != std::string::npos; pos++) frames++;
+    return frames;
+}
+
+// loop() simulado en este hilo; el cliente del stream lee en otro
+TEST(loopKeepsTickingWhileStreaming) {
+    initServers();
+    HttpStream stream(hostWebServerPort(), "/stream");
+    REQUIRE(stream.connected());
+    REQUIRE(waitUntil([] { pumpLoop(); return streamServer.isStreaming(); }, 2000));
+
+    std::atomic<bool> reading(true);
+    std::thread reader([&] {
+        stream.readFor(2000);
+        reading = false;
+    });
+
+    uint32_t ticks = 0;
+    int statusOk = 0;
+    int64_t maxGapUs = 0;
+    int64_t last = esp_timer_get_time();
+    while (reading) {
+        pumpLoop();
+        // Cada 100 ticks una petición normal, como el dashboard
+        if (++ticks % 100 == 0 &&
+            httpRequest(hostWebServerPort(), "GET", "/status", {}, "", pumpLoop).status == 200) {
+            statusOk++;
+        }
+        int64_t now = esp_timer_get_time();
+        maxGapUs = max(maxGapUs, now - last);
+        last = now;
+        delay(1);
+    }
+    reader.join();
+
+    size_t frames = countFrames(stream.data());
+    benchNote("%u vueltas de loop(), %d /status, max %lld ms entre vueltas, %zu frames", ticks, statusOk,
+              (long long)(maxGapUs / 1000), frames);
+    CHECK(ticks > 500);
+    CHECK(statusOk > 5);
+    CHECK(maxGapUs < 200 * 1000);
+    CHECK(frames >= 20);
+    CHECK(stream.data().find("multipart/x-mixed-replace") != std::string::npos);
+
+    stream.close();
+    CHECK(waitUntil([] { return !streamServer.isStreaming(); }, 3000));
+}
+
+// Un cliente que deja de leer no frena a los demás: su socket se llena y
+// salta frames mientras el otro sigue a su ritmo
+TEST(slowClientDoesNotStallOthers) {
+    initServers();
+    HttpStream slow(hostWebServerPort(), "/stream", 4096);
+    REQUIRE(slow.connected());
+    REQUIRE(waitUntil([] { pumpLoop(); return streamServer.getClientCount() == 1; }, 2000));
+    HttpStream fast(hostWebServerPort(), "/stream");
+    REQUIRE(fast.connected());
+    REQUIRE(waitUntil([] { pumpLoop(); return streamServer.getClientCount() == 2; }, 2000));
+
+    fast.readFor(2000, pumpLoop);
+    size_t frames = countFrames(fast.data());
+    CHECK(frames >= 30);        // ~30 fps durante 2 s, con margen
+    CHECK(slow.data().empty());
+    CHECK_EQ(streamServer.getClientCount(), 2);
+
+    slow.close();
+    fast.close();
+    CHECK(waitUntil([] { return !streamServer.isStreaming(); }, 3000));
+}
+
+// Un stream nuevo después de que el anterior terminó vuelve a recibir frames
+// (el pipeline retiene un frame ocioso que el stream salta)
+TEST(restartsAfterLastClientLeaves) {
+    initServers();
+    for (int session = 0; session < 3; session++) {
+        HttpStream stream(hostWebServerPort(), "/stream?fps=20");
+        REQUIRE(stream.connected());
+        stream.readFor(500, pumpLoop);
+        CHECK(countFrames(stream.data()) >= 3);
+        stream.close();
+        CHECK(waitUntil([] { return !streamServer.isStreaming(); }, 3000));
+    }
+}
@@ -0,0 +1,239 @@
+// Bot de Telegram contra un servidor falso local (mock_telegram): subidas
+// de fotos desde memoria y desde SD, difusión por file_id y long polling
+
+#include "test.h"
+#include "mock_telegram.h"
+#include "credentials_manager.h"
+#include "sd_handler.h"
+#include "telegram_bot.h"
+#include <Preferences.h>
+#include <time.h>
+
+static MockTelegram mock;
+static TestSd* sd = nullptr;
+
+// Bot con token y un admin (chat 111), arrancado una sola vez
+static void initBot() {
+    static bool ready = false;
+    if (ready) return;
+    sd = new TestSd();      // Vive todo el proceso
+    Preferences prefs;
+    prefs.begin("credentials", false);
+    prefs.putString("botToken", "123:TEST");
+    prefs.end();
+    prefs.begin("authids", false);
+    prefs.putInt("count", 1);
+    prefs.putString("id0", "111");
+    prefs.putBool("adm0", true);
+    prefs.end();
+
+    credentialsManager.init();
+    sdCard.init();
+    mock.start();
+    telegramBot.init();
+    // Mensaje de inicio a los usuarios autorizados
+    mock.waitFor("sendMessage", 1, 5000);
+    ready = true;
+}
+
+static std::vector<MockRequest> requestsOf(const std::string& method, size_t from = 0) {
+    std::vector<MockRequest> result;
+    std::vector<MockRequest> all = mock.requests();
+    for (size_t i = from; i < all.size(); i++) {
+        if (all[i].method == method) result.push_back(all[i]);
+    }
+    return result;
+}
+
+// La subida desde SD (bloques de un buffer fijo) debe producir exactamente
+// los mismos bytes que la subida desde memoria
+TEST(fileUploadMatchesBufferUpload) {
+    initBot();
+    std::string jpeg = hostMakeJpeg(1600, 1200, 150 * 1024 + 123, 0x37);   // No múltiplo del bloque
+    sd->write("/fotos_telegram/igual.jpg", jpeg);
+    size_t before = mock.count("sendPhoto");
+
+    REQUIRE(telegramBot.sendPhoto((const uint8_t*)jpeg.data(), jpeg.size(), "misma foto"));
+    REQUIRE(mock.waitFor("sendPhoto", before + 1, 5000));
+    REQUIRE(telegramBot.sendPhotoFile("/fotos_telegram/igual.jpg", "misma foto"));
+    REQUIRE(mock.waitFor("sendPhoto", before + 2, 5000));
+
+    std::vector<MockRequest> photos = requestsOf("sendPhoto");
+    const MockRequest& fromBuffer = photos[before];
+    const MockRequest& fromFile = photos[before + 1];
+    CHECK_EQ(MockTelegram::photoOf(fromBuffer).size(), jpeg.size());
+    CHECK(MockTelegram::photoOf(fromBuffer) == jpeg);
+    CHECK_EQ(fromFile.body.size(), fromBuffer.body.size());
+    CHECK(fromFile.body == fromBuffer.body);
+    CHECK_EQ(fromFile.headers.at("content-length"), fromBuffer.headers.at("content-length"));
+    CHECK_EQ(MockTelegram::chatOf(fromFile), std::string("111"));
+}
+
+// Con varios usuarios la foto se sube una vez y al resto se le envía por
+// file_id: los bytes por chat no crecen con el tamaño de la foto
+TEST(broadcastUploadsOnceAndReusesFileId) {
+    initBot();
+    REQUIRE(telegramBot.addAuthorizedId("222"));
+    REQUIRE(telegramBot.addAuthorizedId("333"));
+    std::string jpeg = hostMakeJpeg(1600, 1200, 120 * 1024, 0x21);
+    size_t from = mock.requests().size();
+    size_t before = mock.count("sendPhoto");
+
+    REQUIRE(telegramBot.sendPhoto((const uint8_t*)jpeg.data(), jpeg.size(), "difusion"));
+    REQUIRE(mock.waitFor("sendPhoto", before + 3, 5000));
+
+    std::map<std::string, size_t> bytesPerChat;
+    std::vector<MockRequest> photos = requestsOf("sendPhoto", from);
+    REQUIRE(photos.size() == 3);
+    for (const MockRequest& r : photos) bytesPerChat[MockTelegram::chatOf(r)] += r.bytes;
+    for (const auto& entry : bytesPerChat) benchNote("chat %s: %zu bytes", entry.first.c_str(), entry.second);
+
+    CHECK_EQ(bytesPerChat.size(), (size_t)3);
+    CHECK(bytesPerChat["111"] > jpeg.size());
+    CHECK(bytesPerChat["222"] < 1024);
+    CHECK(bytesPerChat["333"] < 1024);
+    // Los envíos por file_id usan el id más grande que devolvió la subida
+    CHECK(photos[1].body.find("\"photo\":\"FILE") != std::string::npos);
+    CHECK(photos[2].body.find("\"photo\":\"FILE") != std::string::npos);
+
+    telegramBot.removeAuthorizedId("222");
+    telegramBot.removeAuthorizedId("333");
+}
+
+static long long nextUpdateId = 5000;
+
+static size_t repliesTo(const std::string& chat, size_t from) {
+    size_t n = 0;
+    for (const MockRequest& r : requestsOf("sendMessage", from)) {
+        if (MockTelegram::chatOf(r) == chat) n++;
+    }
+    return n;
+}
+
+// Un comando que llega mientras getUpdates está retenido se entrega al
+// instante, sin esperar al próximo ciclo de consulta
+TEST(commandArrivesDuringLongPoll) {
+    initBot();
+    mock.setLongPollMs(3000);
+    size_t polls = mock.count("getUpdates");
+    REQUIRE(mock.waitFor("getUpdates", polls + 1, 5000));
+    delay(100);     // La consulta quedó retenida en el servidor
+
+    size_t from = mock.requests().size();
+    unsigned long start = millis();
+    mock.pushUpdate(MockTelegram::textUpdate(nextUpdateId++, 111, "/myid"));
+    REQUIRE(waitUntil([&] {
+        telegramBot.handleMessages();
+        return repliesTo("111", from) > 0;
+    }, 3000));
+    unsigned long latency = millis() - start;
+    benchNote("comando a respuesta: %lu ms", latency);
+    CHECK(latency < 500);
+}
+
+// Sin mensajes cada getUpdates queda retenido el tiempo del long poll y
+// todos van por la misma conexión
+TEST(idlePollingIsHeldOnOneConnection) {
+    initBot();
+    mock.setLongPollMs(1000);
+    REQUIRE(mock.waitFor("getUpdates", mock.count("getUpdates") + 1, 5000));
+    size_t from = mock.requests().size();
+    delay(3500);
+
+    std::vector<MockRequest> polls = requestsOf("getUpdates", from);
+    benchNote("%zu getUpdates en 3.5 s con long poll de 1 s", polls.size());
+    CHECK(polls.size() >= 2 && polls.size() <= 4);
+    for (const MockRequest& r : polls) {
+        CHECK(r.target.find("timeout=" + std::to_string(TELEGRAM_LONG_POLL)) != std::string::npos);
+        CHECK_EQ(r.connection, polls[0].connection);
+    }
+}
+
+// En modo sleep (SleepManager sube checkInterval) se espera entre consultas
+TEST(sleepIntervalSpacesPolls) {
+    initBot();
+    mock.setLongPollMs(1000);
+    telegramBot.setCheckInterval(2000);
+    REQUIRE(mock.waitFor("getUpdates", mock.count("getUpdates") + 1, 5000));
+    size_t from = mock.requests().size();
+    delay(6000);
+    size_t polls = requestsOf("getUpdates", from).size();
+    benchNote("%zu getUpdates en 6 s con pausa de 2 s", polls);
+    CHECK(polls >= 1 && polls <= 2);
+    telegramBot.setCheckInterval(TELEGRAM_CHECK_INTERVAL);
+}
+
+// Con la cola de salida llena y todos los trabajos en backoff la tarea
+// duerme hasta el primer reintento en vez de girar sin ceder el core
+TEST(fullOutboxSleepsThroughBackoff) {
+    initBot();
+    OutboxStats before = telegramBot.getOutboxStats();
+    mock.failNext("sendMessage", 1000);
+    for (int i = 0; i < TELEGRAM_OUTBOX_DEPTH; i++) {
+        REQUIRE(telegramBot.sendMessage("reintento " + String(i)));
+    }
+    REQUIRE(waitUntil([&] {
+        return telegramBot.getOutboxStats().retries >= before.retries + TELEGRAM_OUTBOX_DEPTH;
+    }, 5000));
+
+    struct timespec start, end;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &start);
+    delay(1000);    // Menos que TELEGRAM_OUTBOX_BACKOFF: ningún trabajo vence
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &end);
+    long cpuMs = (end.tv_sec - start.tv_sec) * 1000 + (end.tv_nsec - start.tv_nsec) / 1000000;
+    benchNote("CPU con %d trabajos en backoff: %ld ms en 1 s", TELEGRAM_OUTBOX_DEPTH, cpuMs);
+    CHECK(cpuMs < 200);
+
+    mock.failNext("sendMessage", 0);
+    REQUIRE(waitUntil([&] {
+        return telegramBot.getOutboxStats().completed >= before.completed + TELEGRAM_OUTBOX_DEPTH;
+    }, 10000));
+    CHECK_EQ(telegramBot.getOutboxStats().depth, 0);
+}
+
+// Si la foto salió completa y la respuesta no llega a tiempo, Telegram pudo
+// haberla aceptado: no se vuelve a subir (ni en la conexión ni en la cola)
+// y queda como sin confirmar
+TEST(slowResponseDoesNotDuplicatePhoto) {
+    initBot();
+    telegramBot.removeAuthorizedId("222");
+    telegramBot.removeAuthorizedId("333");
+    std::string jpeg = hostMakeJpeg(800, 600, 40 * 1024, 0x55);
+    OutboxStats before = telegramBot.getOutboxStats();
+    uint32_t unconfirmedUploads = telegramBot.getUploadStats().unconfirmed;
+    size_t photos = mock.count("sendPhoto");
+    mock.setDelay("sendPhoto", TELEGRAM_RESPONSE_TIMEOUT + 2000);
+
+    REQUIRE(telegramBot.sendPhoto((const uint8_t*)jpeg.data(), jpeg.size(), "lenta"));
+    REQUIRE(mock.waitFor("sendPhoto", photos + 1, 5000));
+    // Pasado el timeout y el primer backoff de la cola de salida
+    CHECK(!mock.waitFor("sendPhoto", photos + 2, TELEGRAM_RESPONSE_TIMEOUT + TELEGRAM_OUTBOX_BACKOFF + 1000));
+    mock.setDelay("sendPhoto", 0);
+
+    // Ni entregada ni fallida: se cuenta aparte
+    OutboxStats after = telegramBot.getOutboxStats();
+    CHECK_EQ(after.completed, before.completed);
+    CHECK_EQ(after.unconfirmed, before.unconfirmed + 1);
+    CHECK_EQ(telegramBot.getUploadStats().unconfirmed, unconfirmedUploads + 1);
+    CHECK_EQ(after.retries, before.retries);
+    CHECK_EQ(after.failed, before.failed);
+}
+
+// /reiniciar responde por la cola de salida: el reinicio espera a que el
+// aviso se haya enviado aunque Telegram tarde en contestar
+TEST(restartWaitsForReply) {
+    initBot();
+    uint32_t restarts = hostRestartCount();
+    mock.setDelay("sendMessage", 1500);
+    size_t from = mock.requests().size();
+    unsigned long start = millis();
+    mock.pushUpdate(MockTelegram::textUpdate(nextUpdateId++, 111, "/reiniciar"));
+    REQUIRE(waitUntil([&] {
+        telegramBot.handleMessages();
+        return hostRestartCount() > restarts;
+    }, TELEGRAM_RESTART_WAIT + 5000));
+    mock.setDelay("sendMessage", 0);
+    benchNote("reinicio %lu ms después del comando", millis() - start);
+    CHECK_EQ(repliesTo("111", from), (size_t)1);
+    CHECK_EQ(telegramBot.getOutboxStats().depth, 0);
+}
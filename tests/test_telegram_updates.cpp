@@ -0,0 +1,241 @@
+// Parser incremental de getUpdates: campos extraídos, cortes de bloque en
+// cualquier byte, escapes, truncado UTF-8 y JSON inválido
+
+#include "test.h"
+#include "telegram_updates.h"
+#include <random>
+
+static TelegramUpdateParser parser;
+
+// Alimenta la respuesta en bloques de chunk bytes
+static bool parse(const std::string& json, size_t chunk = 0) {
+    parser.begin();
+    if (chunk == 0) chunk = json.size();
+    for (size_t pos = 0; pos < json.size(); pos += chunk) {
+        if (!parser.feed((const uint8_t*)json.data() + pos, std::min(chunk, json.size() - pos))) return false;
+    }
+    return parser.finish();
+}
+
+static const char* sample =
+    "{\"ok\":true,\"result\":["
+    "{\"update_id\":1001,\"message\":{\"message_id\":5,\"from\":{\"id\":111,\"is_bot\":false,"
+    "\"first_name\":\"Ana\",\"language_code\":\"es\"},\"chat\":{\"id\":111,\"first_name\":\"Ana\","
+    "\"type\":\"private\"},\"date\":1700000000,\"text\":\"/foto\","
+    "\"entities\":[{\"offset\":0,\"length\":5,\"type\":\"bot_command\"}]}},"
+    "{\"update_id\":1002,\"edited_message\":{\"message_id\":6,\"from\":{\"id\":222,\"first_name\":\"Luis\"},"
+    "\"chat\":{\"id\":-100222,\"title\":\"Grupo\",\"type\":\"group\"},\"date\":1700000001,"
+    "\"edit_date\":1700000002,\"text\":\"/status\"}},"
+    "{\"update_id\":1003,\"my_chat_member\":{\"chat\":{\"id\":333},\"date\":1}}"
+    "]}";
+
+TEST(extractsMessages) {
+    REQUIRE(parse(sample));
+    REQUIRE(parser.getCount() == 3);
+
+    const TelegramUpdate& first = parser.get(0);
+    CHECK_EQ((long long)first.updateId, 1001LL);
+    CHECK(first.hasMessage);
+    CHECK_EQ(std::string(first.chatId), std::string("111"));
+    CHECK_EQ(std::string(first.fromId), std::string("111"));
+    CHECK_EQ(std::string(first.fromName), std::string("Ana"));
+    CHECK_EQ(std::string(first.text), std::string("/foto"));
+
+    const TelegramUpdate& edited = parser.get(1);
+    CHECK(edited.hasMessage);
+    CHECK_EQ(std::string(edited.chatId), std::string("-100222"));
+    CHECK_EQ(std::string(edited.fromName), std::string("Luis"));
+    CHECK_EQ(std::string(edited.text), std::string("/status"));
+
+    // Sin mensaje: se confirma pero no se procesa
+    CHECK(!parser.get(2).hasMessage);
+    CHECK_EQ((long long)parser.getNextOffset(1000), 1004LL);
+}
+
+TEST(anyBlockSizeGivesSameResult) {
+    for (size_t chunk : { 1, 2, 3, 7, 64 }) {
+        REQUIRE(parse(sample, chunk));
+        CHECK_EQ(parser.getCount(), 3);
+        CHECK_EQ(std::string(parser.get(1).text), std::string("/status"));
+    }
+}
+
+TEST(emptyAndFailedResponses) {
+    REQUIRE(parse("{\"ok\":true,\"result\":[]}"));
+    CHECK_EQ(parser.getCount(), 0);
+    CHECK_EQ((long long)parser.getNextOffset(77), 77LL);
+
+    // ok:false (token inválido, conflicto con otro poller)
+    CHECK(!parse("{\"ok\":false,\"error_code\":409,\"description\":\"Conflict\"}"));
+}
+
+TEST(escapesAndUnicode) {
+    std::string json =
+        "{\"ok\":true,\"result\":[{\"update_id\":1,\"message\":{\"chat\":{\"id\":1},\"from\":{\"id\":1,"
+        "\"first_name\":\"Jos\\u00e9\"},\"text\":\"l\\u00ednea\\n\\\"citada\\\" \\/ \\ud83d\\udcf7\"}}]}";
+    REQUIRE(parse(json, 5));
+    CHECK_EQ(std::string(parser.get(0).fromName), std::string("José"));
+    CHECK_EQ(std::string(parser.get(0).text), std::string("línea\n\"citada\" / 📷"));
+}
+
+TEST(longTextIsTruncatedOnCharacterBoundary) {
+    // 'ñ' ocupa 2 bytes: el corte no puede dejar medio carácter
+    std::string text;
+    for (int i = 0; i < TELEGRAM_TEXT_MAX; i++) text += "ñ";
+    std::string json = "{\"ok\":true,\"result\":[{\"update_id\":9,\"message\":{\"chat\":{\"id\":5},\"text\":\"" + text +
+                       "\"}}]}";
+    REQUIRE(parse(json, 13));
+    const TelegramUpdate& u = parser.get(0);
+    CHECK(u.truncated);
+    size_t len = strlen(u.text);
+    CHECK(len < TELEGRAM_TEXT_MAX);
+    CHECK(len % 2 == 0);
+    CHECK_EQ(std::string(u.chatId), std::string("5"));
+}
+
+TEST(moreUpdatesThanSlots) {
+    std::string json = "{\"ok\":true,\"result\":[";
+    for (int i = 0; i < TELEGRAM_UPDATE_SLOTS + 3; i++) {
+        if (i) json += ",";
+        json += "{\"update_id\":" + std::to_string(500 + i) + ",\"message\":{\"chat\":{\"id\":1},\"text\":\"x\"}}";
+    }
+    json += "]}";
+    REQUIRE(parse(json));
+    CHECK_EQ(parser.getCount(), TELEGRAM_UPDATE_SLOTS);
+    // Solo se confirman los guardados: el resto vuelve en el próximo getUpdates
+    CHECK_EQ((long long)parser.getNextOffset(0), 500LL + TELEGRAM_UPDATE_SLOTS);
+}
+
+TEST(invalidJson) {
+    CHECK(!parse("{\"ok\":true,\"result\":[{\"update_id\":1,}]}"));
+    CHECK(!parse("{\"ok\":true,\"result\":[{\"update_id\":1]}"));
+    CHECK(!parse("{\"ok\":true,\"result\":[{\"update_id\":1}"));   // Sin terminar
+    CHECK(!parse("{\"ok\":tru}"));
+    std::string deep = "{\"ok\":true,\"result\":[{\"update_id\":1,\"message\":{\"x\":";
+    for (int i = 0; i < 40; i++) deep += "[";
+    for (int i = 0; i < 40; i++) deep += "]";
+    deep += "}}]}";
+    CHECK(!parse(deep));
+}
+
+// ===== Respuestas de ejemplo (tests/data/telegram, ver generar.py) =====
+
+static bool validUtf8(const char* s) {
+    for (const uint8_t* p = (const uint8_t*)s; *p;) {
+        int extra = *p < 0x80 ? 0 : (*p & 0xE0) == 0xC0 ? 1 : (*p & 0xF0) == 0xE0 ? 2 : (*p & 0xF8) == 0xF0 ? 3 : -1;
+        if (extra < 0) return false;
+        p++;
+        for (int i = 0; i < extra; i++, p++) {
+            if ((*p & 0xC0) != 0x80) return false;
+        }
+    }
+    return true;
+}
+
+TEST(sampleBurst) {
+    // 6 updates: se guardan TELEGRAM_UPDATE_SLOTS y el resto vuelve después
+    REQUIRE(parse(testData("telegram/burst.json"), 17));
+    REQUIRE(parser.getCount() == TELEGRAM_UPDATE_SLOTS);
+    CHECK_EQ(std::string(parser.get(0).text), std::string("/estado"));
+    CHECK_EQ(std::string(parser.get(1).text), std::string("/foto 3"));
+    CHECK_EQ(std::string(parser.get(1).chatId), std::string("-1001234567890"));
+    CHECK_EQ(std::string(parser.get(1).fromName), std::string("Luis"));
+    // Foto con caption: mensaje sin texto. Cambio de miembro: sin mensaje
+    CHECK(parser.get(2).hasMessage);
+    CHECK_EQ(std::string(parser.get(2).text), std::string(""));
+    CHECK(!parser.get(3).hasMessage);
+    CHECK_EQ((long long)parser.getNextOffset(0), 800000014LL);
+}
+
+TEST(sampleLongText) {
+    REQUIRE(parse(testData("telegram/long_text.json"), 512));
+    REQUIRE(parser.getCount() == 1);
+    const TelegramUpdate& u = parser.get(0);
+    CHECK(u.truncated);
+    CHECK(strlen(u.text) < TELEGRAM_TEXT_MAX);
+    CHECK(strlen(u.text) > TELEGRAM_TEXT_MAX - 5);
+    CHECK(validUtf8(u.text));
+    CHECK(strncmp(u.text, "Texto largo con acentos áéíóú", strlen("Texto largo con acentos áéíóú")) == 0);
+}
+
+TEST(sampleUnicodeAndErrors) {
+    REQUIRE(parse(testData("telegram/unicode.json"), 3));
+    CHECK_EQ(std::string(parser.get(0).text), std::string("¿foto? → \"sí\" \\ 📸\n"));
+    CHECK(validUtf8(parser.get(0).fromName));
+    CHECK_EQ(std::string(parser.get(0).chatId), std::string("555"));
+
+    REQUIRE(parse(testData("telegram/empty.json")));
+    CHECK_EQ(parser.getCount(), 0);
+    CHECK(!parse(testData("telegram/error.json")));
+}
+
+// ===== Fuzz =====
+// Mutaciones aleatorias (semilla fija; FUZZ_SEED y FUZZ_ITERATIONS para
+// corridas largas) de las respuestas de ejemplo, en bloques al azar. El
+// parser nunca debe salirse de sus buffers y lo que entrega tiene que
+// cumplir los límites de los slots.
+
+static std::string mutate(const std::string& input, std::mt19937& rng) {
+    static const char interesting[] = "{}[],:\"\\u0aZ-1e.tfn\xC3\xF0\x80";
+    std::string s = input;
+    int ops = 1 + rng() % 4;
+    for (int i = 0; i < ops && !s.empty(); i++) {
+        size_t pos = rng() % s.size();
+        switch (rng() % 6) {
+            case 0: s[pos] = (char)(rng() & 0xFF); break;
+            case 1: s.insert(pos, 1, interesting[rng() % (sizeof(interesting) - 1)]); break;
+            case 2: s.erase(pos, 1 + rng() % 16); break;
+            case 3: s.insert(pos, s.substr(rng() % s.size(), 1 + rng() % 64)); break;
+            case 4: s.resize(pos); break;
+            case 5: s.insert(pos, std::string(1 + rng() % 40, rng() % 2 ? '[' : '{')); break;
+        }
+    }
+    return s;
+}
+
+static bool feedRandomChunks(const std::string& json, std::mt19937& rng) {
+    parser.begin();
+    for (size_t pos = 0; pos < json.size();) {
+        size_t n = std::min((size_t)(1 + rng() % 64), json.size() - pos);
+        if (!parser.feed((const uint8_t*)json.data() + pos, n)) return false;
+        pos += n;
+    }
+    return parser.finish();
+}
+
+TEST(fuzzMutatedSamples) {
+    const char* seedEnv = getenv("FUZZ_SEED");
+    const char* iterEnv = getenv("FUZZ_ITERATIONS");
+    uint32_t seed = seedEnv ? (uint32_t)atol(seedEnv) : 12345;
+    int iterations = iterEnv ? atoi(iterEnv) : 3000;
+    std::mt19937 rng(seed);
+
+    int accepted = 0;
+    int total = 0;
+    for (const char* name : { "single.json", "burst.json", "long_text.json", "unicode.json", "empty.json" }) {
+        std::string sample = testData(std::string("telegram/") + name);
+
+        // Sin mutar, cualquier partición da lo mismo que de una vez
+        REQUIRE(parse(sample));
+        int expectedCount = parser.getCount();
+        int64_t expectedOffset = parser.getNextOffset(0);
+        REQUIRE(feedRandomChunks(sample, rng));
+        CHECK_EQ(parser.getCount(), expectedCount);
+        CHECK_EQ((long long)parser.getNextOffset(0), (long long)expectedOffset);
+
+        for (int i = 0; i < iterations; i++, total++) {
+            std::string input = mutate(sample, rng);
+            if (!feedRandomChunks(input, rng)) continue;
+            accepted++;
+            REQUIRE(parser.getCount() <= TELEGRAM_UPDATE_SLOTS);
+            for (int u = 0; u < parser.getCount(); u++) {
+                const TelegramUpdate& update = parser.get(u);
+                REQUIRE(memchr(update.text, 0, sizeof(update.text)));
+                REQUIRE(memchr(update.fromName, 0, sizeof(update.fromName)));
+                REQUIRE(memchr(update.chatId, 0, sizeof(update.chatId)));
+                REQUIRE(memchr(update.fromId, 0, sizeof(update.fromId)));
+            }
+        }
+    }
+    benchNote("fuzz: %d entradas mutadas (semilla %u), %d aceptadas como JSON válido", total, seed, accepted);
+}
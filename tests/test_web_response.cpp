@@ -0,0 +1,147 @@
+// Piezas puras de las respuestas HTTP: Range, validadores de caché y el JSON
+// por chunks de los listados
+
+#include "test.h"
+#include "web_response.h"
+
+TEST(rangeWithoutHeaderIsFull) {
+    size_t start, end;
+    CHECK_EQ(parseRange("", 1000, start, end), RANGE_FULL);
+    CHECK_EQ(start, (size_t)0);
+    CHECK_EQ(end, (size_t)999);
+}
+
+TEST(rangeForms) {
+    size_t start, end;
+    CHECK_EQ(parseRange("bytes=0-99", 1000, start, end), RANGE_PARTIAL);
+    CHECK_EQ(start, (size_t)0);
+    CHECK_EQ(end, (size_t)99);
+
+    CHECK_EQ(parseRange("bytes=500-", 1000, start, end), RANGE_PARTIAL);
+    CHECK_EQ(start, (size_t)500);
+    CHECK_EQ(end, (size_t)999);
+
+    CHECK_EQ(parseRange("bytes=-100", 1000, start, end), RANGE_PARTIAL);
+    CHECK_EQ(start, (size_t)900);
+    CHECK_EQ(end, (size_t)999);
+
+    // Sufijo mayor que el archivo: el archivo completo como 206
+    CHECK_EQ(parseRange("bytes=-5000", 1000, start, end), RANGE_PARTIAL);
+    CHECK_EQ(start, (size_t)0);
+
+    // Fin más allá del archivo: se recorta
+    CHECK_EQ(parseRange("bytes=900-5000", 1000, start, end), RANGE_PARTIAL);
+    CHECK_EQ(end, (size_t)999);
+
+    CHECK_EQ(parseRange("bytes= 10 - 20 ", 1000, start, end), RANGE_PARTIAL);
+    CHECK_EQ(start, (size_t)10);
+    CHECK_EQ(end, (size_t)20);
+}
+
+TEST(rangeInvalid) {
+    size_t start, end;
+    CHECK_EQ(parseRange("bytes=1000-", 1000, start, end), RANGE_INVALID);
+    CHECK_EQ(parseRange("bytes=20-10", 1000, start, end), RANGE_INVALID);
+    CHECK_EQ(parseRange("bytes=-0", 1000, start, end), RANGE_INVALID);
+    CHECK_EQ(parseRange("bytes=0-", 0, start, end), RANGE_INVALID);
+}
+
+TEST(rangeIgnoredWhenNotUnderstood) {
+    size_t start, end;
+    // Varios intervalos u otras unidades: se responde el archivo completo
+    CHECK_EQ(parseRange("bytes=0-1,5-6", 1000, start, end), RANGE_FULL);
+    CHECK_EQ(parseRange("items=0-1", 1000, start, end), RANGE_FULL);
+    CHECK_EQ(parseRange("bytes=", 1000, start, end), RANGE_FULL);
+    CHECK_EQ(end, (size_t)999);
+}
+
+TEST(cacheValidators) {
+    CacheValidators v;
+    buildCacheValidators(0x1234, 1700000000, v);
+    CHECK_EQ(std::string(v.etag), std::string("\"1234-6553f100\""));
+    CHECK_EQ(std::string(v.lastModified), std::string("Tue, 14 Nov 2023 22:13:20 GMT"));
+
+    CacheValidators other;
+    buildCacheValidators(0x1234, 1700000001, other);
+    CHECK(strcmp(v.etag, other.etag) != 0);
+}
+
+TEST(notModified) {
+    CacheValidators v;
+    buildCacheValidators(5000, 1700000000, v);
+    String etag = v.etag;
+    String stale = "\"1-1\"";
+    String date = v.lastModified;
+
+    CHECK(isNotModified(v, &etag, nullptr));
+    CHECK(!isNotModified(v, &stale, nullptr));
+    CHECK(isNotModified(v, nullptr, &date));
+    // If-None-Match manda aunque If-Modified-Since coincida
+    CHECK(!isNotModified(v, &stale, &date));
+    CHECK(!isNotModified(v, nullptr, nullptr));
+}
+
+class RecordingSink : public JsonChunkSink {
+public:
+    String total;
+    int begins = 0;
+    std::vector<std::string> chunks;
+
+    void beginResponse(const String& totalCount) override {
+        total = totalCount;
+        begins++;
+    }
+    void sendChunk(const String& data) override { chunks.push_back(data.c_str()); }
+
+    std::string body() const {
+        std::string out;
+        for (auto& c : chunks) out += c;
+        return out;
+    }
+};
+
+TEST(chunkedJsonEmpty) {
+    RecordingSink sink;
+    ChunkedJsonWriter json(sink);
+    json.begin("0");
+    json.end();
+    CHECK_EQ(sink.begins, 1);
+    CHECK_EQ(sink.total, String("0"));
+    CHECK_EQ(sink.body(), std::string("[]"));
+    REQUIRE(!sink.chunks.empty());
+    CHECK_EQ(sink.chunks.back(), std::string(""));  // Parte final de longitud cero
+}
+
+TEST(chunkedJsonSplitsByChunkSize) {
+    RecordingSink sink;
+    ChunkedJsonWriter json(sink);
+    json.begin("");
+    std::string expected = "[";
+    for (int i = 0; i < 300; i++) {
+        String item = "{\"name\":\"foto_" + String(i) + ".jpg\",\"size\":" + String(i * 1000) + "}";
+        json.add(item);
+        expected += (i ? "," : "") + std::string(item.c_str());
+    }
+    json.end();
+    expected += "]";
+
+    CHECK_EQ(sink.body(), expected);
+    CHECK(sink.chunks.size() > 3);
+    // Cada parte (salvo la última) junta al menos JSON_LIST_CHUNK bytes y a lo
+    // sumo uno más que no entraba
+    for (size_t i = 0; i + 2 < sink.chunks.size(); i++) {
+        CHECK(sink.chunks[i].size() >= JSON_LIST_CHUNK);
+        CHECK(sink.chunks[i].size() < JSON_LIST_CHUNK + 64);
+    }
+    CHECK_EQ(sink.chunks.back(), std::string(""));
+}
+
+TEST(chunkedJsonCommaAfterFlush) {
+    RecordingSink sink;
+    ChunkedJsonWriter json(sink);
+    json.begin("2");
+    json.add("\"" + String(std::string(JSON_LIST_CHUNK, 'a').c_str()) + "\"");  // Fuerza un envío
+    json.add("2");
+    json.end();
+    CHECK_EQ(sink.body(), "[\"" + std::string(JSON_LIST_CHUNK, 'a') + "\",2]");
+}
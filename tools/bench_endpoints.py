@@ -0,0 +1,216 @@
+#!/usr/bin/env python3
+"""
+Mide los endpoints del ESP32-CAM desde la red y cruza el resultado con el
+perfil que lleva el propio ESP32 en /bench (tiempo del handler y heap).
+
+  - Latencia hasta el último byte (p50, p95, máximo) y bytes por respuesta
+  - Stream MJPEG: frames por segundo e intervalo entre frames
+  - /bench: tiempo medio y máximo de cada handler y heap que deja ocupado
+
+Solo usa la biblioteca estándar. Uso:
+    python3 tools/bench_endpoints.py 192.168.1.50
+    python3 tools/bench_endpoints.py 192.168.1.50 --requests 50 --stream-seconds 10
+    python3 tools/bench_endpoints.py 192.168.1.50 --capture   # incluye /capture
+    python3 tools/bench_endpoints.py 192.168.1.50 --sdbench   # escritura en SD (/sdbench)
+"""
+
+import argparse
+import http.client
+import json
+import sys
+import time
+import urllib.parse
+
+
+def request(host, port, path, headers=None, timeout=15):
+    start = time.perf_counter()
+    conn = http.client.HTTPConnection(host, port, timeout=timeout)
+    try:
+        conn.request("GET", path, headers=headers or {})
+        resp = conn.getresponse()
+        body = resp.read()
+        elapsed = (time.perf_counter() - start) * 1000
+        return resp.status, body, elapsed, dict(resp.getheaders())
+    finally:
+        conn.close()
+
+
+def percentile(values, pct):
+    if not values:
+        return 0.0
+    ordered = sorted(values)
+    index = min(len(ordered) - 1, int(round(pct / 100.0 * (len(ordered) - 1))))
+    return ordered[index]
+
+
+def bench(host, port, path, count, headers=None):
+    times = []
+    size = 0
+    status = None
+    for _ in range(count):
+        status, body, elapsed, _ = request(host, port, path, headers)
+        times.append(elapsed)
+        size = len(body)
+    return {
+        "path": path,
+        "status": status,
+        "bytes": size,
+        "p50": percentile(times, 50),
+        "p95": percentile(times, 95),
+        "max": max(times) if times else 0.0,
+    }
+
+
+def bench_stream(host, port, seconds, fps):
+    """Lee el multipart de /stream y mide el intervalo entre frames."""
+    path = "/stream" + ("?fps=%d" % fps if fps else "")
+    conn = http.client.HTTPConnection(host, port, timeout=10)
+    conn.request("GET", path)
+    resp = conn.getresponse()
+    if resp.status != 200:
+        conn.close()
+        return None
+
+    arrivals = []
+    total = 0
+    buffer = b""
+    deadline = time.perf_counter() + seconds
+    try:
+        while time.perf_counter() < deadline:
+            chunk = resp.read1(8192) if hasattr(resp, "read1") else resp.read(8192)
+            if not chunk:
+                break
+            total += len(chunk)
+            buffer += chunk
+            # Cada cabecera de parte marca un frame nuevo
+            while True:
+                index = buffer.find(b"Content-Type: image/jpeg")
+                if index < 0:
+                    buffer = buffer[-64:]
+                    break
+                arrivals.append(time.perf_counter())
+                buffer = buffer[index + 24:]
+    finally:
+        conn.close()
+
+    intervals = [(b - a) * 1000 for a, b in zip(arrivals, arrivals[1:])]
+    elapsed = (arrivals[-1] - arrivals[0]) if len(arrivals) > 1 else 0
+    return {
+        "frames": len(arrivals),
+        "fps": (len(arrivals) - 1) / elapsed if elapsed > 0 else 0.0,
+        "kbps": total * 8 / 1000.0 / seconds,
+        "p50": percentile(intervals, 50),
+        "p95": percentile(intervals, 95),
+        "max": max(intervals) if intervals else 0.0,
+    }
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Benchmark de endpoints del ESP32-CAM")
+    parser.add_argument("host", help="IP o nombre del ESP32")
+    parser.add_argument("--port", type=int, default=80)
+    parser.add_argument("--requests", type=int, default=20, help="peticiones por endpoint")
+    parser.add_argument("--stream-seconds", type=float, default=5.0, help="0 = no medir el stream")
+    parser.add_argument("--stream-fps", type=int, default=0, help="?fps= del stream (0 = configurado)")
+    parser.add_argument("--capture", action="store_true", help="medir /capture (saca fotos)")
+    parser.add_argument("--sdbench", action="store_true", help="medir la escritura en SD (/sdbench)")
+    parser.add_argument("--sd-files", type=int, default=10, help="archivos por modo en /sdbench")
+    parser.add_argument("--sd-size", type=int, default=200, help="KB por archivo en /sdbench")
+    args = parser.parse_args()
+
+    host, port = args.host, args.port
+
+    try:
+        request(host, port, "/bench")
+    except OSError as e:
+        print("No se pudo conectar con %s:%d (%s)" % (host, port, e))
+        return 1
+
+    gzip = {"Accept-Encoding": "gzip"}
+    paths = [
+        ("/", gzip),
+        ("/app.js", gzip),
+        ("/app.css", gzip),
+        ("/status", None),
+        ("/metrics", None),
+        ("/metrics?format=json", None),
+        ("/folders", None),
+        ("/photos?limit=50", None),
+    ]
+
+    # Una foto real para /photo y /thumb (la primera de la primera carpeta con fotos)
+    try:
+        folders = json.loads(request(host, port, "/folders")[1])
+    except ValueError:
+        folders = []
+    folder = next((f["name"] for f in folders if f.get("count")), None)
+    if folder:
+        body = request(host, port, "/photos?limit=1&folder=" + urllib.parse.quote(folder))[1]
+        photos = json.loads(body)
+        if photos:
+            query = urllib.parse.urlencode({"folder": folder, "name": photos[0]["name"]})
+            paths.append(("/photo?" + query, None))
+            paths.append(("/thumb?" + query, None))
+
+    if args.capture:
+        paths.append(("/capture?flash=0", None))
+
+    # Revalidación del dashboard: la respuesta debe ser un 304 sin cuerpo
+    _, _, _, headers = request(host, port, "/", gzip)
+    etag = headers.get("ETag") or headers.get("etag")
+
+    request(host, port, "/bench?reset=1")
+    results = [bench(host, port, path, args.requests, hdrs) for path, hdrs in paths]
+    if etag:
+        cached = bench(host, port, "/", args.requests, {"Accept-Encoding": "gzip", "If-None-Match": etag})
+        cached["path"] = "/ (If-None-Match)"
+        results.append(cached)
+
+    print("\nLatencia vista por el cliente (%d peticiones por endpoint)\n" % args.requests)
+    print("%-40s %6s %8s %8s %8s %8s" % ("endpoint", "http", "bytes", "p50 ms", "p95 ms", "max ms"))
+    for r in results:
+        print("%-40s %6s %8d %8.1f %8.1f %8.1f"
+              % (r["path"][:40], r["status"], r["bytes"], r["p50"], r["p95"], r["max"]))
+
+    if args.stream_seconds > 0:
+        s = bench_stream(host, port, args.stream_seconds, args.stream_fps)
+        if s:
+            print("\nStream (%.0f s): %d frames, %.1f FPS, %.0f kbit/s, intervalo p50 %.1f / p95 %.1f / max %.1f ms"
+                  % (args.stream_seconds, s["frames"], s["fps"], s["kbps"], s["p50"], s["p95"], s["max"]))
+        else:
+            print("\nStream no disponible")
+
+    if args.sdbench:
+        path = "/sdbench?files=%d&size=%d" % (args.sd_files, args.sd_size)
+        status, body, elapsed, _ = request(host, port, path, timeout=300)
+        if status == 200:
+            sd = json.loads(body)
+            print("\nEscritura en SD: %d archivos de %d KB por modo (%.1f s)\n"
+                  % (sd["files"], sd["sizeKB"], elapsed / 1000))
+            print("%-10s %10s %8s %8s %8s" % ("modo", "KB/s", "p50 ms", "p99 ms", "max ms"))
+            for mode in ("direct", "buffered"):
+                if mode in sd:
+                    r = sd[mode]
+                    print("%-10s %10d %8d %8d %8d" % (mode, r["kbPerSec"], r["p50Ms"], r["p99Ms"], r["maxMs"]))
+        else:
+            print("\n/sdbench no disponible (HTTP %s)" % status)
+
+    status, body, _, _ = request(host, port, "/bench")
+    if status != 200:
+        print("\n/bench no disponible (WEB_PROFILE_ENABLED en false?)")
+        return 0
+    bench_data = json.loads(body)
+
+    print("\nPerfil en el ESP32 (tiempo del handler y heap que quedó ocupado)\n")
+    print("%-16s %6s %8s %8s %8s %10s %8s %10s"
+          % ("ruta", "metodo", "pet.", "media ms", "max ms", "heap B", "max B", "bloques"))
+    for r in bench_data.get("routes", []):
+        blocks = "%d/%d" % (r["blockDelta"], r["blockDeltaMax"]) if "blockDelta" in r else "-"
+        print("%-16s %6s %8d %8.1f %8.1f %10d %8d %10s"
+              % (r["path"], r["method"], r["requests"], r["avgMs"], r["maxMs"],
+                 r["heapDelta"], r["heapDeltaMax"], blocks))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,127 @@
+#!/usr/bin/env python3
+"""
+Genera esp32-camara-media/web_assets.h a partir de esp32-camara-media/web/.
+
+Cada archivo se comprime con gzip y se embebe como arreglo PROGMEM, junto con
+su ETag (hash del contenido comprimido). El ESP32 los sirve tal cual con
+Content-Encoding: gzip, sin armar la página en RAM.
+
+index.html se sirve con revalidación (ETag); app.css y app.js llevan el hash
+en la URL (?v=), así el navegador los guarda sin volver a preguntar.
+
+Uso (ejecutar tras editar cualquier archivo de web/):
+    python3 tools/gen_web_assets.py
+"""
+
+import gzip
+import hashlib
+import os
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SKETCH = os.path.join(ROOT, "esp32-camara-media")
+WEB_DIR = os.path.join(SKETCH, "web")
+OUTPUT = os.path.join(SKETCH, "web_assets.h")
+
+# (archivo en web/, ruta HTTP, tipo MIME, inmutable)
+ASSETS = [
+    ("app.css", "/app.css", "text/css", True),
+    ("app.js", "/app.js", "application/javascript", True),
+    ("index.html", "/", "text/html", False),
+]
+
+
+def compress(data):
+    # mtime=0: la misma entrada produce siempre los mismos bytes (y el mismo ETag)
+    return gzip.compress(data, compresslevel=9, mtime=0)
+
+
+def c_identifier(name):
+    return "WEB_" + name.upper().replace(".", "_").replace("-", "_")
+
+
+def c_array(data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("    " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    return "\n".join(lines)
+
+
+def main():
+    hashes = {}
+    entries = []
+    total_raw = 0
+    total_gz = 0
+
+    for filename, path, mime, immutable in ASSETS:
+        with open(os.path.join(WEB_DIR, filename), "rb") as f:
+            raw = f.read()
+
+        # index.html apunta a la versión actual de cada recurso inmutable
+        if filename == "index.html":
+            for other, digest in hashes.items():
+                raw = raw.replace(('"/%s"' % other).encode(),
+                                  ('"/%s?v=%s"' % (other, digest)).encode())
+
+        gz = compress(raw)
+        digest = hashlib.sha1(gz).hexdigest()[:12]
+        hashes[filename] = digest
+        entries.append((filename, path, mime, immutable, raw, gz, digest))
+        total_raw += len(raw)
+        total_gz += len(gz)
+
+    out = []
+    out.append("// Generado por tools/gen_web_assets.py a partir de web/ - no editar a mano")
+    out.append("//")
+    out.append("// Bytes transferidos (sin comprimir -> gzip):")
+    for filename, _, _, _, raw, gz, _ in entries:
+        out.append("//   %-12s %7d -> %6d" % (filename, len(raw), len(gz)))
+    out.append("//   %-12s %7d -> %6d" % ("total", total_raw, total_gz))
+    out.append("")
+    out.append("#ifndef WEB_ASSETS_H")
+    out.append("#define WEB_ASSETS_H")
+    out.append("")
+    out.append("#include <Arduino.h>")
+    out.append("")
+    out.append("struct WebAsset {")
+    out.append("    const char* path;")
+    out.append("    const char* contentType;")
+    out.append("    const uint8_t* data;        // Contenido gzip en flash")
+    out.append("    size_t length;")
+    out.append("    const char* etag;")
+    out.append("    bool immutable;             // La URL lleva el hash: caché sin revalidar")
+    out.append("};")
+    out.append("")
+
+    for filename, _, _, _, _, gz, _ in entries:
+        out.append("static const uint8_t %s[] PROGMEM = {" % c_identifier(filename))
+        out.append(c_array(gz))
+        out.append("};")
+        out.append("")
+
+    out.append("static const WebAsset WEB_ASSETS[] = {")
+    for filename, path, mime, immutable, _, gz, digest in entries:
+        out.append('    { "%s", "%s", %s, %d, "\\"%s\\"", %s },'
+                   % (path, mime, c_identifier(filename), len(gz), digest,
+                      "true" if immutable else "false"))
+    out.append("};")
+    out.append("")
+    out.append("static const size_t WEB_ASSET_COUNT = sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]);")
+    out.append("")
+    out.append("#endif // WEB_ASSETS_H")
+    out.append("")
+
+    # CRLF como el resto de los fuentes del firmware
+    with open(OUTPUT, "w", newline="\r\n") as f:
+        f.write("\n".join(out))
+
+    print("%-12s %9s %9s" % ("archivo", "original", "gzip"))
+    for filename, _, _, _, raw, gz, _ in entries:
+        print("%-12s %9d %9d" % (filename, len(raw), len(gz)))
+    print("%-12s %9d %9d  (%.1f%% menos)"
+          % ("total", total_raw, total_gz, 100.0 * (1 - total_gz / total_raw)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())